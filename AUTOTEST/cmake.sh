@@ -6,7 +6,7 @@
 
 testname=`basename $0 .sh`
 
-drivers="ij sstruct struct ams_driver maxwell_unscaled sstruct_fac struct_migrate ij_assembly"
+drivers="ij sstruct struct ams_driver maxwell_unscaled sstruct_fac struct_migrate struct_boxman ij_assembly"
 
 # Echo usage information
 case $1 in
@@ -123,6 +123,15 @@ RO="-ij -sstruct -struct -lobpcg -rt -D HYPRE_NO_SAVED -nthreads 2"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $RO
 ./renametest.sh basic $output_dir/basic--with-concurrent-hopscotch
 
+co="--enable-boxloop-tiling --enable-debug"
+./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: -struct -tiling
+./renametest.sh basic $output_dir/basic--enable-boxloop-tiling
+
+co="--with-openmp --enable-boxloop-tiling"
+RO="-struct -tiling -rt -D HYPRE_NO_SAVED -nthreads 2"
+./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $RO
+./renametest.sh basic $output_dir/basic--with-openmp-boxloop-tiling
+
 co="--enable-single --enable-debug"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: -single
 ./renametest.sh basic $output_dir/basic--enable-single
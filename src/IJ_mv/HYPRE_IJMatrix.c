@@ -45,6 +45,10 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixOffProcExchange(ijmatrix) = 0;
+   hypre_IJMatrixAssemblePending(ijmatrix) = 0;
+   hypre_IJMatrixExchangeComm(ijmatrix)    = hypre_MPI_COMM_NULL;
+   hypre_IJMatrixAssemblyPattern(ijmatrix) = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -152,10 +156,14 @@ HYPRE_IJMatrixPartialClone( HYPRE_IJMatrix  matrix_in,
    hypre_IJMatrixObject(ijmatrix_out)             = NULL;
    hypre_IJMatrixTranslator(ijmatrix_out)         = NULL;
    hypre_IJMatrixAssumedPart(ijmatrix_out)        = NULL;
+   hypre_IJMatrixAssemblyPattern(ijmatrix_out)    = NULL;
    hypre_IJMatrixObjectType(ijmatrix_out)         = hypre_IJMatrixObjectType(ijmatrix_in);
    hypre_IJMatrixAssembleFlag(ijmatrix_out)       = 0;
    hypre_IJMatrixPrintLevel(ijmatrix_out)         = hypre_IJMatrixPrintLevel(ijmatrix_in);
    hypre_IJMatrixOMPFlag(ijmatrix_out)            = hypre_IJMatrixOMPFlag(ijmatrix_in);
+   hypre_IJMatrixOffProcExchange(ijmatrix_out)    = hypre_IJMatrixOffProcExchange(ijmatrix_in);
+   hypre_IJMatrixAssemblePending(ijmatrix_out)    = 0;
+   hypre_IJMatrixExchangeComm(ijmatrix_out)       = hypre_MPI_COMM_NULL;
    hypre_IJMatrixGlobalFirstRow(ijmatrix_out)     = hypre_IJMatrixGlobalFirstRow(ijmatrix_in);
    hypre_IJMatrixGlobalFirstCol(ijmatrix_out)     = hypre_IJMatrixGlobalFirstCol(ijmatrix_in);
    hypre_IJMatrixGlobalNumRows(ijmatrix_out)      = hypre_IJMatrixGlobalNumRows(ijmatrix_in);
@@ -190,6 +198,7 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
       {
          hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJMatrixAssumedPart(ijmatrix));
       }
+      hypre_IJAssemblyPatternDestroy(hypre_IJMatrixAssemblyPattern(ijmatrix));
       if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
       {
          hypre_IJMatrixDestroyParCSR( ijmatrix );
@@ -199,6 +208,10 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
          hypre_error_in_arg(1);
          return hypre_error_flag;
       }
+      if (hypre_IJMatrixExchangeComm(ijmatrix) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&hypre_IJMatrixExchangeComm(ijmatrix));
+      }
    }
 
    hypre_TFree(ijmatrix, HYPRE_MEMORY_HOST);
@@ -476,6 +489,7 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
    else
 #endif
    {
+      hypre_IJAssemblyPattern *pattern = hypre_IJMatrixAssemblyPattern(ijmatrix);
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
 
@@ -495,13 +509,27 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (pattern && hypre_IJAssemblyPatternFrozen(pattern))
       {
-         hypre_IJMatrixSetValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         hypre_IJMatrixReplayValuesParCSR(ijmatrix, nrows, ncols_tmp, row_indexes_tmp, values, 0);
       }
       else
       {
-         hypre_IJMatrixSetValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         if (pattern)
+         {
+            hypre_IJMatrixRecordPatternParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp,
+                                              cols, 0);
+         }
+
+         if (hypre_IJMatrixOMPFlag(ijmatrix))
+         {
+            hypre_IJMatrixSetValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols,
+                                              values);
+         }
+         else
+         {
+            hypre_IJMatrixSetValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         }
       }
 
       if (!ncols)
@@ -686,6 +714,7 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    else
 #endif
    {
+      hypre_IJAssemblyPattern *pattern = hypre_IJMatrixAssemblyPattern(ijmatrix);
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
 
@@ -705,13 +734,27 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (pattern && hypre_IJAssemblyPatternFrozen(pattern))
       {
-         hypre_IJMatrixAddToValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         hypre_IJMatrixReplayValuesParCSR(ijmatrix, nrows, ncols_tmp, row_indexes_tmp, values, 1);
       }
       else
       {
-         hypre_IJMatrixAddToValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         if (pattern)
+         {
+            hypre_IJMatrixRecordPatternParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp,
+                                              cols, 1);
+         }
+
+         if (hypre_IJMatrixOMPFlag(ijmatrix))
+         {
+            hypre_IJMatrixAddToValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols,
+                                              values);
+         }
+         else
+         {
+            hypre_IJMatrixAddToValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
+         }
       }
 
       if (!ncols)
@@ -730,6 +773,82 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAddToValuesCOO( HYPRE_IJMatrix       matrix,
+                              HYPRE_Int            nnz,
+                              const HYPRE_BigInt  *rows,
+                              const HYPRE_BigInt  *cols,
+                              const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (nnz == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nnz < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (!cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!values)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_IJMatrixMemoryLocation(matrix) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      /* the device assembly already works on a COO stack */
+      hypre_IJMatrixSetAddValuesParCSRDevice(ijmatrix, nnz, NULL, rows, NULL, cols, values,
+                                             "add");
+   }
+   else
+#endif
+   if (hypre_IJMatrixAssemblyPattern(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "COO batches cannot be used with a frozen pattern!");
+   }
+   else
+   {
+      hypre_IJMatrixAddToValuesCOOParCSR(ijmatrix, nnz, rows, cols, values);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -769,6 +888,93 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAssembleBegin( HYPRE_IJMatrix matrix )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_IJMatrixAssemblePending(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "AssembleBegin called twice without AssembleEnd!");
+      return hypre_error_flag;
+   }
+
+   if (hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR)
+   {
+#if defined(HYPRE_USING_GPU)
+      HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(matrix));
+
+      /* the device assembly is not split: it is completed here */
+      if (exec == HYPRE_EXEC_DEVICE)
+      {
+         hypre_IJMatrixAssembleParCSRDevice(ijmatrix);
+      }
+      else
+#endif
+      {
+         hypre_IJMatrixAssembleBeginParCSR(ijmatrix);
+      }
+      hypre_IJMatrixAssemblePending(ijmatrix) = 1;
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAssembleEnd( HYPRE_IJMatrix matrix )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_IJMatrixAssemblePending(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "AssembleEnd called without AssembleBegin!");
+      return hypre_error_flag;
+   }
+
+   if (hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR)
+   {
+#if defined(HYPRE_USING_GPU)
+      HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(matrix));
+
+      if (exec != HYPRE_EXEC_DEVICE)
+#endif
+      {
+         hypre_IJMatrixAssembleEndParCSR(ijmatrix);
+      }
+      hypre_IJMatrixAssemblePending(ijmatrix) = 0;
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   HYPRE_PRINT_MEMORY_USAGE(hypre_IJMatrixComm(ijmatrix));
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1295,8 +1501,8 @@ HYPRE_IJMatrixReadBinary( const char     *filename,
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixReadMM
  *
- * Reads matrix-market data from file in ASCII format and creates an
- * IJMatrix on host memory.
+ * Reads matrix-market data from file in ASCII format in parallel and
+ * creates an IJMatrix on host memory.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -1305,7 +1511,7 @@ HYPRE_IJMatrixReadMM( const char     *filename,
                       HYPRE_Int       type,
                       HYPRE_IJMatrix *matrix_ptr )
 {
-   hypre_IJMatrixRead(filename, comm, type, matrix_ptr, 1);
+   hypre_IJMatrixReadMM(filename, comm, type, matrix_ptr);
 
    return hypre_error_flag;
 }
@@ -1387,6 +1593,67 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetFrozenPattern
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetFrozenPattern( HYPRE_IJMatrix matrix,
+                                HYPRE_Int      frozen )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (frozen && !hypre_IJMatrixAssemblyPattern(ijmatrix))
+   {
+      hypre_IJMatrixAssemblyPattern(ijmatrix) = hypre_IJAssemblyPatternCreate();
+   }
+   else if (!frozen)
+   {
+      hypre_IJAssemblyPatternDestroy(hypre_IJMatrixAssemblyPattern(ijmatrix));
+      hypre_IJMatrixAssemblyPattern(ijmatrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixSetOffProcExchange
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetOffProcExchange( HYPRE_IJMatrix matrix,
+                                  HYPRE_Int      exchange )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (exchange < 0 || exchange > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+#if MPI_VERSION > 2
+   hypre_IJMatrixOffProcExchange(ijmatrix) = exchange;
+#else
+   /* NBX needs a nonblocking barrier (MPI-3) */
+   hypre_IJMatrixOffProcExchange(ijmatrix) = 0;
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixTranspose
  *--------------------------------------------------------------------------*/
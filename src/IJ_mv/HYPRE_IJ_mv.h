@@ -192,11 +192,53 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
                                      const HYPRE_BigInt  *cols,
                                      const HYPRE_Complex *values);
 
+/**
+ * Adds \e nnz values given as (row, column, value) triplets to the matrix.
+ *
+ * The triplets may be in any order, may refer to rows owned by other
+ * processors, and may contain duplicates, which are summed.  On the host, the
+ * triplets are only copied into a stash of the calling thread, so this
+ * routine may be called concurrently by the threads of an OpenMP parallel
+ * region (with no more threads than at the time of
+ * \ref HYPRE_IJMatrixInitialize).  The triplets are sorted and summed into the
+ * matrix by \ref HYPRE_IJMatrixAssemble.  Once the matrix has been assembled,
+ * the triplets must lie in its existing sparsity pattern.
+ *
+ * Not collective.
+ *
+ **/
+HYPRE_Int HYPRE_IJMatrixAddToValuesCOO(HYPRE_IJMatrix       matrix,
+                                       HYPRE_Int            nnz,
+                                       const HYPRE_BigInt  *rows,
+                                       const HYPRE_BigInt  *cols,
+                                       const HYPRE_Complex *values);
+
 /**
  * Finalize the construction of the matrix before using.
  **/
 HYPRE_Int HYPRE_IJMatrixAssemble(HYPRE_IJMatrix matrix);
 
+/**
+ * Split-phase version of \ref HYPRE_IJMatrixAssemble.  AssembleBegin starts
+ * sending the values set in rows owned by other processors and builds the
+ * local part of the matrix; AssembleEnd receives and adds the values from
+ * other processors and completes the assembly.  Work that does not touch
+ * the matrix may be done in between, to overlap with the communication,
+ * including the assembly of other matrices: each matrix exchanges its values
+ * on a private duplicate of its communicator.  With the default exchange the off-processor values are already exchanged
+ * by AssembleBegin, see \ref HYPRE_IJMatrixSetOffProcExchange.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixAssembleBegin(HYPRE_IJMatrix matrix);
+
+/**
+ * Completes an assembly started with \ref HYPRE_IJMatrixAssembleBegin.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixAssembleEnd(HYPRE_IJMatrix matrix);
+
 /**
  * Gets number of nonzeros elements for \e nrows rows specified in \e rows
  * and returns them in \e ncols, which needs to be allocated by the
@@ -370,6 +412,47 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) Freezes the sparsity pattern of the matrix for repeated
+ * assemblies.  If \e frozen is nonzero, the \ref HYPRE_IJMatrixSetValues and
+ * \ref HYPRE_IJMatrixAddToValues calls up to the next
+ * \ref HYPRE_IJMatrixAssemble are recorded, and that assembly maps every value
+ * to its position in the matrix or to the processor owning its row.  Each
+ * later Initialize/SetValues/AddToValues/Assemble cycle must repeat the same
+ * calls with the same rows and columns in the same order; only the values may
+ * change.  These values are then written directly into the matrix, and the
+ * off-processor values are exchanged with one persistent message per
+ * neighbor.  Note that \ref HYPRE_IJMatrixInitialize does not reset the values;
+ * use \ref HYPRE_IJMatrixSetConstantValues for that.  Setting \e frozen to 0
+ * releases the pattern.
+ *
+ * Only available for matrices in host memory, and not compatible with
+ * \ref HYPRE_IJMatrixAddToValuesCOO.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetFrozenPattern(HYPRE_IJMatrix matrix,
+                                         HYPRE_Int      frozen);
+
+/**
+ * (Optional) Sets how the values in rows owned by other processors are
+ * exchanged at assembly.  With \e exchange = 0 (default), the owners of the
+ * rows are looked up and the values sent in a blocking exchange before the
+ * local part of the matrix is built.  With \e exchange = 1, the values are
+ * sent with a nonblocking consensus (NBX) exchange: every processor posts
+ * synchronous sends to the assumed owners of its off-processor rows, which
+ * forward them to the actual owners, and no processor needs to know from
+ * whom it receives.  The sends are posted by \ref HYPRE_IJMatrixAssembleBegin
+ * and completed by \ref HYPRE_IJMatrixAssembleEnd.  Requires MPI-3; the
+ * default is used otherwise.  With a frozen pattern, see
+ * \ref HYPRE_IJMatrixSetFrozenPattern, the senders are known and the
+ * persistent exchange of the pattern is split the same way.
+ *
+ * Not collective, but must be the same on all processors.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetOffProcExchange(HYPRE_IJMatrix matrix,
+                                           HYPRE_Int      exchange);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
@@ -379,7 +462,11 @@ HYPRE_Int HYPRE_IJMatrixRead(const char     *filename,
                              HYPRE_IJMatrix *matrix);
 
 /**
- * Read the matrix from MM file.  This is mainly for debugging purposes.
+ * Read the matrix from a Matrix Market file.  The file is read in parallel:
+ * every processor parses an equal share of the entries, which are then sent
+ * to their owners.  The rows (and columns) are distributed uniformly among
+ * the processors of \e comm.  Only real or integer coordinate matrices, either
+ * general or symmetric, are supported.
  **/
 HYPRE_Int HYPRE_IJMatrixReadMM(const char     *filename,
                                MPI_Comm        comm,
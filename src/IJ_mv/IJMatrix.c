@@ -242,6 +242,382 @@ hypre_IJMatrixRead( const char     *filename,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixParseMMBigInt
+ *
+ * Parses a non-negative integer starting at *p. Returns the position after
+ * it, or NULL if no digit is found.
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_IJMatrixParseMMBigInt( char         *p,
+                             HYPRE_BigInt *value )
+{
+   HYPRE_BigInt  v = 0;
+   char         *start;
+
+   while (*p == ' ' || *p == '\t')
+   {
+      p++;
+   }
+
+   start = p;
+   while (*p >= '0' && *p <= '9')
+   {
+      v = 10 * v + (HYPRE_BigInt) (*p++ - '0');
+   }
+   *value = v;
+
+   return (p == start) ? NULL : p;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixParseMMReal
+ *
+ * Parses a decimal floating point number starting at *p. Numbers with at
+ * most 19 significant digits whose mantissa and power of ten are exactly
+ * representable are converted directly, which is correctly rounded; the
+ * remaining ones are handed to strtod. Returns the position after the
+ * number, or NULL if no number is found.
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_IJMatrixParseMMReal( char       *p,
+                           HYPRE_Real *value )
+{
+   static const hypre_double powers_of_ten[] =
+   {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+   };
+
+   hypre_uint64  mantissa = 0;
+   HYPRE_Int     num_digits = 0, exponent = 0, exp_value = 0;
+   HYPRE_Int     negative = 0, exp_negative = 0, exact = 1;
+   char         *start, *digits;
+
+   while (*p == ' ' || *p == '\t')
+   {
+      p++;
+   }
+   start = p;
+
+   if (*p == '-' || *p == '+')
+   {
+      negative = (*p++ == '-');
+   }
+
+   digits = p;
+   for (; *p >= '0' && *p <= '9'; p++)
+   {
+      if (num_digits < 19)
+      {
+         mantissa = 10 * mantissa + (hypre_uint64) (*p - '0');
+         num_digits += (mantissa > 0);
+      }
+      else
+      {
+         exponent++;
+         exact = 0;
+      }
+   }
+   if (*p == '.')
+   {
+      for (p++; *p >= '0' && *p <= '9'; p++)
+      {
+         if (num_digits < 19)
+         {
+            mantissa = 10 * mantissa + (hypre_uint64) (*p - '0');
+            num_digits += (mantissa > 0);
+            exponent--;
+         }
+         else
+         {
+            exact = 0;
+         }
+      }
+   }
+   if (p == digits || (p == digits + 1 && *digits == '.'))
+   {
+      return NULL;
+   }
+
+   if (*p == 'e' || *p == 'E')
+   {
+      char *q = p + 1;
+
+      if (*q == '-' || *q == '+')
+      {
+         exp_negative = (*q++ == '-');
+      }
+      if (*q >= '0' && *q <= '9')
+      {
+         for (; *q >= '0' && *q <= '9'; q++)
+         {
+            exp_value = (exp_value < 100000) ? 10 * exp_value + (*q - '0') : exp_value;
+         }
+         exponent += exp_negative ? -exp_value : exp_value;
+         p = q;
+      }
+   }
+
+   if (exact && mantissa <= ((hypre_uint64) 1 << 53) && exponent >= -22 && exponent <= 22)
+   {
+      *value = (exponent < 0) ? (hypre_double) mantissa / powers_of_ten[-exponent] :
+               (hypre_double) mantissa * powers_of_ten[exponent];
+      if (negative)
+      {
+         *value = -(*value);
+      }
+   }
+   else
+   {
+      *value = (HYPRE_Real) strtod(start, NULL);
+   }
+
+   return p;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMM
+ *
+ * Reads a matrix from a Matrix Market file in parallel. Rank 0 reads the
+ * banner and the size line; the remaining bytes are split evenly among the
+ * ranks, each rank parses the entries whose line starts in its byte range,
+ * and the entries are sent to their owners (uniform row partitioning)
+ * through the IJ COO interface. The resulting IJMatrix is stored on host
+ * memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixReadMM( const char     *filename,
+                      MPI_Comm        comm,
+                      HYPRE_Int       type,
+                      HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix  matrix;
+   HYPRE_Int       num_procs, myid;
+   HYPRE_BigInt    info[6];
+   HYPRE_BigInt    num_rows, num_cols, data_offset, file_size;
+   HYPRE_BigInt    row_part[2], col_part[2];
+   HYPRE_BigInt    start, end, begin;
+   HYPRE_Int       is_sym;
+
+   HYPRE_BigInt   *rows = NULL, *cols = NULL;
+   HYPRE_Complex  *values = NULL;
+   HYPRE_Int       nnz = 0, capacity;
+
+   HYPRE_BigInt    I, J;
+   HYPRE_Real      value;
+   char           *buffer, *p, *next;
+   size_t          length, extra, count, k;
+   FILE           *file;
+
+   *matrix_ptr = NULL;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /*-----------------------------------------------------------
+    * Read banner and sizes on rank 0
+    *-----------------------------------------------------------*/
+
+   info[0] = info[1] = info[2] = info[3] = info[4] = info[5] = 0;
+   if (myid == 0)
+   {
+      MM_typecode matcode;
+      HYPRE_Int   nrow, ncol, nz;
+
+      if ((file = fopen(filename, "r")) == NULL)
+      {
+         info[0] = 1;
+      }
+      else
+      {
+         if (hypre_mm_read_banner(file, &matcode) != 0 ||
+             !hypre_mm_is_valid(matcode) ||
+             !( (hypre_mm_is_real(matcode) || hypre_mm_is_integer(matcode)) &&
+                hypre_mm_is_coordinate(matcode) && hypre_mm_is_sparse(matcode) ) ||
+             hypre_mm_read_mtx_crd_size(file, &nrow, &ncol, &nz) != 0)
+         {
+            info[0] = 2;
+         }
+         else
+         {
+            info[1] = (HYPRE_BigInt) nrow;
+            info[2] = (HYPRE_BigInt) ncol;
+            info[3] = (HYPRE_BigInt) hypre_mm_is_symmetric(matcode);
+            info[4] = (HYPRE_BigInt) ftell(file);
+            fseek(file, 0, SEEK_END);
+            info[5] = (HYPRE_BigInt) ftell(file);
+         }
+         fclose(file);
+      }
+   }
+   hypre_MPI_Bcast(info, 6, HYPRE_MPI_BIG_INT, 0, comm);
+
+   if (info[0] == 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   else if (info[0] == 2)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Only sparse real-valued/integer coordinate matrices are supported");
+      return hypre_error_flag;
+   }
+
+   num_rows    = info[1];
+   num_cols    = info[2];
+   is_sym      = (HYPRE_Int) info[3];
+   data_offset = info[4];
+   file_size   = info[5];
+
+   /*-----------------------------------------------------------
+    * Read the local byte range. The range is extended backwards
+    * by one byte to detect whether it starts a line, and forward
+    * to complete the last line.
+    *-----------------------------------------------------------*/
+
+   start = data_offset + ((file_size - data_offset) * myid) / num_procs;
+   end   = data_offset + ((file_size - data_offset) * (myid + 1)) / num_procs;
+   begin = (myid > 0) ? start - 1 : start;
+
+   if ((file = fopen(filename, "r")) == NULL)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   length = (size_t) (end - begin);
+   buffer = hypre_TAlloc(char, length + 1, HYPRE_MEMORY_HOST);
+   fseek(file, (long) begin, SEEK_SET);
+   length = fread(buffer, 1, length, file);
+   if (length > 0 && buffer[length - 1] != '\n')
+   {
+      for (extra = 256; ; extra *= 2)
+      {
+         buffer = hypre_TReAlloc(buffer, char, length + extra + 1, HYPRE_MEMORY_HOST);
+         count  = fread(buffer + length, 1, extra, file);
+         for (k = 0; k < count && buffer[length + k] != '\n'; k++);
+         if (k < count)
+         {
+            length += k + 1;
+            break;
+         }
+         length += count;
+         if (count < extra)
+         {
+            break;
+         }
+      }
+   }
+   buffer[length] = '\0';
+   fclose(file);
+
+   /*-----------------------------------------------------------
+    * Parse the entries whose line starts in [start, end)
+    *-----------------------------------------------------------*/
+
+   p = buffer;
+   if (begin < start)
+   {
+      while (*p && *p != '\n')
+      {
+         p++;
+      }
+      if (*p)
+      {
+         p++;
+      }
+   }
+
+   capacity = (HYPRE_Int) ((length / 16 + 16) * (1 + is_sym));
+   rows     = hypre_TAlloc(HYPRE_BigInt, capacity, HYPRE_MEMORY_HOST);
+   cols     = hypre_TAlloc(HYPRE_BigInt, capacity, HYPRE_MEMORY_HOST);
+   values   = hypre_TAlloc(HYPRE_Complex, capacity, HYPRE_MEMORY_HOST);
+
+   while (*p)
+   {
+      /* Skip blank and comment lines */
+      if (*p == '\n' || *p == '\r' || *p == ' ' || *p == '\t')
+      {
+         p++;
+         continue;
+      }
+      if (*p == '%')
+      {
+         while (*p && *p != '\n')
+         {
+            p++;
+         }
+         continue;
+      }
+
+      if ((next = hypre_IJMatrixParseMMBigInt(p, &I)) == NULL ||
+          (next = hypre_IJMatrixParseMMBigInt(next, &J)) == NULL ||
+          (*next != ' ' && *next != '\t') ||
+          (next = hypre_IJMatrixParseMMReal(next, &value)) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in Matrix Market input file.");
+         break;
+      }
+      p = next;
+
+      if (nnz + 2 > capacity)
+      {
+         capacity = 2 * capacity;
+         rows     = hypre_TReAlloc(rows, HYPRE_BigInt, capacity, HYPRE_MEMORY_HOST);
+         cols     = hypre_TReAlloc(cols, HYPRE_BigInt, capacity, HYPRE_MEMORY_HOST);
+         values   = hypre_TReAlloc(values, HYPRE_Complex, capacity, HYPRE_MEMORY_HOST);
+      }
+
+      rows[nnz]   = I - 1;
+      cols[nnz]   = J - 1;
+      values[nnz] = (HYPRE_Complex) value;
+      nnz++;
+
+      if (is_sym && I != J)
+      {
+         rows[nnz]   = J - 1;
+         cols[nnz]   = I - 1;
+         values[nnz] = (HYPRE_Complex) value;
+         nnz++;
+      }
+
+      /* Ignore anything else on the line */
+      while (*p && *p != '\n')
+      {
+         p++;
+      }
+   }
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------
+    * Build the matrix; off-processor entries are routed to
+    * their owners by the assembly
+    *-----------------------------------------------------------*/
+
+   hypre_GenerateLocalPartitioning(num_rows, num_procs, myid, row_part);
+   hypre_GenerateLocalPartitioning(num_cols, num_procs, myid, col_part);
+
+   HYPRE_IJMatrixCreate(comm, row_part[0], row_part[1] - 1,
+                        col_part[0], col_part[1] - 1, &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+   HYPRE_IJMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixAddToValuesCOO(matrix, nnz, rows, cols, values);
+   HYPRE_IJMatrixAssemble(matrix);
+
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrixReadBinary
  *
@@ -507,3 +883,83 @@ hypre_IJMatrixReadBinary( const char      *prefixname,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_IJAssemblyPatternCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_IJAssemblyPattern *
+hypre_IJAssemblyPatternCreate( void )
+{
+   hypre_IJAssemblyPattern *pattern;
+
+   pattern = hypre_CTAlloc(hypre_IJAssemblyPattern, 1, HYPRE_MEMORY_HOST);
+
+   hypre_IJAssemblyPatternFrozen(pattern)   = 0;
+   hypre_IJAssemblyPatternNumSlots(pattern) = 0;
+   hypre_IJAssemblyPatternMaxSlots(pattern) = 0;
+   hypre_IJAssemblyPatternCursor(pattern)   = 0;
+
+   return pattern;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJAssemblyPatternDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJAssemblyPatternDestroy( hypre_IJAssemblyPattern *pattern )
+{
+   HYPRE_Int num_requests, i;
+
+   if (pattern)
+   {
+      num_requests = hypre_IJAssemblyPatternNumSends(pattern) +
+                     hypre_IJAssemblyPatternNumRecvs(pattern);
+      if (hypre_IJAssemblyPatternRequests(pattern))
+      {
+         for (i = 0; i < num_requests; i++)
+         {
+            hypre_MPI_Request_free(&hypre_IJAssemblyPatternRequests(pattern)[i]);
+         }
+      }
+
+      hypre_TFree(hypre_IJAssemblyPatternSlotI(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternSlotJ(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternSlotMap(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternSendProcs(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternSendStarts(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternSendData(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternRecvProcs(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternRecvStarts(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternRecvData(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternRecvMap(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJAssemblyPatternRequests(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixGetExchangeComm
+ *
+ * Returns the communicator used for the exchange of off-processor values.
+ * It is a duplicate of the matrix communicator owned by the matrix, so that
+ * the exchange cannot match messages of another matrix or of the user.
+ * Collective on first use, when the duplicate is created.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixGetExchangeComm( hypre_IJMatrix *matrix,
+                               MPI_Comm       *comm_ptr )
+{
+   if (hypre_IJMatrixExchangeComm(matrix) == hypre_MPI_COMM_NULL)
+   {
+      hypre_MPI_Comm_dup(hypre_IJMatrixComm(matrix), &hypre_IJMatrixExchangeComm(matrix));
+   }
+
+   *comm_ptr = hypre_IJMatrixExchangeComm(matrix);
+
+   return hypre_error_flag;
+}
@@ -1063,6 +1063,9 @@ hypre_IJMatrixSetConstantValuesParCSRHost( hypre_IJMatrix *matrix,
    HYPRE_Int           nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
    HYPRE_Int           ii;
 
+   hypre_CSRMatrixDestroySellData(diag);
+   hypre_CSRMatrixDestroySellData(offd);
+
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
 #endif
@@ -2530,6 +2533,311 @@ HYPRE_Int hypre_FindProc(HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_
    }
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixPostNBXParCSR
+ *
+ * posts the (row, col, value) triplets of an NBX (nonblocking consensus)
+ * exchange: the triplets are packed by destination procs[k] and sent with
+ * synchronous sends, tag for the indices and tag + 1 for the values, on the
+ * private exchange communicator of the matrix (see
+ * hypre_IJMatrixGetExchangeComm), so that the wildcard receives cannot match
+ * messages of other matrices or of the user.  The buffers and requests are
+ * kept in the auxiliary matrix until the exchange is completed by
+ * hypre_IJMatrixCompleteNBXParCSR.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixPostNBXParCSR( hypre_IJMatrix *matrix,
+                             HYPRE_Int       n,
+                             HYPRE_Int      *procs,
+                             HYPRE_BigInt   *i,
+                             HYPRE_BigInt   *j,
+                             HYPRE_Complex  *data,
+                             HYPRE_Int       tag )
+{
+   MPI_Comm               comm       = hypre_IJMatrixExchangeComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int             *dest, *order;
+   HYPRE_BigInt          *send_ij;
+   HYPRE_Complex         *send_data;
+   hypre_MPI_Request     *requests;
+   HYPRE_Int              k, start, num_sends;
+
+   dest  = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   order = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (k = 0; k < n; k++)
+   {
+      dest[k]  = procs[k];
+      order[k] = k;
+   }
+   hypre_qsort2i(dest, order, 0, n - 1);
+
+   send_ij   = hypre_TAlloc(HYPRE_BigInt,  2 * n, HYPRE_MEMORY_HOST);
+   send_data = hypre_TAlloc(HYPRE_Complex, n,     HYPRE_MEMORY_HOST);
+   num_sends = 0;
+   for (k = 0; k < n; k++)
+   {
+      send_ij[2 * k]     = i[order[k]];
+      send_ij[2 * k + 1] = j[order[k]];
+      send_data[k]       = data[order[k]];
+      if (k == 0 || dest[k] != dest[k - 1])
+      {
+         num_sends++;
+      }
+   }
+
+   /* the last request is for the barrier that ends the exchange */
+   requests = hypre_CTAlloc(hypre_MPI_Request, 2 * num_sends + 1, HYPRE_MEMORY_HOST);
+   num_sends = 0;
+   for (start = 0; start < n; start = k)
+   {
+      for (k = start + 1; k < n && dest[k] == dest[start]; k++);
+
+      hypre_MPI_Issend(send_ij + 2 * start, 2 * (k - start), HYPRE_MPI_BIG_INT, dest[start],
+                       tag, comm, &requests[2 * num_sends]);
+      hypre_MPI_Issend(send_data + start, k - start, HYPRE_MPI_COMPLEX, dest[start],
+                       tag + 1, comm, &requests[2 * num_sends + 1]);
+      num_sends++;
+   }
+   hypre_TFree(dest, HYPRE_MEMORY_HOST);
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+
+   hypre_AuxParCSRMatrixNBXNumSends(aux_matrix) = num_sends;
+   hypre_AuxParCSRMatrixNBXSendIJ(aux_matrix)   = send_ij;
+   hypre_AuxParCSRMatrixNBXSendData(aux_matrix) = send_data;
+   hypre_AuxParCSRMatrixNBXRequests(aux_matrix) = requests;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixCompleteNBXParCSR
+ *
+ * completes an exchange posted by hypre_IJMatrixPostNBXParCSR.  Messages are
+ * received from any source until all own sends have been matched; then a
+ * nonblocking barrier is entered, and its completion means that no message
+ * is left in transit.  The number of senders never needs to be known.
+ * Returns the received triplets, with the (row, col) pairs interleaved.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixCompleteNBXParCSR( hypre_IJMatrix  *matrix,
+                                 HYPRE_Int        tag,
+                                 HYPRE_Int       *num_recv_ptr,
+                                 HYPRE_BigInt   **recv_ij_ptr,
+                                 HYPRE_Complex  **recv_data_ptr )
+{
+   MPI_Comm               comm       = hypre_IJMatrixExchangeComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              num_sends  = hypre_AuxParCSRMatrixNBXNumSends(aux_matrix);
+   hypre_MPI_Request     *requests   = hypre_AuxParCSRMatrixNBXRequests(aux_matrix);
+   HYPRE_BigInt          *recv_ij    = NULL;
+   HYPRE_Complex         *recv_data  = NULL;
+   HYPRE_Int              num_recv   = 0;
+   HYPRE_Int              max_recv   = 0;
+   HYPRE_Int              in_barrier = 0;
+   HYPRE_Int              done       = 0;
+   HYPRE_Int              flag, count, source;
+   hypre_MPI_Status       status;
+
+   while (!done)
+   {
+      hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, tag, comm, &flag, &status);
+      if (flag)
+      {
+         source = status.hypre_MPI_SOURCE;
+         hypre_MPI_Get_count(&status, HYPRE_MPI_BIG_INT, &count);
+         count /= 2;
+         if (num_recv + count > max_recv)
+         {
+            max_recv  = hypre_max(2 * max_recv, num_recv + count);
+            recv_ij   = hypre_TReAlloc(recv_ij, HYPRE_BigInt, 2 * max_recv, HYPRE_MEMORY_HOST);
+            recv_data = hypre_TReAlloc(recv_data, HYPRE_Complex, max_recv, HYPRE_MEMORY_HOST);
+         }
+         hypre_MPI_Recv(recv_ij + 2 * num_recv, 2 * count, HYPRE_MPI_BIG_INT, source,
+                        tag, comm, &status);
+         hypre_MPI_Recv(recv_data + num_recv, count, HYPRE_MPI_COMPLEX, source,
+                        tag + 1, comm, &status);
+         num_recv += count;
+      }
+
+      if (in_barrier)
+      {
+         hypre_MPI_Test(&requests[2 * num_sends], &done, &status);
+      }
+      else
+      {
+         hypre_MPI_Testall(2 * num_sends, requests, &flag, hypre_MPI_STATUSES_IGNORE);
+         if (flag)
+         {
+            hypre_MPI_Ibarrier(comm, &requests[2 * num_sends]);
+            in_barrier = 1;
+         }
+      }
+   }
+
+   hypre_TFree(hypre_AuxParCSRMatrixNBXSendIJ(aux_matrix),   HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixNBXSendData(aux_matrix), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixNBXRequests(aux_matrix), HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixNBXNumSends(aux_matrix) = 0;
+
+   *num_recv_ptr  = num_recv;
+   *recv_ij_ptr   = recv_ij;
+   *recv_data_ptr = recv_data;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixPostOffProcValsNBXParCSR
+ *
+ * first round of the NBX exchange of the off-processor values: every
+ * element is sent to the assumed owner of its row, which needs no
+ * communication to be found.  Collective, as the assumed partition and the
+ * exchange communicator may need to be created.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixPostOffProcValsNBXParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm               comm       = hypre_IJMatrixComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
+   HYPRE_Int              num_elmts  = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
+   HYPRE_BigInt          *off_proc_i = hypre_AuxParCSRMatrixOffProcI(aux_matrix);
+   HYPRE_BigInt          *row;
+   HYPRE_Int             *procs;
+   HYPRE_Int              i, k, n;
+   MPI_Comm               exchange_comm;
+
+   if (hypre_IJMatrixAssumedPart(matrix) == NULL)
+   {
+      hypre_IJMatrixCreateAssumedPartition(matrix);
+   }
+   hypre_IJMatrixGetExchangeComm(matrix, &exchange_comm);
+
+   /* expand the (row, no. of elements) pairs */
+   row   = hypre_TAlloc(HYPRE_BigInt, num_elmts, HYPRE_MEMORY_HOST);
+   procs = hypre_TAlloc(HYPRE_Int,    num_elmts, HYPRE_MEMORY_HOST);
+   n = 0;
+   for (i = 0; i < off_proc_i_indx; i += 2)
+   {
+      for (k = 0; k < (HYPRE_Int) off_proc_i[i + 1]; k++)
+      {
+         row[n] = off_proc_i[i];
+         hypre_GetAssumedPartitionProcFromRow(comm, row[n], hypre_IJMatrixGlobalFirstRow(matrix),
+                                              hypre_IJMatrixGlobalNumRows(matrix), &procs[n]);
+         n++;
+      }
+   }
+
+   hypre_IJMatrixPostNBXParCSR(matrix, n, procs, row, hypre_AuxParCSRMatrixOffProcJ(aux_matrix),
+                               hypre_AuxParCSRMatrixOffProcData(aux_matrix), 7101);
+
+   hypre_TFree(row, HYPRE_MEMORY_HOST);
+   hypre_TFree(procs, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixRecvOffProcValsNBXParCSR
+ *
+ * completes the first round of the NBX exchange, forwards the elements of
+ * rows owned by another processor to their owner in a second round (the
+ * assumed partition knows the owners of the assumed rows), and adds all
+ * received elements to the COO stash.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixRecvOffProcValsNBXParCSR( hypre_IJMatrix *matrix )
+{
+   HYPRE_BigInt        *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   hypre_IJAssumedPart *apart = (hypre_IJAssumedPart *) hypre_IJMatrixAssumedPart(matrix);
+   HYPRE_Int            num_recv, num_fwd, num_local;
+   HYPRE_BigInt        *recv_ij, *fwd_i, *fwd_j, *local_i, *local_j;
+   HYPRE_Complex       *recv_data, *fwd_data, *local_data;
+   HYPRE_Int           *fwd_procs;
+   HYPRE_BigInt         row;
+   HYPRE_Int            k, m;
+
+   hypre_IJMatrixCompleteNBXParCSR(matrix, 7101, &num_recv, &recv_ij, &recv_data);
+
+   local_i    = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   local_j    = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   local_data = hypre_TAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+   fwd_i      = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   fwd_j      = hypre_TAlloc(HYPRE_BigInt,  num_recv, HYPRE_MEMORY_HOST);
+   fwd_data   = hypre_TAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+   fwd_procs  = hypre_TAlloc(HYPRE_Int,     num_recv, HYPRE_MEMORY_HOST);
+   num_local = num_fwd = 0;
+   for (k = 0; k < num_recv; k++)
+   {
+      row = recv_ij[2 * k];
+      if (row >= row_partitioning[0] && row < row_partitioning[1])
+      {
+         local_i[num_local]      = row;
+         local_j[num_local]      = recv_ij[2 * k + 1];
+         local_data[num_local++] = recv_data[k];
+         continue;
+      }
+
+      for (m = 0; m < apart->length; m++)
+      {
+         if (row >= apart->row_start_list[m] && row <= apart->row_end_list[m])
+         {
+            break;
+         }
+      }
+      if (m == apart->length)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Off-processor row outside of the assumed partition!");
+         continue;
+      }
+      fwd_i[num_fwd]       = row;
+      fwd_j[num_fwd]       = recv_ij[2 * k + 1];
+      fwd_data[num_fwd]    = recv_data[k];
+      fwd_procs[num_fwd++] = apart->proc_list[m];
+   }
+   hypre_TFree(recv_ij, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+
+   /* second round; all processors take part, whether they forward or not */
+   hypre_IJMatrixPostNBXParCSR(matrix, num_fwd, fwd_procs, fwd_i, fwd_j, fwd_data, 7103);
+   hypre_IJMatrixCompleteNBXParCSR(matrix, 7103, &num_recv, &recv_ij, &recv_data);
+
+   local_i    = hypre_TReAlloc(local_i,    HYPRE_BigInt,  num_local + num_recv, HYPRE_MEMORY_HOST);
+   local_j    = hypre_TReAlloc(local_j,    HYPRE_BigInt,  num_local + num_recv, HYPRE_MEMORY_HOST);
+   local_data = hypre_TReAlloc(local_data, HYPRE_Complex, num_local + num_recv, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_recv; k++)
+   {
+      local_i[num_local]      = recv_ij[2 * k];
+      local_j[num_local]      = recv_ij[2 * k + 1];
+      local_data[num_local++] = recv_data[k];
+   }
+   hypre_IJMatrixAddToValuesCOOParCSR(matrix, num_local, local_i, local_j, local_data);
+
+   hypre_TFree(local_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fwd_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(fwd_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(fwd_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fwd_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_ij, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre_IJMatrixAssembleParCSR
@@ -2539,6 +2847,27 @@ HYPRE_Int hypre_FindProc(HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_
 
 HYPRE_Int
 hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
+{
+   hypre_IJMatrixAssembleBeginParCSR(matrix);
+   hypre_IJMatrixAssembleEndParCSR(matrix);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAssembleBeginParCSR
+ *
+ * first phase of the assembly: starts the exchange of the off-processor
+ * values and builds the local diag and offd parts from the auxiliary
+ * structure.  With the NBX exchange the off-processor values are only
+ * posted here and merged by hypre_IJMatrixAssembleEndParCSR; otherwise they
+ * are exchanged here and summed before the local parts are built.  The offd
+ * part keeps its global column indices (big_j) until the end of the assembly.
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAssembleBeginParCSR(hypre_IJMatrix *matrix)
 {
    MPI_Comm comm = hypre_IJMatrixComm(matrix);
    hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix*) hypre_IJMatrixObject(matrix);
@@ -2555,9 +2884,7 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    HYPRE_Complex *diag_data;
    HYPRE_Complex *offd_data = NULL;
    HYPRE_Int i, j, j0;
-   HYPRE_Int num_cols_offd;
    HYPRE_Int *diag_pos;
-   HYPRE_BigInt *col_map_offd;
    HYPRE_Int *rownnz;
    HYPRE_Int *row_length;
    HYPRE_BigInt **aux_j;
@@ -2567,11 +2894,8 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    HYPRE_Int num_rownnz;
    HYPRE_Int i_diag, i_offd;
    HYPRE_BigInt col_0, col_n;
-   HYPRE_Int nnz_offd;
    HYPRE_BigInt *big_offd_j;
-   HYPRE_BigInt *tmp_j;
    HYPRE_Complex temp;
-   HYPRE_BigInt base = hypre_IJMatrixGlobalFirstCol(matrix);
    HYPRE_Int off_proc_i_indx;
    HYPRE_Int max_off_proc_elmts;
    HYPRE_Int current_num_elmts;
@@ -2587,11 +2911,27 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    //HYPRE_Int row_len;
    HYPRE_Int max_num_threads;
    HYPRE_Int aux_flag, aux_flag_global;
+   hypre_IJAssemblyPattern *pattern = hypre_IJMatrixAssemblyPattern(matrix);
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    max_num_threads = hypre_NumThreads();
 
+   /* values may have changed since the last assembly */
+   hypre_CSRMatrixDestroySellData(diag);
+   hypre_CSRMatrixDestroySellData(offd);
+
+   /* with a frozen pattern, the values are already in place except for the
+    * off-processor ones */
+   if (pattern && hypre_IJAssemblyPatternFrozen(pattern))
+   {
+      hypre_IJMatrixStartPatternParCSR(matrix);
+
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
    /* first find out if anyone has an aux_matrix, and create one if you don't
     * have one, but other procs do */
    aux_flag = 0;
@@ -2612,6 +2952,9 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
 
    if (aux_matrix)
    {
+      /* sort the COO batches by row and stash their off-proc elements */
+      hypre_IJMatrixBucketCOOParCSR(matrix);
+
       /* first delete all cancelled elements */
       /*cancel_indx = hypre_AuxParCSRMatrixCancelIndx(aux_matrix);
       if (cancel_indx)
@@ -2659,7 +3002,11 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
       hypre_MPI_Allreduce(&off_proc_i_indx, &offd_proc_elmts, 1, HYPRE_MPI_INT,
                           hypre_MPI_SUM, comm);
-      if (offd_proc_elmts)
+      if (offd_proc_elmts && hypre_IJMatrixOffProcExchange(matrix) == 1)
+      {
+         hypre_IJMatrixPostOffProcValsNBXParCSR(matrix);
+      }
+      else if (offd_proc_elmts)
       {
          max_off_proc_elmts = hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix);
          current_num_elmts = hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix);
@@ -2773,11 +3120,14 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
                hypre_TFree(hypre_CSRMatrixData(offd), hypre_CSRMatrixMemoryLocation(offd));
                hypre_TFree(hypre_CSRMatrixBigJ(offd), hypre_CSRMatrixMemoryLocation(offd));
 
-               diag_j     = hypre_CTAlloc(HYPRE_Int,     i_diag, hypre_CSRMatrixMemoryLocation(diag));
-               diag_data  = hypre_CTAlloc(HYPRE_Complex, i_diag, hypre_CSRMatrixMemoryLocation(diag));
-               offd_j     = hypre_CTAlloc(HYPRE_Int,     i_offd, hypre_CSRMatrixMemoryLocation(offd));
-               offd_data  = hypre_CTAlloc(HYPRE_Complex, i_offd, hypre_CSRMatrixMemoryLocation(offd));
-               big_offd_j = hypre_CTAlloc(HYPRE_BigInt,  i_offd, hypre_CSRMatrixMemoryLocation(offd));
+               /* Every entry is written later in parallel (offd_j when mapping the
+                  offd columns), so the arrays are not zeroed here. This leaves the
+                  first touch of their pages (NUMA placement) to the owning threads */
+               diag_j     = hypre_TAlloc(HYPRE_Int,     i_diag, hypre_CSRMatrixMemoryLocation(diag));
+               diag_data  = hypre_TAlloc(HYPRE_Complex, i_diag, hypre_CSRMatrixMemoryLocation(diag));
+               offd_j     = hypre_TAlloc(HYPRE_Int,     i_offd, hypre_CSRMatrixMemoryLocation(offd));
+               offd_data  = hypre_TAlloc(HYPRE_Complex, i_offd, hypre_CSRMatrixMemoryLocation(offd));
+               big_offd_j = hypre_TAlloc(HYPRE_BigInt,  i_offd, hypre_CSRMatrixMemoryLocation(offd));
             }
 #ifdef HYPRE_USING_OPENMP
             #pragma omp barrier
@@ -2903,6 +3253,79 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          }
       }
 
+      /* merge the on-proc COO elements */
+      if (hypre_AuxParCSRMatrixCooRowStart(aux_matrix))
+      {
+         hypre_IJMatrixMergeCOOParCSR(matrix, &big_offd_j);
+      }
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAssembleEndParCSR
+ *
+ * second phase of the assembly: merges the off-processor values received
+ * with the NBX exchange, translates the offd columns to local indices and
+ * frees the auxiliary structure.
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAssembleEndParCSR(hypre_IJMatrix *matrix)
+{
+   MPI_Comm comm = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix*) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int *offd_j;
+   HYPRE_BigInt *big_offd_j;
+   HYPRE_BigInt *col_map_offd;
+   HYPRE_BigInt *tmp_j;
+   HYPRE_BigInt base = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int i, num_rows, nnz_offd, num_cols_offd;
+   hypre_IJAssemblyPattern *pattern = hypre_IJMatrixAssemblyPattern(matrix);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (pattern && hypre_IJAssemblyPatternFrozen(pattern))
+   {
+      hypre_IJMatrixAssemblePatternParCSR(matrix);
+
+      hypre_AuxParCSRMatrixDestroy(aux_matrix);
+      hypre_IJMatrixTranslator(matrix) = NULL;
+
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* sum the off-processor values sent with NBX into the local parts */
+   if (aux_matrix && hypre_AuxParCSRMatrixNBXRequests(aux_matrix))
+   {
+      hypre_IJMatrixRecvOffProcValsNBXParCSR(matrix);
+
+      hypre_IJMatrixBucketCOOParCSR(matrix);
+      if (hypre_IJMatrixAssembleFlag(matrix) == 0 && hypre_AuxParCSRMatrixCooRowStart(aux_matrix))
+      {
+         big_offd_j = hypre_CSRMatrixBigJ(offd);
+         hypre_IJMatrixMergeCOOParCSR(matrix, &big_offd_j);
+      }
+   }
+
+   if (hypre_IJMatrixAssembleFlag(matrix) == 0)
+   {
+      num_rows = (HYPRE_Int)(row_partitioning[1] - row_partitioning[0]);
+      offd_j = hypre_CSRMatrixJ(offd);
+      big_offd_j = hypre_CSRMatrixBigJ(offd);
+
       /*  generate col_map_offd */
       nnz_offd = offd_i[num_rows];
       if (nnz_offd)
@@ -2958,12 +3381,1002 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
 
+   /* the slots recorded during this assembly define the frozen pattern */
+   if (pattern)
+   {
+      hypre_IJMatrixFreezePatternParCSR(matrix);
+   }
+
    HYPRE_PRINT_MEMORY_USAGE(comm);
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixAddToValuesCOOParCSR
+ *
+ * appends a batch of (row, col, value) triplets to the COO stash of the
+ * calling thread.  No search is done here, so different threads may call this
+ * concurrently.  The triplets are summed into the matrix at assembly time.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAddToValuesCOOParCSR( hypre_IJMatrix       *matrix,
+                                    HYPRE_Int             nnz,
+                                    const HYPRE_BigInt   *rows,
+                                    const HYPRE_BigInt   *cols,
+                                    const HYPRE_Complex  *values )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+   HYPRE_Int              size, space;
+
+   if (!aux_matrix)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "IJMatrix not initialized!\n");
+      return hypre_error_flag;
+   }
+
+   if (my_thread_num >= hypre_AuxParCSRMatrixCooNumStashes(aux_matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "More threads than at IJMatrix initialization!\n");
+      return hypre_error_flag;
+   }
+
+   size  = hypre_AuxParCSRMatrixCooSize(aux_matrix)[my_thread_num];
+   space = hypre_AuxParCSRMatrixCooSpace(aux_matrix)[my_thread_num];
+   if (size + nnz > space)
+   {
+      space = hypre_max(2 * space, size + nnz);
+      hypre_AuxParCSRMatrixCooI(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixCooI(aux_matrix)[my_thread_num],
+                        HYPRE_BigInt, space, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixCooJ(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixCooJ(aux_matrix)[my_thread_num],
+                        HYPRE_BigInt, space, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixCooData(aux_matrix)[my_thread_num] =
+         hypre_TReAlloc(hypre_AuxParCSRMatrixCooData(aux_matrix)[my_thread_num],
+                        HYPRE_Complex, space, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixCooSpace(aux_matrix)[my_thread_num] = space;
+   }
+
+   hypre_TMemcpy(hypre_AuxParCSRMatrixCooI(aux_matrix)[my_thread_num] + size, rows,
+                 HYPRE_BigInt, nnz, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_AuxParCSRMatrixCooJ(aux_matrix)[my_thread_num] + size, cols,
+                 HYPRE_BigInt, nnz, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_AuxParCSRMatrixCooData(aux_matrix)[my_thread_num] + size, values,
+                 HYPRE_Complex, nnz, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCooSize(aux_matrix)[my_thread_num] = size + nnz;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixBucketCOOParCSR
+ *
+ * first step of the COO assembly: sorts the on-processor elements of all COO
+ * stashes by row (counting sort, each stash handled by one thread) and moves
+ * the off-processor elements to the regular off-processor stash, so that they
+ * are communicated with the other off-processor values.  If the matrix has
+ * already been assembled, all elements are added with AddToValues instead.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixBucketCOOParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int              num_stashes = hypre_AuxParCSRMatrixCooNumStashes(aux_matrix);
+   HYPRE_Int             *coo_size    = hypre_AuxParCSRMatrixCooSize(aux_matrix);
+   HYPRE_BigInt         **coo_i       = hypre_AuxParCSRMatrixCooI(aux_matrix);
+   HYPRE_BigInt         **coo_j       = hypre_AuxParCSRMatrixCooJ(aux_matrix);
+   HYPRE_Complex        **coo_data    = hypre_AuxParCSRMatrixCooData(aux_matrix);
+   HYPRE_Int              num_rows    = (HYPRE_Int)(row_partitioning[1] - row_partitioning[0]);
+
+   HYPRE_Int             *counts, *row_start, *row_length, *indexes;
+   HYPRE_BigInt          *sorted_j, *off_i, *off_j;
+   HYPRE_Complex         *sorted_data, *off_data;
+   HYPRE_Int              i, k, t, n, nnz, num_on, num_off;
+
+   nnz = 0;
+   for (t = 0; t < num_stashes; t++)
+   {
+      nnz += coo_size[t];
+   }
+   if (nnz == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   indexes = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   for (k = 0; k < nnz; k++)
+   {
+      indexes[k] = k;
+   }
+
+   /* the sparsity pattern is fixed: add the values one by one */
+   if (hypre_IJMatrixAssembleFlag(matrix))
+   {
+      for (t = 0; t < num_stashes; t++)
+      {
+         hypre_IJMatrixAddToValuesParCSR(matrix, coo_size[t], NULL, coo_i[t], indexes,
+                                         coo_j[t], coo_data[t]);
+      }
+      hypre_TFree(indexes, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixDestroyCOO(aux_matrix);
+
+      return hypre_error_flag;
+   }
+
+   /* count elements per row and stash; entry num_rows counts off-proc elements */
+   counts = hypre_CTAlloc(HYPRE_Int, num_stashes * (num_rows + 1), HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_stashes; t++)
+   {
+      HYPRE_Int *count = counts + t * (num_rows + 1);
+
+      for (k = 0; k < coo_size[t]; k++)
+      {
+         if (coo_i[t][k] >= row_partitioning[0] && coo_i[t][k] < row_partitioning[1])
+         {
+            count[coo_i[t][k] - row_partitioning[0]]++;
+         }
+         else
+         {
+            count[num_rows]++;
+         }
+      }
+   }
+
+   /* turn the counts into the offsets of each stash within a row */
+   row_length = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, t, n, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows + 1; i++)
+   {
+      n = 0;
+      for (t = 0; t < num_stashes; t++)
+      {
+         k = counts[t * (num_rows + 1) + i];
+         counts[t * (num_rows + 1) + i] = n;
+         n += k;
+      }
+      row_length[i] = n;
+   }
+
+   row_start = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_start[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_start[i + 1] = row_start[i] + row_length[i];
+   }
+   num_on  = row_start[num_rows];
+   num_off = row_length[num_rows];
+
+   sorted_j    = hypre_TAlloc(HYPRE_BigInt,  num_on,  HYPRE_MEMORY_HOST);
+   sorted_data = hypre_TAlloc(HYPRE_Complex, num_on,  HYPRE_MEMORY_HOST);
+   off_i       = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   off_j       = hypre_TAlloc(HYPRE_BigInt,  num_off, HYPRE_MEMORY_HOST);
+   off_data    = hypre_TAlloc(HYPRE_Complex, num_off, HYPRE_MEMORY_HOST);
+
+   /* scatter; the order within a stash is kept */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, k, i, n) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_stashes; t++)
+   {
+      HYPRE_Int *count = counts + t * (num_rows + 1);
+
+      for (k = 0; k < coo_size[t]; k++)
+      {
+         if (coo_i[t][k] >= row_partitioning[0] && coo_i[t][k] < row_partitioning[1])
+         {
+            i = (HYPRE_Int)(coo_i[t][k] - row_partitioning[0]);
+            n = row_start[i] + count[i]++;
+            sorted_j[n]    = coo_j[t][k];
+            sorted_data[n] = coo_data[t][k];
+         }
+         else
+         {
+            n = count[num_rows]++;
+            off_i[n]    = coo_i[t][k];
+            off_j[n]    = coo_j[t][k];
+            off_data[n] = coo_data[t][k];
+         }
+      }
+   }
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixDestroyCOO(aux_matrix);
+
+   if (num_off)
+   {
+      hypre_IJMatrixAddToValuesParCSR(matrix, num_off, NULL, off_i, indexes, off_j, off_data);
+   }
+   hypre_TFree(indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_data, HYPRE_MEMORY_HOST);
+
+   hypre_AuxParCSRMatrixCooRowStart(aux_matrix)   = row_start;
+   hypre_AuxParCSRMatrixCooRowLength(aux_matrix)  = row_length;
+   hypre_AuxParCSRMatrixCooSortedJ(aux_matrix)    = sorted_j;
+   hypre_AuxParCSRMatrixCooSortedData(aux_matrix) = sorted_data;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixMergeCOOParCSR
+ *
+ * second step of the COO assembly: sums duplicate COO elements and merges
+ * them into the diag and offd parts built from the regular (non-COO) values.
+ * On entry, the offd part holds global column indices in big_offd_j; on exit,
+ * big_offd_j is the new array of global offd columns and the offd_j array
+ * has been reallocated accordingly.  Duplicate diag columns are found with a
+ * marker array per thread, duplicate offd columns with a linear search.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixMergeCOOParCSR( hypre_IJMatrix  *matrix,
+                              HYPRE_BigInt   **big_offd_j_ptr )
+{
+   hypre_ParCSRMatrix    *par_matrix  = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix  = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   hypre_CSRMatrix       *diag        = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix       *offd        = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int             *diag_i      = hypre_CSRMatrixI(diag);
+   HYPRE_Int             *diag_j      = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex         *diag_data   = hypre_CSRMatrixData(diag);
+   HYPRE_Int             *offd_i      = hypre_CSRMatrixI(offd);
+   HYPRE_Complex         *offd_data   = hypre_CSRMatrixData(offd);
+   HYPRE_BigInt          *big_offd_j  = *big_offd_j_ptr;
+   HYPRE_Int              num_rows    = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int              num_cols    = hypre_CSRMatrixNumCols(diag);
+   HYPRE_BigInt           col_0       = col_partitioning[0];
+   HYPRE_BigInt           col_n       = col_partitioning[1] - 1;
+   HYPRE_Int             *row_start   = hypre_AuxParCSRMatrixCooRowStart(aux_matrix);
+   HYPRE_Int             *row_length  = hypre_AuxParCSRMatrixCooRowLength(aux_matrix);
+   HYPRE_BigInt          *sorted_j    = hypre_AuxParCSRMatrixCooSortedJ(aux_matrix);
+   HYPRE_Complex         *sorted_data = hypre_AuxParCSRMatrixCooSortedData(aux_matrix);
+   HYPRE_MemoryLocation   memory_location = hypre_CSRMatrixMemoryLocation(diag);
+   HYPRE_Int              max_num_threads = hypre_NumThreads();
+
+   HYPRE_Int             *new_diag_i, *new_offd_i;
+   HYPRE_Int             *new_diag_j;
+   HYPRE_BigInt          *new_big_offd_j;
+   HYPRE_Complex         *new_diag_data, *new_offd_data;
+   HYPRE_Int             *marker_row, *marker_pos;
+   HYPRE_Int              i;
+
+   new_diag_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   new_offd_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   marker_row = hypre_TAlloc(HYPRE_Int, max_num_threads * num_cols, HYPRE_MEMORY_HOST);
+   marker_pos = hypre_TAlloc(HYPRE_Int, max_num_threads * num_cols, HYPRE_MEMORY_HOST);
+
+   /* sum duplicates, compact each COO row and count the new row lengths */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int      *mrow = marker_row + hypre_GetThreadNum() * num_cols;
+      HYPRE_Int      *mpos = marker_pos + hypre_GetThreadNum() * num_cols;
+      HYPRE_Int       ns, ne, j, k, c, n, p, num_diag, num_offd;
+      HYPRE_BigInt    col;
+
+      for (c = 0; c < num_cols; c++)
+      {
+         mrow[c] = -1;
+      }
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+      for (i = ns; i < ne; i++)
+      {
+         num_diag = diag_i[i + 1] - diag_i[i];
+         num_offd = offd_i[i + 1] - offd_i[i];
+         if (row_length[i])
+         {
+            for (k = diag_i[i]; k < diag_i[i + 1]; k++)
+            {
+               mrow[diag_j[k]] = i;
+               mpos[diag_j[k]] = -k - 1;
+            }
+
+            n = row_start[i];
+            for (k = row_start[i]; k < row_start[i] + row_length[i]; k++)
+            {
+               col = sorted_j[k];
+               if (col >= col_0 && col <= col_n)
+               {
+                  c = (HYPRE_Int)(col - col_0);
+                  if (mrow[c] == i)
+                  {
+                     p = mpos[c];
+                     if (p < 0)
+                     {
+                        diag_data[-p - 1] += sorted_data[k];
+                     }
+                     else
+                     {
+                        sorted_data[p] += sorted_data[k];
+                     }
+                  }
+                  else
+                  {
+                     mrow[c] = i;
+                     mpos[c] = n;
+                     sorted_j[n] = col;
+                     sorted_data[n++] = sorted_data[k];
+                     num_diag++;
+                  }
+               }
+               else
+               {
+                  for (j = offd_i[i]; j < offd_i[i + 1]; j++)
+                  {
+                     if (big_offd_j[j] == col)
+                     {
+                        break;
+                     }
+                  }
+                  if (j < offd_i[i + 1])
+                  {
+                     offd_data[j] += sorted_data[k];
+                     continue;
+                  }
+                  for (j = row_start[i]; j < n; j++)
+                  {
+                     if (sorted_j[j] == col)
+                     {
+                        break;
+                     }
+                  }
+                  if (j < n)
+                  {
+                     sorted_data[j] += sorted_data[k];
+                  }
+                  else
+                  {
+                     sorted_j[n] = col;
+                     sorted_data[n++] = sorted_data[k];
+                     num_offd++;
+                  }
+               }
+            }
+            row_length[i] = n - row_start[i];
+         }
+         new_diag_i[i + 1] = num_diag;
+         new_offd_i[i + 1] = num_offd;
+      }
+   }
+   hypre_TFree(marker_row, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_pos, HYPRE_MEMORY_HOST);
+
+   new_diag_i[0] = 0;
+   new_offd_i[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      new_diag_i[i + 1] += new_diag_i[i];
+      new_offd_i[i + 1] += new_offd_i[i];
+   }
+
+   new_diag_j     = hypre_TAlloc(HYPRE_Int,     new_diag_i[num_rows], memory_location);
+   new_diag_data  = hypre_TAlloc(HYPRE_Complex, new_diag_i[num_rows], memory_location);
+   new_big_offd_j = hypre_TAlloc(HYPRE_BigInt,  new_offd_i[num_rows], memory_location);
+   new_offd_data  = hypre_TAlloc(HYPRE_Complex, new_offd_i[num_rows], memory_location);
+
+   /* fill the merged rows, keeping the diagonal element first */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int      k, pd, po;
+      HYPRE_Complex  temp;
+
+      pd = new_diag_i[i];
+      po = new_offd_i[i];
+      for (k = diag_i[i]; k < diag_i[i + 1]; k++)
+      {
+         new_diag_j[pd] = diag_j[k];
+         new_diag_data[pd++] = diag_data[k];
+      }
+      for (k = offd_i[i]; k < offd_i[i + 1]; k++)
+      {
+         new_big_offd_j[po] = big_offd_j[k];
+         new_offd_data[po++] = offd_data[k];
+      }
+      for (k = row_start[i]; k < row_start[i] + row_length[i]; k++)
+      {
+         if (sorted_j[k] >= col_0 && sorted_j[k] <= col_n)
+         {
+            new_diag_j[pd] = (HYPRE_Int)(sorted_j[k] - col_0);
+            new_diag_data[pd] = sorted_data[k];
+            if (new_diag_j[pd] == i && pd > new_diag_i[i])
+            {
+               new_diag_j[pd] = new_diag_j[new_diag_i[i]];
+               new_diag_j[new_diag_i[i]] = i;
+               temp = new_diag_data[pd];
+               new_diag_data[pd] = new_diag_data[new_diag_i[i]];
+               new_diag_data[new_diag_i[i]] = temp;
+            }
+            pd++;
+         }
+         else
+         {
+            new_big_offd_j[po] = sorted_j[k];
+            new_offd_data[po++] = sorted_data[k];
+         }
+      }
+   }
+
+   hypre_TMemcpy(diag_i, new_diag_i, HYPRE_Int, num_rows + 1,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(offd_i, new_offd_i, HYPRE_Int, num_rows + 1,
+                 memory_location, HYPRE_MEMORY_HOST);
+   hypre_TFree(new_diag_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(new_offd_i, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(hypre_CSRMatrixJ(diag),    memory_location);
+   hypre_TFree(hypre_CSRMatrixData(diag), memory_location);
+   hypre_TFree(hypre_CSRMatrixJ(offd),    memory_location);
+   hypre_TFree(hypre_CSRMatrixData(offd), memory_location);
+   if (hypre_CSRMatrixBigJ(offd) != big_offd_j)
+   {
+      hypre_TFree(hypre_CSRMatrixBigJ(offd), memory_location);
+   }
+   hypre_TFree(big_offd_j, memory_location);
+
+   hypre_CSRMatrixJ(diag)           = new_diag_j;
+   hypre_CSRMatrixData(diag)        = new_diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   hypre_CSRMatrixJ(offd)           = hypre_TAlloc(HYPRE_Int, offd_i[num_rows], memory_location);
+   hypre_CSRMatrixBigJ(offd)        = new_big_offd_j;
+   hypre_CSRMatrixData(offd)        = new_offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+   *big_offd_j_ptr = new_big_offd_j;
+
+   hypre_AuxParCSRMatrixDestroyCOO(aux_matrix);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixRecordPatternParCSR
+ *
+ * appends the (row, col) slots of a Set/AddToValues call to the pattern that
+ * is being recorded.  Values set on other processors are dropped by
+ * hypre_IJMatrixSetValuesParCSR, so their slots are marked with row -1.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixRecordPatternParCSR( hypre_IJMatrix       *matrix,
+                                   HYPRE_Int             nrows,
+                                   HYPRE_Int            *ncols,
+                                   const HYPRE_BigInt   *rows,
+                                   const HYPRE_Int      *row_indexes,
+                                   const HYPRE_BigInt   *cols,
+                                   HYPRE_Int             add )
+{
+   hypre_IJAssemblyPattern *pattern = hypre_IJMatrixAssemblyPattern(matrix);
+   HYPRE_BigInt            *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int                num_slots = hypre_IJAssemblyPatternNumSlots(pattern);
+   HYPRE_Int                max_slots = hypre_IJAssemblyPatternMaxSlots(pattern);
+   HYPRE_BigInt            *slot_i, *slot_j;
+   HYPRE_BigInt             row;
+   HYPRE_Int                i, j, size;
+
+   size = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      size += ncols[i];
+   }
+
+   if (num_slots + size > max_slots)
+   {
+      max_slots = hypre_max(2 * max_slots, num_slots + size);
+      hypre_IJAssemblyPatternSlotI(pattern) =
+         hypre_TReAlloc(hypre_IJAssemblyPatternSlotI(pattern), HYPRE_BigInt, max_slots,
+                        HYPRE_MEMORY_HOST);
+      hypre_IJAssemblyPatternSlotJ(pattern) =
+         hypre_TReAlloc(hypre_IJAssemblyPatternSlotJ(pattern), HYPRE_BigInt, max_slots,
+                        HYPRE_MEMORY_HOST);
+      hypre_IJAssemblyPatternMaxSlots(pattern) = max_slots;
+   }
+   slot_i = hypre_IJAssemblyPatternSlotI(pattern);
+   slot_j = hypre_IJAssemblyPatternSlotJ(pattern);
+
+   for (i = 0; i < nrows; i++)
+   {
+      row = rows[i];
+      if (!add && (row < row_partitioning[0] || row >= row_partitioning[1]))
+      {
+         row = -1;
+      }
+      for (j = 0; j < ncols[i]; j++)
+      {
+         slot_i[num_slots] = row;
+         slot_j[num_slots] = cols[row_indexes[i] + j];
+         num_slots++;
+      }
+   }
+   hypre_IJAssemblyPatternNumSlots(pattern) = num_slots;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixReplayValuesParCSR
+ *
+ * writes the values of a Set/AddToValues call into the slots of a frozen
+ * pattern: local values go directly into the diag/offd data, off-processor
+ * values into the send buffer.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixReplayValuesParCSR( hypre_IJMatrix       *matrix,
+                                  HYPRE_Int             nrows,
+                                  HYPRE_Int            *ncols,
+                                  const HYPRE_Int      *row_indexes,
+                                  const HYPRE_Complex  *values,
+                                  HYPRE_Int             add )
+{
+   hypre_IJAssemblyPattern *pattern    = hypre_IJMatrixAssemblyPattern(matrix);
+   hypre_ParCSRMatrix      *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix         *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix         *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Complex           *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex           *offd_data  = hypre_CSRMatrixData(offd);
+   HYPRE_Complex           *send_data  = hypre_IJAssemblyPatternSendData(pattern);
+   HYPRE_Int               *slot_map   = hypre_IJAssemblyPatternSlotMap(pattern);
+   HYPRE_Int                diag_nnz   = hypre_CSRMatrixI(diag)[hypre_CSRMatrixNumRows(diag)];
+   HYPRE_Int                k          = hypre_IJAssemblyPatternCursor(pattern);
+   HYPRE_Int                i, j, m, size;
+   HYPRE_Complex            value;
+
+   size = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      size += ncols[i];
+   }
+
+   if (k + size > hypre_IJAssemblyPatternNumSlots(pattern))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "More values than in the frozen pattern!");
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < nrows; i++)
+   {
+      for (j = 0; j < ncols[i]; j++)
+      {
+         value = values[row_indexes[i] + j];
+         m = slot_map[k++];
+         if (m < 0)
+         {
+            send_data[-1 - m] = value;
+         }
+         else if (m < diag_nnz)
+         {
+            diag_data[m] = add ? diag_data[m] + value : value;
+         }
+         else
+         {
+            offd_data[m - diag_nnz] = add ? offd_data[m - diag_nnz] + value : value;
+         }
+      }
+   }
+   hypre_IJAssemblyPatternCursor(pattern) = k;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixLocateEntryParCSR
+ *
+ * returns the position of the local entry (row, col) of an assembled matrix
+ * in the slot_map encoding of hypre_IJAssemblyPattern, or -1 if the entry is
+ * not in the matrix.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixLocateEntryParCSR( hypre_IJMatrix *matrix,
+                                 HYPRE_BigInt    row,
+                                 HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag             = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd             = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i           = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j           = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i           = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j           = hypre_CSRMatrixJ(offd);
+   HYPRE_BigInt       *col_map_offd     = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt       *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_Int           i, j, col_local;
+
+   if (row < row_partitioning[0] || row >= row_partitioning[1])
+   {
+      return -1;
+   }
+   i = (HYPRE_Int)(row - row_partitioning[0]);
+
+   if (col >= col_partitioning[0] && col < col_partitioning[1])
+   {
+      col_local = (HYPRE_Int)(col - col_partitioning[0]);
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++)
+      {
+         if (diag_j[j] == col_local)
+         {
+            return j;
+         }
+      }
+   }
+   else
+   {
+      col_local = hypre_BigBinarySearch(col_map_offd, col - hypre_IJMatrixGlobalFirstCol(matrix),
+                                        hypre_CSRMatrixNumCols(offd));
+      for (j = offd_i[i]; j < offd_i[i + 1] && col_local > -1; j++)
+      {
+         if (offd_j[j] == col_local)
+         {
+            return diag_i[hypre_CSRMatrixNumRows(diag)] + j;
+         }
+      }
+   }
+
+   return -1;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixFreezePatternParCSR
+ *
+ * turns the slots recorded up to this assembly into positions in the matrix
+ * and in the send buffer, and sets up the persistent exchange of the
+ * off-processor values: the row owners are found with an assumed partition
+ * and then told which (row, col) entries they will receive, in which order.
+ * All these messages go through the private exchange communicator of the
+ * matrix.  Collective.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixFreezePatternParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm                 comm       = hypre_IJMatrixComm(matrix);
+   hypre_IJAssemblyPattern *pattern    = hypre_IJMatrixAssemblyPattern(matrix);
+   hypre_ParCSRMatrix      *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_BigInt            *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt             first_row  = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt             global_num_rows = hypre_ParCSRMatrixGlobalNumRows(par_matrix);
+   HYPRE_Int                num_slots  = hypre_IJAssemblyPatternNumSlots(pattern);
+   HYPRE_BigInt            *slot_i     = hypre_IJAssemblyPatternSlotI(pattern);
+   HYPRE_BigInt            *slot_j     = hypre_IJAssemblyPatternSlotJ(pattern);
+   HYPRE_Int               *slot_map;
+
+   hypre_IJAssumedPart     *apart;
+   hypre_ParCSRCommPkg     *comm_pkg;
+   hypre_MPI_Request       *requests;
+   HYPRE_BigInt            *off_rows, *send_ij, *recv_ij;
+   HYPRE_Int               *off_proc, *send_counts, *send_starts, *recv_starts, *recv_map;
+   HYPRE_Int               *send_procs, *recv_procs;
+   HYPRE_Int                num_sends, num_recvs, num_off_rows, num_send_elmts, num_recv_elmts;
+   HYPRE_Int                i, k, p, u, num_bad;
+   MPI_Comm                 exchange_comm;
+
+   /* the handshakes and the persistent exchange use the private communicator */
+   hypre_IJMatrixGetExchangeComm(matrix, &exchange_comm);
+
+   slot_map = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+
+   /* sorted list of the off-processor rows, shifted to 0-based indices */
+   num_off_rows = 0;
+   for (k = 0; k < num_slots; k++)
+   {
+      if (slot_i[k] > -1 && (slot_i[k] < row_partitioning[0] || slot_i[k] >= row_partitioning[1]))
+      {
+         num_off_rows++;
+      }
+   }
+   off_rows = hypre_TAlloc(HYPRE_BigInt, num_off_rows, HYPRE_MEMORY_HOST);
+   num_off_rows = 0;
+   for (k = 0; k < num_slots; k++)
+   {
+      if (slot_i[k] > -1 && (slot_i[k] < row_partitioning[0] || slot_i[k] >= row_partitioning[1]))
+      {
+         off_rows[num_off_rows++] = slot_i[k] - first_row;
+      }
+   }
+   if (num_off_rows > 0)
+   {
+      hypre_BigQsort0(off_rows, 0, num_off_rows - 1);
+      u = 1;
+      for (i = 1; i < num_off_rows; i++)
+      {
+         if (off_rows[i] > off_rows[u - 1])
+         {
+            off_rows[u++] = off_rows[i];
+         }
+      }
+      num_off_rows = u;
+   }
+
+   /* find the owners of the off-processor rows (the "receives" of comm_pkg)
+    * and the processors that will send values to us (its "sends") */
+   apart = hypre_AssumedPartitionCreate(comm, global_num_rows,
+                                        row_partitioning[0] - first_row,
+                                        row_partitioning[1] - first_row - 1);
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgCreateApart(comm, off_rows, row_partitioning[0] - first_row,
+                                  num_off_rows, global_num_rows, apart, comm_pkg);
+   hypre_AssumedPartitionDestroy(apart);
+
+   num_sends  = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   num_recvs  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_procs = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   recv_procs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   off_proc   = hypre_TAlloc(HYPRE_Int, num_off_rows, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_sends; p++)
+   {
+      send_procs[p] = hypre_ParCSRCommPkgRecvProc(comm_pkg, p);
+      for (u = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, p);
+           u < hypre_ParCSRCommPkgRecvVecStart(comm_pkg, p + 1); u++)
+      {
+         off_proc[u] = p;
+      }
+   }
+   for (p = 0; p < num_recvs; p++)
+   {
+      recv_procs[p] = hypre_ParCSRCommPkgSendProc(comm_pkg, p);
+   }
+   hypre_MatvecCommPkgDestroy(comm_pkg);
+
+   /* local slots get their position in the matrix, off-processor slots get
+    * consecutive positions per owner in the send buffer */
+   send_counts = hypre_CTAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   send_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_slots; k++)
+   {
+      if (slot_i[k] > -1 && (slot_i[k] < row_partitioning[0] || slot_i[k] >= row_partitioning[1]))
+      {
+         u = hypre_BigBinarySearch(off_rows, slot_i[k] - first_row, num_off_rows);
+         send_counts[off_proc[u]]++;
+      }
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      send_starts[p + 1] = send_starts[p] + send_counts[p];
+      send_counts[p] = 0;
+   }
+   num_send_elmts = send_starts[num_sends];
+   send_ij = hypre_TAlloc(HYPRE_BigInt, 2 * num_send_elmts, HYPRE_MEMORY_HOST);
+
+   num_bad = 0;
+   for (k = 0; k < num_slots; k++)
+   {
+      if (slot_i[k] < 0)
+      {
+         /* dropped values go to a scratch entry past the send buffer */
+         slot_map[k] = -1 - num_send_elmts;
+      }
+      else if (slot_i[k] < row_partitioning[0] || slot_i[k] >= row_partitioning[1])
+      {
+         u = hypre_BigBinarySearch(off_rows, slot_i[k] - first_row, num_off_rows);
+         p = off_proc[u];
+         i = send_starts[p] + send_counts[p]++;
+         send_ij[2 * i]     = slot_i[k];
+         send_ij[2 * i + 1] = slot_j[k];
+         slot_map[k] = -1 - i;
+      }
+      else
+      {
+         slot_map[k] = hypre_IJMatrixLocateEntryParCSR(matrix, slot_i[k], slot_j[k]);
+         if (slot_map[k] < 0)
+         {
+            slot_map[k] = -1 - num_send_elmts;
+            num_bad++;
+         }
+      }
+   }
+
+   /* tell the owners which entries they will receive */
+   requests    = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Irecv(&recv_starts[p + 1], 1, HYPRE_MPI_INT, recv_procs[p], 0, exchange_comm,
+                      &requests[p]);
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      hypre_MPI_Isend(&send_counts[p], 1, HYPRE_MPI_INT, send_procs[p], 0, exchange_comm,
+                      &requests[num_recvs + p]);
+   }
+   hypre_MPI_Waitall(num_sends + num_recvs, requests, hypre_MPI_STATUSES_IGNORE);
+
+   for (p = 0; p < num_recvs; p++)
+   {
+      recv_starts[p + 1] += recv_starts[p];
+   }
+   num_recv_elmts = recv_starts[num_recvs];
+   recv_ij = hypre_TAlloc(HYPRE_BigInt, 2 * num_recv_elmts, HYPRE_MEMORY_HOST);
+
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Irecv(&recv_ij[2 * recv_starts[p]], 2 * (recv_starts[p + 1] - recv_starts[p]),
+                      HYPRE_MPI_BIG_INT, recv_procs[p], 0, exchange_comm, &requests[p]);
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      hypre_MPI_Isend(&send_ij[2 * send_starts[p]], 2 * send_counts[p], HYPRE_MPI_BIG_INT,
+                      send_procs[p], 0, exchange_comm, &requests[num_recvs + p]);
+   }
+   hypre_MPI_Waitall(num_sends + num_recvs, requests, hypre_MPI_STATUSES_IGNORE);
+
+   recv_map = hypre_TAlloc(HYPRE_Int, num_recv_elmts, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_recv_elmts; k++)
+   {
+      recv_map[k] = hypre_IJMatrixLocateEntryParCSR(matrix, recv_ij[2 * k], recv_ij[2 * k + 1]);
+      if (recv_map[k] < 0)
+      {
+         num_bad++;
+      }
+   }
+
+   if (num_bad)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Recorded entries missing from the assembled matrix!");
+   }
+
+   /* set up the persistent exchange of the values */
+   hypre_IJAssemblyPatternSendData(pattern) = hypre_CTAlloc(HYPRE_Complex, num_send_elmts + 1,
+                                                            HYPRE_MEMORY_HOST);
+   hypre_IJAssemblyPatternRecvData(pattern) = hypre_CTAlloc(HYPRE_Complex, num_recv_elmts,
+                                                            HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Recv_init(hypre_IJAssemblyPatternRecvData(pattern) + recv_starts[p],
+                          recv_starts[p + 1] - recv_starts[p], HYPRE_MPI_COMPLEX,
+                          recv_procs[p], 0, exchange_comm, &requests[p]);
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      hypre_MPI_Send_init(hypre_IJAssemblyPatternSendData(pattern) + send_starts[p],
+                          send_counts[p], HYPRE_MPI_COMPLEX,
+                          send_procs[p], 0, exchange_comm, &requests[num_recvs + p]);
+   }
+
+   hypre_IJAssemblyPatternNumSends(pattern)   = num_sends;
+   hypre_IJAssemblyPatternSendProcs(pattern)  = send_procs;
+   hypre_IJAssemblyPatternSendStarts(pattern) = send_starts;
+   hypre_IJAssemblyPatternNumRecvs(pattern)   = num_recvs;
+   hypre_IJAssemblyPatternRecvProcs(pattern)  = recv_procs;
+   hypre_IJAssemblyPatternRecvStarts(pattern) = recv_starts;
+   hypre_IJAssemblyPatternRecvMap(pattern)    = recv_map;
+   hypre_IJAssemblyPatternRequests(pattern)   = requests;
+   hypre_IJAssemblyPatternSlotMap(pattern)    = slot_map;
+   hypre_IJAssemblyPatternCursor(pattern)     = 0;
+   hypre_IJAssemblyPatternFrozen(pattern)     = 1;
+
+   /* the recorded indices are not needed anymore */
+   hypre_TFree(hypre_IJAssemblyPatternSlotI(pattern), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_IJAssemblyPatternSlotJ(pattern), HYPRE_MEMORY_HOST);
+   hypre_IJAssemblyPatternMaxSlots(pattern) = num_slots;
+
+   hypre_TFree(off_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_proc, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_ij, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_ij, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixStartPatternParCSR
+ *
+ * starts the persistent exchange of the off-processor values of a matrix
+ * with a frozen pattern.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixStartPatternParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_IJAssemblyPattern *pattern = hypre_IJMatrixAssemblyPattern(matrix);
+   HYPRE_Int                num_requests;
+
+   /* the messages are sent in any case, so that the neighbors do not hang */
+   if (hypre_IJAssemblyPatternCursor(pattern) != hypre_IJAssemblyPatternNumSlots(pattern))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Fewer values than in the frozen pattern!");
+   }
+
+   num_requests = hypre_IJAssemblyPatternNumSends(pattern) +
+                  hypre_IJAssemblyPatternNumRecvs(pattern);
+   if (num_requests)
+   {
+      hypre_MPI_Startall(num_requests, hypre_IJAssemblyPatternRequests(pattern));
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAssemblePatternParCSR
+ *
+ * completes the assembly of a matrix with a frozen pattern: all values have
+ * already been written by hypre_IJMatrixReplayValuesParCSR, so only the
+ * off-processor values started by hypre_IJMatrixStartPatternParCSR need to
+ * be received and added.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAssemblePatternParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_IJAssemblyPattern *pattern    = hypre_IJMatrixAssemblyPattern(matrix);
+   hypre_ParCSRMatrix      *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix         *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix         *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Complex           *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex           *offd_data  = hypre_CSRMatrixData(offd);
+   HYPRE_Int                diag_nnz   = hypre_CSRMatrixI(diag)[hypre_CSRMatrixNumRows(diag)];
+   HYPRE_Int                num_recvs  = hypre_IJAssemblyPatternNumRecvs(pattern);
+   HYPRE_Int                num_requests;
+   HYPRE_Complex           *recv_data  = hypre_IJAssemblyPatternRecvData(pattern);
+   HYPRE_Int               *recv_map   = hypre_IJAssemblyPatternRecvMap(pattern);
+   HYPRE_Int                k, m;
+
+   num_requests = hypre_IJAssemblyPatternNumSends(pattern) + num_recvs;
+   if (num_requests)
+   {
+      hypre_MPI_Waitall(num_requests, hypre_IJAssemblyPatternRequests(pattern),
+                        hypre_MPI_STATUSES_IGNORE);
+   }
+
+   for (k = 0; k < hypre_IJAssemblyPatternRecvStarts(pattern)[num_recvs]; k++)
+   {
+      m = recv_map[k];
+      if (m < 0)
+      {
+         continue;
+      }
+      else if (m < diag_nnz)
+      {
+         diag_data[m] += recv_data[k];
+      }
+      else
+      {
+         offd_data[m - diag_nnz] += recv_data[k];
+      }
+   }
+   hypre_IJAssemblyPatternCursor(pattern) = 0;
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * IJMatrix_ParCSR interface
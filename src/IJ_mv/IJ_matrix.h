@@ -14,6 +14,61 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJAssemblyPattern:
+ *
+ * Recorded sequence of Set/AddToValues slots of a matrix with a frozen
+ * sparsity pattern.  Once frozen, slot_map gives for each slot its position
+ * in the diag data, the diag nnz plus its position in the offd data, or
+ * (-1 - k) for position k in the send buffer.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int           frozen;      /* 0 while recording, 1 once frozen */
+   HYPRE_Int           num_slots;   /* number of values per assembly */
+   HYPRE_Int           max_slots;
+   HYPRE_Int           cursor;      /* next slot to be filled */
+   HYPRE_BigInt       *slot_i;      /* recorded rows (-1: dropped value) */
+   HYPRE_BigInt       *slot_j;      /* recorded columns */
+   HYPRE_Int          *slot_map;
+
+   /* persistent exchange of the off-processor values */
+   HYPRE_Int           num_sends;
+   HYPRE_Int          *send_procs;
+   HYPRE_Int          *send_starts;
+   HYPRE_Complex      *send_data;
+   HYPRE_Int           num_recvs;
+   HYPRE_Int          *recv_procs;
+   HYPRE_Int          *recv_starts;
+   HYPRE_Complex      *recv_data;
+   HYPRE_Int          *recv_map;    /* position of the received values */
+   hypre_MPI_Request  *requests;
+
+} hypre_IJAssemblyPattern;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJAssemblyPattern
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJAssemblyPatternFrozen(pattern)      ((pattern) -> frozen)
+#define hypre_IJAssemblyPatternNumSlots(pattern)    ((pattern) -> num_slots)
+#define hypre_IJAssemblyPatternMaxSlots(pattern)    ((pattern) -> max_slots)
+#define hypre_IJAssemblyPatternCursor(pattern)      ((pattern) -> cursor)
+#define hypre_IJAssemblyPatternSlotI(pattern)       ((pattern) -> slot_i)
+#define hypre_IJAssemblyPatternSlotJ(pattern)       ((pattern) -> slot_j)
+#define hypre_IJAssemblyPatternSlotMap(pattern)     ((pattern) -> slot_map)
+#define hypre_IJAssemblyPatternNumSends(pattern)    ((pattern) -> num_sends)
+#define hypre_IJAssemblyPatternSendProcs(pattern)   ((pattern) -> send_procs)
+#define hypre_IJAssemblyPatternSendStarts(pattern)  ((pattern) -> send_starts)
+#define hypre_IJAssemblyPatternSendData(pattern)    ((pattern) -> send_data)
+#define hypre_IJAssemblyPatternNumRecvs(pattern)    ((pattern) -> num_recvs)
+#define hypre_IJAssemblyPatternRecvProcs(pattern)   ((pattern) -> recv_procs)
+#define hypre_IJAssemblyPatternRecvStarts(pattern)  ((pattern) -> recv_starts)
+#define hypre_IJAssemblyPatternRecvData(pattern)    ((pattern) -> recv_data)
+#define hypre_IJAssemblyPatternRecvMap(pattern)     ((pattern) -> recv_map)
+#define hypre_IJAssemblyPatternRequests(pattern)    ((pattern) -> requests)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -39,6 +94,13 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
+   HYPRE_Int     off_proc_exchange;   /* exchange of off-processor values:
+                                         0 = DataExchangeList, 1 = NBX */
+   HYPRE_Int     assemble_pending;    /* AssembleBegin called, AssembleEnd not yet */
+   MPI_Comm      exchange_comm;       /* private duplicate of comm for the exchange
+                                         of off-processor values, made on first use */
+
+   hypre_IJAssemblyPattern *pattern;  /* frozen sparsity pattern, if any */
 
 } hypre_IJMatrix;
 
@@ -63,6 +125,10 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixOffProcExchange(matrix)  ((matrix) -> off_proc_exchange)
+#define hypre_IJMatrixAssemblePending(matrix)  ((matrix) -> assemble_pending)
+#define hypre_IJMatrixExchangeComm(matrix)     ((matrix) -> exchange_comm)
+#define hypre_IJMatrixAssemblyPattern(matrix)  ((matrix) -> pattern)
 
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
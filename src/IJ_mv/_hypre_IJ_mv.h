@@ -78,6 +78,22 @@ typedef struct
                                                   * (-global col id. -1) if AddToValues */
    HYPRE_Complex       *off_proc_data;           /* contains corresponding data */
 
+   HYPRE_Int            coo_num_stashes;         /* number of COO stashes (one per thread) */
+   HYPRE_Int           *coo_size;                /* coo_size[t] is the no. of elements in stash t */
+   HYPRE_Int           *coo_space;               /* coo_space[t] is the space allocated to stash t */
+   HYPRE_BigInt       **coo_i;                   /* global row indices of the COO stashes */
+   HYPRE_BigInt       **coo_j;                   /* global column indices of the COO stashes */
+   HYPRE_Complex      **coo_data;                /* values of the COO stashes */
+   HYPRE_Int           *coo_row_start;           /* on-proc COO elements bucketed by row: row i */
+   HYPRE_Int           *coo_row_length;          /* has coo_row_length[i] elements starting at */
+   HYPRE_BigInt        *coo_sorted_j;            /* coo_row_start[i] in coo_sorted_j/data */
+   HYPRE_Complex       *coo_sorted_data;
+
+   HYPRE_Int            nbx_num_sends;           /* pending NBX exchange of off-proc elements: */
+   HYPRE_BigInt        *nbx_send_ij;             /* (row, col) pairs and values packed by */
+   HYPRE_Complex       *nbx_send_data;           /* destination, with two synchronous sends */
+   hypre_MPI_Request   *nbx_requests;            /* per destination */
+
    HYPRE_MemoryLocation memory_location;
 
 #if defined(HYPRE_USING_GPU)
@@ -122,6 +138,22 @@ typedef struct
 #define hypre_AuxParCSRMatrixOffProcJ(matrix)             ((matrix) -> off_proc_j)
 #define hypre_AuxParCSRMatrixOffProcData(matrix)          ((matrix) -> off_proc_data)
 
+#define hypre_AuxParCSRMatrixCooNumStashes(matrix)        ((matrix) -> coo_num_stashes)
+#define hypre_AuxParCSRMatrixCooSize(matrix)              ((matrix) -> coo_size)
+#define hypre_AuxParCSRMatrixCooSpace(matrix)             ((matrix) -> coo_space)
+#define hypre_AuxParCSRMatrixCooI(matrix)                 ((matrix) -> coo_i)
+#define hypre_AuxParCSRMatrixCooJ(matrix)                 ((matrix) -> coo_j)
+#define hypre_AuxParCSRMatrixCooData(matrix)              ((matrix) -> coo_data)
+#define hypre_AuxParCSRMatrixCooRowStart(matrix)          ((matrix) -> coo_row_start)
+#define hypre_AuxParCSRMatrixCooRowLength(matrix)         ((matrix) -> coo_row_length)
+#define hypre_AuxParCSRMatrixCooSortedJ(matrix)           ((matrix) -> coo_sorted_j)
+#define hypre_AuxParCSRMatrixCooSortedData(matrix)        ((matrix) -> coo_sorted_data)
+
+#define hypre_AuxParCSRMatrixNBXNumSends(matrix)          ((matrix) -> nbx_num_sends)
+#define hypre_AuxParCSRMatrixNBXSendIJ(matrix)            ((matrix) -> nbx_send_ij)
+#define hypre_AuxParCSRMatrixNBXSendData(matrix)          ((matrix) -> nbx_send_data)
+#define hypre_AuxParCSRMatrixNBXRequests(matrix)          ((matrix) -> nbx_requests)
+
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
 #if defined(HYPRE_USING_GPU)
@@ -223,6 +255,61 @@ typedef struct
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJAssemblyPattern:
+ *
+ * Recorded sequence of Set/AddToValues slots of a matrix with a frozen
+ * sparsity pattern.  Once frozen, slot_map gives for each slot its position
+ * in the diag data, the diag nnz plus its position in the offd data, or
+ * (-1 - k) for position k in the send buffer.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int           frozen;      /* 0 while recording, 1 once frozen */
+   HYPRE_Int           num_slots;   /* number of values per assembly */
+   HYPRE_Int           max_slots;
+   HYPRE_Int           cursor;      /* next slot to be filled */
+   HYPRE_BigInt       *slot_i;      /* recorded rows (-1: dropped value) */
+   HYPRE_BigInt       *slot_j;      /* recorded columns */
+   HYPRE_Int          *slot_map;
+
+   /* persistent exchange of the off-processor values */
+   HYPRE_Int           num_sends;
+   HYPRE_Int          *send_procs;
+   HYPRE_Int          *send_starts;
+   HYPRE_Complex      *send_data;
+   HYPRE_Int           num_recvs;
+   HYPRE_Int          *recv_procs;
+   HYPRE_Int          *recv_starts;
+   HYPRE_Complex      *recv_data;
+   HYPRE_Int          *recv_map;    /* position of the received values */
+   hypre_MPI_Request  *requests;
+
+} hypre_IJAssemblyPattern;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJAssemblyPattern
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJAssemblyPatternFrozen(pattern)      ((pattern) -> frozen)
+#define hypre_IJAssemblyPatternNumSlots(pattern)    ((pattern) -> num_slots)
+#define hypre_IJAssemblyPatternMaxSlots(pattern)    ((pattern) -> max_slots)
+#define hypre_IJAssemblyPatternCursor(pattern)      ((pattern) -> cursor)
+#define hypre_IJAssemblyPatternSlotI(pattern)       ((pattern) -> slot_i)
+#define hypre_IJAssemblyPatternSlotJ(pattern)       ((pattern) -> slot_j)
+#define hypre_IJAssemblyPatternSlotMap(pattern)     ((pattern) -> slot_map)
+#define hypre_IJAssemblyPatternNumSends(pattern)    ((pattern) -> num_sends)
+#define hypre_IJAssemblyPatternSendProcs(pattern)   ((pattern) -> send_procs)
+#define hypre_IJAssemblyPatternSendStarts(pattern)  ((pattern) -> send_starts)
+#define hypre_IJAssemblyPatternSendData(pattern)    ((pattern) -> send_data)
+#define hypre_IJAssemblyPatternNumRecvs(pattern)    ((pattern) -> num_recvs)
+#define hypre_IJAssemblyPatternRecvProcs(pattern)   ((pattern) -> recv_procs)
+#define hypre_IJAssemblyPatternRecvStarts(pattern)  ((pattern) -> recv_starts)
+#define hypre_IJAssemblyPatternRecvData(pattern)    ((pattern) -> recv_data)
+#define hypre_IJAssemblyPatternRecvMap(pattern)     ((pattern) -> recv_map)
+#define hypre_IJAssemblyPatternRequests(pattern)    ((pattern) -> requests)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -248,6 +335,13 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
+   HYPRE_Int     off_proc_exchange;   /* exchange of off-processor values:
+                                         0 = DataExchangeList, 1 = NBX */
+   HYPRE_Int     assemble_pending;    /* AssembleBegin called, AssembleEnd not yet */
+   MPI_Comm      exchange_comm;       /* private duplicate of comm for the exchange
+                                         of off-processor values, made on first use */
+
+   hypre_IJAssemblyPattern *pattern;  /* frozen sparsity pattern, if any */
 
 } hypre_IJMatrix;
 
@@ -272,6 +366,10 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixOffProcExchange(matrix)  ((matrix) -> off_proc_exchange)
+#define hypre_IJMatrixAssemblePending(matrix)  ((matrix) -> assemble_pending)
+#define hypre_IJMatrixExchangeComm(matrix)     ((matrix) -> exchange_comm)
+#define hypre_IJMatrixAssemblyPattern(matrix)  ((matrix) -> pattern)
 
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
@@ -383,6 +481,7 @@ HYPRE_Int hypre_AuxParCSRMatrixSetRownnz ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                               HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_AuxParCSRMatrixDestroyCOO ( hypre_AuxParCSRMatrix *matrix );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -403,8 +502,13 @@ HYPRE_Int hypre_IJMatrixGetColPartitioning ( HYPRE_IJMatrix matrix,
 HYPRE_Int hypre_IJMatrixSetObject ( HYPRE_IJMatrix matrix, void *object );
 HYPRE_Int hypre_IJMatrixRead( const char *filename, MPI_Comm comm, HYPRE_Int type,
                               HYPRE_IJMatrix *matrix_ptr, HYPRE_Int is_mm );
+HYPRE_Int hypre_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int hypre_IJMatrixReadBinary( const char *prefixname, MPI_Comm comm,
                                     HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
+hypre_IJAssemblyPattern *hypre_IJAssemblyPatternCreate ( void );
+HYPRE_Int hypre_IJAssemblyPatternDestroy ( hypre_IJAssemblyPattern *pattern );
+HYPRE_Int hypre_IJMatrixGetExchangeComm ( hypre_IJMatrix *matrix, MPI_Comm *comm_ptr );
 
 /* IJMatrix_isis.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizeISIS ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
@@ -466,7 +570,31 @@ HYPRE_Int hypre_FillResponseIJOffProcVals ( void *p_recv_contact_buf, HYPRE_Int
                                             HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                             HYPRE_Int *response_message_size );
 HYPRE_Int hypre_FindProc ( HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_length );
+HYPRE_Int hypre_IJMatrixPostNBXParCSR ( hypre_IJMatrix *matrix, HYPRE_Int n, HYPRE_Int *procs,
+                                        HYPRE_BigInt *i, HYPRE_BigInt *j, HYPRE_Complex *data, HYPRE_Int tag );
+HYPRE_Int hypre_IJMatrixCompleteNBXParCSR ( hypre_IJMatrix *matrix, HYPRE_Int tag,
+                                            HYPRE_Int *num_recv_ptr, HYPRE_BigInt **recv_ij_ptr, HYPRE_Complex **recv_data_ptr );
+HYPRE_Int hypre_IJMatrixPostOffProcValsNBXParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixRecvOffProcValsNBXParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixAssembleParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleBeginParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleEndParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAddToValuesCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nnz,
+                                               const HYPRE_BigInt *rows, const HYPRE_BigInt *cols,
+                                               const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixBucketCOOParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixMergeCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_BigInt **big_offd_j_ptr );
+HYPRE_Int hypre_IJMatrixRecordPatternParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes,
+                                              const HYPRE_BigInt *cols, HYPRE_Int add );
+HYPRE_Int hypre_IJMatrixReplayValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                             HYPRE_Int *ncols, const HYPRE_Int *row_indexes, const HYPRE_Complex *values,
+                                             HYPRE_Int add );
+HYPRE_Int hypre_IJMatrixLocateEntryParCSR ( hypre_IJMatrix *matrix, HYPRE_BigInt row,
+                                            HYPRE_BigInt col );
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixStartPatternParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssemblePatternParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetValuesOMPParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
                                              const HYPRE_Complex *values );
@@ -553,7 +681,11 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPR
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddToValuesCOO ( HYPRE_IJMatrix matrix, HYPRE_Int nnz,
+                                         const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAssembleBegin ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAssembleEnd ( HYPRE_IJMatrix matrix );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
@@ -576,6 +708,8 @@ HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int t
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetFrozenPattern ( HYPRE_IJMatrix matrix, HYPRE_Int frozen );
+HYPRE_Int HYPRE_IJMatrixSetOffProcExchange ( HYPRE_IJMatrix matrix, HYPRE_Int exchange );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
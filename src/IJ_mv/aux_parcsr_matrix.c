@@ -51,6 +51,26 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcI(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
+   /* per-thread stashes for COO batches */
+   hypre_AuxParCSRMatrixCooNumStashes(matrix) = hypre_NumThreads();
+   hypre_AuxParCSRMatrixCooSize(matrix)  = hypre_CTAlloc(HYPRE_Int, hypre_NumThreads(),
+                                                         HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCooSpace(matrix) = hypre_CTAlloc(HYPRE_Int, hypre_NumThreads(),
+                                                         HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCooI(matrix)     = hypre_CTAlloc(HYPRE_BigInt *, hypre_NumThreads(),
+                                                         HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCooJ(matrix)     = hypre_CTAlloc(HYPRE_BigInt *, hypre_NumThreads(),
+                                                         HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCooData(matrix)  = hypre_CTAlloc(HYPRE_Complex *, hypre_NumThreads(),
+                                                         HYPRE_MEMORY_HOST);
+   hypre_AuxParCSRMatrixCooRowStart(matrix)   = NULL;
+   hypre_AuxParCSRMatrixCooRowLength(matrix)  = NULL;
+   hypre_AuxParCSRMatrixCooSortedJ(matrix)    = NULL;
+   hypre_AuxParCSRMatrixCooSortedData(matrix) = NULL;
+   hypre_AuxParCSRMatrixNBXNumSends(matrix)   = 0;
+   hypre_AuxParCSRMatrixNBXSendIJ(matrix)     = NULL;
+   hypre_AuxParCSRMatrixNBXSendData(matrix)   = NULL;
+   hypre_AuxParCSRMatrixNBXRequests(matrix)   = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
 #if defined(HYPRE_USING_GPU)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
@@ -142,6 +162,17 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      hypre_AuxParCSRMatrixDestroyCOO(matrix);
+      hypre_TFree(hypre_AuxParCSRMatrixCooSize(matrix),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCooSpace(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCooI(matrix),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCooJ(matrix),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCooData(matrix),  HYPRE_MEMORY_HOST);
+
+      hypre_TFree(hypre_AuxParCSRMatrixNBXSendIJ(matrix),   HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixNBXSendData(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixNBXRequests(matrix), HYPRE_MEMORY_HOST);
+
 #if defined(HYPRE_USING_GPU)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
@@ -386,3 +417,31 @@ hypre_AuxParCSRMatrixInitialize(hypre_AuxParCSRMatrix *matrix)
 
    return -2;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_AuxParCSRMatrixDestroyCOO
+ *
+ * Frees the COO stashes and the row-bucketed COO elements
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AuxParCSRMatrixDestroyCOO( hypre_AuxParCSRMatrix *matrix )
+{
+   HYPRE_Int  t;
+
+   for (t = 0; t < hypre_AuxParCSRMatrixCooNumStashes(matrix); t++)
+   {
+      hypre_TFree(hypre_AuxParCSRMatrixCooI(matrix)[t],    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCooJ(matrix)[t],    HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_AuxParCSRMatrixCooData(matrix)[t], HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixCooSize(matrix)[t]  = 0;
+      hypre_AuxParCSRMatrixCooSpace(matrix)[t] = 0;
+   }
+
+   hypre_TFree(hypre_AuxParCSRMatrixCooRowStart(matrix),   HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixCooRowLength(matrix),  HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixCooSortedJ(matrix),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixCooSortedData(matrix), HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -63,6 +63,22 @@ typedef struct
                                                   * (-global col id. -1) if AddToValues */
    HYPRE_Complex       *off_proc_data;           /* contains corresponding data */
 
+   HYPRE_Int            coo_num_stashes;         /* number of COO stashes (one per thread) */
+   HYPRE_Int           *coo_size;                /* coo_size[t] is the no. of elements in stash t */
+   HYPRE_Int           *coo_space;               /* coo_space[t] is the space allocated to stash t */
+   HYPRE_BigInt       **coo_i;                   /* global row indices of the COO stashes */
+   HYPRE_BigInt       **coo_j;                   /* global column indices of the COO stashes */
+   HYPRE_Complex      **coo_data;                /* values of the COO stashes */
+   HYPRE_Int           *coo_row_start;           /* on-proc COO elements bucketed by row: row i */
+   HYPRE_Int           *coo_row_length;          /* has coo_row_length[i] elements starting at */
+   HYPRE_BigInt        *coo_sorted_j;            /* coo_row_start[i] in coo_sorted_j/data */
+   HYPRE_Complex       *coo_sorted_data;
+
+   HYPRE_Int            nbx_num_sends;           /* pending NBX exchange of off-proc elements: */
+   HYPRE_BigInt        *nbx_send_ij;             /* (row, col) pairs and values packed by */
+   HYPRE_Complex       *nbx_send_data;           /* destination, with two synchronous sends */
+   hypre_MPI_Request   *nbx_requests;            /* per destination */
+
    HYPRE_MemoryLocation memory_location;
 
 #if defined(HYPRE_USING_GPU)
@@ -107,6 +123,22 @@ typedef struct
 #define hypre_AuxParCSRMatrixOffProcJ(matrix)             ((matrix) -> off_proc_j)
 #define hypre_AuxParCSRMatrixOffProcData(matrix)          ((matrix) -> off_proc_data)
 
+#define hypre_AuxParCSRMatrixCooNumStashes(matrix)        ((matrix) -> coo_num_stashes)
+#define hypre_AuxParCSRMatrixCooSize(matrix)              ((matrix) -> coo_size)
+#define hypre_AuxParCSRMatrixCooSpace(matrix)             ((matrix) -> coo_space)
+#define hypre_AuxParCSRMatrixCooI(matrix)                 ((matrix) -> coo_i)
+#define hypre_AuxParCSRMatrixCooJ(matrix)                 ((matrix) -> coo_j)
+#define hypre_AuxParCSRMatrixCooData(matrix)              ((matrix) -> coo_data)
+#define hypre_AuxParCSRMatrixCooRowStart(matrix)          ((matrix) -> coo_row_start)
+#define hypre_AuxParCSRMatrixCooRowLength(matrix)         ((matrix) -> coo_row_length)
+#define hypre_AuxParCSRMatrixCooSortedJ(matrix)           ((matrix) -> coo_sorted_j)
+#define hypre_AuxParCSRMatrixCooSortedData(matrix)        ((matrix) -> coo_sorted_data)
+
+#define hypre_AuxParCSRMatrixNBXNumSends(matrix)          ((matrix) -> nbx_num_sends)
+#define hypre_AuxParCSRMatrixNBXSendIJ(matrix)            ((matrix) -> nbx_send_ij)
+#define hypre_AuxParCSRMatrixNBXSendData(matrix)          ((matrix) -> nbx_send_data)
+#define hypre_AuxParCSRMatrixNBXRequests(matrix)          ((matrix) -> nbx_requests)
+
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
 #if defined(HYPRE_USING_GPU)
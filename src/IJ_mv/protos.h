@@ -13,6 +13,7 @@ HYPRE_Int hypre_AuxParCSRMatrixSetRownnz ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix,
                                               HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_AuxParCSRMatrixDestroyCOO ( hypre_AuxParCSRMatrix *matrix );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -33,8 +34,13 @@ HYPRE_Int hypre_IJMatrixGetColPartitioning ( HYPRE_IJMatrix matrix,
 HYPRE_Int hypre_IJMatrixSetObject ( HYPRE_IJMatrix matrix, void *object );
 HYPRE_Int hypre_IJMatrixRead( const char *filename, MPI_Comm comm, HYPRE_Int type,
                               HYPRE_IJMatrix *matrix_ptr, HYPRE_Int is_mm );
+HYPRE_Int hypre_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int hypre_IJMatrixReadBinary( const char *prefixname, MPI_Comm comm,
                                     HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
+hypre_IJAssemblyPattern *hypre_IJAssemblyPatternCreate ( void );
+HYPRE_Int hypre_IJAssemblyPatternDestroy ( hypre_IJAssemblyPattern *pattern );
+HYPRE_Int hypre_IJMatrixGetExchangeComm ( hypre_IJMatrix *matrix, MPI_Comm *comm_ptr );
 
 /* IJMatrix_isis.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizeISIS ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
@@ -96,7 +102,31 @@ HYPRE_Int hypre_FillResponseIJOffProcVals ( void *p_recv_contact_buf, HYPRE_Int
                                             HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                             HYPRE_Int *response_message_size );
 HYPRE_Int hypre_FindProc ( HYPRE_BigInt *list, HYPRE_BigInt value, HYPRE_Int list_length );
+HYPRE_Int hypre_IJMatrixPostNBXParCSR ( hypre_IJMatrix *matrix, HYPRE_Int n, HYPRE_Int *procs,
+                                        HYPRE_BigInt *i, HYPRE_BigInt *j, HYPRE_Complex *data, HYPRE_Int tag );
+HYPRE_Int hypre_IJMatrixCompleteNBXParCSR ( hypre_IJMatrix *matrix, HYPRE_Int tag,
+                                            HYPRE_Int *num_recv_ptr, HYPRE_BigInt **recv_ij_ptr, HYPRE_Complex **recv_data_ptr );
+HYPRE_Int hypre_IJMatrixPostOffProcValsNBXParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixRecvOffProcValsNBXParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixAssembleParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleBeginParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleEndParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAddToValuesCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nnz,
+                                               const HYPRE_BigInt *rows, const HYPRE_BigInt *cols,
+                                               const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixBucketCOOParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixMergeCOOParCSR ( hypre_IJMatrix *matrix, HYPRE_BigInt **big_offd_j_ptr );
+HYPRE_Int hypre_IJMatrixRecordPatternParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes,
+                                              const HYPRE_BigInt *cols, HYPRE_Int add );
+HYPRE_Int hypre_IJMatrixReplayValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                             HYPRE_Int *ncols, const HYPRE_Int *row_indexes, const HYPRE_Complex *values,
+                                             HYPRE_Int add );
+HYPRE_Int hypre_IJMatrixLocateEntryParCSR ( hypre_IJMatrix *matrix, HYPRE_BigInt row,
+                                            HYPRE_BigInt col );
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixStartPatternParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssemblePatternParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetValuesOMPParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
                                              HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
                                              const HYPRE_Complex *values );
@@ -183,7 +213,11 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPR
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddToValuesCOO ( HYPRE_IJMatrix matrix, HYPRE_Int nnz,
+                                         const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAssembleBegin ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAssembleEnd ( HYPRE_IJMatrix matrix );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
@@ -206,6 +240,8 @@ HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int t
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetFrozenPattern ( HYPRE_IJMatrix matrix, HYPRE_Int frozen );
+HYPRE_Int HYPRE_IJMatrixSetOffProcExchange ( HYPRE_IJMatrix matrix, HYPRE_Int exchange );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
 HYPRE_Int HYPRE_IJMatrixAdd ( HYPRE_Complex alpha, HYPRE_IJMatrix matrix_A, HYPRE_Complex beta,
@@ -504,7 +504,7 @@ function(add_hypre_target_distclean)
     COMMAND find ${CMAKE_SOURCE_DIR}/test -name "*.out*" -type f -delete
     COMMAND find ${CMAKE_SOURCE_DIR}/test -name "*.err*" -type f -delete
     COMMAND find ${CMAKE_SOURCE_DIR}/examples -type f -name "ex[0-9]" -name "ex[10-19]" -delete
-    COMMAND find ${CMAKE_SOURCE_DIR}/test -type f -name "ij|struct|sstruct|ams_driver|maxwell_unscalled|struct_migrate|sstruct_fac|ij_assembly" -delete
+    COMMAND find ${CMAKE_SOURCE_DIR}/test -type f -name "ij|struct|sstruct|ams_driver|maxwell_unscalled|struct_migrate|struct_boxman|sstruct_fac|ij_assembly" -delete
     WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
     COMMENT "Removing all build artifacts and generated files"
     VERBATIM
@@ -152,6 +152,43 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetFlex(HYPRE_Solver solver,
                            HYPRE_Int    flex);
 
+/**
+ * (Optional) Use the communication-avoiding s-step variant of PCG if
+ * sstep > 1. Each outer step builds a basis of sstep preconditioned
+ * Krylov vectors and computes all its inner products with a single global
+ * reduction (if the vector interface supports it), which reduces the number
+ * of reductions by a factor of about sstep. The convergence test is applied
+ * every sstep iterations. Not compatible with the flexible, relative change,
+ * residual tolerance and residual recomputation options; classical PCG is
+ * used in that case. Values of sstep up to 4-8 are typically stable; larger
+ * values may need the Newton basis (see HYPRE_PCGSetSStepBasis).
+ * The default is 0 (classical PCG).
+ **/
+HYPRE_Int HYPRE_PCGSetSStep(HYPRE_Solver solver,
+                            HYPRE_Int    sstep);
+
+/**
+ * (Optional) Basis of the s-step variant.
+ *  If set to 0 (default): monomial basis
+ *  If set to 1: Newton basis, shifted by Ritz values estimated during the
+ *  first outer step of each solve
+ **/
+HYPRE_Int HYPRE_PCGSetSStepBasis(HYPRE_Solver solver,
+                                 HYPRE_Int    sstep_basis);
+
+/**
+ * (Optional) Use the pipelined variant of PCG if pipelined > 0. The global
+ * reduction of each iteration is started before, and completed after, the
+ * preconditioner and matrix-vector product, so that its latency is hidden if
+ * the vector interface supports non-blocking reductions. It needs six
+ * additional vectors and is slightly less accurate than classical PCG.
+ * Not compatible with the flexible, relative change, residual tolerance and
+ * residual recomputation options; classical PCG is used in that case.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Skips subnormal alpha, gamma and iprod values in CG.
  *  If set to 0 (default): will break if values are below HYPRE_REAL_MIN
@@ -263,6 +300,21 @@ HYPRE_Int HYPRE_PCGGetSkipBreak(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGGetFlex(HYPRE_Solver solver,
                            HYPRE_Int   *flex);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetSStep(HYPRE_Solver solver,
+                            HYPRE_Int   *sstep);
+
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetSStepBasis(HYPRE_Solver solver,
+                                 HYPRE_Int   *sstep_basis);
+
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int   *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_PCGGetPrecond(HYPRE_Solver  solver,
@@ -375,6 +427,20 @@ HYPRE_Int HYPRE_GMRESSetRelChange(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck(HYPRE_Solver solver,
                                               HYPRE_Int    skip_real_r_check);
 
+/**
+ * (Optional) Use the pipelined variant of GMRES if pipelined > 0. The
+ * orthogonalization of each new Krylov vector uses classical Gram-Schmidt
+ * with a single global reduction, which is started before, and completed
+ * after, the next preconditioner and matrix-vector product, so that its
+ * latency is hidden if the vector interface supports non-blocking
+ * reductions. It needs k_dim additional vectors and is less robust than
+ * the default modified Gram-Schmidt GMRES for large k_dim. Not compatible
+ * with the relative change and convergence factor options; the default
+ * GMRES is used in that case. The default is 0.
+ **/
+HYPRE_Int HYPRE_GMRESSetPipelined(HYPRE_Solver solver,
+                                  HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -418,6 +484,11 @@ HYPRE_Int HYPRE_GMRESGetResidual(HYPRE_Solver   solver,
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
                                               HYPRE_Int   *skip_real_r_check);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetPipelined(HYPRE_Solver solver,
+                                  HYPRE_Int   *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetTol(HYPRE_Solver  solver,
@@ -282,6 +282,60 @@ HYPRE_PCGGetFlex( HYPRE_Solver  solver,
    return ( hypre_PCGGetFlex( (void *) solver, flex ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetSStep, HYPRE_PCGGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetSStep( HYPRE_Solver solver,
+                   HYPRE_Int    sstep )
+{
+   return ( hypre_PCGSetSStep( (void *) solver, sstep ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetSStep( HYPRE_Solver  solver,
+                   HYPRE_Int    *sstep )
+{
+   return ( hypre_PCGGetSStep( (void *) solver, sstep ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetSStepBasis, HYPRE_PCGGetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetSStepBasis( HYPRE_Solver solver,
+                        HYPRE_Int    sstep_basis )
+{
+   return ( hypre_PCGSetSStepBasis( (void *) solver, sstep_basis ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetSStepBasis( HYPRE_Solver  solver,
+                        HYPRE_Int    *sstep_basis )
+{
+   return ( hypre_PCGGetSStepBasis( (void *) solver, sstep_basis ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGSetPipelined, HYPRE_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGSetPipelined( HYPRE_Solver solver,
+                       HYPRE_Int    pipelined )
+{
+   return ( hypre_PCGSetPipelined( (void *) solver, pipelined ) );
+}
+
+HYPRE_Int
+HYPRE_PCGGetPipelined( HYPRE_Solver  solver,
+                       HYPRE_Int    *pipelined )
+{
+   return ( hypre_PCGGetPipelined( (void *) solver, pipelined ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGSetPrecond
  *--------------------------------------------------------------------------*/
@@ -58,6 +58,8 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
    gmres_functions->Axpy = Axpy;
+   gmres_functions->IBlockInnerProd = NULL;
+   gmres_functions->IBlockInnerProdWait = NULL;
    /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
@@ -91,10 +93,12 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
    (gmres_data -> stop_crit)      = 0; /* rel. residual norm  - this is obsolete!*/
    (gmres_data -> converged)      = 0;
    (gmres_data -> hybrid)         = 0;
+   (gmres_data -> pipelined)      = 0;
    (gmres_data -> precond_data)   = NULL;
    (gmres_data -> print_level)    = 0;
    (gmres_data -> logging)        = 0;
    (gmres_data -> p)              = NULL;
+   (gmres_data -> z)              = NULL;
    (gmres_data -> r)              = NULL;
    (gmres_data -> w)              = NULL;
    (gmres_data -> w_2)            = NULL;
@@ -159,6 +163,17 @@ hypre_GMRESDestroy( void *gmres_vdata )
          }
          hypre_TFreeF( gmres_data->p, gmres_functions );
       }
+      if ( (gmres_data -> z) != NULL )
+      {
+         for (i = 0; i < (gmres_data -> k_dim + 1); i++)
+         {
+            if ( (gmres_data -> z)[i] != NULL )
+            {
+               (*(gmres_functions->DestroyVector))( (gmres_data -> z) [i]);
+            }
+         }
+         hypre_TFreeF( gmres_data->z, gmres_functions );
+      }
       hypre_TFreeF( gmres_data, gmres_functions );
       hypre_TFreeF( gmres_functions, gmres_functions );
    }
@@ -325,6 +340,12 @@ hypre_GMRESSolve(void  *gmres_vdata,
    HYPRE_Int             rel_change_passed = 0, num_rel_change_check = 0;
    HYPRE_Real            real_r_norm_old, real_r_norm_new;
 
+   /* pipelined variant with overlapped reductions (see hypre_GMRESPipelinedSolve) */
+   if ((gmres_data -> pipelined) && !rel_change && cf_tol == 0.0)
+   {
+      return hypre_GMRESPipelinedSolve(gmres_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (gmres_data -> converged) = 0;
@@ -924,6 +945,364 @@ hypre_GMRESSolve(void  *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESPipelinedSolve
+ *
+ * Pipelined restarted GMRES with right preconditioning (p(1)-GMRES of
+ * Ghysels, Ashby, Meerbergen and Vanroose). With B = A*C, the candidate
+ * z_{i+1} = B*v_i of the next Arnoldi vector is orthogonalized by classical
+ * Gram-Schmidt, and all its inner products with the basis (plus its norm)
+ * are reduced together with a single non-blocking reduction if the
+ * interface provides IBlockInnerProd. While the reduction is in progress,
+ * B*z_{i+1} is computed, from which the next candidate follows by a
+ * recurrence. To limit the growth of rounding errors in this recurrence, the
+ * shifted basis z_{i+1} = (B - sigma_i I)*v_i is used, so that
+ *
+ *    z_{i+2} = (B*z_{i+1} - sigma_{i+1} z_{i+1}
+ *               - sum_{j<=i} g(j,i) (z_{j+1} + (sigma_j - sigma_{i+1}) v_j)) / g(i+1,i),
+ *
+ * with g(j,i) = <v_j, z_{i+1}> and h(j,i) = g(j,i) + sigma_i delta(j,i). The
+ * shift is h(0,0) in the first cycle and the mean of the Ritz values (the
+ * trace of h over its dimension) of the previous cycle afterwards.
+ *
+ * The norm g(i+1,i) is obtained from <z,z> - sum_j g(j,i)^2; if this is not
+ * positive (loss of orthogonality or breakdown), the cycle is ended and the
+ * method restarts. The true residual is computed at each restart. The
+ * relative change and convergence factor options are not supported and fall
+ * back to hypre_GMRESSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESPipelinedSolve( void  *gmres_vdata,
+                           void  *A,
+                           void  *b,
+                           void  *x )
+{
+   hypre_GMRESData      *gmres_data         = (hypre_GMRESData *)gmres_vdata;
+   hypre_GMRESFunctions *gmres_functions    = (gmres_data -> functions);
+
+   HYPRE_Int             k_dim              = (gmres_data -> k_dim);
+   HYPRE_Int             min_iter           = (gmres_data -> min_iter);
+   HYPRE_Int             max_iter           = (gmres_data -> max_iter);
+   HYPRE_Int             hybrid             = (gmres_data -> hybrid);
+   HYPRE_Real            r_tol              = (gmres_data -> tol);
+   HYPRE_Real            a_tol              = (gmres_data -> a_tol);
+   void                 *matvec_data        = (gmres_data -> matvec_data);
+   void                 *r                  = (gmres_data -> r);
+   void                 *w                  = (gmres_data -> w);
+   void                **p                  = (gmres_data -> p);
+   void                **z;
+
+   HYPRE_Int           (*precond)(void*, void*, void*, void*) = (gmres_functions -> precond);
+   HYPRE_Int            *precond_data = (HYPRE_Int*) (gmres_data -> precond_data);
+
+   HYPRE_Int             print_level        = (gmres_data -> print_level);
+   HYPRE_Int             logging            = (gmres_data -> logging);
+   HYPRE_Real           *norms              = (gmres_data -> norms);
+
+   HYPRE_Int             i, j, k, more;
+   HYPRE_Real           *rs, **hh, *c, *s, *prods, *shifts;
+   void                **xs, **ys;
+   void                 *request;
+   HYPRE_Int             iter = 0, cycle = 0;
+   HYPRE_Int             my_id, num_procs;
+   HYPRE_Real            epsilon, gamma, t, r_norm = 0.0, b_norm, den_norm = 0.0;
+   HYPRE_Real            trace, sigma = 0.0;
+   HYPRE_Real            epsmac = 1.e-16;
+   HYPRE_Real            ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (gmres_data -> converged) = 0;
+
+   (*(gmres_functions->CommInfo))(A, &my_id, &num_procs);
+
+   if ((gmres_data -> z) == NULL)
+   {
+      (gmres_data -> z) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim + 1, x);
+   }
+   z = (gmres_data -> z);
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   c = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
+   s = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
+   prods = hypre_CTAllocF(HYPRE_Real, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   shifts = hypre_CTAllocF(HYPRE_Real, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   xs = hypre_CTAllocF(void *, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   ys = hypre_CTAllocF(void *, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   hh = hypre_CTAllocF(HYPRE_Real*, k_dim + 1, gmres_functions, HYPRE_MEMORY_HOST);
+   for (i = 0; i < k_dim + 1; i++)
+   {
+      hh[i] = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
+   }
+
+   b_norm = hypre_sqrt((*(gmres_functions->InnerProd))(b, b));
+   if (b_norm != 0.)
+   {
+      ieee_check = b_norm / b_norm; /* INF -> NaN conversion */
+   }
+   if (ieee_check != ieee_check)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "INFs and/or NaNs detected in input in pipelined GMRES");
+      iter = max_iter + 1;
+   }
+
+   epsilon = 0.0;
+   if ( print_level > 1 && my_id == 0 && iter <= max_iter )
+   {
+      hypre_printf("L2 norm of b: %e\n", b_norm);
+   }
+
+   /* outer iteration cycle; the true residual is computed at each restart */
+   while (iter <= max_iter)
+   {
+      (*(gmres_functions->CopyVector))(b, p[0]);
+      (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+      r_norm = hypre_sqrt((*(gmres_functions->InnerProd))(p[0], p[0]));
+
+      if (cycle == 0)
+      {
+         if (r_norm != 0.) { ieee_check = r_norm / r_norm; } /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "INFs and/or NaNs detected in input in pipelined GMRES");
+            break;
+         }
+
+         /* convergence criterion |r_i| <= max(a_tol, r_tol * |b|), or
+            relative to |r_0| if b = 0 */
+         den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+         epsilon  = hypre_max(a_tol, r_tol * den_norm);
+
+         if ( logging > 0 || print_level > 0 )
+         {
+            norms[0] = r_norm;
+         }
+         if ( print_level > 1 && my_id == 0 )
+         {
+            hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+            hypre_printf("=============================================\n\n");
+            hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+            hypre_printf("-----    ------------    ---------- ------------\n");
+         }
+      }
+      cycle++;
+
+      if ((r_norm <= epsilon && iter >= min_iter) || r_norm == 0.0)
+      {
+         (gmres_data -> converged) = 1;
+         break;
+      }
+      if (iter >= max_iter)
+      {
+         break;
+      }
+
+      /* shifts of this cycle; in the first one, sigma_0 = 0 and the others
+         are set to h(0,0) below */
+      for (j = 0; j < k_dim + 1; j++)
+      {
+         shifts[j] = sigma;
+      }
+      trace = 0.0;
+
+      /* v_0 = r/|r|, z_1 = (B - sigma_0 I)*v_0 */
+      (*(gmres_functions->ScaleVector))(1.0 / r_norm, p[0]);
+      rs[0] = r_norm;
+      (*(gmres_functions->ClearVector))(r);
+      precond(precond_data, A, p[0], r);
+      (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, z[1]);
+      if (shifts[0] != 0.0)
+      {
+         (*(gmres_functions->Axpy))(-shifts[0], p[0], z[1]);
+      }
+
+      i = 0;
+      while (i < k_dim && iter < max_iter)
+      {
+         /* start the reduction of <v_j, z_{i+1}>, j <= i, and <z_{i+1}, z_{i+1}> */
+         for (j = 0; j <= i; j++)
+         {
+            xs[j] = p[j];  ys[j] = z[i + 1];
+         }
+         xs[i + 1] = z[i + 1];  ys[i + 1] = z[i + 1];
+         request = NULL;
+         if ((gmres_functions -> IBlockInnerProd) && (gmres_functions -> IBlockInnerProdWait))
+         {
+            (*(gmres_functions->IBlockInnerProd))(i + 2, xs, ys, prods, &request);
+         }
+         else
+         {
+            for (j = 0; j < i + 2; j++)
+            {
+               prods[j] = (*(gmres_functions->InnerProd))(xs[j], ys[j]);
+            }
+         }
+
+         /* overlapped with the reduction: w = B*z_{i+1}, needed for the next step */
+         more = (i + 1 < k_dim && iter + 1 < max_iter);
+         if (more)
+         {
+            (*(gmres_functions->ClearVector))(r);
+            precond(precond_data, A, z[i + 1], r);
+            (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, w);
+         }
+
+         if (request)
+         {
+            (*(gmres_functions->IBlockInnerProdWait))(request);
+         }
+
+         /* Arnoldi: g(j,i) = <v_j, z_{i+1}>, g(i+1,i) = |z_{i+1} - sum_j g(j,i) v_j| */
+         t = prods[i + 1];
+         for (j = 0; j <= i; j++)
+         {
+            hh[j][i] = prods[j];
+            t -= prods[j] * prods[j];
+         }
+         t = (t > 1.0e4 * epsmac * prods[i + 1]) ? hypre_sqrt(t) : 0.0;
+         hh[i][i] += shifts[i];
+         hh[i + 1][i] = t;
+         trace += hh[i][i];
+         if (cycle == 1 && i == 0)
+         {
+            for (j = 1; j < k_dim + 1; j++)
+            {
+               shifts[j] = hh[0][0];
+            }
+         }
+
+         if (t != 0.0)
+         {
+            /* v_{i+1} = (z_{i+1} - sum_j g(j,i) v_j) / g(i+1,i) */
+            (*(gmres_functions->CopyVector))(z[i + 1], p[i + 1]);
+            for (j = 0; j <= i; j++)
+            {
+               (*(gmres_functions->Axpy))(-prods[j], p[j], p[i + 1]);
+            }
+            (*(gmres_functions->ScaleVector))(1.0 / t, p[i + 1]);
+
+            /* z_{i+2} = (B - sigma_{i+1} I)*v_{i+1} by the recurrence above */
+            if (more)
+            {
+               (*(gmres_functions->CopyVector))(w, z[i + 2]);
+               (*(gmres_functions->Axpy))(-shifts[i + 1], z[i + 1], z[i + 2]);
+               for (j = 0; j <= i; j++)
+               {
+                  (*(gmres_functions->Axpy))(-prods[j], z[j + 1], z[i + 2]);
+                  if (shifts[j] != shifts[i + 1])
+                  {
+                     (*(gmres_functions->Axpy))(-prods[j] * (shifts[j] - shifts[i + 1]),
+                                                p[j], z[i + 2]);
+                  }
+               }
+               (*(gmres_functions->ScaleVector))(1.0 / t, z[i + 2]);
+            }
+         }
+
+         i++;
+         iter++;
+
+         /* update the QR factorization of hh, as in hypre_GMRESSolve */
+         for (j = 1; j < i; j++)
+         {
+            t = hh[j - 1][i - 1];
+            hh[j - 1][i - 1] = s[j - 1] * hh[j][i - 1] + c[j - 1] * t;
+            hh[j][i - 1] = -s[j - 1] * t + c[j - 1] * hh[j][i - 1];
+         }
+         t = hh[i][i - 1] * hh[i][i - 1];
+         t += hh[i - 1][i - 1] * hh[i - 1][i - 1];
+         gamma = hypre_sqrt(t);
+         if (gamma == 0.0)
+         {
+            gamma = epsmac;
+         }
+         c[i - 1] = hh[i - 1][i - 1] / gamma;
+         s[i - 1] = hh[i][i - 1] / gamma;
+         rs[i] = -hh[i][i - 1] * rs[i - 1];
+         rs[i] /=  gamma;
+         rs[i - 1] = c[i - 1] * rs[i - 1];
+         hh[i - 1][i - 1] = s[i - 1] * hh[i][i - 1] + c[i - 1] * hh[i - 1][i - 1];
+         r_norm = hypre_abs(rs[i]);
+
+         if ( print_level > 0 )
+         {
+            norms[iter] = r_norm;
+            if ( print_level > 1 && my_id == 0 )
+            {
+               hypre_printf("% 5d    %e    %f   %e\n", iter, norms[iter],
+                            norms[iter] / norms[iter - 1], norms[iter] / den_norm);
+            }
+         }
+
+         if ((r_norm <= epsilon && iter >= min_iter) || hh[i][i - 1] == 0.0)
+         {
+            break;
+         }
+      } /* end of restart cycle */
+
+      /* shift for the next cycle: mean of the Ritz values of this one */
+      sigma = trace / i;
+
+      /* solve the upper triangular system and update x += C * V * y */
+      rs[i - 1] = rs[i - 1] / hh[i - 1][i - 1];
+      for (k = i - 2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k + 1; j < i; j++)
+         {
+            t -= hh[k][j] * rs[j];
+         }
+         t += rs[k];
+         rs[k] = t / hh[k][k];
+      }
+
+      (*(gmres_functions->CopyVector))(p[i - 1], w);
+      (*(gmres_functions->ScaleVector))(rs[i - 1], w);
+      for (j = i - 2; j >= 0; j--)
+      {
+         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      }
+      (*(gmres_functions->ClearVector))(r);
+      precond(precond_data, A, w, r);
+      (*(gmres_functions->Axpy))(1.0, r, x);
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+   }
+
+   (gmres_data -> num_iterations) = iter;
+   (gmres_data -> rel_residual_norm) = (b_norm > 0.0) ? r_norm / b_norm : r_norm;
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0 && hybrid != -1)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFreeF(c, gmres_functions);
+   hypre_TFreeF(s, gmres_functions);
+   hypre_TFreeF(rs, gmres_functions);
+   hypre_TFreeF(prods, gmres_functions);
+   hypre_TFreeF(shifts, gmres_functions);
+   hypre_TFreeF(xs, gmres_functions);
+   hypre_TFreeF(ys, gmres_functions);
+   for (i = 0; i < k_dim + 1; i++)
+   {
+      hypre_TFreeF(hh[i], gmres_functions);
+   }
+   hypre_TFreeF(hh, gmres_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetKDim, hypre_GMRESGetKDim
  *--------------------------------------------------------------------------*/
@@ -1145,6 +1524,32 @@ hypre_GMRESGetSkipRealResidualCheck( void      *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetPipelined, hypre_GMRESGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetPipelined( void     *gmres_vdata,
+                         HYPRE_Int pipelined )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   (gmres_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetPipelined( void      *gmres_vdata,
+                         HYPRE_Int *pipelined )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *pipelined = (gmres_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetStopCrit, hypre_GMRESGetStopCrit
  *
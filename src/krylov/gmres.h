@@ -64,6 +64,11 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: non-blocking result[i] = <x[i],y[i]> for i < n with a single
+      reduction; result is valid after IBlockInnerProdWait */
+   HYPRE_Int    (*IBlockInnerProd)( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                    void **request );
+   HYPRE_Int    (*IBlockInnerProdWait)( void *request );
 
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
@@ -84,6 +89,7 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      pipelined;
    HYPRE_Real   tol;
    HYPRE_Real   cf_tol;
    HYPRE_Real   a_tol;
@@ -94,6 +100,7 @@ typedef struct
    void  *w;
    void  *w_2;
    void  **p;
+   void  **z; /* images of the Krylov basis (pipelined GMRES only) */
 
    void    *matvec_data;
    void    *precond_data;
@@ -411,6 +411,11 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: non-blocking result[i] = <x[i],y[i]> for i < n with a single
+      reduction; result is valid after IBlockInnerProdWait */
+   HYPRE_Int    (*IBlockInnerProd)( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                    void **request );
+   HYPRE_Int    (*IBlockInnerProdWait)( void *request );
 
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
@@ -431,6 +436,7 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      pipelined;
    HYPRE_Real   tol;
    HYPRE_Real   cf_tol;
    HYPRE_Real   a_tol;
@@ -441,6 +447,7 @@ typedef struct
    void  *w;
    void  *w_2;
    void  **p;
+   void  **z; /* images of the Krylov basis (pipelined GMRES only) */
 
    void    *matvec_data;
    void    *precond_data;
@@ -1066,6 +1073,12 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: result[i] = <x[i],y[i]> for i < n with a single reduction */
+   HYPRE_Int    (*BlockInnerProd)( HYPRE_Int n, void **x, void **y, HYPRE_Real *result );
+   /* optional: non-blocking BlockInnerProd; result is valid after IBlockInnerProdWait */
+   HYPRE_Int    (*IBlockInnerProd)( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                    void **request );
+   HYPRE_Int    (*IBlockInnerProdWait)( void *request );
 
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
@@ -1124,6 +1137,9 @@ typedef struct
    HYPRE_Int      hybrid;
    HYPRE_Int      skip_break;
    HYPRE_Int      flex;
+   HYPRE_Int      sstep;       /* s-step PCG if > 1 */
+   HYPRE_Int      sstep_basis; /* 0: monomial, 1: Newton */
+   HYPRE_Int      pipelined;   /* pipelined PCG if > 0 */
 
    void    *A;
    void    *p;
@@ -1133,6 +1149,19 @@ typedef struct
    void    *r_old; /* only needed for flexible CG */
    void    *v; /* work vector; only needed if recompute_residual_p is set */
 
+   /* s-step PCG: Krylov basis, previous direction block, their images
+      under A, and the Newton basis shifts */
+   HYPRE_Int      sstep_nvecs;
+   void   **sstep_V;
+   void   **sstep_AV;
+   void   **sstep_P;
+   void   **sstep_AP;
+   HYPRE_Real  *sstep_shifts;
+   HYPRE_Int      sstep_num_shifts;
+
+   /* pipelined PCG: auxiliary recurrence vectors u, w, m, n, q, z */
+   void   **pipe_vecs;
+
    HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void    *matvec_data;
    void    *precond_data;
@@ -1255,6 +1284,7 @@ HYPRE_Int hypre_GMRESDestroy ( void *gmres_vdata );
 HYPRE_Int hypre_GMRESGetResidual ( void *gmres_vdata, void **residual );
 HYPRE_Int hypre_GMRESSetup ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_GMRESSolve ( void *gmres_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_GMRESPipelinedSolve ( void *gmres_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_GMRESSetKDim ( void *gmres_vdata, HYPRE_Int k_dim );
 HYPRE_Int hypre_GMRESGetKDim ( void *gmres_vdata, HYPRE_Int *k_dim );
 HYPRE_Int hypre_GMRESSetTol ( void *gmres_vdata, HYPRE_Real tol );
@@ -1271,6 +1301,8 @@ HYPRE_Int hypre_GMRESSetRelChange ( void *gmres_vdata, HYPRE_Int rel_change );
 HYPRE_Int hypre_GMRESGetRelChange ( void *gmres_vdata, HYPRE_Int *rel_change );
 HYPRE_Int hypre_GMRESSetSkipRealResidualCheck ( void *gmres_vdata, HYPRE_Int skip_real_r_check );
 HYPRE_Int hypre_GMRESGetSkipRealResidualCheck ( void *gmres_vdata, HYPRE_Int *skip_real_r_check );
+HYPRE_Int hypre_GMRESSetPipelined ( void *gmres_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_GMRESGetPipelined ( void *gmres_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_GMRESSetStopCrit ( void *gmres_vdata, HYPRE_Int stop_crit );
 HYPRE_Int hypre_GMRESGetStopCrit ( void *gmres_vdata, HYPRE_Int *stop_crit );
 HYPRE_Int hypre_GMRESSetPrecond ( void *gmres_vdata, HYPRE_Int (*precond )(void*, void*, void*,
@@ -1456,6 +1488,8 @@ HYPRE_Int HYPRE_GMRESSetRelChange ( HYPRE_Solver solver, HYPRE_Int rel_change );
 HYPRE_Int HYPRE_GMRESGetRelChange ( HYPRE_Solver solver, HYPRE_Int *rel_change );
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck ( HYPRE_Solver solver, HYPRE_Int skip_real_r_check );
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck ( HYPRE_Solver solver, HYPRE_Int *skip_real_r_check );
+HYPRE_Int HYPRE_GMRESSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_GMRESGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_GMRESSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                   HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_GMRESGetPrecond ( HYPRE_Solver solver, HYPRE_Solver *precond_data_ptr );
@@ -1596,6 +1630,12 @@ HYPRE_Int HYPRE_PCGSetSkipBreak ( HYPRE_Solver solver, HYPRE_Int skip_break );
 HYPRE_Int HYPRE_PCGGetSkipBreak ( HYPRE_Solver solver, HYPRE_Int *skip_break );
 HYPRE_Int HYPRE_PCGSetFlex ( HYPRE_Solver solver, HYPRE_Int flex );
 HYPRE_Int HYPRE_PCGGetFlex ( HYPRE_Solver solver, HYPRE_Int *flex );
+HYPRE_Int HYPRE_PCGSetSStep ( HYPRE_Solver solver, HYPRE_Int sstep );
+HYPRE_Int HYPRE_PCGGetSStep ( HYPRE_Solver solver, HYPRE_Int *sstep );
+HYPRE_Int HYPRE_PCGSetSStepBasis ( HYPRE_Solver solver, HYPRE_Int sstep_basis );
+HYPRE_Int HYPRE_PCGGetSStepBasis ( HYPRE_Solver solver, HYPRE_Int *sstep_basis );
+HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver, HYPRE_Int pipelined );
+HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver, HYPRE_Int *pipelined );
 HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver, HYPRE_PtrToSolverFcn precond,
                                 HYPRE_PtrToSolverFcn precond_setup, HYPRE_Solver precond_solver );
 HYPRE_Int HYPRE_PCGSetPreconditioner ( HYPRE_Solver solver, HYPRE_Solver precond_solver );
@@ -1615,6 +1655,10 @@ HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
 HYPRE_Int hypre_PCGSetup ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGSStepDestroyVectors ( void *pcg_vdata );
+HYPRE_Int hypre_PCGSStepCreateVectors ( void *pcg_vdata, void *b, void *x );
+HYPRE_Int hypre_PCGSStepSolve ( void *pcg_vdata, void *A, void *b, void *x );
+HYPRE_Int hypre_PCGPipelinedSolve ( void *pcg_vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata, HYPRE_Real a_tol );
@@ -1641,6 +1685,12 @@ HYPRE_Int hypre_PCGSetSkipBreak ( void *pcg_vdata, HYPRE_Int skip_break );
 HYPRE_Int hypre_PCGGetSkipBreak ( void *pcg_vdata, HYPRE_Int *skip_break );
 HYPRE_Int hypre_PCGSetFlex ( void *pcg_vdata, HYPRE_Int flex );
 HYPRE_Int hypre_PCGGetFlex ( void *pcg_vdata, HYPRE_Int *flex );
+HYPRE_Int hypre_PCGSetSStep ( void *pcg_vdata, HYPRE_Int sstep );
+HYPRE_Int hypre_PCGGetSStep ( void *pcg_vdata, HYPRE_Int *sstep );
+HYPRE_Int hypre_PCGSetSStepBasis ( void *pcg_vdata, HYPRE_Int sstep_basis );
+HYPRE_Int hypre_PCGGetSStepBasis ( void *pcg_vdata, HYPRE_Int *sstep_basis );
+HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata, HYPRE_Int pipelined );
+HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata, HYPRE_Int *pipelined );
 HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata, HYPRE_Solver *precond_data_ptr );
 HYPRE_Int hypre_PCGSetPrecond ( void *pcg_vdata,
                                 HYPRE_Int (*precond )(void*, void*, void*, void*),
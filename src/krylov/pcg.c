@@ -65,6 +65,9 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->BlockInnerProd = NULL;
+   pcg_functions->IBlockInnerProd = NULL;
+   pcg_functions->IBlockInnerProdWait = NULL;
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -114,6 +117,17 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> r)            = NULL;
    (pcg_data -> r_old)        = NULL;
    (pcg_data -> v)            = NULL;
+   (pcg_data -> sstep)        = 0;
+   (pcg_data -> sstep_basis)  = 0;
+   (pcg_data -> sstep_nvecs)  = 0;
+   (pcg_data -> sstep_V)      = NULL;
+   (pcg_data -> sstep_AV)     = NULL;
+   (pcg_data -> sstep_P)      = NULL;
+   (pcg_data -> sstep_AP)     = NULL;
+   (pcg_data -> sstep_shifts) = NULL;
+   (pcg_data -> sstep_num_shifts) = 0;
+   (pcg_data -> pipelined)    = 0;
+   (pcg_data -> pipe_vecs)    = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -128,6 +142,7 @@ HYPRE_Int
 hypre_PCGDestroy( void *pcg_vdata )
 {
    hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   HYPRE_Int      i;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -174,6 +189,15 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> v);
          pcg_data -> v = NULL;
       }
+      hypre_PCGSStepDestroyVectors(pcg_data);
+      if ( pcg_data -> pipe_vecs != NULL )
+      {
+         for (i = 0; i < 6; i++)
+         {
+            (*(pcg_functions->DestroyVector))(pcg_data -> pipe_vecs[i]);
+         }
+         hypre_TFreeF( pcg_data -> pipe_vecs, pcg_functions );
+      }
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -379,6 +403,19 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   /* communication-avoiding s-step variant (see hypre_PCGSStepSolve); this
+      takes precedence over the pipelined variant */
+   if ((pcg_data -> sstep) > 1 && !flex && !rel_change && !rtol && !recompute_residual_p)
+   {
+      return hypre_PCGSStepSolve(pcg_vdata, A, b, x);
+   }
+
+   /* pipelined variant with overlapped reductions (see hypre_PCGPipelinedSolve) */
+   if ((pcg_data -> pipelined) && !flex && !rel_change && !rtol && !recompute_residual_p)
+   {
+      return hypre_PCGPipelinedSolve(pcg_vdata, A, b, x);
+   }
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (pcg_data -> converged) = 0;
@@ -1008,160 +1045,1262 @@ hypre_PCGSolve( void *pcg_vdata,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_PCGSetTol, hypre_PCGGetTol
+ * hypre_PCGSolveInit
+ *
+ * Common start of the s-step and pipelined variants: computes <b,b> (or
+ * <C*b,b>) and the convergence threshold exactly as hypre_PCGSolve does, the
+ * initial residual r = b - A*x, and prints the header of the convergence
+ * history. Returns 1 if the solve is already finished (b = 0) or the input
+ * is invalid.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_PCGSetTol( void   *pcg_vdata,
-                 HYPRE_Real  tol       )
+static HYPRE_Int
+hypre_PCGSolveInit( void       *pcg_vdata,
+                    void       *A,
+                    void       *b,
+                    void       *x,
+                    HYPRE_Int   my_id,
+                    HYPRE_Real *bi_prod_ptr,
+                    HYPRE_Real *eps_ptr )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
 
-   (pcg_data -> tol) = tol;
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   void           *p            = (pcg_data -> p);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
 
-   return hypre_error_flag;
-}
+   HYPRE_Real      bi_prod;
+   HYPRE_Real      ieee_check = 0.;
 
-HYPRE_Int
-hypre_PCGGetTol( void   *pcg_vdata,
-                 HYPRE_Real * tol       )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<b,b>: %e\n", bi_prod);
+      }
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("<C*b,b>: %e\n", bi_prod);
+      }
+   }
 
-   *tol = (pcg_data -> tol);
+   if (bi_prod != 0.) { ieee_check = bi_prod / bi_prod; } /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "INFs and/or NaNs detected in input in PCG");
 
-   return hypre_error_flag;
-}
-/*--------------------------------------------------------------------------
- * hypre_PCGSetAbsoluteTol, hypre_PCGGetAbsoluteTol
- *--------------------------------------------------------------------------*/
+      return 1;
+   }
 
-HYPRE_Int
-hypre_PCGSetAbsoluteTol( void   *pcg_vdata,
-                         HYPRE_Real  a_tol       )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   *eps_ptr = r_tol * r_tol;
+   if ( bi_prod > 0.0 )
+   {
+      if ( stop_crit && !rel_change && atolf <= 0 ) /* pure absolute tolerance */
+      {
+         *eps_ptr = *eps_ptr / bi_prod;
+      }
+      else if ( atolf > 0 ) /* mixed relative and absolute tolerance */
+      {
+         bi_prod += atolf;
+      }
+      else
+      {
+         *eps_ptr = hypre_max(r_tol * r_tol, a_tol * a_tol / bi_prod);
+      }
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging > 0 || print_level > 0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      (pcg_data -> num_iterations)    = 0;
+      (pcg_data -> rel_residual_norm) = 0.0;
 
-   (pcg_data -> a_tol) = a_tol;
+      return 1;
+   }
 
-   return hypre_error_flag;
-}
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
 
-HYPRE_Int
-hypre_PCGGetAbsoluteTol( void   *pcg_vdata,
-                         HYPRE_Real * a_tol       )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
 
-   *a_tol = (pcg_data -> a_tol);
+   *bi_prod_ptr = bi_prod;
 
-   return hypre_error_flag;
+   return 0;
 }
 
 /*--------------------------------------------------------------------------
- * hypre_PCGSetAbsoluteTolFactor, hypre_PCGGetAbsoluteTolFactor
+ * hypre_PCGBlockInnerProdStart, hypre_PCGBlockInnerProdWait
+ *
+ * result[i] = <x[i],y[i]> for i < n, with a single non-blocking reduction if
+ * the interface provides one. Otherwise the products are computed right away
+ * and *request is set to NULL.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_PCGSetAbsoluteTolFactor( void   *pcg_vdata,
-                               HYPRE_Real  atolf   )
+static HYPRE_Int
+hypre_PCGBlockInnerProdStart( hypre_PCGFunctions  *pcg_functions,
+                              HYPRE_Int            n,
+                              void               **x,
+                              void               **y,
+                              HYPRE_Real          *result,
+                              void               **request )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   HYPRE_Int i;
 
-   (pcg_data -> atolf) = atolf;
+   *request = NULL;
+   if ((pcg_functions -> IBlockInnerProd) && (pcg_functions -> IBlockInnerProdWait))
+   {
+      (*(pcg_functions->IBlockInnerProd))(n, x, y, result, request);
+   }
+   else if (pcg_functions -> BlockInnerProd)
+   {
+      (*(pcg_functions->BlockInnerProd))(n, x, y, result);
+   }
+   else
+   {
+      for (i = 0; i < n; i++)
+      {
+         result[i] = (*(pcg_functions->InnerProd))(x[i], y[i]);
+      }
+   }
 
    return hypre_error_flag;
 }
 
-HYPRE_Int
-hypre_PCGGetAbsoluteTolFactor( void   *pcg_vdata,
-                               HYPRE_Real  * atolf   )
+static HYPRE_Int
+hypre_PCGBlockInnerProdWait( hypre_PCGFunctions *pcg_functions,
+                             void               *request )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
-
-   *atolf = (pcg_data -> atolf);
+   if (request)
+   {
+      (*(pcg_functions->IBlockInnerProdWait))(request);
+   }
 
    return hypre_error_flag;
 }
 
 /*--------------------------------------------------------------------------
- * hypre_PCGSetResidualTol, hypre_PCGGetResidualTol
+ * Small dense kernels for s-step PCG. Matrices are n x n, row-major.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_PCGSetResidualTol( void   *pcg_vdata,
-                         HYPRE_Real  rtol   )
+/* In-place Cholesky factorization A = L*L^T. Stops at the first pivot that
+   is small relative to the corresponding diagonal entry of A, and returns the
+   number of leading rows and columns that were factored. */
+static HYPRE_Int
+hypre_PCGSStepCholesky( HYPRE_Int   n,
+                        HYPRE_Real *A )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
-
-   (pcg_data -> rtol) = rtol;
-
-   return hypre_error_flag;
-}
+   HYPRE_Int  i, j, k;
+   HYPRE_Real sum;
 
-HYPRE_Int
-hypre_PCGGetResidualTol( void   *pcg_vdata,
-                         HYPRE_Real  * rtol   )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   for (j = 0; j < n; j++)
+   {
+      sum = A[j * n + j];
+      for (k = 0; k < j; k++)
+      {
+         sum -= A[j * n + k] * A[j * n + k];
+      }
+      if (!(sum > 1.0e4 * HYPRE_REAL_EPSILON * A[j * n + j]))
+      {
+         return j;
+      }
+      A[j * n + j] = hypre_sqrt(sum);
 
-   *rtol = (pcg_data -> rtol);
+      for (i = j + 1; i < n; i++)
+      {
+         sum = A[i * n + j];
+         for (k = 0; k < j; k++)
+         {
+            sum -= A[i * n + k] * A[j * n + k];
+         }
+         A[i * n + j] = sum / A[j * n + j];
+      }
+   }
 
-   return hypre_error_flag;
+   return n;
 }
 
-/*--------------------------------------------------------------------------
- * hypre_PCGSetConvergenceFactorTol, hypre_PCGGetConvergenceFactorTol
- *--------------------------------------------------------------------------*/
-
-HYPRE_Int
-hypre_PCGSetConvergenceFactorTol( void   *pcg_vdata,
-                                  HYPRE_Real  cf_tol   )
+/* Solves L*y = b in place */
+static void
+hypre_PCGSStepLowerSolve( HYPRE_Int   n,
+                          HYPRE_Real *L,
+                          HYPRE_Real *b )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
-
-   (pcg_data -> cf_tol) = cf_tol;
+   HYPRE_Int i, k;
 
-   return hypre_error_flag;
+   for (i = 0; i < n; i++)
+   {
+      for (k = 0; k < i; k++)
+      {
+         b[i] -= L[i * n + k] * b[k];
+      }
+      b[i] /= L[i * n + i];
+   }
 }
 
-HYPRE_Int
-hypre_PCGGetConvergenceFactorTol( void   *pcg_vdata,
-                                  HYPRE_Real * cf_tol   )
+/* Solves L*L^T*y = b in place */
+static void
+hypre_PCGSStepCholeskySolve( HYPRE_Int   n,
+                             HYPRE_Real *L,
+                             HYPRE_Real *b )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
-
-   *cf_tol = (pcg_data -> cf_tol);
+   HYPRE_Int i, k;
 
-   return hypre_error_flag;
+   hypre_PCGSStepLowerSolve(n, L, b);
+   for (i = n - 1; i >= 0; i--)
+   {
+      for (k = i + 1; k < n; k++)
+      {
+         b[i] -= L[k * n + i] * b[k];
+      }
+      b[i] /= L[i * n + i];
+   }
 }
 
 /*--------------------------------------------------------------------------
- * hypre_PCGSetMaxIter, hypre_PCGGetMaxIter
+ * hypre_PCGSStepRitzValues
+ *
+ * Computes up to m Ritz values of the preconditioned operator C*A from the
+ * Gram matrix G = V^T*A*V of a monomial basis V = [z, CAz, ..., (CA)^m z]
+ * (leading dimension ldg). The projected pencil is (H, M) with
+ * H(i,j) = G(i,j+1) and M(i,j) = G(i,j), which is reduced to a symmetric
+ * eigenproblem and solved with cyclic Jacobi rotations. If M is numerically
+ * singular, only its leading well-conditioned part is used. The values are
+ * returned in Leja order, which is the order used for the Newton basis.
+ * Returns the number of Ritz values, or 0 if they can not be used as shifts.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_PCGSetMaxIter( void *pcg_vdata,
-                     HYPRE_Int   max_iter  )
+static HYPRE_Int
+hypre_PCGSStepRitzValues( HYPRE_Int   m,
+                          HYPRE_Real *G,
+                          HYPRE_Int   ldg,
+                          HYPRE_Real *theta )
 {
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   HYPRE_Real *M, *S, *T, *col;
+   HYPRE_Real  off, apq, tau, t, c, sn, akp, akq, tmp, prod, best;
+   HYPRE_Int   i, j, k, p, q, sweep, ibest, ierr = 0;
 
-   (pcg_data -> max_iter) = max_iter;
+   M   = hypre_CTAlloc(HYPRE_Real, m * m, HYPRE_MEMORY_HOST);
+   S   = hypre_CTAlloc(HYPRE_Real, m * m, HYPRE_MEMORY_HOST);
+   T   = hypre_CTAlloc(HYPRE_Real, m * m, HYPRE_MEMORY_HOST);
+   col = hypre_CTAlloc(HYPRE_Real, m, HYPRE_MEMORY_HOST);
 
-   return hypre_error_flag;
-}
+   for (i = 0; i < m; i++)
+   {
+      for (j = 0; j < m; j++)
+      {
+         M[i * m + j] = G[i * ldg + j];
+      }
+   }
 
-HYPRE_Int
-hypre_PCGGetMaxIter( void *pcg_vdata,
-                     HYPRE_Int * max_iter  )
-{
-   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+   k = hypre_PCGSStepCholesky(m, M);
+   if (k < m)
+   {
+      m = k;
+      for (i = 0; i < m; i++)
+      {
+         for (j = 0; j < m; j++)
+         {
+            M[i * m + j] = G[i * ldg + j];
+         }
+      }
+      hypre_PCGSStepCholesky(m, M);
+   }
 
+   if (m == 0)
+   {
+      ierr = 1;
+   }
+   else
+   {
+      /* S = L^{-1} H L^{-T}: T = (L^{-1} H)^T = H L^{-T}, then apply
+         L^{-1} to the columns of T */
+      for (j = 0; j < m; j++)
+      {
+         for (i = 0; i < m; i++)
+         {
+            col[i] = G[i * ldg + j + 1];
+         }
+         hypre_PCGSStepLowerSolve(m, M, col);
+         for (i = 0; i < m; i++)
+         {
+            T[j * m + i] = col[i];
+         }
+      }
+      for (j = 0; j < m; j++)
+      {
+         for (i = 0; i < m; i++)
+         {
+            col[i] = T[i * m + j];
+         }
+         hypre_PCGSStepLowerSolve(m, M, col);
+         for (i = 0; i < m; i++)
+         {
+            S[j * m + i] = col[i];
+         }
+      }
+      for (i = 0; i < m; i++)
+      {
+         for (j = i + 1; j < m; j++)
+         {
+            tmp = 0.5 * (S[i * m + j] + S[j * m + i]);
+            S[i * m + j] = S[j * m + i] = tmp;
+         }
+      }
 
-   *max_iter = (pcg_data -> max_iter);
+      /* cyclic Jacobi */
+      for (sweep = 0; sweep < 50; sweep++)
+      {
+         off = 0.0;
+         tmp = 0.0;
+         for (i = 0; i < m; i++)
+         {
+            tmp += S[i * m + i] * S[i * m + i];
+            for (j = i + 1; j < m; j++)
+            {
+               off += S[i * m + j] * S[i * m + j];
+            }
+         }
+         if (off <= HYPRE_REAL_EPSILON * HYPRE_REAL_EPSILON * tmp)
+         {
+            break;
+         }
 
-   return hypre_error_flag;
-}
+         for (p = 0; p < m - 1; p++)
+         {
+            for (q = p + 1; q < m; q++)
+            {
+               apq = S[p * m + q];
+               if (apq == 0.0)
+               {
+                  continue;
+               }
+               tau = (S[q * m + q] - S[p * m + p]) / (2.0 * apq);
+               t   = (tau >= 0.0 ? 1.0 : -1.0) / (hypre_abs(tau) + hypre_sqrt(1.0 + tau * tau));
+               c   = 1.0 / hypre_sqrt(1.0 + t * t);
+               sn  = t * c;
+               for (k = 0; k < m; k++)
+               {
+                  akp = S[k * m + p];
+                  akq = S[k * m + q];
+                  S[k * m + p] = c * akp - sn * akq;
+                  S[k * m + q] = sn * akp + c * akq;
+               }
+               for (k = 0; k < m; k++)
+               {
+                  akp = S[p * m + k];
+                  akq = S[q * m + k];
+                  S[p * m + k] = c * akp - sn * akq;
+                  S[q * m + k] = sn * akp + c * akq;
+               }
+            }
+         }
+      }
+
+      for (i = 0; i < m; i++)
+      {
+         theta[i] = S[i * m + i];
+         if (!(theta[i] > 0.0))
+         {
+            ierr = 1;
+         }
+      }
+   }
+
+   /* Leja ordering: start with the largest value, then repeatedly pick the
+      value that maximizes the product of distances to the chosen ones */
+   if (!ierr)
+   {
+      for (k = 0; k < m; k++)
+      {
+         ibest = k;
+         best  = -1.0;
+         for (i = k; i < m; i++)
+         {
+            if (k == 0)
+            {
+               prod = theta[i];
+            }
+            else
+            {
+               prod = 1.0;
+               for (j = 0; j < k; j++)
+               {
+                  prod *= hypre_abs(theta[i] - theta[j]);
+               }
+            }
+            if (prod > best)
+            {
+               best  = prod;
+               ibest = i;
+            }
+         }
+         tmp          = theta[k];
+         theta[k]     = theta[ibest];
+         theta[ibest] = tmp;
+      }
+   }
+
+   hypre_TFree(M, HYPRE_MEMORY_HOST);
+   hypre_TFree(S, HYPRE_MEMORY_HOST);
+   hypre_TFree(T, HYPRE_MEMORY_HOST);
+   hypre_TFree(col, HYPRE_MEMORY_HOST);
+
+   return ierr ? 0 : m;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSStepCreateVectors, hypre_PCGSStepDestroyVectors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSStepDestroyVectors( void *pcg_vdata )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           i;
+
+   for (i = 0; i < (pcg_data -> sstep_nvecs); i++)
+   {
+      (*(pcg_functions->DestroyVector))(pcg_data -> sstep_V[i]);
+      (*(pcg_functions->DestroyVector))(pcg_data -> sstep_AV[i]);
+      (*(pcg_functions->DestroyVector))(pcg_data -> sstep_P[i]);
+      (*(pcg_functions->DestroyVector))(pcg_data -> sstep_AP[i]);
+   }
+   hypre_TFreeF( pcg_data -> sstep_V, pcg_functions );
+   hypre_TFreeF( pcg_data -> sstep_AV, pcg_functions );
+   hypre_TFreeF( pcg_data -> sstep_P, pcg_functions );
+   hypre_TFreeF( pcg_data -> sstep_AP, pcg_functions );
+   hypre_TFreeF( pcg_data -> sstep_shifts, pcg_functions );
+   (pcg_data -> sstep_nvecs) = 0;
+   (pcg_data -> sstep_num_shifts) = 0;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGSStepCreateVectors( void *pcg_vdata,
+                             void *b,
+                             void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int           sstep         = (pcg_data -> sstep);
+   HYPRE_Int           i;
+
+   if ((pcg_data -> sstep_nvecs) == sstep)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_PCGSStepDestroyVectors(pcg_vdata);
+
+   (pcg_data -> sstep_V)      = hypre_CTAllocF(void *, sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   (pcg_data -> sstep_AV)     = hypre_CTAllocF(void *, sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   (pcg_data -> sstep_P)      = hypre_CTAllocF(void *, sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   (pcg_data -> sstep_AP)     = hypre_CTAllocF(void *, sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   (pcg_data -> sstep_shifts) = hypre_CTAllocF(HYPRE_Real, sstep, pcg_functions,
+                                               HYPRE_MEMORY_HOST);
+   for (i = 0; i < sstep; i++)
+   {
+      (pcg_data -> sstep_V[i])  = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> sstep_AV[i]) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> sstep_P[i])  = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> sstep_AP[i]) = (*(pcg_functions->CreateVector))(b);
+   }
+   (pcg_data -> sstep_nvecs) = sstep;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSStepSolve
+ *
+ * Communication-avoiding (s-step) PCG. Each outer step generates the basis
+ * V = [z, (CA)z, ..., (CA)^{s-1}z] of the preconditioned residual z = C*r
+ * (monomial basis), or with (CA - theta_j I) factors using Leja ordered Ritz
+ * values from the first outer step (Newton basis). The block is then made
+ * A-conjugate to the previous one, and the s coefficients are obtained from
+ * the s x s projected system. All inner products of an outer step, i.e.
+ * V^T*r, V^T*A*V and (A*P)^T*V, are computed with one block reduction if
+ * the interface provides BlockInnerProd. In exact arithmetic the iterates
+ * coincide with every s-th iterate of PCG.
+ *
+ * If the basis of an outer step is numerically rank deficient, the step is
+ * truncated to its leading well-conditioned part and s is reduced
+ * accordingly for the rest of the solve.
+ *
+ * The convergence test is the same as in hypre_PCGSolve, but it is only
+ * applied every s iterations. The relative change, residual tolerance,
+ * periodic residual recomputation and flexible options are not supported
+ * and fall back to hypre_PCGSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSStepSolve( void *pcg_vdata,
+                     void *A,
+                     void *b,
+                     void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   HYPRE_Int       sstep        = (pcg_data -> sstep);
+   HYPRE_Int       sstep_basis  = (pcg_data -> sstep_basis);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void          **V, **AV, **P, **AP, **tmp;
+   void          **xs, **ys;
+   void           *request;
+   HYPRE_Real     *shifts;
+   HYPRE_Real     *prods, *G, *C, *W, *W_old, *B, *g, *col;
+   HYPRE_Real      bi_prod, eps, gamma, rate;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Int       num_shifts, max_prods, num_prods;
+   HYPRE_Int       s_cur, sk, sk_old = 0, ng, iter = 0, block = 0;
+   HYPRE_Int       i, j, l;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   hypre_PCGSStepCreateVectors(pcg_vdata, b, x);
+   V      = (pcg_data -> sstep_V);
+   AV     = (pcg_data -> sstep_AV);
+   P      = (pcg_data -> sstep_P);
+   AP     = (pcg_data -> sstep_AP);
+   shifts = (pcg_data -> sstep_shifts);
+
+   /* the operator may have changed since the last solve */
+   num_shifts = 0;
+   s_cur      = sstep;
+
+   if (hypre_PCGSolveInit(pcg_vdata, A, b, x, my_id, &bi_prod, &eps))
+   {
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Workspace for the block reductions and the small dense systems
+    *-----------------------------------------------------------------------*/
+
+   max_prods = 1 + sstep + sstep * (sstep + 1) / 2 + sstep * sstep;
+   xs    = hypre_CTAllocF(void *, max_prods, pcg_functions, HYPRE_MEMORY_HOST);
+   ys    = hypre_CTAllocF(void *, max_prods, pcg_functions, HYPRE_MEMORY_HOST);
+   prods = hypre_CTAllocF(HYPRE_Real, max_prods, pcg_functions, HYPRE_MEMORY_HOST);
+   G     = hypre_CTAllocF(HYPRE_Real, sstep * sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   C     = hypre_CTAllocF(HYPRE_Real, sstep * sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   B     = hypre_CTAllocF(HYPRE_Real, sstep * sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   W     = hypre_CTAllocF(HYPRE_Real, sstep * sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   W_old = hypre_CTAllocF(HYPRE_Real, sstep * sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   g     = hypre_CTAllocF(HYPRE_Real, sstep, pcg_functions, HYPRE_MEMORY_HOST);
+   col   = hypre_CTAllocF(HYPRE_Real, sstep, pcg_functions, HYPRE_MEMORY_HOST);
+
+   while (1)
+   {
+      /* the last outer step is shortened to max_iter; sk = 0 only
+         evaluates the final residual norm */
+      sk = hypre_min(s_cur, max_iter - iter);
+      ng = hypre_max(sk, 1);
+
+      /*--------------------------------------------------------------------
+       * Matrix powers: V(0) = C*r, V(j+1) = C*A*V(j) - shift(j)*V(j)
+       *--------------------------------------------------------------------*/
+
+      (*(pcg_functions->ClearVector))(V[0]);
+      precond(precond_data, A, r, V[0]);
+      for (j = 0; j < sk; j++)
+      {
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, V[j], 0.0, AV[j]);
+         if (j + 1 < sk)
+         {
+            (*(pcg_functions->ClearVector))(V[j + 1]);
+            precond(precond_data, A, AV[j], V[j + 1]);
+            if (num_shifts > 0)
+            {
+               (*(pcg_functions->Axpy))(-shifts[j % num_shifts], V[j], V[j + 1]);
+            }
+         }
+      }
+
+      /*--------------------------------------------------------------------
+       * Block reduction: [<r,r>], V^T*r, V^T*A*V (upper part), (A*P)^T*V
+       *--------------------------------------------------------------------*/
+
+      num_prods = 0;
+      if (two_norm)
+      {
+         xs[num_prods] = r;  ys[num_prods++] = r;
+      }
+      for (i = 0; i < ng; i++)
+      {
+         xs[num_prods] = V[i];  ys[num_prods++] = r;
+      }
+      for (i = 0; i < sk; i++)
+      {
+         for (j = i; j < sk; j++)
+         {
+            xs[num_prods] = V[i];  ys[num_prods++] = AV[j];
+         }
+      }
+      for (i = 0; i < sk_old; i++)
+      {
+         for (j = 0; j < sk; j++)
+         {
+            xs[num_prods] = AP[i];  ys[num_prods++] = V[j];
+         }
+      }
+
+      hypre_PCGBlockInnerProdStart(pcg_functions, num_prods, xs, ys, prods, &request);
+      hypre_PCGBlockInnerProdWait(pcg_functions, request);
+
+      num_prods = 0;
+      if (two_norm)
+      {
+         i_prod = prods[num_prods++];
+      }
+      for (i = 0; i < ng; i++)
+      {
+         g[i] = prods[num_prods++];
+      }
+      for (i = 0; i < sk; i++)
+      {
+         for (j = i; j < sk; j++)
+         {
+            G[i * sk + j] = G[j * sk + i] = prods[num_prods++];
+         }
+      }
+      for (i = 0; i < sk_old; i++)
+      {
+         for (j = 0; j < sk; j++)
+         {
+            C[i * sk + j] = prods[num_prods++];
+         }
+      }
+
+      /* gamma = <C*r,r> */
+      gamma = g[0];
+      if (!two_norm)
+      {
+         i_prod = gamma;
+      }
+
+      if (block == 0)
+      {
+         if (gamma != 0.) { ieee_check = gamma / gamma; } /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "INFs and/or NaNs detected in input in s-step PCG");
+            break;
+         }
+      }
+
+      /*--------------------------------------------------------------------
+       * Logging and convergence test for the residual of the last step
+       *--------------------------------------------------------------------*/
+
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[iter]     = hypre_sqrt(i_prod);
+         rel_norms[iter] = bi_prod ? hypre_sqrt(i_prod / bi_prod) : 0;
+      }
+      if ( print_level > 1 && my_id == 0 && block > 0 )
+      {
+         rate = norms[iter - sk_old] > 0.0 ?
+                hypre_pow(norms[iter] / norms[iter - sk_old], 1.0 / sk_old) : 0.0;
+         hypre_printf("% 5d    %e    %f    %e\n", iter, norms[iter], rate, rel_norms[iter]);
+      }
+
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+      if (sk == 0)
+      {
+         break;
+      }
+      if (!(gamma > 0.0))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero gamma value in s-step PCG");
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * A-conjugation against the previous block:
+       *    B = (P^T*A*P)^{-1} * (A*P)^T*V,  V -= P*B,  A*V -= A*P*B
+       * and the projected matrix W = V^T*A*V - C^T*B of the new block.
+       *--------------------------------------------------------------------*/
+
+      for (i = 0; i < sk * sk; i++)
+      {
+         W[i] = G[i];
+      }
+      if (sk_old > 0)
+      {
+         for (j = 0; j < sk; j++)
+         {
+            for (i = 0; i < sk_old; i++)
+            {
+               col[i] = C[i * sk + j];
+            }
+            hypre_PCGSStepCholeskySolve(sk_old, W_old, col);
+            for (i = 0; i < sk_old; i++)
+            {
+               B[i * sk + j] = col[i];
+            }
+         }
+
+         for (j = 0; j < sk; j++)
+         {
+            for (i = 0; i < sk_old; i++)
+            {
+               (*(pcg_functions->Axpy))(-B[i * sk + j], P[i], V[j]);
+               (*(pcg_functions->Axpy))(-B[i * sk + j], AP[i], AV[j]);
+            }
+         }
+
+         for (i = 0; i < sk; i++)
+         {
+            for (j = 0; j < sk; j++)
+            {
+               for (l = 0; l < sk_old; l++)
+               {
+                  W[i * sk + j] -= C[l * sk + i] * B[l * sk + j];
+               }
+            }
+         }
+         for (i = 0; i < sk; i++)
+         {
+            for (j = i + 1; j < sk; j++)
+            {
+               W[i * sk + j] = W[j * sk + i] = 0.5 * (W[i * sk + j] + W[j * sk + i]);
+            }
+         }
+      }
+
+      /* Newton basis shifts from the first (monomial) block */
+      if (block == 0 && sstep_basis == 1 && sk > 1)
+      {
+         num_shifts = hypre_PCGSStepRitzValues(sk - 1, G, sk, shifts);
+      }
+
+      /*--------------------------------------------------------------------
+       * Solve W*a = V^T*r (P^T*r = 0 for the previous block) and update.
+       * If the basis is numerically rank deficient, only its leading
+       * well-conditioned part is used for this step.
+       *--------------------------------------------------------------------*/
+
+      l = hypre_PCGSStepCholesky(sk, W);
+      if (l == 0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV,
+                           "Numerically rank deficient basis in s-step PCG; reduce s or use the Newton basis");
+         break;
+      }
+      if (l < sk)
+      {
+         /* continue with the smaller step size */
+         s_cur = l;
+         for (i = 0; i < l; i++)
+         {
+            for (j = 0; j < l; j++)
+            {
+               W[i * l + j] = W[i * sk + j];
+            }
+         }
+         sk = l;
+      }
+      for (i = 0; i < sk; i++)
+      {
+         col[i] = g[i];
+      }
+      hypre_PCGSStepCholeskySolve(sk, W, col);
+
+      for (j = 0; j < sk; j++)
+      {
+         (*(pcg_functions->Axpy))(col[j], V[j], x);
+         (*(pcg_functions->Axpy))(-col[j], AV[j], r);
+      }
+
+      /* the new block becomes the previous one */
+      tmp = P;  P = V;  V = tmp;
+      tmp = AP; AP = AV; AV = tmp;
+      for (i = 0; i < sk * sk; i++)
+      {
+         W_old[i] = W[i];
+      }
+      sk_old = sk;
+
+      iter += sk;
+      block++;
+   }
+
+   /* keep the vector arrays consistent with the swapped pointers */
+   (pcg_data -> sstep_V)  = V;
+   (pcg_data -> sstep_AV) = AV;
+   (pcg_data -> sstep_P)  = P;
+   (pcg_data -> sstep_AP) = AP;
+   (pcg_data -> sstep_num_shifts) = num_shifts;
+
+   hypre_TFreeF(xs, pcg_functions);
+   hypre_TFreeF(ys, pcg_functions);
+   hypre_TFreeF(prods, pcg_functions);
+   hypre_TFreeF(G, pcg_functions);
+   hypre_TFreeF(C, pcg_functions);
+   hypre_TFreeF(B, pcg_functions);
+   hypre_TFreeF(W, pcg_functions);
+   hypre_TFreeF(W_old, pcg_functions);
+   hypre_TFreeF(g, pcg_functions);
+   hypre_TFreeF(col, pcg_functions);
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (iter >= max_iter && (i_prod / bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations)    = iter;
+   (pcg_data -> rel_residual_norm) = hypre_sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGPipelinedSolve
+ *
+ * Pipelined PCG (Ghysels and Vanroose). The recurrences for u = C*r,
+ * w = A*u and for the images of the search direction are carried along, so
+ * that the inner products <r,u>, <w,u> (and <r,r>) of an iteration do not
+ * depend on the preconditioner and matrix-vector product of the same
+ * iteration. They are reduced with a single non-blocking reduction if the
+ * interface provides IBlockInnerProd, and the reduction is overlapped with
+ * the preconditioner application m = C*w and the product n = A*m.
+ *
+ * The iterates coincide with those of hypre_PCGSolve in exact arithmetic,
+ * but rounding errors in the extra recurrences make the attainable accuracy
+ * somewhat lower. The relative change, residual tolerance, periodic residual
+ * recomputation and flexible options are not supported and fall back to
+ * hypre_PCGSolve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGPipelinedSolve( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*, void*, void*, void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *u, *w, *m, *n, *q, *z;
+   void           *xs[3], *ys[3];
+   void           *request;
+   HYPRE_Real      prods[3];
+   HYPRE_Real      bi_prod, eps, gamma, delta, alpha, beta;
+   HYPRE_Real      gamma_old = 0.0, alpha_old = 0.0;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Int       num_prods, iter = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A, &my_id, &num_procs);
+
+   if ((pcg_data -> pipe_vecs) == NULL)
+   {
+      (pcg_data -> pipe_vecs) = hypre_CTAllocF(void *, 6, pcg_functions, HYPRE_MEMORY_HOST);
+      (pcg_data -> pipe_vecs)[0] = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> pipe_vecs)[1] = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> pipe_vecs)[2] = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> pipe_vecs)[3] = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> pipe_vecs)[4] = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> pipe_vecs)[5] = (*(pcg_functions->CreateVector))(b);
+   }
+   u = (pcg_data -> pipe_vecs)[0];
+   w = (pcg_data -> pipe_vecs)[1];
+   m = (pcg_data -> pipe_vecs)[2];
+   n = (pcg_data -> pipe_vecs)[3];
+   q = (pcg_data -> pipe_vecs)[4];
+   z = (pcg_data -> pipe_vecs)[5];
+
+   if (hypre_PCGSolveInit(pcg_vdata, A, b, x, my_id, &bi_prod, &eps))
+   {
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   /* u = C*r, w = A*u */
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   while (1)
+   {
+      /* start the reduction of gamma = <r,u>, delta = <w,u> [, <r,r>] */
+      xs[0] = r;  ys[0] = u;
+      xs[1] = w;  ys[1] = u;
+      num_prods = 2;
+      if (two_norm)
+      {
+         xs[2] = r;  ys[2] = r;
+         num_prods = 3;
+      }
+      hypre_PCGBlockInnerProdStart(pcg_functions, num_prods, xs, ys, prods, &request);
+
+      /* overlapped with the reduction: m = C*w, n = A*m */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      hypre_PCGBlockInnerProdWait(pcg_functions, request);
+
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      if (iter == 0)
+      {
+         if (i_prod != 0.) { ieee_check = i_prod / i_prod; } /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "INFs and/or NaNs detected in input in pipelined PCG");
+            break;
+         }
+      }
+
+      if ( logging > 0 || print_level > 0 )
+      {
+         norms[iter]     = hypre_sqrt(i_prod);
+         rel_norms[iter] = bi_prod ? hypre_sqrt(i_prod / bi_prod) : 0;
+      }
+      if ( print_level > 1 && my_id == 0 && iter > 0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", iter, norms[iter],
+                      norms[iter - 1] ? norms[iter] / norms[iter - 1] : 0.0, rel_norms[iter]);
+      }
+
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+      if (iter >= max_iter)
+      {
+         break;
+      }
+      if (!(gamma > 0.0))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero gamma value in pipelined PCG");
+         break;
+      }
+
+      if (iter == 0)
+      {
+         beta  = 0.0;
+         alpha = gamma / delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         alpha = gamma / (delta - beta * gamma / alpha_old);
+      }
+      if (!(alpha > 0.0))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Negative or zero alpha value in pipelined PCG");
+         break;
+      }
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (iter == 0)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x += alpha*p, r -= alpha*s, u -= alpha*q, w -= alpha*z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+      iter++;
+   }
+
+   if ( print_level > 1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   if (iter >= max_iter && (i_prod / bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      char msg[1024];
+      hypre_sprintf(msg, "Reached max iterations %d in PCG before convergence", max_iter);
+      hypre_error_w_msg(HYPRE_ERROR_CONV, msg);
+   }
+
+   (pcg_data -> num_iterations)    = iter;
+   (pcg_data -> rel_residual_norm) = hypre_sqrt(i_prod / bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetTol, hypre_PCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetTol( void   *pcg_vdata,
+                 HYPRE_Real  tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetTol( void   *pcg_vdata,
+                 HYPRE_Real * tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *tol = (pcg_data -> tol);
+
+   return hypre_error_flag;
+}
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetAbsoluteTol, hypre_PCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetAbsoluteTol( void   *pcg_vdata,
+                         HYPRE_Real  a_tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetAbsoluteTol( void   *pcg_vdata,
+                         HYPRE_Real * a_tol       )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *a_tol = (pcg_data -> a_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetAbsoluteTolFactor, hypre_PCGGetAbsoluteTolFactor
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetAbsoluteTolFactor( void   *pcg_vdata,
+                               HYPRE_Real  atolf   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> atolf) = atolf;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetAbsoluteTolFactor( void   *pcg_vdata,
+                               HYPRE_Real  * atolf   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *atolf = (pcg_data -> atolf);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetResidualTol, hypre_PCGGetResidualTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetResidualTol( void   *pcg_vdata,
+                         HYPRE_Real  rtol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> rtol) = rtol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetResidualTol( void   *pcg_vdata,
+                         HYPRE_Real  * rtol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *rtol = (pcg_data -> rtol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetConvergenceFactorTol, hypre_PCGGetConvergenceFactorTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetConvergenceFactorTol( void   *pcg_vdata,
+                                  HYPRE_Real  cf_tol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> cf_tol) = cf_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetConvergenceFactorTol( void   *pcg_vdata,
+                                  HYPRE_Real * cf_tol   )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *cf_tol = (pcg_data -> cf_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetMaxIter, hypre_PCGGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetMaxIter( void *pcg_vdata,
+                     HYPRE_Int   max_iter  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetMaxIter( void *pcg_vdata,
+                     HYPRE_Int * max_iter  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+
+   *max_iter = (pcg_data -> max_iter);
+
+   return hypre_error_flag;
+}
 
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTwoNorm, hypre_PCGGetTwoNorm
@@ -1357,6 +2496,100 @@ hypre_PCGGetFlex( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetSStep, hypre_PCGGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetSStep( void *pcg_vdata,
+                   HYPRE_Int   sstep  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   if (sstep < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> sstep) = sstep;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetSStep( void *pcg_vdata,
+                   HYPRE_Int * sstep  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+
+   *sstep = (pcg_data -> sstep);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetSStepBasis, hypre_PCGGetSStepBasis
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetSStepBasis( void *pcg_vdata,
+                        HYPRE_Int   sstep_basis  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   if (sstep_basis < 0 || sstep_basis > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   (pcg_data -> sstep_basis) = sstep_basis;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetSStepBasis( void *pcg_vdata,
+                        HYPRE_Int * sstep_basis  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+
+   *sstep_basis = (pcg_data -> sstep_basis);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetPrecond
  *--------------------------------------------------------------------------*/
@@ -63,6 +63,12 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional: result[i] = <x[i],y[i]> for i < n with a single reduction */
+   HYPRE_Int    (*BlockInnerProd)( HYPRE_Int n, void **x, void **y, HYPRE_Real *result );
+   /* optional: non-blocking BlockInnerProd; result is valid after IBlockInnerProdWait */
+   HYPRE_Int    (*IBlockInnerProd)( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                    void **request );
+   HYPRE_Int    (*IBlockInnerProdWait)( void *request );
 
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
@@ -122,6 +128,9 @@ typedef struct
    HYPRE_Int    hybrid;
    HYPRE_Int    skip_break;
    HYPRE_Int    flex;
+   HYPRE_Int    sstep;       /* s-step PCG if > 1 */
+   HYPRE_Int    sstep_basis; /* 0: monomial, 1: Newton */
+   HYPRE_Int    pipelined;   /* pipelined PCG if > 0 */
 
    void    *A;
    void    *p;
@@ -131,6 +140,19 @@ typedef struct
    void    *r_old; /* old residual needed for flexible CG, PR method */
    void    *v; /* work vector only needed if recompute_residual_p uis used */
 
+   /* s-step PCG: Krylov basis, previous direction block, their images
+      under A, and the Newton basis shifts */
+   HYPRE_Int    sstep_nvecs;
+   void       **sstep_V;
+   void       **sstep_AV;
+   void       **sstep_P;
+   void       **sstep_AP;
+   HYPRE_Real  *sstep_shifts;
+   HYPRE_Int    sstep_num_shifts;
+
+   /* pipelined PCG: auxiliary recurrence vectors u, w, m, n, q, z */
+   void       **pipe_vecs;
+
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
    void      *precond_data;
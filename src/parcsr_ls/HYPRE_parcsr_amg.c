@@ -56,6 +56,28 @@ HYPRE_BoomerAMGSetup( HYPRE_Solver solver,
                                   (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetupNumericOnly
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetupNumericOnly( HYPRE_Solver solver,
+                                 HYPRE_ParCSRMatrix A,
+                                 HYPRE_ParVector b,
+                                 HYPRE_ParVector x      )
+{
+   if (!A)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_BoomerAMGSetupNumericOnly( (void *) solver,
+                                             (hypre_ParCSRMatrix *) A,
+                                             (hypre_ParVector *) b,
+                                             (hypre_ParVector *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSolve
  *--------------------------------------------------------------------------*/
@@ -1072,6 +1094,28 @@ HYPRE_BoomerAMGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGGetRelResidualNorm( (void *) solver, rel_resid_norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetComponentNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetComponentNumIterations( HYPRE_Solver  solver,
+                                          HYPRE_Int    *num_iterations )
+{
+   return ( hypre_BoomerAMGGetComponentNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGGetComponentRelResidualNorms
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGGetComponentRelResidualNorms( HYPRE_Solver  solver,
+                                             HYPRE_Real   *rel_resid_norms )
+{
+   return ( hypre_BoomerAMGGetComponentRelResidualNorms( (void *) solver, rel_resid_norms ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetVariant, HYPRE_BoomerAMGGetVariant
  *--------------------------------------------------------------------------*/
@@ -2172,6 +2216,28 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetKeepStrength
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetKeepStrength (HYPRE_Solver solver,
+                                HYPRE_Int    keep_strength)
+{
+   return (hypre_BoomerAMGSetKeepStrength ( (void *) solver, keep_strength ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSinglePrecisionLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSinglePrecisionLevel (HYPRE_Solver solver,
+                                        HYPRE_Int    sp_level)
+{
+   return (hypre_BoomerAMGSetSinglePrecisionLevel ( (void *) solver, sp_level ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
@@ -41,6 +41,9 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup,
          hypre_ParKrylovIdentity );
+   /* non-blocking reductions for pipelined GMRES */
+   gmres_functions->IBlockInnerProd     = hypre_ParKrylovIBlockInnerProd;
+   gmres_functions->IBlockInnerProdWait = hypre_ParKrylovIBlockInnerProdWait;
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
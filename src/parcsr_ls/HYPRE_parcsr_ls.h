@@ -93,6 +93,32 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Set up the BoomerAMG solver or preconditioner again for a matrix that
+ * has the same sparsity pattern and row partitioning as the matrix of the
+ * previous setup, but different values, e.g., in a time-stepping loop.
+ * The C/F splittings of the previous setup are reused, so the coarsening is
+ * skipped and the hierarchy keeps its levels and coarse grids; the
+ * interpolation weights, coarse grid operators and smoothers are recomputed.
+ * If the strength matrices were kept (see \e HYPRE_BoomerAMGSetKeepStrength),
+ * the strength of connection is not recomputed either, and the sparsity of
+ * the interpolation operators is the same as before unless they are
+ * truncated.
+ *
+ * Falls back to \e HYPRE_BoomerAMGSetup if there is no previous setup or
+ * the options used are not supported (nodal or block systems AMG, GSMG,
+ * aggressive coarsening, CR coarsening, interpolation vectors).
+ *
+ * @param solver [IN] object to be set up.
+ * @param A [IN] ParCSR matrix used to construct the solver/preconditioner.
+ * @param b Ignored by this function.
+ * @param x Ignored by this function.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetupNumericOnly(HYPRE_Solver       solver,
+                                          HYPRE_ParCSRMatrix A,
+                                          HYPRE_ParVector    b,
+                                          HYPRE_ParVector    x);
+
 /**
  * Solve the system or apply AMG as a preconditioner.
  * If used as a preconditioner, this function should be passed
@@ -165,6 +191,24 @@ HYPRE_Int HYPRE_BoomerAMGSetCumNnzAP(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
                                                       HYPRE_Real   *rel_resid_norm);
 
+/**
+ * Returns, for a solve with multicomponent vectors, the number of cycles after
+ * which each component reached the convergence tolerance. Components that did
+ * not converge report the total number of cycles. The array must have one
+ * entry per component.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetComponentNumIterations(HYPRE_Solver  solver,
+                                                   HYPRE_Int    *num_iterations);
+
+/**
+ * Returns, for a solve with multicomponent vectors, the final relative residual
+ * norm of each component. The array must have one entry per component. The
+ * value returned by \e HYPRE\_BoomerAMGGetFinalRelativeResidualNorm is their
+ * maximum.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetComponentRelResidualNorms(HYPRE_Solver  solver,
+                                                      HYPRE_Real   *rel_resid_norms);
+
 /**
  * (Optional) Sets the size of the system of PDEs, if using the systems version.
  * The default is 1, i.e. a scalar system.
@@ -1379,6 +1423,30 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the strength matrices of all levels are kept
+ * after the setup, so that \e HYPRE_BoomerAMGSetupNumericOnly does not
+ * need to recompute them. This costs about the memory of the sparsity
+ * pattern of the matrices in the hierarchy. The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetKeepStrength(HYPRE_Solver solver,
+                                         HYPRE_Int    keep_strength);
+
+/**
+ * (Optional) If sp_level > 0, the coarse grid operators on levels
+ * sp_level and coarser, and the interpolation (and restriction) operators
+ * between them, are stored in single precision at the end of the setup,
+ * while vectors and arithmetic stay in double precision. This reduces the
+ * memory footprint and bandwidth of the solve phase. Levels whose smoother
+ * does not support single precision (supported are relax types 0, 3, 4, 6,
+ * 7, 8, 13, 14, 18, 88, 89 and, on the coarsest level, Gaussian elimination)
+ * or that use complex smoothers are kept in double precision. Only
+ * available on the host, and ignored by the additive cycles.
+ * The default is -1 (disabled).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel(HYPRE_Solver solver,
+                                                 HYPRE_Int    sp_level);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
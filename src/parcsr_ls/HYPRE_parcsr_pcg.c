@@ -33,6 +33,11 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   /* single reduction for the Gram matrices of s-step PCG, and non-blocking
+      reductions for pipelined PCG */
+   pcg_functions->BlockInnerProd      = hypre_ParKrylovBlockInnerProd;
+   pcg_functions->IBlockInnerProd     = hypre_ParKrylovIBlockInnerProd;
+   pcg_functions->IBlockInnerProdWait = hypre_ParKrylovIBlockInnerProdWait;
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
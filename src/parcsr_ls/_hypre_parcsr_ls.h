@@ -127,6 +127,9 @@ typedef struct
    hypre_ParCSRMatrix **P_array;
    hypre_ParCSRMatrix **R_array;
    hypre_IntArray     **CF_marker_array;
+   hypre_ParCSRMatrix **S_array;
+   hypre_ParCSRSpGEMMPlan **rap_plan_array;
+   HYPRE_Int            num_rap_plans;
    hypre_IntArray     **dof_func_array;
    HYPRE_Int          **dof_point_array;
    HYPRE_Int          **point_dof_map_array;
@@ -227,6 +230,11 @@ typedef struct
    HYPRE_Real       rel_resid_norm;
    hypre_ParVector *residual; /* available if logging>1 */
 
+   /* per-component convergence of the last multivector solve */
+   HYPRE_Int        num_components;
+   HYPRE_Int       *comp_num_iterations;
+   HYPRE_Real      *comp_rel_resid_norms;
+
    /* output params */
    HYPRE_Int      print_level;
    char           log_file_name[256];
@@ -290,6 +298,13 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* numeric-only re-setup (reuse of the C/F splittings and strength) */
+   HYPRE_Int keep_strength;
+   HYPRE_Int setup_numeric_only;
+
+   /* store operators on coarse levels in single precision */
+   HYPRE_Int single_precision_level;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -395,6 +410,9 @@ typedef struct
 
 /* data generated by the setup phase */
 #define hypre_ParAMGDataCFMarkerArray(amg_data) ((amg_data)-> CF_marker_array)
+#define hypre_ParAMGDataSArray(amg_data) ((amg_data)-> S_array)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)-> rap_plan_array)
+#define hypre_ParAMGDataNumRAPPlans(amg_data) ((amg_data)-> num_rap_plans)
 #define hypre_ParAMGDataAArray(amg_data) ((amg_data)->A_array)
 #define hypre_ParAMGDataFArray(amg_data) ((amg_data)->F_array)
 #define hypre_ParAMGDataUArray(amg_data) ((amg_data)->U_array)
@@ -492,6 +510,9 @@ typedef struct
 #endif
 #define hypre_ParAMGDataRelativeResidualNorm(amg_data) ((amg_data)->rel_resid_norm)
 #define hypre_ParAMGDataResidual(amg_data) ((amg_data)->residual)
+#define hypre_ParAMGDataNumComponents(amg_data) ((amg_data)->num_components)
+#define hypre_ParAMGDataCompNumIterations(amg_data) ((amg_data)->comp_num_iterations)
+#define hypre_ParAMGDataCompRelResidualNorms(amg_data) ((amg_data)->comp_rel_resid_norms)
 
 /* output parameters */
 #define hypre_ParAMGDataPrintLevel(amg_data) ((amg_data)->print_level)
@@ -560,6 +581,9 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataKeepStrength(amg_data) ((amg_data)->keep_strength)
+#define hypre_ParAMGDataSetupNumericOnly(amg_data) ((amg_data)->setup_numeric_only)
+#define hypre_ParAMGDataSinglePrecisionLevel(amg_data) ((amg_data)->single_precision_level)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -1838,6 +1862,8 @@ HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGSetupNumericOnly ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                            HYPRE_ParVector b, HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
@@ -1940,6 +1966,10 @@ HYPRE_Int HYPRE_BoomerAMGGetCumNumIterations ( HYPRE_Solver solver, HYPRE_Int *c
 HYPRE_Int HYPRE_BoomerAMGGetResidual ( HYPRE_Solver solver, HYPRE_ParVector *residual );
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm ( HYPRE_Solver solver,
                                                         HYPRE_Real *rel_resid_norm );
+HYPRE_Int HYPRE_BoomerAMGGetComponentNumIterations ( HYPRE_Solver solver,
+                                                     HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BoomerAMGGetComponentRelResidualNorms ( HYPRE_Solver solver,
+                                                        HYPRE_Real *rel_resid_norms );
 HYPRE_Int HYPRE_BoomerAMGSetVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGGetVariant ( HYPRE_Solver solver, HYPRE_Int *variant );
 HYPRE_Int HYPRE_BoomerAMGSetOverlap ( HYPRE_Solver solver, HYPRE_Int overlap );
@@ -2047,6 +2077,8 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetKeepStrength ( HYPRE_Solver solver, HYPRE_Int keep_strength );
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel ( HYPRE_Solver solver, HYPRE_Int sp_level );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -2604,6 +2636,8 @@ HYPRE_Int hypre_BoomerAMGGetNumIterations ( void *data, HYPRE_Int *num_iteration
 HYPRE_Int hypre_BoomerAMGGetCumNumIterations ( void *data, HYPRE_Int *cum_num_iterations );
 HYPRE_Int hypre_BoomerAMGGetResidual ( void *data, hypre_ParVector **resid );
 HYPRE_Int hypre_BoomerAMGGetRelResidualNorm ( void *data, HYPRE_Real *rel_resid_norm );
+HYPRE_Int hypre_BoomerAMGGetComponentNumIterations ( void *data, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BoomerAMGGetComponentRelResidualNorms ( void *data, HYPRE_Real *rel_resid_norms );
 HYPRE_Int hypre_BoomerAMGSetVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGGetVariant ( void *data, HYPRE_Int *variant );
 HYPRE_Int hypre_BoomerAMGSetOverlap ( void *data, HYPRE_Int overlap );
@@ -2674,6 +2708,8 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetKeepStrength ( void *data, HYPRE_Int keep_strength );
+HYPRE_Int hypre_BoomerAMGSetSinglePrecisionLevel ( void *data, HYPRE_Int sp_level );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2687,6 +2723,12 @@ HYPRE_Int hypre_BoomerAMGGetCumNnzAP ( void *data, HYPRE_Real *cum_nnz_AP );
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSetupNumericOnly ( void *amg_vdata, hypre_ParCSRMatrix *A,
+                                            hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSetupRAPPlan ( void *amg_vdata, HYPRE_Int level,
+                                        hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                        hypre_ParCSRMatrix **A_H_ptr );
+HYPRE_Int hypre_BoomerAMGSetupSinglePrecision ( void *amg_vdata );
 
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -3153,6 +3195,8 @@ HYPRE_Int hypre_GaussElimSolveDevice ( hypre_ParAMGData *amg_data, HYPRE_Int lev
 /* par_gauss_elim.c */
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
+HYPRE_Int hypre_GaussElimSolveMultiVec ( hypre_ParAMGData *amg_data, HYPRE_Int level,
+                                         HYPRE_Int solver_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
 
@@ -3160,6 +3204,10 @@ HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                  HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVecHost( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                            HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                            HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, HYPRE_Int GS_order,
+                                            HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq );
 HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                       HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                                       HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
@@ -3195,6 +3243,9 @@ HYPRE_Int hypre_BoomerAMGRelax6HybridSSOR( hypre_ParCSRMatrix *A, hypre_ParVecto
                                            HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                            hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
 
+HYPRE_Int hypre_BoomerAMGRelax7JacobiHost ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                            HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
+                                            hypre_ParVector *u, hypre_ParVector *Vtemp );
 HYPRE_Int hypre_BoomerAMGRelax7Jacobi( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                        HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
                                        hypre_ParVector *u, hypre_ParVector *Vtemp );
@@ -3454,6 +3505,10 @@ HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_I
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovIBlockInnerProd ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                          void **request );
+HYPRE_Int hypre_ParKrylovIBlockInnerProdWait ( void *request );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
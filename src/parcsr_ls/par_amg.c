@@ -472,6 +472,12 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataPArray(amg_data) = NULL;
    hypre_ParAMGDataRArray(amg_data) = NULL;
    hypre_ParAMGDataCFMarkerArray(amg_data) = NULL;
+   hypre_ParAMGDataSArray(amg_data) = NULL;
+   hypre_ParAMGDataRAPPlanArray(amg_data) = NULL;
+   hypre_ParAMGDataNumRAPPlans(amg_data) = 0;
+   hypre_ParAMGDataNumComponents(amg_data) = 0;
+   hypre_ParAMGDataCompNumIterations(amg_data) = NULL;
+   hypre_ParAMGDataCompRelResidualNorms(amg_data) = NULL;
    hypre_ParAMGDataVtemp(amg_data)  = NULL;
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
@@ -545,6 +551,9 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataKeepStrength(amg_data)      = 0;
+   hypre_ParAMGDataSetupNumericOnly(amg_data)  = 0;
+   hypre_ParAMGDataSinglePrecisionLevel(amg_data) = -1;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -791,6 +800,22 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataDofFuncArray(amg_data), HYPRE_MEMORY_HOST);
          hypre_ParAMGDataDofFuncArray(amg_data) = NULL;
       }
+      if (hypre_ParAMGDataSArray(amg_data))
+      {
+         for (i = 0; i < num_levels - 1; i++)
+         {
+            hypre_ParCSRMatrixDestroy(hypre_ParAMGDataSArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataSArray(amg_data), HYPRE_MEMORY_HOST);
+      }
+      if (hypre_ParAMGDataRAPPlanArray(amg_data))
+      {
+         for (i = 0; i < hypre_ParAMGDataNumRAPPlans(amg_data); i++)
+         {
+            hypre_ParCSRSpGEMMPlanDestroy(hypre_ParAMGDataRAPPlanArray(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataRAPPlanArray(amg_data), HYPRE_MEMORY_HOST);
+      }
       if (hypre_ParAMGDataRestriction(amg_data))
       {
          hypre_TFree(hypre_ParAMGDataRBlockArray(amg_data), HYPRE_MEMORY_HOST);
@@ -869,6 +894,8 @@ hypre_BoomerAMGDestroy( void *data )
       }
       hypre_ParVectorDestroy(hypre_ParAMGDataResidual(amg_data));
       hypre_ParAMGDataResidual(amg_data) = NULL;
+      hypre_TFree(hypre_ParAMGDataCompNumIterations(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataCompRelResidualNorms(amg_data), HYPRE_MEMORY_HOST);
 
       if ( hypre_ParAMGInterpVecVariant(amg_data) > 0 &&
            hypre_ParAMGNumInterpVectors(amg_data) > 0)
@@ -3902,6 +3929,57 @@ hypre_BoomerAMGGetRelResidualNorm( void     *data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGGetComponentNumIterations
+ *
+ * Number of cycles after which each component of the last multivector solve
+ * met the tolerance (the total number of cycles if it did not).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetComponentNumIterations( void      *data,
+                                          HYPRE_Int *num_iterations )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   HYPRE_Int          k;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   for (k = 0; k < hypre_ParAMGDataNumComponents(amg_data); k++)
+   {
+      num_iterations[k] = hypre_ParAMGDataCompNumIterations(amg_data)[k];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGGetComponentRelResidualNorms
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetComponentRelResidualNorms( void       *data,
+                                             HYPRE_Real *rel_resid_norms )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   HYPRE_Int          k;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   for (k = 0; k < hypre_ParAMGDataNumComponents(amg_data); k++)
+   {
+      rel_resid_norms[k] = hypre_ParAMGDataCompRelResidualNorms(amg_data)[k];
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetVariant( void     *data,
                            HYPRE_Int       variant)
@@ -5064,6 +5142,32 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetKeepStrength( void       *data,
+                                HYPRE_Int   keep_strength )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   hypre_ParAMGDataKeepStrength(amg_data) = keep_strength;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSinglePrecisionLevel( void       *data,
+                                        HYPRE_Int   sp_level )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSinglePrecisionLevel(amg_data) = sp_level;
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
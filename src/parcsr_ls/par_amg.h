@@ -109,6 +109,9 @@ typedef struct
    hypre_ParCSRMatrix **P_array;
    hypre_ParCSRMatrix **R_array;
    hypre_IntArray     **CF_marker_array;
+   hypre_ParCSRMatrix **S_array;
+   hypre_ParCSRSpGEMMPlan **rap_plan_array;
+   HYPRE_Int            num_rap_plans;
    hypre_IntArray     **dof_func_array;
    HYPRE_Int          **dof_point_array;
    HYPRE_Int          **point_dof_map_array;
@@ -209,6 +212,11 @@ typedef struct
    HYPRE_Real       rel_resid_norm;
    hypre_ParVector *residual; /* available if logging>1 */
 
+   /* per-component convergence of the last multivector solve */
+   HYPRE_Int        num_components;
+   HYPRE_Int       *comp_num_iterations;
+   HYPRE_Real      *comp_rel_resid_norms;
+
    /* output params */
    HYPRE_Int      print_level;
    char           log_file_name[256];
@@ -272,6 +280,13 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* numeric-only re-setup (reuse of the C/F splittings and strength) */
+   HYPRE_Int keep_strength;
+   HYPRE_Int setup_numeric_only;
+
+   /* store operators on coarse levels in single precision */
+   HYPRE_Int single_precision_level;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -377,6 +392,9 @@ typedef struct
 
 /* data generated by the setup phase */
 #define hypre_ParAMGDataCFMarkerArray(amg_data) ((amg_data)-> CF_marker_array)
+#define hypre_ParAMGDataSArray(amg_data) ((amg_data)-> S_array)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)-> rap_plan_array)
+#define hypre_ParAMGDataNumRAPPlans(amg_data) ((amg_data)-> num_rap_plans)
 #define hypre_ParAMGDataAArray(amg_data) ((amg_data)->A_array)
 #define hypre_ParAMGDataFArray(amg_data) ((amg_data)->F_array)
 #define hypre_ParAMGDataUArray(amg_data) ((amg_data)->U_array)
@@ -474,6 +492,9 @@ typedef struct
 #endif
 #define hypre_ParAMGDataRelativeResidualNorm(amg_data) ((amg_data)->rel_resid_norm)
 #define hypre_ParAMGDataResidual(amg_data) ((amg_data)->residual)
+#define hypre_ParAMGDataNumComponents(amg_data) ((amg_data)->num_components)
+#define hypre_ParAMGDataCompNumIterations(amg_data) ((amg_data)->comp_num_iterations)
+#define hypre_ParAMGDataCompRelResidualNorms(amg_data) ((amg_data)->comp_rel_resid_norms)
 
 /* output parameters */
 #define hypre_ParAMGDataPrintLevel(amg_data) ((amg_data)->print_level)
@@ -542,6 +563,9 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataKeepStrength(amg_data) ((amg_data)->keep_strength)
+#define hypre_ParAMGDataSetupNumericOnly(amg_data) ((amg_data)->setup_numeric_only)
+#define hypre_ParAMGDataSinglePrecisionLevel(amg_data) ((amg_data)->single_precision_level)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -21,6 +21,37 @@
  *
  *****************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGStrengthMatchesA
+ *
+ * Returns 1 on all ranks if a strength matrix kept from a previous setup
+ * can be used with A, i.e., its off-diagonal columns still refer to the
+ * same global columns as those of A. On coarse levels this may not be the
+ * case when interpolation truncation dropped different entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGStrengthMatchesA( hypre_ParCSRMatrix *S,
+                                 hypre_ParCSRMatrix *A )
+{
+   HYPRE_Int      num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_BigInt  *col_map_offd_A = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt  *col_map_offd_S = hypre_ParCSRMatrixColMapOffd(S);
+   HYPRE_Int      match, all_match, i;
+
+   match = (hypre_ParCSRMatrixNumRows(S) == hypre_ParCSRMatrixNumRows(A)) &&
+           (hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(S)) == num_cols_offd);
+   for (i = 0; match && i < num_cols_offd; i++)
+   {
+      match = (col_map_offd_S[i] == col_map_offd_A[i]);
+   }
+
+   hypre_MPI_Allreduce(&match, &all_match, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return all_match;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGSetup
  *--------------------------------------------------------------------------*/
@@ -51,6 +82,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_IntArray     **dof_func_array;
    hypre_IntArray      *dof_func;
    HYPRE_Int           *dof_func_data;
+   hypre_ParCSRMatrix **S_array;
    HYPRE_Real          *relax_weight;
    HYPRE_Real          *omega;
    HYPRE_Real           schwarz_relax_wt = 1;
@@ -239,6 +271,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    HYPRE_Real cum_nnz_AP = hypre_ParAMGDataCumNnzAP(amg_data);
 
+   /* numeric-only re-setup: C/F splittings (and strength matrices) taken
+      over from the previous setup, see hypre_BoomerAMGSetupNumericOnly */
+   HYPRE_Int            numeric_only = hypre_ParAMGDataSetupNumericOnly(amg_data);
+   HYPRE_Int            keep_strength = hypre_ParAMGDataKeepStrength(amg_data);
+   HYPRE_Int            reuse_level = 0;
+   HYPRE_Int            num_reuse_levels = 0;
+   hypre_IntArray     **reuse_CF_marker_array = NULL;
+   hypre_ParCSRMatrix **reuse_S_array = NULL;
+   hypre_ParCSRMatrix **reuse_A_array = NULL;
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_GpuProfilingPushRange("AMGsetup");
    hypre_MemoryPrintUsage(comm, hypre_HandleLogLevel(hypre_handle()), "BoomerAMG setup begin", 0);
@@ -313,6 +355,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
    dof_func_array = hypre_ParAMGDataDofFuncArray(amg_data);
    dof_func = hypre_ParAMGDataDofFunc(amg_data);
+   S_array = hypre_ParAMGDataSArray(amg_data);
    local_size = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
    first_local_row = hypre_ParCSRMatrixFirstRowIndex(A);
 
@@ -435,6 +478,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
        dof_func_array || R_array || R_block_array)
    {
+      /* Keep the coarse grid operators for a numeric-only re-setup: the new
+         Galerkin products are computed into their patterns, see
+         hypre_BoomerAMGSetupRAPPlan */
+      if (numeric_only && old_num_levels > 1 && A_array)
+      {
+         reuse_A_array = hypre_CTAlloc(hypre_ParCSRMatrix*, old_num_levels, HYPRE_MEMORY_HOST);
+         for (j = 1; j < old_num_levels; j++)
+         {
+            reuse_A_array[j] = A_array[j];
+            A_array[j] = NULL;
+         }
+      }
+
       for (j = 1; j < old_num_levels; j++)
       {
          if (A_array[j])
@@ -480,6 +536,27 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
+      /* Keep the C/F splittings (and strength matrices) for a numeric-only
+         re-setup; these are handed back level by level below */
+      if (numeric_only && old_num_levels > 1 && CF_marker_array)
+      {
+         num_reuse_levels = old_num_levels - 1;
+         reuse_CF_marker_array = hypre_CTAlloc(hypre_IntArray*, num_reuse_levels,
+                                               HYPRE_MEMORY_HOST);
+         reuse_S_array = hypre_CTAlloc(hypre_ParCSRMatrix*, num_reuse_levels,
+                                       HYPRE_MEMORY_HOST);
+         for (j = 0; j < num_reuse_levels; j++)
+         {
+            reuse_CF_marker_array[j] = CF_marker_array[j];
+            CF_marker_array[j] = NULL;
+            if (S_array)
+            {
+               reuse_S_array[j] = S_array[j];
+               S_array[j] = NULL;
+            }
+         }
+      }
+
       /* Special case use of CF_marker_array when old_num_levels == 1
          requires us to attempt this deallocation every time */
       hypre_IntArrayDestroy(CF_marker_array[0]);
@@ -492,6 +569,30 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }
 
+   /* product plans of a previous setup are only used by numeric-only re-setups */
+   if (!numeric_only && hypre_ParAMGDataRAPPlanArray(amg_data))
+   {
+      for (j = 0; j < hypre_ParAMGDataNumRAPPlans(amg_data); j++)
+      {
+         hypre_ParCSRSpGEMMPlanDestroy(hypre_ParAMGDataRAPPlanArray(amg_data)[j]);
+      }
+      hypre_TFree(hypre_ParAMGDataRAPPlanArray(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataNumRAPPlans(amg_data) = 0;
+   }
+
+   if (S_array)
+   {
+      for (j = 0; j < old_num_levels - 1; j++)
+      {
+         hypre_ParCSRMatrixDestroy(S_array[j]);
+         S_array[j] = NULL;
+      }
+      if (!keep_strength)
+      {
+         hypre_TFree(S_array, HYPRE_MEMORY_HOST);
+      }
+   }
+
    {
       MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
       void *amg = hypre_ParAMGDataCoarseSolver(amg_data);
@@ -699,6 +800,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       CF_marker_array = hypre_CTAlloc(hypre_IntArray*, max_levels, HYPRE_MEMORY_HOST);
    }
 
+   if (S_array == NULL && keep_strength && max_levels > 1)
+   {
+      S_array = hypre_CTAlloc(hypre_ParCSRMatrix*, max_levels - 1, HYPRE_MEMORY_HOST);
+   }
+
    if (num_C_points_coarse > 0)
    {
 #if defined(HYPRE_USING_GPU)
@@ -803,6 +909,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    dof_func_array[0] = dof_func;
    hypre_ParAMGDataCFMarkerArray(amg_data) = CF_marker_array;
+   hypre_ParAMGDataSArray(amg_data) = S_array;
    hypre_ParAMGDataNumCPoints(amg_data) = num_C_points_coarse;
    hypre_ParAMGDataDofFunc(amg_data) = dof_func;
    hypre_ParAMGDataDofFuncArray(amg_data) = dof_func_array;
@@ -1089,6 +1196,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                             level, &SmoothVecs);
          }
 
+         /* reuse the C/F splitting of the previous setup on this level */
+         reuse_level = (level < num_reuse_levels && reuse_CF_marker_array[level] != NULL);
+
          /**** Get the Strength Matrix ****/
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
@@ -1126,7 +1236,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
             else /* standard AMG or unknown approach */
             {
-               if (!useSabs)
+               if (reuse_level && reuse_S_array[level] &&
+                   hypre_BoomerAMGStrengthMatchesA(reuse_S_array[level], A_array[level]))
+               {
+                  S = reuse_S_array[level];
+                  reuse_S_array[level] = NULL;
+               }
+               else if (!useSabs)
                {
                   hypre_BoomerAMGCreateS(A_array[level], strong_threshold, max_row_sum,
                                          num_functions, dof_func_data, &S);
@@ -1159,12 +1275,20 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /* Allocate CF_marker for the current level */
-         CF_marker_array[level] = hypre_IntArrayCreate(local_num_vars);
-         hypre_IntArrayInitialize(CF_marker_array[level]);
+         if (reuse_level)
+         {
+            CF_marker_array[level] = reuse_CF_marker_array[level];
+            reuse_CF_marker_array[level] = NULL;
+         }
+         else
+         {
+            CF_marker_array[level] = hypre_IntArrayCreate(local_num_vars);
+            hypre_IntArrayInitialize(CF_marker_array[level]);
+         }
          CF_marker = hypre_IntArrayData(CF_marker_array[level]);
 
          /* Set isolated fine points (SF_PT) given by the user */
-         if ((num_isolated_F_points > 0) && (level == 0))
+         if ((num_isolated_F_points > 0) && (level == 0) && !reuse_level)
          {
             if (block_mode)
             {
@@ -1219,7 +1343,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
 
-         if (nodal == 0) /* no nodal coarsening */
+         if (reuse_level)
+         {
+            /* numeric-only re-setup: C/F splitting from the previous setup */
+         }
+         else if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
@@ -2948,7 +3076,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
-      if (S)
+      if (S && S_array)
+      {
+         /* keep the strength matrix for a numeric-only re-setup */
+         S_array[level] = S;
+      }
+      else if (S)
       {
          hypre_ParCSRMatrixDestroy(S);
       }
@@ -3069,12 +3202,24 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          else
          {
             /* Compute standard Galerkin coarse-grid product */
-            if (hypre_ParAMGDataModularizedMatMat(amg_data))
+            A_H = NULL;
+            if (reuse_A_array && level + 1 < old_num_levels && reuse_A_array[level + 1] &&
+                hypre_ParAMGDataADropTol(amg_data) <= 0.0 &&
+                hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[level])) ==
+                HYPRE_EXEC_HOST)
+            {
+               /* numeric phase only, into the previous coarse grid operator */
+               A_H = reuse_A_array[level + 1];
+               reuse_A_array[level + 1] = NULL;
+               hypre_BoomerAMGSetupRAPPlan(amg_data, level, A_array[level], P_array[level], &A_H);
+            }
+
+            if (A_H == NULL && hypre_ParAMGDataModularizedMatMat(amg_data))
             {
                A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
                                              P_array[level], keepTranspose);
             }
-            else
+            else if (A_H == NULL)
             {
                hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
                                                     P_array[level], keepTranspose, &A_H);
@@ -4038,9 +4183,255 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   /* Store coarse level operators in single precision */
+   if (hypre_ParAMGDataSinglePrecisionLevel(amg_data) > 0)
+   {
+      hypre_BoomerAMGSetupSinglePrecision(amg_data);
+   }
+
+   /* splittings of a numeric-only re-setup that were not used */
+   for (j = 0; j < num_reuse_levels; j++)
+   {
+      hypre_IntArrayDestroy(reuse_CF_marker_array[j]);
+      hypre_ParCSRMatrixDestroy(reuse_S_array[j]);
+   }
+   hypre_TFree(reuse_CF_marker_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(reuse_S_array, HYPRE_MEMORY_HOST);
+   for (j = 1; j < old_num_levels && reuse_A_array; j++)
+   {
+      hypre_ParCSRMatrixDestroy(reuse_A_array[j]);
+   }
+   hypre_TFree(reuse_A_array, HYPRE_MEMORY_HOST);
+
    hypre_MemoryPrintUsage(comm, hypre_HandleLogLevel(hypre_handle()), "BoomerAMG setup end", 0);
    hypre_GpuProfilingPopRange();
    HYPRE_ANNOTATE_FUNC_END;
 
    return (hypre_error_flag);
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupNumericOnly
+ *
+ * Re-setup of BoomerAMG for a matrix A that has the same sparsity pattern
+ * (and row partitioning) as the one of the previous setup, but different
+ * values. The C/F splittings of all levels are taken over from the previous
+ * setup, so that the coarsening is skipped, and, if the strength matrices
+ * were kept (see hypre_BoomerAMGSetKeepStrength), so is the computation of
+ * the strength of connection. This keeps the number of levels, the coarse
+ * grids and the sparsity of the interpolation operators; the interpolation
+ * weights, the coarse grid operators and the smoother data are recomputed.
+ *
+ * If there is no previous setup, the number of local rows has changed, or
+ * the setup options are not supported (nodal or block coarsening, GSMG,
+ * aggressive coarsening, CR coarsening, interpolation vectors), a full
+ * setup is done instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupNumericOnly( void               *amg_vdata,
+                                 hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 hypre_ParVector    *u )
+{
+   MPI_Comm             comm            = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData    *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   hypre_IntArray     **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            interp_type     = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int            coarsen_type    = hypre_ParAMGDataCoarsenType(amg_data);
+   HYPRE_Int            reuse, reuse_all;
+
+   reuse = (hypre_ParAMGDataAArray(amg_data) != NULL &&
+            CF_marker_array != NULL && num_levels > 1 &&
+            CF_marker_array[0] != NULL &&
+            hypre_IntArraySize(CF_marker_array[0]) ==
+            hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)));
+
+   reuse = reuse && !hypre_ParAMGDataNodal(amg_data) &&
+           !hypre_ParAMGDataBlockMode(amg_data) &&
+           !hypre_ParAMGDataGSMG(amg_data) &&
+           !hypre_ParAMGInterpVecVariant(amg_data) &&
+           hypre_ParAMGDataAggNumLevels(amg_data) == 0 &&
+           coarsen_type != 98 && coarsen_type != 99 &&
+           interp_type != 1 && interp_type != 10 && interp_type != 11 &&
+           (interp_type < 20 || interp_type == 100);
+
+   /* all processes have to agree */
+   hypre_MPI_Allreduce(&reuse, &reuse_all, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   hypre_ParAMGDataSetupNumericOnly(amg_data) = reuse_all;
+   hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   hypre_ParAMGDataSetupNumericOnly(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupRAPPlan
+ *
+ * Computes the Galerkin product P^T*A*P of a numeric-only re-setup into the
+ * coarse grid operator *A_H_ptr of the previous setup, which keeps its
+ * pattern and CommPkg. The symbolic plan of the product is built for this
+ * level the first time and kept in amg_data for the following re-setups.
+ * If the patterns do not allow this (e.g., after truncation of P changed
+ * the pattern of P^T*A*P), *A_H_ptr is destroyed and set to NULL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupRAPPlan( void                *amg_vdata,
+                             HYPRE_Int            level,
+                             hypre_ParCSRMatrix  *A,
+                             hypre_ParCSRMatrix  *P,
+                             hypre_ParCSRMatrix **A_H_ptr )
+{
+   hypre_ParAMGData        *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRSpGEMMPlan **plans     = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int                num_plans = hypre_ParAMGDataNumRAPPlans(amg_data);
+   hypre_ParCSRMatrix      *A_H       = *A_H_ptr;
+   hypre_ParCSRSpGEMMPlan  *plan;
+   hypre_CSRMatrix         *PT;
+   HYPRE_Int                matches, j;
+
+   if (level >= num_plans)
+   {
+      j = hypre_max(level + 1, hypre_ParAMGDataMaxLevels(amg_data));
+      plans = hypre_TReAlloc(plans, hypre_ParCSRSpGEMMPlan*, j, HYPRE_MEMORY_HOST);
+      for (; num_plans < j; num_plans++)
+      {
+         plans[num_plans] = NULL;
+      }
+      hypre_ParAMGDataRAPPlanArray(amg_data) = plans;
+      hypre_ParAMGDataNumRAPPlans(amg_data)  = num_plans;
+   }
+
+   plan = plans[level];
+   if (plan)
+   {
+      hypre_ParCSRSpGEMMPlanMatches(plan, P, A, P, A_H, &matches);
+      if (!matches)
+      {
+         hypre_ParCSRSpGEMMPlanDestroy(plan);
+         plan = NULL;
+      }
+   }
+   if (!plan)
+   {
+      hypre_ParCSRMatrixRAPPlanCreate(P, A, P, A_H, &plan);
+   }
+   plans[level] = plan;
+
+   if (!plan)
+   {
+      hypre_ParCSRMatrixDestroy(A_H);
+      *A_H_ptr = NULL;
+
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixRAPPlanCompute(plan, P, A, P, A_H);
+
+   if (hypre_ParAMGDataKeepTranspose(amg_data))
+   {
+      hypre_CSRMatrixTranspose(hypre_ParCSRMatrixDiag(P), &PT, 1);
+      hypre_ParCSRMatrixDiagT(P) = PT;
+      if (hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(P)))
+      {
+         hypre_CSRMatrixTranspose(hypre_ParCSRMatrixOffd(P), &PT, 1);
+         hypre_ParCSRMatrixOffdT(P) = PT;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSinglePrecisionRelaxType
+ *
+ * Returns 1 if relax_type can be used with single precision operators.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSinglePrecisionRelaxType( HYPRE_Int relax_type,
+                                         HYPRE_Int coarsest )
+{
+   switch (relax_type)
+   {
+      case 0: case 3: case 4: case 6: case 7: case 8:
+      case 13: case 14: case 18: case 88: case 89:
+         return 1;
+
+      /* Gaussian elimination works on a dense copy made during setup */
+      case 9: case 19: case 98: case 99: case 198: case 199:
+         return coarsest;
+
+      default:
+         return 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupSinglePrecision
+ *
+ * Converts A on the levels >= SinglePrecisionLevel, and the interpolation
+ * (restriction) operators between them, to single precision storage.
+ * Levels with complex smoothers or relaxation methods that read the matrix
+ * values directly without a single precision variant are skipped.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupSinglePrecision( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data          = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array           = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array           = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int           *grid_relax_type   = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
+   HYPRE_Int            restri_type       = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int            level, start;
+
+   start = hypre_max(hypre_ParAMGDataSinglePrecisionLevel(amg_data), smooth_num_levels);
+   start = hypre_max(start, 1);
+
+   if (start >= num_levels ||
+       hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataSimple(amg_data) > -1 ||
+       hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) != HYPRE_EXEC_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Down/up relaxation is the same on all intermediate levels */
+   if (start < num_levels - 1 &&
+       !(hypre_BoomerAMGSinglePrecisionRelaxType(grid_relax_type[1], 0) &&
+         hypre_BoomerAMGSinglePrecisionRelaxType(grid_relax_type[2], 0)))
+   {
+      start = num_levels - 1;
+   }
+
+   if (!hypre_BoomerAMGSinglePrecisionRelaxType(grid_relax_type[3], 1))
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = start; level < num_levels; level++)
+   {
+      hypre_ParCSRMatrixConvertToSinglePrecision(A_array[level]);
+
+      if (level < num_levels - 1)
+      {
+         hypre_ParCSRMatrixConvertToSinglePrecision(P_array[level]);
+
+         if (restri_type && R_array[level] && R_array[level] != P_array[level])
+         {
+            hypre_ParCSRMatrixConvertToSinglePrecision(R_array[level]);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,75 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGComponentConvergence
+ *
+ * Per-component convergence check of a multivector solve. The relative
+ * residual norms ||r_k|| / ref_norms[k] are stored in amg_data, components
+ * that reach tol for the first time record cycle_count as their number of
+ * iterations. Returns the largest relative residual norm.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_BoomerAMGComponentConvergence( hypre_ParAMGData *amg_data,
+                                     hypre_ParVector  *r,
+                                     HYPRE_Real       *ref_norms,
+                                     HYPRE_Real        tol,
+                                     HYPRE_Int         cycle_count )
+{
+   HYPRE_Int   num_vectors     = hypre_ParAMGDataNumComponents(amg_data);
+   HYPRE_Int  *num_iterations  = hypre_ParAMGDataCompNumIterations(amg_data);
+   HYPRE_Real *rel_resid_norms = hypre_ParAMGDataCompRelResidualNorms(amg_data);
+   HYPRE_Real  max_rel_resid   = 0.0;
+   HYPRE_Int   k;
+
+   hypre_ParVectorComponentInnerProds(r, r, rel_resid_norms);
+
+   for (k = 0; k < num_vectors; k++)
+   {
+      rel_resid_norms[k] = hypre_sqrt(rel_resid_norms[k]);
+      if (ref_norms[k])
+      {
+         rel_resid_norms[k] /= ref_norms[k];
+      }
+      if (rel_resid_norms[k] < tol && num_iterations[k] < 0)
+      {
+         num_iterations[k] = cycle_count;
+      }
+      max_rel_resid = hypre_max(max_rel_resid, rel_resid_norms[k]);
+   }
+
+   return max_rel_resid;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGResetCommPkgs
+ *
+ * The multivector matvecs of a multivector solve switch the communication
+ * packages of the levels to num_vectors components, while the single
+ * vector routines (e.g., relaxation) assume one component. Switch them
+ * back before returning from the solve.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetCommPkgs( hypre_ParCSRMatrix **A_array,
+                              HYPRE_Int            num_levels )
+{
+   HYPRE_Int  j;
+
+   for (j = 0; j < num_levels; j++)
+   {
+      hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(A_array[j]);
+
+      if (comm_pkg)
+      {
+         hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, 1, 0, 1);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGSolve
  *--------------------------------------------------------------------*/
@@ -69,6 +138,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real          rhs_norm = 0.0;
    HYPRE_Real          old_resid;
    HYPRE_Real          ieee_check = 0.;
+   HYPRE_Real         *comp_ref_norms = NULL;
+   HYPRE_Int           k;
 
    hypre_ParVector    *Vtemp;
    hypre_ParVector    *Rtemp;
@@ -133,6 +204,23 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_ParVectorResize(U_array[j], num_vectors);
    }
 
+   /* Per-component convergence history */
+   if (hypre_ParAMGDataNumComponents(amg_data) != num_vectors)
+   {
+      hypre_TFree(hypre_ParAMGDataCompNumIterations(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataCompRelResidualNorms(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataNumComponents(amg_data)      = num_vectors;
+      hypre_ParAMGDataCompNumIterations(amg_data)  = hypre_CTAlloc(HYPRE_Int, num_vectors,
+                                                                   HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataCompRelResidualNorms(amg_data) = hypre_CTAlloc(HYPRE_Real, num_vectors,
+                                                                     HYPRE_MEMORY_HOST);
+   }
+   for (k = 0; k < num_vectors; k++)
+   {
+      hypre_ParAMGDataCompNumIterations(amg_data)[k]   = -1;
+      hypre_ParAMGDataCompRelResidualNorms(amg_data)[k] = 1.0;
+   }
+
    /*-----------------------------------------------------------------------
     *    Write the solver parameters
     *-----------------------------------------------------------------------*/
@@ -180,12 +268,17 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       }
       else
       {
-         hypre_ParVectorCopy(F_array[0], Vtemp);
          if (tol > 0)
          {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Vtemp);
+            /* fused residual and norm computation; the sign of Vtemp is
+               irrelevant here */
+            hypre_ParCSRMatrixResidual(A_array[0], U_array[0], F_array[0], Vtemp, &resid_nrm);
+         }
+         else
+         {
+            hypre_ParVectorCopy(F_array[0], Vtemp);
+            resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
          }
-         resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
       }
 
       /* Since it does not diminish performance, attempt to return an error flag
@@ -210,6 +303,10 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         if (num_vectors > 1)
+         {
+            hypre_BoomerAMGResetCommPkgs(A_array, num_levels);
+         }
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -235,6 +332,23 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          /* converge_type != 0, test convergence with ||r|| / ||r0|| */
          relative_resid = 1.0;
       }
+
+      /* Multivectors: each component is tested against its own reference
+         norm, and the solve stops when all components have converged */
+      if (num_vectors > 1)
+      {
+         comp_ref_norms = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+         hypre_ParVectorComponentInnerProds((0 == converge_type) ? f : (amg_logging > 1 ? Residual : Vtemp),
+                                            (0 == converge_type) ? f : (amg_logging > 1 ? Residual : Vtemp),
+                                            comp_ref_norms);
+         for (k = 0; k < num_vectors; k++)
+         {
+            comp_ref_norms[k] = hypre_sqrt(comp_ref_norms[k]);
+         }
+         relative_resid = hypre_BoomerAMGComponentConvergence(amg_data,
+                                                              amg_logging > 1 ? Residual : Vtemp,
+                                                              comp_ref_norms, tol, 0);
+      }
    }
    else
    {
@@ -288,9 +402,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          }
          else
          {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0],
-                                               Vtemp);
-            resid_nrm = hypre_sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+            hypre_ParCSRMatrixResidual(A_array[0], U_array[0], F_array[0], Vtemp, &resid_nrm);
          }
 
          if (old_resid)
@@ -318,6 +430,13 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             relative_resid = resid_nrm / resid_nrm_init;
          }
 
+         if (num_vectors > 1)
+         {
+            relative_resid = hypre_BoomerAMGComponentConvergence(amg_data,
+                                                                 amg_logging > 1 ? Residual : Vtemp,
+                                                                 comp_ref_norms, tol, cycle_count + 1);
+         }
+
          hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
       }
 
@@ -341,6 +460,25 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_error(HYPRE_ERROR_CONV);
    }
 
+   /* Components that did not converge (all of them for single vectors) */
+   for (k = 0; k < num_vectors; k++)
+   {
+      if (hypre_ParAMGDataCompNumIterations(amg_data)[k] < 0)
+      {
+         hypre_ParAMGDataCompNumIterations(amg_data)[k] = cycle_count;
+      }
+   }
+   if (num_vectors == 1)
+   {
+      hypre_ParAMGDataCompRelResidualNorms(amg_data)[0] = relative_resid;
+   }
+   hypre_TFree(comp_ref_norms, HYPRE_MEMORY_HOST);
+
+   if (num_vectors > 1)
+   {
+      hypre_BoomerAMGResetCommPkgs(A_array, num_levels);
+   }
+
    /*-----------------------------------------------------------------------
     *    Compute closing statistics
     *-----------------------------------------------------------------------*/
@@ -664,45 +664,49 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          alpha = -1.0;
          beta = 1.0;
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
-         hypre_GpuProfilingPushRange("Residual");
-         if (block_mode)
+         if (!block_mode && !restri_type)
          {
-            hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
-            hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
-                                          beta, Vtemp);
+            /* residual and restriction in one sweep over the residual */
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+            hypre_GpuProfilingPushRange("Restriction");
+            hypre_ParCSRMatrixResidualRestrict(A_array[fine_grid], U_array[fine_grid],
+                                               F_array[fine_grid], R_array[fine_grid],
+                                               Vtemp, F_array[coarse_grid]);
          }
          else
          {
-            // JSP: avoid unnecessary copy using out-of-place version of SpMV
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
-                                               beta, F_array[fine_grid], Vtemp);
-         }
-         HYPRE_ANNOTATE_REGION_END("%s", "Residual");
-         hypre_GpuProfilingPopRange();
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
+            hypre_GpuProfilingPushRange("Residual");
+            if (block_mode)
+            {
+               hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
+               hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
+                                             beta, Vtemp);
+            }
+            else
+            {
+               // JSP: avoid unnecessary copy using out-of-place version of SpMV
+               hypre_ParCSRMatrixResidual(A_array[fine_grid], U_array[fine_grid],
+                                          F_array[fine_grid], Vtemp, NULL);
+            }
+            HYPRE_ANNOTATE_REGION_END("%s", "Residual");
+            hypre_GpuProfilingPopRange();
 
-         alpha = 1.0;
-         beta = 0.0;
+            alpha = 1.0;
+            beta = 0.0;
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
-         hypre_GpuProfilingPushRange("Restriction");
-         if (block_mode)
-         {
-            hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
-                                           beta, F_array[coarse_grid]);
-         }
-         else
-         {
-            if (restri_type)
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+            hypre_GpuProfilingPushRange("Restriction");
+            if (block_mode)
             {
-               /* RL: no transpose for R */
-               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
-                                        beta, F_array[coarse_grid]);
+               hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
+                                              beta, F_array[coarse_grid]);
             }
             else
             {
-               hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                         beta, F_array[coarse_grid]);
+               /* RL: no transpose for R */
+               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
+                                        beta, F_array[coarse_grid]);
             }
          }
          HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
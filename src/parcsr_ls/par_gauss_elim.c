@@ -445,6 +445,68 @@ hypre_GaussElimSetup(hypre_ParAMGData *amg_data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GaussElimSolveMultiVec
+ *
+ * Gaussian elimination solve for multivectors stored by columns. The
+ * components are solved one after the other by temporarily replacing the
+ * level's F and U multivectors with single vector views of each component.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GaussElimSolveMultiVec(hypre_ParAMGData *amg_data,
+                             HYPRE_Int         level,
+                             HYPRE_Int         solver_type)
+{
+   hypre_ParVector  **F_array     = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector  **U_array     = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector   *f           = F_array[level];
+   hypre_ParVector   *u           = U_array[level];
+   hypre_Vector      *f_local     = hypre_ParVectorLocalVector(f);
+   hypre_Vector      *u_local     = hypre_ParVectorLocalVector(u);
+   HYPRE_Int          num_vectors = hypre_VectorNumVectors(f_local);
+   hypre_ParVector   *views[2];
+   HYPRE_Int          i, k;
+
+   if (hypre_VectorIndexStride(f_local) != 1 || hypre_VectorIndexStride(u_local) != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Gaussian elimination requires multivectors stored by columns");
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < 2; i++)
+   {
+      hypre_ParVector *x = i ? u : f;
+
+      views[i] = hypre_ParVectorCreate(hypre_ParVectorComm(x),
+                                       hypre_ParVectorGlobalSize(x),
+                                       hypre_ParVectorPartitioning(x));
+      hypre_SeqVectorSetDataOwner(hypre_ParVectorLocalVector(views[i]), 0);
+      hypre_VectorMemoryLocation(hypre_ParVectorLocalVector(views[i])) =
+         hypre_ParVectorMemoryLocation(x);
+   }
+
+   F_array[level] = views[0];
+   U_array[level] = views[1];
+   for (k = 0; k < num_vectors; k++)
+   {
+      hypre_VectorData(hypre_ParVectorLocalVector(views[0])) =
+         hypre_VectorData(f_local) + k * hypre_VectorVectorStride(f_local);
+      hypre_VectorData(hypre_ParVectorLocalVector(views[1])) =
+         hypre_VectorData(u_local) + k * hypre_VectorVectorStride(u_local);
+
+      hypre_GaussElimSolve(amg_data, level, solver_type);
+   }
+   F_array[level] = f;
+   U_array[level] = u;
+
+   hypre_ParVectorDestroy(views[0]);
+   hypre_ParVectorDestroy(views[1]);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GaussElimSolve
  *
@@ -495,6 +557,11 @@ hypre_GaussElimSolve(hypre_ParAMGData *amg_data,
    HYPRE_Int            *displs, *info;
    HYPRE_Int             new_num_procs;
 
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_GaussElimSolveMultiVec(amg_data, level, solver_type);
+   }
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_GS_ELIM_SOLVE] -= hypre_MPI_Wtime();
 #endif
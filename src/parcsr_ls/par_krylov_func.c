@@ -211,6 +211,34 @@ hypre_ParKrylovMassDotpTwo( void *x, void *y,
                                         unroll, (HYPRE_Real *)result_x, (HYPRE_Real *)result_y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProd
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_ParKrylovBlockInnerProd( HYPRE_Int n, void **x, void **y, HYPRE_Real *result )
+{
+   return ( hypre_ParVectorBlockInnerProd( n, (hypre_ParVector **) x, (hypre_ParVector **) y,
+                                           result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovIBlockInnerProd, hypre_ParKrylovIBlockInnerProdWait
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_ParKrylovIBlockInnerProd( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                void **request )
+{
+   return ( hypre_ParVectorBlockInnerProdStart( n, (hypre_ParVector **) x,
+                                                (hypre_ParVector **) y, result,
+                                                (hypre_ParVectorReduceHandle **) request ) );
+}
+
+HYPRE_Int
+hypre_ParKrylovIBlockInnerProdWait( void *request )
+{
+   return ( hypre_ParVectorBlockInnerProdWait( (hypre_ParVectorReduceHandle *) request ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -172,6 +172,198 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    return relax_error;
 }
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVecHost
+ *
+ * Host relaxation of all components of a multivector u. The halo of all
+ * components is exchanged in a single communication, and every row of A
+ * is read once per sweep for all components.
+ *
+ * GS_order = 0 gives (weighted) Jacobi, GS_order > 0 and < 0 forward and
+ * backward hybrid Gauss-Seidel, with a backward sweep following the
+ * forward one if Symm is set. The weights and the l1_norms and Skip_diag
+ * options have the same meaning as in the single vector routines.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVecHost( hypre_ParCSRMatrix *A,
+                                  hypre_ParVector    *f,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_points,
+                                  HYPRE_Real          relax_weight,
+                                  HYPRE_Real          omega,
+                                  HYPRE_Real         *l1_norms,
+                                  hypre_ParVector    *u,
+                                  hypre_ParVector    *Vtemp,
+                                  HYPRE_Int           GS_order,
+                                  HYPRE_Int           Symm,
+                                  HYPRE_Int           Skip_diag,
+                                  HYPRE_Int           forced_seq )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
+   HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Complex       *Vtemp_data    = Vtemp ? hypre_VectorData(hypre_ParVectorLocalVector(Vtemp)) : NULL;
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(u_local);
+   HYPRE_Int            vecstride     = hypre_VectorVectorStride(u_local);
+   HYPRE_Int            idxstride     = hypre_VectorIndexStride(u_local);
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   HYPRE_Complex       *work_data;
+
+   const HYPRE_Real     one_minus_omega = GS_order ? 1.0 - omega : 0.0;
+   const HYPRE_Real     prod            = 1.0 - relax_weight * (GS_order ? omega : 1.0);
+   const HYPRE_Int      num_sweeps      = (Symm && GS_order) ? 2 : 1;
+   const HYPRE_Int      non_scale       = relax_weight == 1.0 && omega == 1.0;
+   HYPRE_Int            num_procs, num_threads, num_sends, i, j;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = forced_seq ? 1 : hypre_NumThreads();
+
+   if (hypre_VectorNumVectors(f_local) != num_vectors ||
+       hypre_VectorVectorStride(f_local) != vecstride ||
+       hypre_VectorIndexStride(f_local) != idxstride)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multivector relaxation requires f and u with the same layout");
+      return hypre_error_flag;
+   }
+
+   /* Vtemp holds a copy of u unless this is an unscaled sequential GS sweep */
+   if (!GS_order || num_threads > 1 || !non_scale)
+   {
+      if (!Vtemp_data || hypre_ParVectorNumVectors(Vtemp) < num_vectors)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Multivector relaxation requires a work multivector");
+         return hypre_error_flag;
+      }
+   }
+   else
+   {
+      Vtemp_data = NULL;
+   }
+
+   /*-----------------------------------------------------------------
+    * Exchange the halo of all components at once
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, num_vectors, vecstride, idxstride);
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); j++)
+      {
+         v_buf_data[j] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                    HYPRE_MEMORY_HOST, v_buf_data,
+                                                    HYPRE_MEMORY_HOST, v_ext_data);
+
+      /* overlapped with the exchange: copy of u */
+      if (Vtemp_data)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            for (j = 0; j < num_vectors; j++)
+            {
+               Vtemp_data[i * idxstride + j * vecstride] = u_data[i * idxstride + j * vecstride];
+            }
+         }
+      }
+
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      /* The single vector routines expect one component */
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, 1, 0, 1);
+   }
+   else if (Vtemp_data)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = 0; j < num_vectors; j++)
+         {
+            Vtemp_data[i * idxstride + j * vecstride] = u_data[i * idxstride + j * vecstride];
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax all points, each thread sweeping over its block of rows.
+    *-----------------------------------------------------------------*/
+
+   work_data = hypre_TAlloc(HYPRE_Complex, 3 * num_vectors * num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      HYPRE_Complex *work = work_data + 3 * num_vectors * j;
+      HYPRE_Int      ns, ne, sweep;
+
+      hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = (num_sweeps == 1 && GS_order < 0) || sweep == 1 ? -1 : 1;
+         const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+         const HYPRE_Int iend   = iorder > 0 ? ne : ns - 1;
+
+         hypre_HybridGaussSeidelMultiVec(A_diag_i, A_diag_j, A_diag_data,
+                                         A_offd_i, A_offd_j, A_offd_data,
+                                         f_data, cf_marker, relax_points,
+                                         relax_weight, GS_order ? omega : 1.0,
+                                         one_minus_omega, prod, l1_norms,
+                                         u_data, Vtemp_data, v_ext_data,
+                                         num_vectors, vecstride, idxstride,
+                                         GS_order ? ns : 0, GS_order ? ne : 0,
+                                         ibegin, iend, iorder, Skip_diag, work);
+      }
+   }
+
+   hypre_TFree(work_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGRelaxWeightedJacobi_core
  *--------------------------------------------------------------------*/
@@ -196,6 +388,8 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
    HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_float         *A_diag_data_sp = hypre_CSRMatrixDataSP(A_diag);
+   hypre_float         *A_offd_data_sp = hypre_CSRMatrixDataSP(A_offd);
    hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
@@ -215,12 +409,18 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Int num_procs, my_id, i, j, ii, jj, index, num_sends, start;
    hypre_ParCSRCommHandle *comm_handle = NULL;
 
-   /* Sanity check */
+   /* Multivectors */
    if (hypre_ParVectorNumVectors(f) > 1)
    {
-      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
-                        "Jacobi relaxation doesn't support multicomponent vectors");
-      return hypre_error_flag;
+      if (A_diag_data_sp)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Single precision Jacobi relaxation doesn't support multicomponent vectors");
+         return hypre_error_flag;
+      }
+
+      return hypre_BoomerAMGRelaxMultiVecHost(A, f, cf_marker, relax_points, relax_weight, 1.0,
+                                              l1_norms, u, Vtemp, 0, 0, Skip_diag, 0);
    }
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -271,7 +471,9 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
 #endif
    for (i = 0; i < num_rows; i++)
    {
-      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] :
+                               A_diag_data_sp ? (HYPRE_Complex) A_diag_data_sp[A_diag_i[i]] :
+                               A_diag_data[A_diag_i[i]];
 
       /*-----------------------------------------------------------
        * If i is of the right type ( C or F or All ) and diagonal is
@@ -281,15 +483,31 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
       if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
       {
          res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         if (A_diag_data_sp)
          {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data_sp[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data_sp[jj] * v_ext_data[ii];
+            }
          }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         else
          {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data[jj] * v_ext_data[ii];
+            }
          }
 
          if (Skip_diag)
@@ -716,6 +934,8 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
    HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_float         *A_diag_data_sp = hypre_CSRMatrixDataSP(A_diag);
+   hypre_float         *A_offd_data_sp = hypre_CSRMatrixDataSP(A_offd);
    hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
    hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
@@ -747,11 +967,25 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
-   /* Sanity check */
+   /* Multivectors */
    if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      if (A_diag_data_sp || Topo_order)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Single precision or ordered hybrid GS relaxation doesn't support multicomponent vectors");
+         return hypre_error_flag;
+      }
+
+      return hypre_BoomerAMGRelaxMultiVecHost(A, f, cf_marker, relax_points, relax_weight, omega,
+                                              l1_norms, u, Vtemp, GS_order > 0 ? 1 : -1, Symm,
+                                              Skip_diag, forced_seq);
+   }
+
+   if (A_diag_data_sp && (!Vtemp || Topo_order))
    {
       hypre_error_w_msg(HYPRE_ERROR_GENERIC,
-                        "Hybrid GS relaxation doesn't support multicomponent vectors");
+                        "Single precision hybrid GS relaxation requires Vtemp and no ordering");
       return hypre_error_flag;
    }
 
@@ -854,7 +1088,7 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
 #endif
 
-   if ( (num_threads > 1 || !non_scale) && Vtemp_data )
+   if ( (num_threads > 1 || !non_scale || A_diag_data_sp) && Vtemp_data )
    {
 #ifdef HYPRE_USING_OPENMP
       #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
@@ -881,7 +1115,14 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
             const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
             const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
 
-            if (non_scale)
+            if (A_diag_data_sp)
+            {
+               hypre_HybridGaussSeidelThreadsSP(A_diag_i, A_diag_j, A_diag_data_sp, A_offd_i, A_offd_j,
+                                                A_offd_data_sp, f_data, cf_marker, relax_points, relax_weight,
+                                                omega, one_minus_omega, prod, l1_norms, u_data, Vtemp_data,
+                                                v_ext_data, ns, ne, ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNSThreads(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                                 f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -911,6 +1152,13 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
                                              f_data, cf_marker, relax_points, u_data, NULL, v_ext_data,
                                              ibegin, iend, iorder, proc_ordering);
          }
+         else if (A_diag_data_sp)
+         {
+            hypre_HybridGaussSeidelThreadsSP(A_diag_i, A_diag_j, A_diag_data_sp, A_offd_i, A_offd_j,
+                                             A_offd_data_sp, f_data, cf_marker, relax_points, relax_weight,
+                                             omega, one_minus_omega, prod, l1_norms, u_data, Vtemp_data,
+                                             v_ext_data, 0, num_rows, ibegin, iend, iorder, Skip_diag);
+         }
          else
          {
             if (non_scale)
@@ -1170,6 +1418,153 @@ hypre_BoomerAMGRelax6HybridSSOR( hypre_ParCSRMatrix *A,
                                         omega, NULL, u, Vtemp, Ztemp, 1, 1, 1, 0);
 }
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGRelax7JacobiHost
+ *
+ * Fused host version of relax-7: the diag part of w*(f - A*u) is
+ * computed while the halo of u is being exchanged, and the offd part is
+ * added in the same sweep that applies u += Vtemp / l1_norms. This
+ * replaces the copy, matvec and Elmdivpy passes of the generic version
+ * with the same floating point operations.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelax7JacobiHost( hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *f,
+                                 HYPRE_Int          *cf_marker,
+                                 HYPRE_Int           relax_points,
+                                 HYPRE_Real          relax_weight,
+                                 HYPRE_Real         *l1_norms,
+                                 hypre_ParVector    *u,
+                                 hypre_ParVector    *Vtemp )
+{
+   hypre_CSRMatrix        *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real             *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int              *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix        *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int              *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real             *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int              *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int               num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Complex          *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex          *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex          *Vtemp_data    = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Complex          *u_buf_data    = NULL;
+   HYPRE_Complex          *u_ext_data    = NULL;
+   hypre_ParCSRCommHandle *comm_handle   = NULL;
+
+   HYPRE_Complex           neg_weight    = -relax_weight;
+   HYPRE_Complex           tempx;
+   HYPRE_Int               i, jj, num_sends;
+
+   /*-----------------------------------------------------------------
+    * u = 0 on input: u += w * f / l1_norms
+    *-----------------------------------------------------------------*/
+   if (hypre_ParVectorAllZeros(u))
+   {
+#if defined(HYPRE_DEBUG)
+      hypre_assert(hypre_ParVectorInnerProd(u, u) == 0.0);
+#endif
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         Vtemp_data[i] = relax_weight * f_data[i];
+         if (relax_points == 0 || cf_marker[i] == relax_points)
+         {
+            u_data[i] += Vtemp_data[i] / l1_norms[i];
+         }
+      }
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------
+    * Start the halo exchange of u
+    *-----------------------------------------------------------------*/
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, 1,
+                                      hypre_VectorVectorStride(hypre_ParVectorLocalVector(u)),
+                                      hypre_VectorIndexStride(hypre_ParVectorLocalVector(u)));
+
+   num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   u_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+   u_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+        i++)
+   {
+      u_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                 HYPRE_MEMORY_HOST, u_buf_data,
+                                                 HYPRE_MEMORY_HOST, u_ext_data);
+
+   /*-----------------------------------------------------------------
+    * Vtemp = w * (f - A_diag * u)
+    *-----------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      tempx = 0.0;
+      for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+      {
+         tempx += A_diag_data[jj] * u_data[A_diag_j[jj]];
+      }
+      Vtemp_data[i]  = relax_weight * f_data[i];
+      Vtemp_data[i] += neg_weight * tempx;
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------
+    * Vtemp -= w * A_offd * u_ext, u += Vtemp / l1_norms
+    *-----------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      if (num_cols_offd)
+      {
+         tempx = 0.0;
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            tempx += A_offd_data[jj] * u_ext_data[A_offd_j[jj]];
+         }
+         Vtemp_data[i] += neg_weight * tempx;
+      }
+
+      if (relax_points == 0 || cf_marker[i] == relax_points)
+      {
+         u_data[i] += Vtemp_data[i] / l1_norms[i];
+      }
+   }
+
+   hypre_TFree(u_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(u_ext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGRelax7Jacobi
  *--------------------------------------------------------------------*/
@@ -1190,6 +1585,20 @@ hypre_BoomerAMGRelax7Jacobi( hypre_ParCSRMatrix *A,
 
    hypre_GpuProfilingPushRange("Relax7Jacobi");
 
+   if (hypre_GetExecPolicy2(hypre_ParCSRMatrixMemoryLocation(A),
+                            hypre_ParVectorMemoryLocation(u)) == HYPRE_EXEC_HOST &&
+       hypre_ParVectorNumVectors(f) == 1 &&
+       !hypre_CSRMatrixDataSP(hypre_ParCSRMatrixDiag(A)) &&
+       !hypre_CSRMatrixDataSP(hypre_ParCSRMatrixOffd(A)) &&
+       !hypre_HandleSpMVUseSell(hypre_handle()))
+   {
+      hypre_BoomerAMGRelax7JacobiHost(A, f, cf_marker, relax_points,
+                                      relax_weight, l1_norms, u, Vtemp);
+      hypre_GpuProfilingPopRange();
+
+      return hypre_error_flag;
+   }
+
    hypre_VectorNumVectors(&l1_norms_vec) = 1;
    hypre_VectorMultiVecStorageMethod(&l1_norms_vec) = 0;
    hypre_VectorOwnsData(&l1_norms_vec) = 0;
@@ -454,6 +454,81 @@ hypre_HybridGaussSeidelThreads( HYPRE_Int     *A_diag_i,
 }
 
 
+/* Scaled Threaded version with single precision matrix values */
+static inline void
+hypre_HybridGaussSeidelThreadsSP( HYPRE_Int     *A_diag_i,
+                                  HYPRE_Int     *A_diag_j,
+                                  hypre_float   *A_diag_data,
+                                  HYPRE_Int     *A_offd_i,
+                                  HYPRE_Int     *A_offd_j,
+                                  hypre_float   *A_offd_data,
+                                  HYPRE_Complex *f_data,
+                                  HYPRE_Int     *cf_marker,
+                                  HYPRE_Int      relax_points,
+                                  HYPRE_Real     relax_weight,
+                                  HYPRE_Real     omega,
+                                  HYPRE_Real     one_minus_omega,
+                                  HYPRE_Real     prod,
+                                  HYPRE_Complex *l1_norms,
+                                  HYPRE_Complex *u_data,
+                                  HYPRE_Complex *v_tmp_data,
+                                  HYPRE_Complex *v_ext_data,
+                                  HYPRE_Int      ns,
+                                  HYPRE_Int      ne,
+                                  HYPRE_Int      ibegin,
+                                  HYPRE_Int      iend,
+                                  HYPRE_Int      iorder,
+                                  HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   /*-----------------------------------------------------------
+    * Same as hypre_HybridGaussSeidelThreads, with ns = 0 and
+    * ne = num_rows for the non-threaded case. The non-scaled
+    * variants are recovered with relax_weight = omega = 1.
+    *-----------------------------------------------------------*/
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : (HYPRE_Complex) A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+         HYPRE_Complex res0 = 0.0;
+         HYPRE_Complex res2 = 0.0;
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            const HYPRE_Int ii = A_diag_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res0 -= A_diag_data[jj] * u_data[ii];
+               res2 += A_diag_data[jj] * v_tmp_data[ii];
+            }
+            else
+            {
+               res -= A_diag_data[jj] * v_tmp_data[ii];
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            const HYPRE_Int ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] *= prod;
+         }
+         u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) / di;
+      }
+   } /* for ( i = ...) */
+}
+
+
 /* Ordered Version */
 static inline void
 hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
@@ -508,4 +583,119 @@ hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
    } /* for ( i = ...) */
 }
 
+/* Multivector version: all num_vectors components of row i are relaxed with a
+ * single pass over its coefficients. The components of u, f and v_tmp are
+ * addressed through vecstride/idxstride, v_ext is stored interleaved as
+ * received from the halo exchange. Columns in [ns, ne) are updated in place,
+ * all other local columns are taken from the copy v_tmp (ns = ne gives
+ * Jacobi). v_tmp may be NULL if [ns, ne) covers all rows and the update is not
+ * scaled. work holds 3 * num_vectors values. */
+static inline void
+hypre_HybridGaussSeidelMultiVec( HYPRE_Int     *A_diag_i,
+                                 HYPRE_Int     *A_diag_j,
+                                 HYPRE_Complex *A_diag_data,
+                                 HYPRE_Int     *A_offd_i,
+                                 HYPRE_Int     *A_offd_j,
+                                 HYPRE_Complex *A_offd_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Real     relax_weight,
+                                 HYPRE_Real     omega,
+                                 HYPRE_Real     one_minus_omega,
+                                 HYPRE_Real     prod,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_tmp_data,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      num_vectors,
+                                 HYPRE_Int      vecstride,
+                                 HYPRE_Int      idxstride,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag,
+                                 HYPRE_Complex *work )
+{
+   HYPRE_Complex *res  = work;
+   HYPRE_Complex *res0 = work + num_vectors;
+   HYPRE_Complex *res2 = work + 2 * num_vectors;
+   HYPRE_Int      i, k;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      /*-----------------------------------------------------------
+       * Relax only C or F points as determined by relax_points.
+       * If i is of the right type ( C or F or All) and diagonal is
+       * nonzero, relax point i; otherwise, skip it.
+       *-----------------------------------------------------------*/
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      {
+         HYPRE_Int jj;
+
+         for (k = 0; k < num_vectors; k++)
+         {
+            res[k]  = f_data[i * idxstride + k * vecstride];
+            res0[k] = 0.0;
+            res2[k] = 0.0;
+         }
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            const HYPRE_Int     ii = A_diag_j[jj];
+            const HYPRE_Complex a  = A_diag_data[jj];
+
+            if (ii >= ns && ii < ne)
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res0[k] -= a * u_data[ii * idxstride + k * vecstride];
+               }
+               if (v_tmp_data)
+               {
+                  for (k = 0; k < num_vectors; k++)
+                  {
+                     res2[k] += a * v_tmp_data[ii * idxstride + k * vecstride];
+                  }
+               }
+            }
+            else
+            {
+               for (k = 0; k < num_vectors; k++)
+               {
+                  res[k] -= a * v_tmp_data[ii * idxstride + k * vecstride];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            const HYPRE_Int     ii = A_offd_j[jj];
+            const HYPRE_Complex a  = A_offd_data[jj];
+
+            for (k = 0; k < num_vectors; k++)
+            {
+               res[k] -= a * v_ext_data[ii * num_vectors + k];
+            }
+         }
+
+         for (k = 0; k < num_vectors; k++)
+         {
+            HYPRE_Complex *u_ik = &u_data[i * idxstride + k * vecstride];
+
+            if (Skip_diag)
+            {
+               *u_ik *= prod;
+            }
+            *u_ik += relax_weight * (omega * res[k] + res0[k] + one_minus_omega * res2[k]) / di;
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 #endif /* #ifndef HYPRE_PAR_RELAX_HEADER */
@@ -383,6 +383,8 @@ HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGSetupNumericOnly ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A,
+                                            HYPRE_ParVector b, HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
@@ -485,6 +487,10 @@ HYPRE_Int HYPRE_BoomerAMGGetCumNumIterations ( HYPRE_Solver solver, HYPRE_Int *c
 HYPRE_Int HYPRE_BoomerAMGGetResidual ( HYPRE_Solver solver, HYPRE_ParVector *residual );
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm ( HYPRE_Solver solver,
                                                         HYPRE_Real *rel_resid_norm );
+HYPRE_Int HYPRE_BoomerAMGGetComponentNumIterations ( HYPRE_Solver solver,
+                                                     HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_BoomerAMGGetComponentRelResidualNorms ( HYPRE_Solver solver,
+                                                        HYPRE_Real *rel_resid_norms );
 HYPRE_Int HYPRE_BoomerAMGSetVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGGetVariant ( HYPRE_Solver solver, HYPRE_Int *variant );
 HYPRE_Int HYPRE_BoomerAMGSetOverlap ( HYPRE_Solver solver, HYPRE_Int overlap );
@@ -592,6 +598,8 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetKeepStrength ( HYPRE_Solver solver, HYPRE_Int keep_strength );
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel ( HYPRE_Solver solver, HYPRE_Int sp_level );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -1149,6 +1157,8 @@ HYPRE_Int hypre_BoomerAMGGetNumIterations ( void *data, HYPRE_Int *num_iteration
 HYPRE_Int hypre_BoomerAMGGetCumNumIterations ( void *data, HYPRE_Int *cum_num_iterations );
 HYPRE_Int hypre_BoomerAMGGetResidual ( void *data, hypre_ParVector **resid );
 HYPRE_Int hypre_BoomerAMGGetRelResidualNorm ( void *data, HYPRE_Real *rel_resid_norm );
+HYPRE_Int hypre_BoomerAMGGetComponentNumIterations ( void *data, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_BoomerAMGGetComponentRelResidualNorms ( void *data, HYPRE_Real *rel_resid_norms );
 HYPRE_Int hypre_BoomerAMGSetVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGGetVariant ( void *data, HYPRE_Int *variant );
 HYPRE_Int hypre_BoomerAMGSetOverlap ( void *data, HYPRE_Int overlap );
@@ -1219,6 +1229,8 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetKeepStrength ( void *data, HYPRE_Int keep_strength );
+HYPRE_Int hypre_BoomerAMGSetSinglePrecisionLevel ( void *data, HYPRE_Int sp_level );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1232,6 +1244,12 @@ HYPRE_Int hypre_BoomerAMGGetCumNnzAP ( void *data, HYPRE_Real *cum_nnz_AP );
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSetupNumericOnly ( void *amg_vdata, hypre_ParCSRMatrix *A,
+                                            hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSetupRAPPlan ( void *amg_vdata, HYPRE_Int level,
+                                        hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                        hypre_ParCSRMatrix **A_H_ptr );
+HYPRE_Int hypre_BoomerAMGSetupSinglePrecision ( void *amg_vdata );
 
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -1698,6 +1716,8 @@ HYPRE_Int hypre_GaussElimSolveDevice ( hypre_ParAMGData *amg_data, HYPRE_Int lev
 /* par_gauss_elim.c */
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
+HYPRE_Int hypre_GaussElimSolveMultiVec ( hypre_ParAMGData *amg_data, HYPRE_Int level,
+                                         HYPRE_Int solver_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
                                  HYPRE_Int solver_type );
 
@@ -1705,6 +1725,10 @@ HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data, HYPRE_Int level,
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker,
                                  HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                  HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVecHost( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                            HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
+                                            HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, HYPRE_Int GS_order,
+                                            HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq );
 HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                                       HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                                       HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp,
@@ -1740,6 +1764,9 @@ HYPRE_Int hypre_BoomerAMGRelax6HybridSSOR( hypre_ParCSRMatrix *A, hypre_ParVecto
                                            HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega,
                                            hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
 
+HYPRE_Int hypre_BoomerAMGRelax7JacobiHost ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                            HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
+                                            hypre_ParVector *u, hypre_ParVector *Vtemp );
 HYPRE_Int hypre_BoomerAMGRelax7Jacobi( hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                        HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real *l1_norms,
                                        hypre_ParVector *u, hypre_ParVector *Vtemp );
@@ -1999,6 +2026,10 @@ HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_I
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
                                        void *result_x, void *result_y );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovIBlockInnerProd ( HYPRE_Int n, void **x, void **y, HYPRE_Real *result,
+                                          void **request );
+HYPRE_Int hypre_ParKrylovIBlockInnerProdWait ( void *request );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k,
                                    HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
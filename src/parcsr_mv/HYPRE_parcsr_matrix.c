@@ -93,6 +93,43 @@ HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixPrintCheckpoint
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixPrintCheckpoint( HYPRE_ParCSRMatrix  matrix,
+                                   const char         *file_name )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParCSRMatrixPrintCheckpoint( (hypre_ParCSRMatrix *) matrix,
+                                               file_name ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixReadCheckpoint
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixReadCheckpoint( MPI_Comm            comm,
+                                  const char         *file_name,
+                                  HYPRE_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParCSRMatrixReadCheckpoint( comm, file_name,
+                                              (hypre_ParCSRMatrix **) matrix ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixGetComm
  *--------------------------------------------------------------------------*/
@@ -408,3 +445,30 @@ HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex      alpha,
                alpha, (hypre_ParCSRMatrix *) A,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixInvalidateSpMVData
+ *
+ * Frees the data derived from the CSR arrays for the host SpMV (e.g., the
+ * SELL-C-sigma copies), so that it is rebuilt from the current values by
+ * the next matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixInvalidateSpMVData( HYPRE_ParCSRMatrix matrix )
+{
+   hypre_ParCSRMatrix *A = (hypre_ParCSRMatrix *) matrix;
+
+   if (!A)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixDestroySellData(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixDestroySellData(hypre_ParCSRMatrixOffd(A));
+   hypre_CSRMatrixDestroySellData(hypre_ParCSRMatrixDiagT(A));
+   hypre_CSRMatrixDestroySellData(hypre_ParCSRMatrixOffdT(A));
+
+   return hypre_error_flag;
+}
@@ -116,6 +116,43 @@ HYPRE_ParVectorPrintBinaryIJ( HYPRE_ParVector  vector,
                                           file_name ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorPrintCheckpoint
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorPrintCheckpoint( HYPRE_ParVector  vector,
+                                const char      *file_name )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParVectorPrintCheckpoint( (hypre_ParVector *) vector,
+                                            file_name ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorReadCheckpoint
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorReadCheckpoint( MPI_Comm         comm,
+                               const char      *file_name,
+                               HYPRE_ParVector *vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_ParVectorReadCheckpoint( comm, file_name,
+                                           (hypre_ParVector **) vector ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParVectorSetConstantValues
  *--------------------------------------------------------------------------*/
@@ -254,6 +254,10 @@ typedef struct hypre_ParVector_struct
 
    hypre_IJAssumedPart  *assumed_partition; /* only populated if this partition needed
                                               (for setting off-proc elements, for example)*/
+
+   /* File mapping that `local_vector' points into (single-rank checkpoint reads) */
+   void                 *mapped_data;
+   size_t                mapped_size;
 } hypre_ParVector;
 
 /*--------------------------------------------------------------------------
@@ -277,6 +281,8 @@ typedef struct hypre_ParVector_struct
 #define hypre_ParVectorEntryIJ(vector, i, j)    (hypre_VectorEntryIJ((vector) -> local_vector, i, j))
 
 #define hypre_ParVectorAssumedPartition(vector) ((vector) -> assumed_partition)
+#define hypre_ParVectorMappedData(vector)       ((vector) -> mapped_data)
+#define hypre_ParVectorMappedSize(vector)       ((vector) -> mapped_size)
 
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
@@ -284,6 +290,18 @@ hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
    return hypre_VectorMemoryLocation(hypre_ParVectorLocalVector(vector));
 }
 
+/*--------------------------------------------------------------------------
+ * Handle of a non-blocking block inner product
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int          num_values;
+   HYPRE_Real        *local_result;  /* send buffer of the reduction */
+   hypre_MPI_Request  request;
+
+} hypre_ParVectorReduceHandle;
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -364,6 +382,10 @@ typedef struct hypre_ParCSRMatrix_struct
    HYPRE_Complex        *bdiaginv;
    hypre_ParCSRCommPkg  *bdiaginv_comm_pkg;
 
+   /* File mapping that `diag' points into (single-rank checkpoint reads) */
+   void                 *mapped_data;
+   size_t                mapped_size;
+
 #if defined(HYPRE_USING_GPU)
    /* these two arrays are reserveed for SoC matrices on GPUs to help build interpolation */
    HYPRE_Int            *soc_diag_j;
@@ -403,6 +425,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixMappedData(matrix)             ((matrix) -> mapped_data)
+#define hypre_ParCSRMatrixMappedSize(matrix)             ((matrix) -> mapped_size)
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -445,6 +469,53 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic plan of a sparse matrix product (hypre_ParMatmulPlan*,
+ * hypre_ParCSRMatrixRAPPlan*)
+ *
+ * Records everything of the products C = A*B and C = R^T*A*B that only
+ * depends on the sparsity patterns of the operands: the communication
+ * pattern and column indices of the external rows of B, the patterns of the
+ * intermediate product Q = A*B and of R^T, the rows of C owned by other
+ * processes, and where each contribution goes in the pattern of C. A product
+ * with the same patterns then only requires the numeric phase.
+ *
+ * Column indices of Q (and of the external rows of B) refer to the local
+ * column space [diag columns of B | col_map_offd_Q].
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_stages;      /* 1: C = A*B, 2: C = R^T*A*B */
+   hypre_ulonglongint    fingerprint[4];  /* patterns of R, A, B and C */
+
+   /* column space of Q */
+   HYPRE_Int             num_cols_diag_B;
+   HYPRE_Int             num_cols_offd_Q;
+   HYPRE_Int            *map_B_to_Q;      /* offd column of B -> offd column of Q */
+   HYPRE_Int            *map_C_to_Q;      /* offd column of C -> offd column of Q, or -1 */
+
+   /* external rows of B, one send/recv element per nonzero */
+   HYPRE_Int            *Bext_i;
+   HYPRE_Int            *Bext_j;
+   hypre_ParCSRCommPkg  *Bext_comm_pkg;
+
+   /* intermediate product Q = A*B and transpose of R (two stages only) */
+   HYPRE_Int            *Q_i;
+   HYPRE_Int            *Q_j;
+   hypre_CSRMatrix      *RT_diag;
+   hypre_CSRMatrix      *RT_offd;
+   HYPRE_Int            *RT_diag_perm;    /* R_diag nonzero -> RT_diag nonzero */
+   HYPRE_Int            *RT_offd_perm;
+
+   /* rows of C owned by other processes (two stages only) */
+   HYPRE_Int            *Cint_i;
+   HYPRE_Int            *Cint_j;
+   hypre_ParCSRCommPkg  *Cext_comm_pkg;
+   HYPRE_Int            *Cext_pos;        /* k >= 0: C_diag nonzero k, k < 0: C_offd nonzero -k-1 */
+
+} hypre_ParCSRSpGEMMPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -708,6 +779,9 @@ HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name,
                                    HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixPrintCheckpoint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadCheckpoint ( MPI_Comm comm, const char *file_name,
+                                             HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix,
@@ -730,6 +804,7 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                       HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixInvalidateSpMVData ( HYPRE_ParCSRMatrix matrix );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size,
@@ -741,6 +816,9 @@ HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorPrintBinaryIJ ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorPrintCheckpoint ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadCheckpoint ( MPI_Comm comm, const char *file_name,
+                                          HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -895,6 +973,15 @@ hypre_ParCSRBooleanMatrix *hypre_CSRBooleanMatrixToParCSRBooleanMatrix ( MPI_Com
 HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A,
                                              hypre_ParCSRBooleanMatrix *matrix, HYPRE_BigInt first_col_diag, HYPRE_BigInt last_col_diag );
 
+/* par_csr_checkpoint.c */
+HYPRE_Int hypre_CheckpointUnmap ( void *data, size_t size );
+HYPRE_Int hypre_ParCSRMatrixPrintCheckpoint ( hypre_ParCSRMatrix *matrix, const char *filename );
+HYPRE_Int hypre_ParCSRMatrixReadCheckpoint ( MPI_Comm comm, const char *filename,
+                                             hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParVectorPrintCheckpoint ( hypre_ParVector *vector, const char *filename );
+HYPRE_Int hypre_ParVectorReadCheckpoint ( MPI_Comm comm, const char *filename,
+                                          hypre_ParVector **vector_ptr );
+
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg,
                                                        void *send_data, void *recv_data );
@@ -1133,6 +1220,7 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
+HYPRE_Int hypre_ParCSRMatrixConvertToSinglePrecision( hypre_ParCSRMatrix *matrix );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixCreateFromDenseBlockMatrix(MPI_Comm comm,
                                                                  HYPRE_BigInt global_num_rows,
                                                                  HYPRE_BigInt global_num_cols,
@@ -1209,6 +1297,18 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceDevice ( HYPRE_Complex alpha, hypre_
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
+// r = b - A*x, r_norm = ||r||_2
+HYPRE_Int hypre_ParCSRMatrixResidual ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                       hypre_ParVector *b, hypre_ParVector *r, HYPRE_Real *r_norm );
+HYPRE_Int hypre_ParCSRMatrixResidualHost ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                           hypre_ParVector *b, hypre_ParVector *r, HYPRE_Real *r_norm );
+// r = b - A*x, y = R^T*r
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                               hypre_ParVector *b, hypre_ParCSRMatrix *R,
+                                               hypre_ParVector *r, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrictHost ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                                   hypre_ParVector *b, hypre_ParCSRMatrix *R,
+                                                   hypre_ParVector *r, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                       hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecTDevice ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
@@ -1220,6 +1320,22 @@ HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_spgemm_plan.c */
+HYPRE_Int hypre_ParCSRSpGEMMPlanDestroy( hypre_ParCSRSpGEMMPlan *plan );
+HYPRE_Int hypre_ParCSRSpGEMMPlanMatches( hypre_ParCSRSpGEMMPlan *plan, hypre_ParCSRMatrix *R,
+                                         hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                         hypre_ParCSRMatrix *C, HYPRE_Int *matches_ptr );
+HYPRE_Int hypre_ParMatmulPlanCreate( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                     hypre_ParCSRMatrix *C, hypre_ParCSRSpGEMMPlan **plan_ptr );
+HYPRE_Int hypre_ParMatmulPlanCompute( hypre_ParCSRSpGEMMPlan *plan, hypre_ParCSRMatrix *A,
+                                      hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatrixRAPPlanCreate( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                           hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *C,
+                                           hypre_ParCSRSpGEMMPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPPlanCompute( hypre_ParCSRSpGEMMPlan *plan, hypre_ParCSRMatrix *R,
+                                            hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                            hypre_ParCSRMatrix *C );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -1289,6 +1405,14 @@ HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorComponentInnerProds ( hypre_ParVector *x, hypre_ParVector *y,
+                                               HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( HYPRE_Int n, hypre_ParVector **x, hypre_ParVector **y,
+                                         HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorBlockInnerProdStart ( HYPRE_Int n, hypre_ParVector **x,
+                                              hypre_ParVector **y, HYPRE_Real *result,
+                                              hypre_ParVectorReduceHandle **handle_ptr );
+HYPRE_Int hypre_ParVectorBlockInnerProdWait ( hypre_ParVectorReduceHandle *handle );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
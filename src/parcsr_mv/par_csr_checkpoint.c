@@ -0,0 +1,915 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary checkpoint files for ParCSR matrices and ParVectors.
+ *
+ * A checkpoint is a single shared file written collectively by all ranks of
+ * the object's communicator. Its layout is independent of the number of
+ * writer ranks, so it can be read back with a different number of ranks
+ * (the rows are then redistributed uniformly). All sections start at
+ * 64-byte aligned offsets:
+ *
+ *    header     16 uint64 words (see below)
+ *    parts      row starts, then column starts of the writer ranks
+ *               (2 * (num_parts + 1) uint64 words)
+ *    rowptr     global row pointer, (global_num_rows + 1) uint64 words
+ *               (matrices only)
+ *    cols       global column indices, index_size bytes each, with the
+ *               diagonal block of every row first (matrices only)
+ *    values     coefficients, value_size bytes each
+ *
+ * Header words:
+ *
+ *    0) Magic number ("HYPRECKP")
+ *    1) Format version
+ *    2) Object kind (1: ParCSR matrix, 2: ParVector)
+ *    3) Number of bytes for storing an index
+ *    4) Number of bytes for storing a coefficient
+ *    5) Number of global rows
+ *    6) Number of global columns (1 for vectors)
+ *    7) Number of global nonzeros (global rows for vectors)
+ *    8) Number of writer ranks (num_parts)
+ *    9) Offset of the parts section
+ *   10) Offset of the rowptr section (0 for vectors)
+ *   11) Offset of the cols section (0 for vectors)
+ *   12) Offset of the values section
+ *   13) Total file size in bytes
+ *   14-15) Reserved
+ *
+ * In parallel builds the file is accessed with MPI-IO collective calls. When
+ * a checkpoint is read by a single rank, and the stored index and
+ * coefficient sizes match HYPRE_Int and HYPRE_Complex, the column indices
+ * and coefficients are not copied: the file is mapped into memory, the
+ * object points directly into the mapping, and the mapping is released
+ * when the object is destroyed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#include "../seq_mv/csr_matrix.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#define hypre_CHECKPOINT_MAGIC        0x504B434552505948ULL /* "HYPRECKP" */
+#define hypre_CHECKPOINT_VERSION      1
+#define hypre_CHECKPOINT_KIND_MATRIX  1
+#define hypre_CHECKPOINT_KIND_VECTOR  2
+#define hypre_CHECKPOINT_HEADER_SIZE  16
+#define hypre_CHECKPOINT_ALIGNMENT    64
+#define hypre_CHECKPOINT_MAX_CHUNK    ((size_t) 1 << 30)
+
+#define hypre_CheckpointAlign(offset) \
+   ((((offset) + hypre_CHECKPOINT_ALIGNMENT - 1) / hypre_CHECKPOINT_ALIGNMENT) * \
+    hypre_CHECKPOINT_ALIGNMENT)
+
+typedef struct
+{
+   MPI_Comm   comm;
+#ifdef HYPRE_SEQUENTIAL
+   FILE      *fp;
+#else
+   MPI_File   fh;
+#endif
+
+} hypre_CheckpointFile;
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointOpen
+ *
+ * Collectively opens a checkpoint file for reading or writing. When writing,
+ * the file is truncated/extended to "size" bytes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CheckpointOpen( MPI_Comm              comm,
+                      const char           *filename,
+                      HYPRE_Int             write,
+                      hypre_uint64          size,
+                      hypre_CheckpointFile *file )
+{
+   file -> comm = comm;
+
+#ifdef HYPRE_SEQUENTIAL
+   HYPRE_UNUSED_VAR(size);
+
+   if ((file -> fp = fopen(filename, write ? "wb" : "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open checkpoint file!");
+   }
+#else
+   HYPRE_Int  ierr;
+
+   ierr = MPI_File_open(comm, (char *) filename,
+                        write ? (MPI_MODE_CREATE | MPI_MODE_WRONLY) : MPI_MODE_RDONLY,
+                        MPI_INFO_NULL, &(file -> fh));
+   if (ierr != MPI_SUCCESS)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open checkpoint file!");
+      return hypre_error_flag;
+   }
+
+   if (write && MPI_File_set_size(file -> fh, (MPI_Offset) size) != MPI_SUCCESS)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not resize checkpoint file!");
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointClose
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CheckpointClose( hypre_CheckpointFile *file )
+{
+#ifdef HYPRE_SEQUENTIAL
+   fclose(file -> fp);
+#else
+   MPI_File_close(&(file -> fh));
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointAccess
+ *
+ * Collectively reads (write = 0) or writes (write = 1) nbytes bytes at the
+ * given file offset. Every rank of the communicator must call this function,
+ * possibly with nbytes = 0. Large transfers are split in chunks so that the
+ * byte count always fits in an int.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CheckpointAccess( hypre_CheckpointFile *file,
+                        HYPRE_Int             write,
+                        hypre_uint64          offset,
+                        void                 *buffer,
+                        size_t                nbytes )
+{
+#ifdef HYPRE_SEQUENTIAL
+   size_t  count;
+
+   if (nbytes == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (fseek(file -> fp, (long) offset, SEEK_SET))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not seek in checkpoint file!");
+      return hypre_error_flag;
+   }
+
+   count = write ? fwrite(buffer, 1, nbytes, file -> fp) :
+           fread(buffer, 1, nbytes, file -> fp);
+   if (count != nbytes)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not access checkpoint file!");
+   }
+#else
+   char        *cbuffer = (char *) buffer;
+   size_t       start, length;
+   HYPRE_Int    num_chunks, max_chunks, k;
+   HYPRE_Int    ierr, failed = 0, any_failed;
+   MPI_Status   status;
+
+   num_chunks = (HYPRE_Int) ((nbytes + hypre_CHECKPOINT_MAX_CHUNK - 1) /
+                             hypre_CHECKPOINT_MAX_CHUNK);
+   hypre_MPI_Allreduce(&num_chunks, &max_chunks, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                       file -> comm);
+
+   for (k = 0; k < max_chunks; k++)
+   {
+      start  = (size_t) k * hypre_CHECKPOINT_MAX_CHUNK;
+      length = (start < nbytes) ? hypre_min(hypre_CHECKPOINT_MAX_CHUNK, nbytes - start) : 0;
+
+      if (write)
+      {
+         ierr = MPI_File_write_at_all(file -> fh, (MPI_Offset) (offset + start),
+                                      length ? cbuffer + start : NULL,
+                                      (int) length, MPI_BYTE, &status);
+      }
+      else
+      {
+         ierr = MPI_File_read_at_all(file -> fh, (MPI_Offset) (offset + start),
+                                     length ? cbuffer + start : NULL,
+                                     (int) length, MPI_BYTE, &status);
+      }
+      failed |= (ierr != MPI_SUCCESS);
+   }
+
+   hypre_MPI_Allreduce(&failed, &any_failed, 1, HYPRE_MPI_INT, hypre_MPI_MAX, file -> comm);
+   if (any_failed)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not access checkpoint file!");
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointWriteHeaderAndParts
+ *
+ * Writes the header (rank 0) and the parts section. Each rank writes its
+ * own row and column starts; the last rank also writes the closing entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CheckpointWriteHeaderAndParts( hypre_CheckpointFile *file,
+                                     hypre_uint64         *header,
+                                     HYPRE_BigInt         *row_starts,
+                                     HYPRE_BigInt         *col_starts )
+{
+   MPI_Comm      comm = file -> comm;
+   HYPRE_Int     num_procs, myid;
+   HYPRE_Int     last;
+   hypre_uint64  parts[2];
+   hypre_uint64  parts_offset = header[9];
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+   last = (myid == num_procs - 1);
+
+   hypre_CheckpointAccess(file, 1, 0, header,
+                          myid ? 0 : hypre_CHECKPOINT_HEADER_SIZE * sizeof(hypre_uint64));
+
+   parts[0] = (hypre_uint64) row_starts[0];
+   parts[1] = (hypre_uint64) row_starts[1];
+   hypre_CheckpointAccess(file, 1, parts_offset + (hypre_uint64) myid * sizeof(hypre_uint64),
+                          parts, (size_t) (1 + last) * sizeof(hypre_uint64));
+
+   parts_offset += (hypre_uint64) (num_procs + 1) * sizeof(hypre_uint64);
+   parts[0] = (hypre_uint64) col_starts[0];
+   parts[1] = (hypre_uint64) col_starts[1];
+   hypre_CheckpointAccess(file, 1, parts_offset + (hypre_uint64) myid * sizeof(hypre_uint64),
+                          parts, (size_t) (1 + last) * sizeof(hypre_uint64));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointReadHeaderAndParts
+ *
+ * Reads and validates the header, and computes the local row and column
+ * ranges. The writer's partitioning is reused when the number of ranks
+ * matches; otherwise rows and columns are distributed uniformly.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CheckpointReadHeaderAndParts( hypre_CheckpointFile *file,
+                                    hypre_uint64          kind,
+                                    hypre_uint64         *header,
+                                    HYPRE_BigInt         *row_starts,
+                                    HYPRE_BigInt         *col_starts )
+{
+   MPI_Comm      comm = file -> comm;
+   HYPRE_Int     num_procs, myid;
+   HYPRE_BigInt  global_num_rows, global_num_cols;
+   hypre_uint64  parts[2];
+   hypre_uint64  parts_offset;
+   HYPRE_Int     one = 1;
+
+   /* Exit if trying to read from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   hypre_CheckpointAccess(file, 0, 0, header,
+                          hypre_CHECKPOINT_HEADER_SIZE * sizeof(hypre_uint64));
+   if (hypre_error_flag)
+   {
+      return hypre_error_flag;
+   }
+
+   if (header[0] != hypre_CHECKPOINT_MAGIC)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Not a hypre checkpoint file!");
+      return hypre_error_flag;
+   }
+   if (header[1] != hypre_CHECKPOINT_VERSION)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Unsupported checkpoint version!");
+      return hypre_error_flag;
+   }
+   if (header[2] != kind)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Checkpoint stores a different object kind!");
+      return hypre_error_flag;
+   }
+   if (header[3] != sizeof(hypre_uint32) && header[3] != sizeof(hypre_uint64))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Unsupported checkpoint index size!");
+      return hypre_error_flag;
+   }
+   if (header[4] != sizeof(HYPRE_Complex))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Checkpoint coefficient size does not match!");
+      return hypre_error_flag;
+   }
+
+   global_num_rows = (HYPRE_BigInt) header[5];
+   global_num_cols = (HYPRE_BigInt) header[6];
+
+   if ((hypre_uint64) num_procs == header[8])
+   {
+      parts_offset = header[9] + (hypre_uint64) myid * sizeof(hypre_uint64);
+      hypre_CheckpointAccess(file, 0, parts_offset, parts, 2 * sizeof(hypre_uint64));
+      row_starts[0] = (HYPRE_BigInt) parts[0];
+      row_starts[1] = (HYPRE_BigInt) parts[1];
+
+      parts_offset += (header[8] + 1) * sizeof(hypre_uint64);
+      hypre_CheckpointAccess(file, 0, parts_offset, parts, 2 * sizeof(hypre_uint64));
+      col_starts[0] = (HYPRE_BigInt) parts[0];
+      col_starts[1] = (HYPRE_BigInt) parts[1];
+   }
+   else
+   {
+      hypre_GenerateLocalPartitioning(global_num_rows, num_procs, myid, row_starts);
+      hypre_GenerateLocalPartitioning(global_num_cols, num_procs, myid, col_starts);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointMap
+ *
+ * Maps a whole checkpoint file into memory (private, copy-on-write). The
+ * objects built on top of it do not own their index and coefficient arrays;
+ * instead they record the mapping, which hypre_CheckpointUnmap releases when
+ * they are destroyed.
+ *--------------------------------------------------------------------------*/
+
+static char *
+hypre_CheckpointMap( const char   *filename,
+                     hypre_uint64  size )
+{
+#ifndef WIN32
+   void  *map;
+   int    fd;
+
+   if ((fd = open(filename, O_RDONLY)) < 0)
+   {
+      return NULL;
+   }
+   map = mmap(NULL, (size_t) size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+
+   return (map == MAP_FAILED) ? NULL : (char *) map;
+#else
+   HYPRE_UNUSED_VAR(filename);
+   HYPRE_UNUSED_VAR(size);
+
+   return NULL;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CheckpointUnmap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CheckpointUnmap( void   *data,
+                       size_t  size )
+{
+#ifndef WIN32
+   munmap(data, size);
+#else
+   HYPRE_UNUSED_VAR(data);
+   HYPRE_UNUSED_VAR(size);
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintCheckpoint
+ *
+ * Collectively writes a ParCSR matrix to a single binary checkpoint file.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintCheckpoint( hypre_ParCSRMatrix *matrix,
+                                   const char         *filename )
+{
+   MPI_Comm              comm = hypre_ParCSRMatrixComm(matrix);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+   hypre_ParCSRMatrix   *h_matrix;
+
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_BigInt          first_col_diag;
+   HYPRE_BigInt         *row_starts, *col_starts;
+   HYPRE_BigInt          global_num_rows;
+   HYPRE_Int             num_rows;
+
+   HYPRE_Int             num_procs, myid;
+   HYPRE_BigInt          local_nnz, nnz_end, global_nnz;
+   HYPRE_Int             i, j, k;
+   HYPRE_Int             one = 1;
+
+   hypre_CheckpointFile  file;
+   hypre_uint64          header[hypre_CHECKPOINT_HEADER_SIZE];
+   hypre_uint64          offset;
+   hypre_uint64         *rowptr;
+   HYPRE_BigInt         *cols;
+   HYPRE_Complex        *values;
+
+   /* Exit if trying to write from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Create temporary matrix on host memory if needed */
+   h_matrix = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+              hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST) : matrix;
+
+   diag            = hypre_ParCSRMatrixDiag(h_matrix);
+   offd            = hypre_ParCSRMatrixOffd(h_matrix);
+   diag_i          = hypre_CSRMatrixI(diag);
+   diag_j          = hypre_CSRMatrixJ(diag);
+   diag_data       = hypre_CSRMatrixData(diag);
+   offd_i          = hypre_CSRMatrixI(offd);
+   offd_j          = hypre_CSRMatrixJ(offd);
+   offd_data       = hypre_CSRMatrixData(offd);
+   col_map_offd    = hypre_ParCSRMatrixColMapOffd(h_matrix);
+   first_col_diag  = hypre_ParCSRMatrixFirstColDiag(h_matrix);
+   row_starts      = hypre_ParCSRMatrixRowStarts(h_matrix);
+   col_starts      = hypre_ParCSRMatrixColStarts(h_matrix);
+   global_num_rows = hypre_ParCSRMatrixGlobalNumRows(h_matrix);
+   num_rows        = hypre_ParCSRMatrixNumRows(h_matrix);
+
+   /* Position of the local rows in the global nonzero sequence */
+   local_nnz = (HYPRE_BigInt) (diag_i[num_rows] + offd_i[num_rows]);
+   hypre_MPI_Scan(&local_nnz, &nnz_end, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   hypre_MPI_Allreduce(&local_nnz, &global_nnz, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+
+   /*---------------------------------------------
+    * Compute file layout
+    *---------------------------------------------*/
+
+   header[0]  = hypre_CHECKPOINT_MAGIC;
+   header[1]  = (hypre_uint64) hypre_CHECKPOINT_VERSION;
+   header[2]  = (hypre_uint64) hypre_CHECKPOINT_KIND_MATRIX;
+   header[3]  = (hypre_uint64) sizeof(HYPRE_BigInt);
+   header[4]  = (hypre_uint64) sizeof(HYPRE_Complex);
+   header[5]  = (hypre_uint64) global_num_rows;
+   header[6]  = (hypre_uint64) hypre_ParCSRMatrixGlobalNumCols(h_matrix);
+   header[7]  = (hypre_uint64) global_nnz;
+   header[8]  = (hypre_uint64) num_procs;
+   offset     = hypre_CHECKPOINT_HEADER_SIZE * sizeof(hypre_uint64);
+   header[9]  = hypre_CheckpointAlign(offset);
+   offset     = header[9] + 2 * (header[8] + 1) * sizeof(hypre_uint64);
+   header[10] = hypre_CheckpointAlign(offset);
+   offset     = header[10] + (header[5] + 1) * sizeof(hypre_uint64);
+   header[11] = hypre_CheckpointAlign(offset);
+   offset     = header[11] + header[7] * header[3];
+   header[12] = hypre_CheckpointAlign(offset);
+   header[13] = header[12] + header[7] * header[4];
+   header[14] = 0;
+   header[15] = 0;
+
+   /*---------------------------------------------
+    * Pack local rows: diagonal block first
+    *---------------------------------------------*/
+
+   rowptr = hypre_TAlloc(hypre_uint64, num_rows + 1, HYPRE_MEMORY_HOST);
+   cols   = hypre_TAlloc(HYPRE_BigInt, local_nnz, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Complex, local_nnz, HYPRE_MEMORY_HOST);
+
+   k = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      rowptr[i] = (hypre_uint64) (nnz_end - local_nnz + k);
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++, k++)
+      {
+         cols[k]   = first_col_diag + (HYPRE_BigInt) diag_j[j];
+         values[k] = diag_data[j];
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++, k++)
+      {
+         cols[k]   = col_map_offd[offd_j[j]];
+         values[k] = offd_data[j];
+      }
+   }
+   rowptr[num_rows] = (hypre_uint64) nnz_end;
+
+   /*---------------------------------------------
+    * Write sections
+    *---------------------------------------------*/
+
+   hypre_CheckpointOpen(comm, filename, 1, header[13], &file);
+   if (!hypre_error_flag)
+   {
+      hypre_CheckpointWriteHeaderAndParts(&file, header, row_starts, col_starts);
+
+      offset = header[10] + (hypre_uint64) row_starts[0] * sizeof(hypre_uint64);
+      hypre_CheckpointAccess(&file, 1, offset, rowptr, (size_t) (num_rows +
+                             (myid == num_procs - 1)) * sizeof(hypre_uint64));
+
+      offset = header[11] + (hypre_uint64) (nnz_end - local_nnz) * header[3];
+      hypre_CheckpointAccess(&file, 1, offset, cols, (size_t) local_nnz * sizeof(HYPRE_BigInt));
+
+      offset = header[12] + (hypre_uint64) (nnz_end - local_nnz) * header[4];
+      hypre_CheckpointAccess(&file, 1, offset, values, (size_t) local_nnz * sizeof(HYPRE_Complex));
+
+      hypre_CheckpointClose(&file);
+   }
+
+   hypre_TFree(rowptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   /* Free temporary matrix */
+   if (h_matrix != matrix)
+   {
+      hypre_ParCSRMatrixDestroy(h_matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadCheckpointMapped
+ *
+ * Single-rank reader: the diagonal block points into a mapping of the file.
+ * Only the row pointer is copied (and converted to HYPRE_Int). Returns NULL
+ * if the file cannot be mapped, in which case the caller falls back to the
+ * regular reader.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRMatrix *
+hypre_ParCSRMatrixReadCheckpointMapped( MPI_Comm      comm,
+                                        const char   *filename,
+                                        hypre_uint64 *header )
+{
+   hypre_ParCSRMatrix  *matrix;
+   hypre_CSRMatrix     *diag, *offd;
+   HYPRE_Int           *diag_i;
+   hypre_uint64        *rowptr;
+   HYPRE_BigInt         row_starts[2], col_starts[2];
+   HYPRE_Int            num_rows = (HYPRE_Int) header[5];
+   HYPRE_Int            num_cols = (HYPRE_Int) header[6];
+   HYPRE_Int            nnz      = (HYPRE_Int) header[7];
+   HYPRE_Int            i;
+   char                *map;
+
+   if ((map = hypre_CheckpointMap(filename, header[13])) == NULL)
+   {
+      return NULL;
+   }
+   rowptr = (hypre_uint64 *) (map + header[10]);
+
+   diag_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_rows; i++)
+   {
+      diag_i[i] = (HYPRE_Int) rowptr[i];
+   }
+
+   diag = hypre_CSRMatrixCreate(num_rows, num_cols, nnz);
+   hypre_CSRMatrixMemoryLocation(diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(diag)        = diag_i;
+   hypre_CSRMatrixJ(diag)        = (HYPRE_Int *) (map + header[11]);
+   hypre_CSRMatrixData(diag)     = (HYPRE_Complex *) (map + header[12]);
+   hypre_CSRMatrixOwnsData(diag) = 0;
+   if (num_rows == num_cols)
+   {
+      hypre_CSRMatrixReorder(diag);
+   }
+
+   offd = hypre_CSRMatrixCreate(num_rows, 0, 0);
+   hypre_CSRMatrixInitialize_v2(offd, 0, HYPRE_MEMORY_HOST);
+
+   row_starts[0] = col_starts[0] = 0;
+   row_starts[1] = (HYPRE_BigInt) num_rows;
+   col_starts[1] = (HYPRE_BigInt) num_cols;
+
+   matrix = hypre_ParCSRMatrixCreate(comm, row_starts[1], col_starts[1],
+                                     row_starts, col_starts, 0, nnz, 0);
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(matrix));
+   hypre_ParCSRMatrixDiag(matrix) = diag;
+   hypre_ParCSRMatrixOffd(matrix) = offd;
+   hypre_ParCSRMatrixMappedData(matrix) = (void *) map;
+   hypre_ParCSRMatrixMappedSize(matrix) = (size_t) header[13];
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadCheckpoint
+ *
+ * Collectively reads a ParCSR matrix from a checkpoint file. The writer's
+ * row partitioning is kept if the number of ranks matches; otherwise rows
+ * are redistributed uniformly. The matrix is created in host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReadCheckpoint( MPI_Comm             comm,
+                                  const char          *filename,
+                                  hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_ParCSRMatrix   *matrix = NULL;
+   hypre_CSRMatrix      *local, *diag, *offd;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_BigInt          row_starts[2], col_starts[2];
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             num_procs;
+   HYPRE_Int             num_rows, nnz, i;
+   HYPRE_Int            *local_i;
+   HYPRE_BigInt         *local_j;
+   HYPRE_Complex        *local_data;
+
+   hypre_CheckpointFile  file;
+   hypre_uint64          header[hypre_CHECKPOINT_HEADER_SIZE];
+   hypre_uint64         *rowptr;
+   hypre_uint64          first_nnz;
+   void                 *buffer;
+
+   *matrix_ptr = NULL;
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_CheckpointOpen(comm, filename, 0, 0, &file);
+   if (hypre_error_flag)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CheckpointReadHeaderAndParts(&file, hypre_CHECKPOINT_KIND_MATRIX, header,
+                                      row_starts, col_starts);
+   if (hypre_error_flag)
+   {
+      hypre_CheckpointClose(&file);
+      return hypre_error_flag;
+   }
+
+   /* Zero-copy path */
+   if (num_procs == 1 && header[3] == sizeof(HYPRE_Int) &&
+       header[7] <= (hypre_uint64) HYPRE_INT_MAX)
+   {
+      matrix = hypre_ParCSRMatrixReadCheckpointMapped(comm, filename, header);
+   }
+
+   if (!matrix)
+   {
+      /* Row pointer of the local rows */
+      num_rows = (HYPRE_Int) (row_starts[1] - row_starts[0]);
+      rowptr   = hypre_TAlloc(hypre_uint64, num_rows + 1, HYPRE_MEMORY_HOST);
+      hypre_CheckpointAccess(&file, 0, header[10] + (hypre_uint64) row_starts[0] *
+                             sizeof(hypre_uint64), rowptr,
+                             (size_t) (num_rows + 1) * sizeof(hypre_uint64));
+      first_nnz = rowptr[0];
+      nnz       = (HYPRE_Int) (rowptr[num_rows] - first_nnz);
+
+      local_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_rows; i++)
+      {
+         local_i[i] = (HYPRE_Int) (rowptr[i] - first_nnz);
+      }
+      hypre_TFree(rowptr, HYPRE_MEMORY_HOST);
+
+      /* Column indices, converted to HYPRE_BigInt if needed */
+      local_j = hypre_TAlloc(HYPRE_BigInt, nnz, HYPRE_MEMORY_HOST);
+      buffer  = (header[3] == sizeof(HYPRE_BigInt)) ? (void *) local_j :
+                hypre_TAlloc(char, (size_t) nnz * header[3], HYPRE_MEMORY_HOST);
+      hypre_CheckpointAccess(&file, 0, header[11] + first_nnz * header[3], buffer,
+                             (size_t) nnz * header[3]);
+      if (buffer != (void *) local_j)
+      {
+         for (i = 0; i < nnz; i++)
+         {
+            local_j[i] = (header[3] == sizeof(hypre_uint32)) ?
+                         (HYPRE_BigInt) ((hypre_uint32 *) buffer)[i] :
+                         (HYPRE_BigInt) ((hypre_uint64 *) buffer)[i];
+         }
+         hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+      }
+
+      /* Coefficients */
+      local_data = hypre_TAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+      hypre_CheckpointAccess(&file, 0, header[12] + first_nnz * header[4], local_data,
+                             (size_t) nnz * sizeof(HYPRE_Complex));
+
+      /* Split into diagonal and off-diagonal blocks */
+      local = hypre_CSRMatrixCreate(num_rows, (HYPRE_Int) header[6], nnz);
+      hypre_CSRMatrixMemoryLocation(local) = HYPRE_MEMORY_HOST;
+      hypre_CSRMatrixI(local)    = local_i;
+      hypre_CSRMatrixBigJ(local) = local_j;
+      hypre_CSRMatrixData(local) = local_data;
+
+      hypre_CSRMatrixSplit(local, col_starts[0], col_starts[1] - 1, 0, NULL,
+                           &num_cols_offd, &col_map_offd, &diag, &offd);
+      hypre_CSRMatrixDestroy(local);
+
+      if (hypre_CSRMatrixNumRows(diag) == hypre_CSRMatrixNumCols(diag))
+      {
+         hypre_CSRMatrixReorder(diag);
+      }
+
+      matrix = hypre_ParCSRMatrixCreate(comm, (HYPRE_BigInt) header[5],
+                                        (HYPRE_BigInt) header[6],
+                                        row_starts, col_starts, num_cols_offd,
+                                        hypre_CSRMatrixNumNonzeros(diag),
+                                        hypre_CSRMatrixNumNonzeros(offd));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(matrix));
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(matrix));
+      hypre_ParCSRMatrixDiag(matrix)       = diag;
+      hypre_ParCSRMatrixOffd(matrix)       = offd;
+      hypre_ParCSRMatrixColMapOffd(matrix) = col_map_offd;
+   }
+
+   hypre_CheckpointClose(&file);
+
+   hypre_ParCSRMatrixSetNumNonzeros(matrix);
+   hypre_ParCSRMatrixSetDNumNonzeros(matrix);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintCheckpoint
+ *
+ * Collectively writes a ParVector to a single binary checkpoint file.
+ * Multivectors are not supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintCheckpoint( hypre_ParVector *vector,
+                                const char      *filename )
+{
+   MPI_Comm              comm = hypre_ParVectorComm(vector);
+   HYPRE_MemoryLocation  memory_location = hypre_ParVectorMemoryLocation(vector);
+   hypre_ParVector      *h_vector;
+   HYPRE_BigInt         *partitioning = hypre_ParVectorPartitioning(vector);
+   HYPRE_BigInt          col_starts[2];
+   HYPRE_Int             num_procs, myid;
+   HYPRE_Int             one = 1;
+
+   hypre_CheckpointFile  file;
+   hypre_uint64          header[hypre_CHECKPOINT_HEADER_SIZE];
+   hypre_uint64          offset;
+
+   /* Exit if trying to write from big-endian machine */
+   if ((*(char*)&one) == 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Support to big-endian machines is incomplete!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_VectorNumVectors(hypre_ParVectorLocalVector(vector)) > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multivector checkpoints are not supported!");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Create temporary vector on host memory if needed */
+   h_vector = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+              hypre_ParVectorCloneDeep_v2(vector, HYPRE_MEMORY_HOST) : vector;
+
+   header[0]  = hypre_CHECKPOINT_MAGIC;
+   header[1]  = (hypre_uint64) hypre_CHECKPOINT_VERSION;
+   header[2]  = (hypre_uint64) hypre_CHECKPOINT_KIND_VECTOR;
+   header[3]  = (hypre_uint64) sizeof(HYPRE_BigInt);
+   header[4]  = (hypre_uint64) sizeof(HYPRE_Complex);
+   header[5]  = (hypre_uint64) hypre_ParVectorGlobalSize(h_vector);
+   header[6]  = 1;
+   header[7]  = header[5];
+   header[8]  = (hypre_uint64) num_procs;
+   offset     = hypre_CHECKPOINT_HEADER_SIZE * sizeof(hypre_uint64);
+   header[9]  = hypre_CheckpointAlign(offset);
+   header[10] = 0;
+   header[11] = 0;
+   offset     = header[9] + 2 * (header[8] + 1) * sizeof(hypre_uint64);
+   header[12] = hypre_CheckpointAlign(offset);
+   header[13] = header[12] + header[7] * header[4];
+   header[14] = 0;
+   header[15] = 0;
+
+   col_starts[0] = 0;
+   col_starts[1] = (myid == num_procs - 1) ? 1 : 0;
+
+   hypre_CheckpointOpen(comm, filename, 1, header[13], &file);
+   if (!hypre_error_flag)
+   {
+      hypre_CheckpointWriteHeaderAndParts(&file, header, partitioning, col_starts);
+
+      offset = header[12] + (hypre_uint64) partitioning[0] * header[4];
+      hypre_CheckpointAccess(&file, 1, offset,
+                             hypre_VectorData(hypre_ParVectorLocalVector(h_vector)),
+                             (size_t) (partitioning[1] - partitioning[0]) * sizeof(HYPRE_Complex));
+
+      hypre_CheckpointClose(&file);
+   }
+
+   /* Free temporary vector */
+   if (h_vector != vector)
+   {
+      hypre_ParVectorDestroy(h_vector);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadCheckpoint
+ *
+ * Collectively reads a ParVector from a checkpoint file. The vector is
+ * created in host memory; with a single rank its data points into a mapping
+ * of the file.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorReadCheckpoint( MPI_Comm          comm,
+                               const char       *filename,
+                               hypre_ParVector **vector_ptr )
+{
+   hypre_ParVector      *vector;
+   hypre_Vector         *local_vector;
+   HYPRE_BigInt          partitioning[2], col_starts[2];
+   HYPRE_Int             num_procs;
+   char                 *map = NULL;
+
+   hypre_CheckpointFile  file;
+   hypre_uint64          header[hypre_CHECKPOINT_HEADER_SIZE];
+
+   *vector_ptr = NULL;
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_CheckpointOpen(comm, filename, 0, 0, &file);
+   if (hypre_error_flag)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CheckpointReadHeaderAndParts(&file, hypre_CHECKPOINT_KIND_VECTOR, header,
+                                      partitioning, col_starts);
+   if (hypre_error_flag)
+   {
+      hypre_CheckpointClose(&file);
+      return hypre_error_flag;
+   }
+
+   vector = hypre_ParVectorCreate(comm, (HYPRE_BigInt) header[5], partitioning);
+   local_vector = hypre_ParVectorLocalVector(vector);
+
+   /* Zero-copy path */
+   if (num_procs == 1)
+   {
+      map = hypre_CheckpointMap(filename, header[13]);
+   }
+
+   if (map)
+   {
+      hypre_ParVectorInitializeShell(vector);
+      hypre_VectorMemoryLocation(local_vector) = HYPRE_MEMORY_HOST;
+      hypre_VectorData(local_vector)      = (HYPRE_Complex *) (map + header[12]);
+      hypre_VectorOwnsData(local_vector)  = 0;
+      hypre_ParVectorMappedData(vector)   = (void *) map;
+      hypre_ParVectorMappedSize(vector)   = (size_t) header[13];
+   }
+   else
+   {
+      hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+      hypre_CheckpointAccess(&file, 0, header[12] + (hypre_uint64) partitioning[0] * header[4],
+                             hypre_VectorData(local_vector),
+                             (size_t) (partitioning[1] - partitioning[0]) * sizeof(HYPRE_Complex));
+   }
+
+   hypre_CheckpointClose(&file);
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
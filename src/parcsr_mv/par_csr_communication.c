@@ -1071,6 +1071,7 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
    HYPRE_Int    *send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
 
    HYPRE_Int    *send_map_elmts_new;
+   HYPRE_Int     num_elmts, elmt;
 
    HYPRE_Int     i, j;
 
@@ -1078,59 +1079,34 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
 
    if (num_components_in != num_components)
    {
+      /* Number of send elements of a single component */
+      num_elmts = send_map_starts[num_sends] / num_components;
+
       /* Update number of components in the communication package */
       hypre_ParCSRCommPkgNumComponents(comm_pkg) = num_components_in;
 
       /* Allocate send_maps_elmts */
-      send_map_elmts_new = hypre_CTAlloc(HYPRE_Int,
-                                         send_map_starts[num_sends] * num_components_in,
+      send_map_elmts_new = hypre_CTAlloc(HYPRE_Int, num_elmts * num_components_in,
                                          HYPRE_MEMORY_HOST);
 
-      /* Update send_maps_elmts */
-      if (num_components_in > num_components)
+      /* Update send_maps_elmts. The entries of the first component give the
+         (already strided, if num_components > 1) local indices */
+      for (i = 0; i < num_elmts; i++)
       {
-         if (num_components == 1)
+         elmt = send_map_elmts[i * num_components];
+         if (num_components_in == 1)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
-            {
-               for (j = 0; j < num_components_in; j++)
-               {
-                  send_map_elmts_new[i * num_components_in + j] = send_map_elmts[i] * idxstride +
-                                                                  j * vecstride;
-               }
-            }
+            send_map_elmts_new[i] = elmt;
          }
          else
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            if (num_components == 1)
             {
-               for (j = 0; j < num_components_in; j++)
-               {
-                  send_map_elmts_new[i * num_components_in + j] =
-                     send_map_elmts[i * num_components] * idxstride + j * vecstride;
-               }
+               elmt *= idxstride;
             }
-         }
-      }
-      else
-      {
-         /* num_components_in < num_components */
-         if (num_components_in == 1)
-         {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
-            {
-               send_map_elmts_new[i] = send_map_elmts[i * num_components];
-            }
-         }
-         else
-         {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (j = 0; j < num_components_in; j++)
             {
-               for (j = 0; j < num_components_in; j++)
-               {
-                  send_map_elmts_new[i * num_components_in + j] =
-                     send_map_elmts[i * num_components + j];
-               }
+               send_map_elmts_new[i * num_components_in + j] = elmt + j * vecstride;
             }
          }
       }
@@ -1147,13 +1123,13 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       /* Update send_map_starts */
       for (i = 0; i < num_sends + 1; i++)
       {
-         send_map_starts[i] *= num_components_in / num_components;
+         send_map_starts[i] = (send_map_starts[i] / num_components) * num_components_in;
       }
 
       /* Update recv_vec_starts */
       for (i = 0; i < num_recvs + 1; i++)
       {
-         recv_vec_starts[i] *= num_components_in / num_components;
+         recv_vec_starts[i] = (recv_vec_starts[i] / num_components) * num_components_in;
       }
    }
 
@@ -125,6 +125,8 @@ hypre_ParCSRMatrixCreate( MPI_Comm      comm,
 
    matrix->bdiaginv = NULL;
    matrix->bdiaginv_comm_pkg = NULL;
+   hypre_ParCSRMatrixMappedData(matrix) = NULL;
+   hypre_ParCSRMatrixMappedSize(matrix) = 0;
    matrix->bdiag_size = -1;
 
 #if defined(HYPRE_USING_GPU)
@@ -180,6 +182,12 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
          {
             hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkgT(matrix));
          }
+
+         if (hypre_ParCSRMatrixMappedData(matrix))
+         {
+            hypre_CheckpointUnmap(hypre_ParCSRMatrixMappedData(matrix),
+                                  hypre_ParCSRMatrixMappedSize(matrix));
+         }
       }
 
       /* RL: this is actually not correct since the memory_location may have been changed after allocation
@@ -501,6 +509,45 @@ hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToSinglePrecision
+ *
+ * Stores the values of the local blocks (and their transposes, if kept) in
+ * single precision. See hypre_CSRMatrixConvertToSinglePrecision.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToSinglePrecision( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParCSRMatrixDiag(matrix))
+   {
+      hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixDiag(matrix));
+   }
+
+   if (hypre_ParCSRMatrixOffd(matrix))
+   {
+      hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixOffd(matrix));
+   }
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixDiagT(matrix));
+   }
+
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertToSinglePrecision(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixCreateFromDenseBlockMatrix
  *--------------------------------------------------------------------------*/
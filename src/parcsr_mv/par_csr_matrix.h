@@ -77,6 +77,10 @@ typedef struct hypre_ParCSRMatrix_struct
    HYPRE_Complex        *bdiaginv;
    hypre_ParCSRCommPkg  *bdiaginv_comm_pkg;
 
+   /* File mapping that `diag' points into (single-rank checkpoint reads) */
+   void                 *mapped_data;
+   size_t                mapped_size;
+
 #if defined(HYPRE_USING_GPU)
    /* these two arrays are reserveed for SoC matrices on GPUs to help build interpolation */
    HYPRE_Int            *soc_diag_j;
@@ -116,6 +120,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixMappedData(matrix)             ((matrix) -> mapped_data)
+#define hypre_ParCSRMatrixMappedSize(matrix)             ((matrix) -> mapped_size)
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -158,6 +164,53 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic plan of a sparse matrix product (hypre_ParMatmulPlan*,
+ * hypre_ParCSRMatrixRAPPlan*)
+ *
+ * Records everything of the products C = A*B and C = R^T*A*B that only
+ * depends on the sparsity patterns of the operands: the communication
+ * pattern and column indices of the external rows of B, the patterns of the
+ * intermediate product Q = A*B and of R^T, the rows of C owned by other
+ * processes, and where each contribution goes in the pattern of C. A product
+ * with the same patterns then only requires the numeric phase.
+ *
+ * Column indices of Q (and of the external rows of B) refer to the local
+ * column space [diag columns of B | col_map_offd_Q].
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_stages;      /* 1: C = A*B, 2: C = R^T*A*B */
+   hypre_ulonglongint    fingerprint[4];  /* patterns of R, A, B and C */
+
+   /* column space of Q */
+   HYPRE_Int             num_cols_diag_B;
+   HYPRE_Int             num_cols_offd_Q;
+   HYPRE_Int            *map_B_to_Q;      /* offd column of B -> offd column of Q */
+   HYPRE_Int            *map_C_to_Q;      /* offd column of C -> offd column of Q, or -1 */
+
+   /* external rows of B, one send/recv element per nonzero */
+   HYPRE_Int            *Bext_i;
+   HYPRE_Int            *Bext_j;
+   hypre_ParCSRCommPkg  *Bext_comm_pkg;
+
+   /* intermediate product Q = A*B and transpose of R (two stages only) */
+   HYPRE_Int            *Q_i;
+   HYPRE_Int            *Q_j;
+   hypre_CSRMatrix      *RT_diag;
+   hypre_CSRMatrix      *RT_offd;
+   HYPRE_Int            *RT_diag_perm;    /* R_diag nonzero -> RT_diag nonzero */
+   HYPRE_Int            *RT_offd_perm;
+
+   /* rows of C owned by other processes (two stages only) */
+   HYPRE_Int            *Cint_i;
+   HYPRE_Int            *Cint_j;
+   hypre_ParCSRCommPkg  *Cext_comm_pkg;
+   HYPRE_Int            *Cext_pos;        /* k >= 0: C_diag nonzero k, k < 0: C_offd nonzero -k-1 */
+
+} hypre_ParCSRSpGEMMPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
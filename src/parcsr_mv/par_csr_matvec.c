@@ -280,6 +280,572 @@ hypre_ParCSRMatrixMatvec( HYPRE_Complex       alpha,
    return hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualHost
+ *
+ * Fused host kernel for r = b - A*x and, optionally, ||r||_2.
+ *
+ * The diag part of every row is computed while the halo of x is being
+ * exchanged. Afterwards, a single sweep adds the offd part of the boundary
+ * rows and accumulates the norm, so that r is written once and read once
+ * instead of the separate diag, offd and inner product passes. The results
+ * are bitwise identical to MatvecOutOfPlace(-1, A, x, 1, b, r) followed by
+ * InnerProd(r, r).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualHost( hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *x,
+                                hypre_ParVector    *b,
+                                hypre_ParVector    *r,
+                                HYPRE_Real         *r_norm )
+{
+   MPI_Comm                 comm          = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg     *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix         *diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int               *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex           *diag_data     = hypre_CSRMatrixData(diag);
+   hypre_CSRMatrix         *offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int               *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex           *offd_data     = hypre_CSRMatrixData(offd);
+   HYPRE_Int                num_rows      = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(offd);
+
+   HYPRE_Complex           *x_data        = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex           *b_data        = hypre_VectorData(hypre_ParVectorLocalVector(b));
+   HYPRE_Complex           *r_data        = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Complex           *x_buf_data    = NULL;
+   HYPRE_Complex           *x_ext_data    = NULL;
+   hypre_ParCSRCommHandle  *comm_handle   = NULL;
+
+   HYPRE_Real               local_norm    = 0.0;
+   HYPRE_Real               global_norm;
+   HYPRE_Complex            tempx;
+   HYPRE_Int                i, jj, num_sends;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /*---------------------------------------------------------------------
+    * Start the halo exchange of x. Note that processes without offd
+    * columns may still have to send data.
+    *--------------------------------------------------------------------*/
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, 1,
+                                      hypre_VectorVectorStride(hypre_ParVectorLocalVector(x)),
+                                      hypre_VectorIndexStride(hypre_ParVectorLocalVector(x)));
+
+   num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+   x_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+        i++)
+   {
+      x_buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                 HYPRE_MEMORY_HOST, x_buf_data,
+                                                 HYPRE_MEMORY_HOST, x_ext_data);
+
+   /*---------------------------------------------------------------------
+    * r = b - A_diag*x (and the norm if there is no offd part)
+    *--------------------------------------------------------------------*/
+
+   if (!num_cols_offd && r_norm)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i,jj,tempx) reduction(+:local_norm) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = diag_i[i]; jj < diag_i[i + 1]; jj++)
+         {
+            tempx -= diag_data[jj] * x_data[diag_j[jj]];
+         }
+         r_data[i] = b_data[i] + tempx;
+         local_norm += hypre_conj(r_data[i]) * r_data[i];
+      }
+   }
+   else
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = diag_i[i]; jj < diag_i[i + 1]; jj++)
+         {
+            tempx -= diag_data[jj] * x_data[diag_j[jj]];
+         }
+         r_data[i] = b_data[i] + tempx;
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /*---------------------------------------------------------------------
+    * r -= A_offd*x_ext (and the norm)
+    *--------------------------------------------------------------------*/
+
+   if (num_cols_offd && r_norm)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i,jj,tempx) reduction(+:local_norm) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = offd_i[i]; jj < offd_i[i + 1]; jj++)
+         {
+            tempx -= offd_data[jj] * x_ext_data[offd_j[jj]];
+         }
+         r_data[i] += tempx;
+         local_norm += hypre_conj(r_data[i]) * r_data[i];
+      }
+   }
+   else if (num_cols_offd)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = offd_i[i]; jj < offd_i[i + 1]; jj++)
+         {
+            tempx -= offd_data[jj] * x_ext_data[offd_j[jj]];
+         }
+         r_data[i] += tempx;
+      }
+   }
+
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_ext_data, HYPRE_MEMORY_HOST);
+
+   if (r_norm)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+
+      hypre_MPI_Allreduce(&local_norm, &global_norm, 1, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, comm);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+      *r_norm = hypre_sqrt(global_norm);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidual
+ *
+ * Computes r = b - A*x and, if r_norm is not NULL, r_norm = ||r||_2.
+ * Uses the fused host kernel when possible.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidual( hypre_ParCSRMatrix *A,
+                            hypre_ParVector    *x,
+                            hypre_ParVector    *b,
+                            hypre_ParVector    *r,
+                            HYPRE_Real         *r_norm )
+{
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   if (hypre_GetExecPolicy2(hypre_ParCSRMatrixMemoryLocation(A),
+                            hypre_ParVectorMemoryLocation(x)) == HYPRE_EXEC_HOST &&
+       hypre_ParVectorNumVectors(x) == 1 &&
+       !hypre_CSRMatrixDataSP(diag) && !hypre_CSRMatrixDataSP(offd) &&
+       !hypre_HandleSpMVUseSell(hypre_handle()) &&
+       x != r)
+   {
+      return hypre_ParCSRMatrixResidualHost(A, x, b, r, r_norm);
+   }
+
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r);
+
+   if (r_norm)
+   {
+      *r_norm = hypre_sqrt(hypre_ParVectorInnerProd(r, r));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrictHost
+ *
+ * Fused host kernel for r = b - A*x and y = R^T*r.
+ *
+ * The diag part of r is computed while the halo of x is being exchanged.
+ * The sweep that adds the offd part of A also scatters each finished r(i)
+ * into the local (R_diag^T) and remote (R_offd^T) parts of y, so that r is
+ * not streamed again by a separate restriction pass. The remote part is
+ * then sent back to its owners as in MatvecT. With OpenMP, the per-thread
+ * partial sums are laid out and reduced as in hypre_CSRMatrixMatvecTHost,
+ * so the results are bitwise identical to Residual(A, x, b, r) followed by
+ * MatvecT(1, R, r, 0, y).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrictHost( hypre_ParCSRMatrix *A,
+                                        hypre_ParVector    *x,
+                                        hypre_ParVector    *b,
+                                        hypre_ParCSRMatrix *R,
+                                        hypre_ParVector    *r,
+                                        hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg     *comm_pkg        = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix         *diag            = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int               *diag_i          = hypre_CSRMatrixI(diag);
+   HYPRE_Int               *diag_j          = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex           *diag_data       = hypre_CSRMatrixData(diag);
+   hypre_CSRMatrix         *offd            = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               *offd_i          = hypre_CSRMatrixI(offd);
+   HYPRE_Int               *offd_j          = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex           *offd_data       = hypre_CSRMatrixData(offd);
+   HYPRE_Int                num_rows        = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int                num_cols_offd   = hypre_CSRMatrixNumCols(offd);
+
+   hypre_ParCSRCommPkg     *R_comm_pkg      = hypre_ParCSRMatrixCommPkg(R);
+   hypre_CSRMatrix         *R_diag          = hypre_ParCSRMatrixDiag(R);
+   HYPRE_Int               *R_diag_i        = hypre_CSRMatrixI(R_diag);
+   HYPRE_Int               *R_diag_j        = hypre_CSRMatrixJ(R_diag);
+   HYPRE_Complex           *R_diag_data     = hypre_CSRMatrixData(R_diag);
+   hypre_CSRMatrix         *R_offd          = hypre_ParCSRMatrixOffd(R);
+   HYPRE_Int               *R_offd_i        = hypre_CSRMatrixI(R_offd);
+   HYPRE_Int               *R_offd_j        = hypre_CSRMatrixJ(R_offd);
+   HYPRE_Complex           *R_offd_data     = hypre_CSRMatrixData(R_offd);
+   HYPRE_Int                R_num_cols_offd = hypre_CSRMatrixNumCols(R_offd);
+
+   HYPRE_Complex           *x_data          = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex           *b_data          = hypre_VectorData(hypre_ParVectorLocalVector(b));
+   HYPRE_Complex           *r_data          = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Complex           *y_data          = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Int                y_size          = hypre_VectorSize(hypre_ParVectorLocalVector(y));
+   HYPRE_Complex           *x_buf_data      = NULL;
+   HYPRE_Complex           *x_ext_data      = NULL;
+   HYPRE_Complex           *y_tmp_data      = NULL;
+   HYPRE_Complex           *y_buf_data      = NULL;
+   HYPRE_Complex           *y_expand        = NULL;
+   HYPRE_Complex           *y_tmp_expand    = NULL;
+   hypre_ParCSRCommHandle  *comm_handle     = NULL;
+
+   HYPRE_Complex            tempx;
+   HYPRE_Int                i, j, jj, num_sends, num_threads;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   /*---------------------------------------------------------------------
+    * Start the halo exchange of x
+    *--------------------------------------------------------------------*/
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, 1,
+                                      hypre_VectorVectorStride(hypre_ParVectorLocalVector(x)),
+                                      hypre_VectorIndexStride(hypre_ParVectorLocalVector(x)));
+
+   num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+   x_ext_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for HYPRE_SMP_SCHEDULE
+#endif
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+        i++)
+   {
+      x_buf_data[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                 HYPRE_MEMORY_HOST, x_buf_data,
+                                                 HYPRE_MEMORY_HOST, x_ext_data);
+
+   /*---------------------------------------------------------------------
+    * r = b - A_diag*x
+    *--------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      tempx = 0.0;
+      for (jj = diag_i[i]; jj < diag_i[i + 1]; jj++)
+      {
+         tempx -= diag_data[jj] * x_data[diag_j[jj]];
+      }
+      r_data[i] = b_data[i] + tempx;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /*---------------------------------------------------------------------
+    * r -= A_offd*x_ext, y = R_diag^T*r and y_tmp = R_offd^T*r
+    *--------------------------------------------------------------------*/
+
+   if (!R_comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(R);
+      R_comm_pkg = hypre_ParCSRMatrixCommPkg(R);
+   }
+
+   hypre_ParCSRCommPkgUpdateVecStarts(R_comm_pkg, 1,
+                                      hypre_VectorVectorStride(hypre_ParVectorLocalVector(y)),
+                                      hypre_VectorIndexStride(hypre_ParVectorLocalVector(y)));
+
+   num_sends  = hypre_ParCSRCommPkgNumSends(R_comm_pkg);
+   y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                             hypre_ParCSRCommPkgSendMapStart(R_comm_pkg, num_sends),
+                             HYPRE_MEMORY_HOST);
+   y_tmp_data = hypre_CTAlloc(HYPRE_Complex, R_num_cols_offd, HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < y_size; i++)
+   {
+      y_data[i] = 0.0;
+   }
+
+   num_threads = hypre_NumThreads();
+   if (num_threads > 1)
+   {
+      y_expand     = hypre_CTAlloc(HYPRE_Complex, num_threads * y_size, HYPRE_MEMORY_HOST);
+      y_tmp_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * R_num_cols_offd,
+                                   HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(i,j,jj,tempx)
+#endif
+      {
+         HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+         HYPRE_Complex *y_th          = y_expand + my_thread_num * y_size;
+         HYPRE_Complex *y_tmp_th      = y_tmp_expand + my_thread_num * R_num_cols_offd;
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            if (num_cols_offd)
+            {
+               tempx = 0.0;
+               for (jj = offd_i[i]; jj < offd_i[i + 1]; jj++)
+               {
+                  tempx -= offd_data[jj] * x_ext_data[offd_j[jj]];
+               }
+               r_data[i] += tempx;
+            }
+
+            for (jj = R_diag_i[i]; jj < R_diag_i[i + 1]; jj++)
+            {
+               y_th[R_diag_j[jj]] += R_diag_data[jj] * r_data[i];
+            }
+            for (jj = R_offd_i[i]; jj < R_offd_i[i + 1]; jj++)
+            {
+               y_tmp_th[R_offd_j[jj]] += R_offd_data[jj] * r_data[i];
+            }
+         }
+
+         /* implied barrier (for threads) */
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < R_num_cols_offd; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_tmp_data[i] += y_tmp_expand[j * R_num_cols_offd + i];
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_expand[j * y_size + i];
+            }
+         }
+      } /* end parallel threaded region */
+
+      hypre_TFree(y_expand, HYPRE_MEMORY_HOST);
+      hypre_TFree(y_tmp_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         if (num_cols_offd)
+         {
+            tempx = 0.0;
+            for (jj = offd_i[i]; jj < offd_i[i + 1]; jj++)
+            {
+               tempx -= offd_data[jj] * x_ext_data[offd_j[jj]];
+            }
+            r_data[i] += tempx;
+         }
+
+         for (jj = R_diag_i[i]; jj < R_diag_i[i + 1]; jj++)
+         {
+            y_data[R_diag_j[jj]] += R_diag_data[jj] * r_data[i];
+         }
+         for (jj = R_offd_i[i]; jj < R_offd_i[i + 1]; jj++)
+         {
+            y_tmp_data[R_offd_j[jj]] += R_offd_data[jj] * r_data[i];
+         }
+      }
+   }
+
+   /*---------------------------------------------------------------------
+    * Send y_tmp back to its owners and add it to y
+    *--------------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(2, R_comm_pkg,
+                                                 HYPRE_MEMORY_HOST, y_tmp_data,
+                                                 HYPRE_MEMORY_HOST, y_buf_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   -= hypre_MPI_Wtime();
+#endif
+
+   for (i = hypre_ParCSRCommPkgSendMapStart(R_comm_pkg, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(R_comm_pkg, num_sends);
+        i++)
+   {
+      y_data[hypre_ParCSRCommPkgSendMapElmt(R_comm_pkg, i)] += y_buf_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(y_tmp_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrict
+ *
+ * Computes r = b - A*x and y = R^T*r. Uses the fused host kernel when
+ * possible, and Residual followed by MatvecT otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrict( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *x,
+                                    hypre_ParVector    *b,
+                                    hypre_ParCSRMatrix *R,
+                                    hypre_ParVector    *r,
+                                    hypre_ParVector    *y )
+{
+   hypre_CSRMatrix *diag   = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd   = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *R_diag = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix *R_offd = hypre_ParCSRMatrixOffd(R);
+
+   if (hypre_GetExecPolicy2(hypre_ParCSRMatrixMemoryLocation(A),
+                            hypre_ParVectorMemoryLocation(x)) == HYPRE_EXEC_HOST &&
+       hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(R)) == HYPRE_EXEC_HOST &&
+       hypre_ParVectorNumVectors(x) == 1 &&
+       hypre_ParVectorNumVectors(y) == 1 &&
+       !hypre_CSRMatrixDataSP(diag) && !hypre_CSRMatrixDataSP(offd) &&
+       !hypre_CSRMatrixDataSP(R_diag) && !hypre_CSRMatrixDataSP(R_offd) &&
+       !hypre_ParCSRMatrixDiagT(R) && !hypre_ParCSRMatrixOffdT(R) &&
+       !hypre_HandleSpMVUseSell(hypre_handle()) &&
+       hypre_CSRMatrixNumRows(R_diag) == hypre_CSRMatrixNumRows(diag) &&
+       x != r && y != r)
+   {
+      return hypre_ParCSRMatrixResidualRestrictHost(A, x, b, R, r, y);
+   }
+
+   hypre_ParCSRMatrixResidual(A, x, b, r, NULL);
+   hypre_ParCSRMatrixMatvecT(1.0, R, r, 0.0, y);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecTHost
  *--------------------------------------------------------------------------*/
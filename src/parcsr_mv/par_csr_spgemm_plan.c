@@ -0,0 +1,1411 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Symbolic plans for repeated sparse matrix products on the host:
+ *
+ *    C = A*B     (hypre_ParMatmulPlanCreate, hypre_ParMatmulPlanCompute)
+ *    C = R^T*A*B (hypre_ParCSRMatrixRAPPlanCreate, hypre_ParCSRMatrixRAPPlanCompute)
+ *
+ * The plan is built for an existing product matrix C (e.g., the result of
+ * hypre_ParMatmul or hypre_ParCSRMatrixRAPKT) and records the parts of the
+ * computation that only depend on the sparsity patterns. The numeric phase
+ * then exchanges values only and accumulates them directly into the data
+ * arrays of C, which keeps its pattern, col_map_offd and CommPkg.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPatternFingerprint
+ *
+ * Hash (FNV-1a) of the local sparsity pattern of a ParCSR matrix: sizes,
+ * row pointers, column indices and col_map_offd.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_FingerprintAdd( hypre_ulonglongint *h,
+                      hypre_ulonglongint  v )
+{
+   *h = (*h ^ v) * 1099511628211ULL;
+}
+
+static hypre_ulonglongint
+hypre_ParCSRMatrixPatternFingerprint( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix    *diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix    *offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           num_rows      = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int          *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_BigInt       *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int           diag_nnz      = diag_i ? diag_i[num_rows] : 0;
+   HYPRE_Int           offd_nnz      = offd_i ? offd_i[num_rows] : 0;
+   hypre_ulonglongint  h             = 14695981039346656037ULL;
+   HYPRE_Int           i;
+
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) hypre_ParCSRMatrixFirstRowIndex(A));
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) hypre_ParCSRMatrixFirstColDiag(A));
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) num_rows);
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) hypre_CSRMatrixNumCols(diag));
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) num_cols_offd);
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) diag_nnz);
+   hypre_FingerprintAdd(&h, (hypre_ulonglongint) offd_nnz);
+
+   if (diag_nnz || offd_nnz)
+   {
+      for (i = 0; i <= num_rows; i++)
+      {
+         hypre_FingerprintAdd(&h, (hypre_ulonglongint) diag_i[i]);
+         hypre_FingerprintAdd(&h, (hypre_ulonglongint) offd_i[i]);
+      }
+   }
+   for (i = 0; i < diag_nnz; i++)
+   {
+      hypre_FingerprintAdd(&h, (hypre_ulonglongint) diag_j[i]);
+   }
+   for (i = 0; i < offd_nnz; i++)
+   {
+      hypre_FingerprintAdd(&h, (hypre_ulonglongint) offd_j[i]);
+   }
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      hypre_FingerprintAdd(&h, (hypre_ulonglongint) col_map_offd[i]);
+   }
+
+   return h;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanCommPkg
+ *
+ * Creates a communication package that sends/receives the nonzeros of the
+ * rows described by (send_procs, send_row_starts) and (recv_procs,
+ * recv_row_starts), given the row pointers send_i and recv_i of the packed
+ * send and receive rows. The packed values are sent as they are, so there
+ * is no send_map_elmts.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg *
+hypre_ParCSRSpGEMMPlanCommPkg( MPI_Comm   comm,
+                               HYPRE_Int  num_sends,
+                               HYPRE_Int *send_procs,
+                               HYPRE_Int *send_row_starts,
+                               HYPRE_Int *send_i,
+                               HYPRE_Int  num_recvs,
+                               HYPRE_Int *recv_procs,
+                               HYPRE_Int *recv_row_starts,
+                               HYPRE_Int *recv_i )
+{
+   hypre_ParCSRCommPkg *comm_pkg = NULL;
+   HYPRE_Int           *nnz_send_procs, *nnz_send_starts;
+   HYPRE_Int           *nnz_recv_procs, *nnz_recv_starts;
+   HYPRE_Int            i;
+
+   nnz_send_procs  = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   nnz_send_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   nnz_recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   nnz_recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      nnz_send_procs[i] = send_procs[i];
+   }
+   for (i = 0; i <= num_sends; i++)
+   {
+      nnz_send_starts[i] = send_i[send_row_starts[i]];
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      nnz_recv_procs[i] = recv_procs[i];
+   }
+   for (i = 0; i <= num_recvs; i++)
+   {
+      nnz_recv_starts[i] = recv_i[recv_row_starts[i]];
+   }
+
+   hypre_ParCSRCommPkgCreateAndFill(comm,
+                                    num_recvs, nnz_recv_procs, nnz_recv_starts,
+                                    num_sends, nnz_send_procs, nnz_send_starts,
+                                    NULL, &comm_pkg);
+
+   return comm_pkg;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanSetupBext
+ *
+ * Symbolic exchange of the rows of B needed for the off-processor columns
+ * of A. Sets up the column space of Q = A*B and returns its col_map_offd.
+ * The nonzeros of each external row are ordered as in B: diag part first,
+ * then offd part.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanSetupBext( hypre_ParCSRSpGEMMPlan *plan,
+                                 hypre_ParCSRMatrix     *A,
+                                 hypre_ParCSRMatrix     *B,
+                                 HYPRE_BigInt          **col_map_offd_Q_ptr )
+{
+   MPI_Comm             comm             = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *B_diag           = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int           *B_diag_i         = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int           *B_diag_j         = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int            num_cols_diag_B  = hypre_CSRMatrixNumCols(B_diag);
+   hypre_CSRMatrix     *B_offd           = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int           *B_offd_i         = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int           *B_offd_j         = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int            num_cols_offd_B  = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt        *col_map_offd_B   = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt         first_col_diag_B = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_BigInt         last_col_diag_B  = first_col_diag_B + (HYPRE_BigInt) num_cols_diag_B - 1;
+
+   hypre_ParCSRCommPkg    *comm_pkg_A;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               num_sends, num_recvs, num_elmts_send, num_cols_offd_A;
+   HYPRE_Int              *send_procs, *send_map_starts, *send_map_elmts;
+   HYPRE_Int              *recv_procs, *recv_vec_starts;
+   HYPRE_Int              *send_i, *Bext_i, *Bext_j, *map_B_to_Q;
+   HYPRE_BigInt           *send_big_j, *Bext_big_j, *col_map_offd_Q;
+   HYPRE_BigInt            big_col;
+   HYPRE_Int               num_cols_offd_Q, Bext_nnz;
+   HYPRE_Int               i, j, k, row, cnt;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg_A);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg_A);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+   num_elmts_send  = send_map_starts[num_sends];
+   num_cols_offd_A = recv_vec_starts[num_recvs];
+
+   /* row lengths of the external rows */
+   send_i = hypre_CTAlloc(HYPRE_Int, num_elmts_send + 1, HYPRE_MEMORY_HOST);
+   Bext_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_elmts_send; i++)
+   {
+      row = send_map_elmts[i];
+      send_i[i + 1] = (B_diag_i[row + 1] - B_diag_i[row]) +
+                      (B_offd_i[row + 1] - B_offd_i[row]);
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg_A, send_i + 1, Bext_i + 1);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < num_elmts_send; i++)
+   {
+      send_i[i + 1] += send_i[i];
+   }
+   for (i = 0; i < num_cols_offd_A; i++)
+   {
+      Bext_i[i + 1] += Bext_i[i];
+   }
+   Bext_nnz = Bext_i[num_cols_offd_A];
+
+   (plan -> Bext_comm_pkg) = hypre_ParCSRSpGEMMPlanCommPkg(comm,
+                                                           num_sends, send_procs,
+                                                           send_map_starts, send_i,
+                                                           num_recvs, recv_procs,
+                                                           recv_vec_starts, Bext_i);
+
+   /* global column indices of the external rows */
+   send_big_j = hypre_TAlloc(HYPRE_BigInt, send_i[num_elmts_send], HYPRE_MEMORY_HOST);
+   Bext_big_j = hypre_TAlloc(HYPRE_BigInt, Bext_nnz, HYPRE_MEMORY_HOST);
+   for (i = 0, k = 0; i < num_elmts_send; i++)
+   {
+      row = send_map_elmts[i];
+      for (j = B_diag_i[row]; j < B_diag_i[row + 1]; j++)
+      {
+         send_big_j[k++] = first_col_diag_B + (HYPRE_BigInt) B_diag_j[j];
+      }
+      for (j = B_offd_i[row]; j < B_offd_i[row + 1]; j++)
+      {
+         send_big_j[k++] = col_map_offd_B[B_offd_j[j]];
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(21, (plan -> Bext_comm_pkg),
+                                              send_big_j, Bext_big_j);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* col_map_offd_Q: union of col_map_offd_B and the off-processor columns of Bext */
+   col_map_offd_Q = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_B + Bext_nnz, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_B; i++)
+   {
+      col_map_offd_Q[i] = col_map_offd_B[i];
+   }
+   cnt = num_cols_offd_B;
+   for (i = 0; i < Bext_nnz; i++)
+   {
+      big_col = Bext_big_j[i];
+      if (big_col < first_col_diag_B || big_col > last_col_diag_B)
+      {
+         col_map_offd_Q[cnt++] = big_col;
+      }
+   }
+
+   num_cols_offd_Q = 0;
+   if (cnt > 0)
+   {
+      hypre_BigQsort0(col_map_offd_Q, 0, cnt - 1);
+      num_cols_offd_Q = 1;
+      for (i = 1; i < cnt; i++)
+      {
+         if (col_map_offd_Q[i] > col_map_offd_Q[num_cols_offd_Q - 1])
+         {
+            col_map_offd_Q[num_cols_offd_Q++] = col_map_offd_Q[i];
+         }
+      }
+   }
+
+   map_B_to_Q = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_B; i++)
+   {
+      map_B_to_Q[i] = hypre_BigBinarySearch(col_map_offd_Q, col_map_offd_B[i], num_cols_offd_Q);
+   }
+
+   Bext_j = hypre_TAlloc(HYPRE_Int, Bext_nnz, HYPRE_MEMORY_HOST);
+   for (i = 0; i < Bext_nnz; i++)
+   {
+      big_col = Bext_big_j[i];
+      if (big_col < first_col_diag_B || big_col > last_col_diag_B)
+      {
+         Bext_j[i] = num_cols_diag_B +
+                     hypre_BigBinarySearch(col_map_offd_Q, big_col, num_cols_offd_Q);
+      }
+      else
+      {
+         Bext_j[i] = (HYPRE_Int) (big_col - first_col_diag_B);
+      }
+   }
+
+   (plan -> num_cols_diag_B) = num_cols_diag_B;
+   (plan -> num_cols_offd_Q) = num_cols_offd_Q;
+   (plan -> map_B_to_Q)      = map_B_to_Q;
+   (plan -> Bext_i)          = Bext_i;
+   (plan -> Bext_j)          = Bext_j;
+
+   *col_map_offd_Q_ptr = col_map_offd_Q;
+
+   hypre_TFree(send_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(Bext_big_j, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanSetupMapC
+ *
+ * Maps the offd columns of C to the column space of Q (-1 if a column of C
+ * does not appear in Q).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanSetupMapC( hypre_ParCSRSpGEMMPlan *plan,
+                                 hypre_ParCSRMatrix     *C,
+                                 HYPRE_BigInt           *col_map_offd_Q )
+{
+   HYPRE_Int      num_cols_offd_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+   HYPRE_BigInt  *col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_Int     *map_C_to_Q;
+   HYPRE_Int      i;
+
+   map_C_to_Q = hypre_TAlloc(HYPRE_Int, num_cols_offd_C, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_C; i++)
+   {
+      map_C_to_Q[i] = hypre_BigBinarySearch(col_map_offd_Q, col_map_offd_C[i],
+                                            (plan -> num_cols_offd_Q));
+   }
+   (plan -> map_C_to_Q) = map_C_to_Q;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanRowPatternAB
+ *
+ * Column indices (in the column space of Q) of row i of A*B. marker must
+ * be different from i on entry for all columns.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanRowPatternAB( hypre_ParCSRSpGEMMPlan *plan,
+                                    hypre_ParCSRMatrix     *A,
+                                    hypre_ParCSRMatrix     *B,
+                                    HYPRE_Int               i,
+                                    HYPRE_Int              *marker,
+                                    HYPRE_Int              *cols )
+{
+   hypre_CSRMatrix *A_diag     = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i   = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j   = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd     = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i   = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j   = hypre_CSRMatrixJ(A_offd);
+   hypre_CSRMatrix *B_diag     = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int       *B_diag_i   = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int       *B_diag_j   = hypre_CSRMatrixJ(B_diag);
+   hypre_CSRMatrix *B_offd     = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int       *B_offd_i   = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int       *B_offd_j   = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int        nB         = (plan -> num_cols_diag_B);
+   HYPRE_Int       *map_B_to_Q = (plan -> map_B_to_Q);
+   HYPRE_Int       *Bext_i     = (plan -> Bext_i);
+   HYPRE_Int       *Bext_j     = (plan -> Bext_j);
+   HYPRE_Int        jj, kk, k, col, cnt = 0;
+
+   for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+   {
+      k = A_diag_j[jj];
+      for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+      {
+         col = B_diag_j[kk];
+         if (marker[col] != i)
+         {
+            marker[col] = i;
+            cols[cnt++] = col;
+         }
+      }
+      for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+      {
+         col = nB + map_B_to_Q[B_offd_j[kk]];
+         if (marker[col] != i)
+         {
+            marker[col] = i;
+            cols[cnt++] = col;
+         }
+      }
+   }
+   for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+   {
+      k = A_offd_j[jj];
+      for (kk = Bext_i[k]; kk < Bext_i[k + 1]; kk++)
+      {
+         col = Bext_j[kk];
+         if (marker[col] != i)
+         {
+            marker[col] = i;
+            cols[cnt++] = col;
+         }
+      }
+   }
+
+   return cnt;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanRowPatternRTQ
+ *
+ * Column indices of row i of RT*Q, see hypre_ParCSRSpGEMMPlanRowPatternAB.
+ * The marker value used is `stamp'.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanRowPatternRTQ( hypre_ParCSRSpGEMMPlan *plan,
+                                     hypre_CSRMatrix        *RT,
+                                     HYPRE_Int               i,
+                                     HYPRE_Int               stamp,
+                                     HYPRE_Int              *marker,
+                                     HYPRE_Int              *cols )
+{
+   HYPRE_Int  *RT_i = hypre_CSRMatrixI(RT);
+   HYPRE_Int  *RT_j = hypre_CSRMatrixJ(RT);
+   HYPRE_Int  *Q_i  = (plan -> Q_i);
+   HYPRE_Int  *Q_j  = (plan -> Q_j);
+   HYPRE_Int   jj, kk, k, col, cnt = 0;
+
+   for (jj = RT_i[i]; jj < RT_i[i + 1]; jj++)
+   {
+      k = RT_j[jj];
+      for (kk = Q_i[k]; kk < Q_i[k + 1]; kk++)
+      {
+         col = Q_j[kk];
+         if (marker[col] != stamp)
+         {
+            marker[col] = stamp;
+            cols[cnt++] = col;
+         }
+      }
+   }
+
+   return cnt;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanRowCheckC
+ *
+ * Returns 1 if one of the columns `cols' (in the column space of Q) is not
+ * in the pattern of row i of C.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanRowCheckC( hypre_ParCSRSpGEMMPlan *plan,
+                                 hypre_ParCSRMatrix     *C,
+                                 HYPRE_Int               i,
+                                 HYPRE_Int               num_cols,
+                                 HYPRE_Int              *cols,
+                                 HYPRE_Int              *marker )
+{
+   hypre_CSRMatrix *C_diag     = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int       *C_diag_i   = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int       *C_diag_j   = hypre_CSRMatrixJ(C_diag);
+   hypre_CSRMatrix *C_offd     = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int       *C_offd_i   = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int       *C_offd_j   = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Int        nB         = (plan -> num_cols_diag_B);
+   HYPRE_Int       *map_C_to_Q = (plan -> map_C_to_Q);
+   HYPRE_Int        jj, q;
+
+   for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+   {
+      marker[C_diag_j[jj]] = i;
+   }
+   for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+   {
+      q = map_C_to_Q[C_offd_j[jj]];
+      if (q > -1)
+      {
+         marker[nB + q] = i;
+      }
+   }
+   for (jj = 0; jj < num_cols; jj++)
+   {
+      if (marker[cols[jj]] != i)
+      {
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanTranspose
+ *
+ * Pattern of the transpose of A, with the permutation of the nonzeros.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanTranspose( hypre_CSRMatrix  *A,
+                                 hypre_CSRMatrix **AT_ptr,
+                                 HYPRE_Int       **perm_ptr )
+{
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int       *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int       *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int        nnz      = A_i[num_rows];
+   hypre_CSRMatrix *AT;
+   HYPRE_Int       *AT_i, *AT_j, *perm;
+   HYPRE_Int        i, jj, pos;
+
+   AT = hypre_CSRMatrixCreate(num_cols, num_rows, nnz);
+   hypre_CSRMatrixInitialize_v2(AT, 0, HYPRE_MEMORY_HOST);
+   AT_i = hypre_CSRMatrixI(AT);
+   AT_j = hypre_CSRMatrixJ(AT);
+   perm = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+
+   for (jj = 0; jj < nnz; jj++)
+   {
+      AT_i[A_j[jj] + 1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i + 1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         pos = AT_i[A_j[jj]]++;
+         AT_j[pos] = i;
+         perm[jj]  = pos;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i - 1];
+   }
+   AT_i[0] = 0;
+
+   *AT_ptr   = AT;
+   *perm_ptr = perm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanFinalize
+ *
+ * All processes agree on whether the plan could be built; otherwise it is
+ * destroyed and NULL is returned.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanFinalize( MPI_Comm                 comm,
+                                HYPRE_Int                failed,
+                                hypre_ParCSRSpGEMMPlan **plan_ptr )
+{
+   HYPRE_Int failed_all;
+
+   hypre_MPI_Allreduce(&failed, &failed_all, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (failed_all)
+   {
+      hypre_ParCSRSpGEMMPlanDestroy(*plan_ptr);
+      *plan_ptr = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRSpGEMMPlanDestroy( hypre_ParCSRSpGEMMPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(plan -> map_B_to_Q, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> map_C_to_Q, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Bext_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Bext_j, HYPRE_MEMORY_HOST);
+      if (plan -> Bext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> Bext_comm_pkg);
+      }
+      hypre_TFree(plan -> Q_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Q_j, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan -> RT_diag);
+      hypre_CSRMatrixDestroy(plan -> RT_offd);
+      hypre_TFree(plan -> RT_diag_perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> RT_offd_perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Cint_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> Cint_j, HYPRE_MEMORY_HOST);
+      if (plan -> Cext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> Cext_comm_pkg);
+      }
+      hypre_TFree(plan -> Cext_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanMatches
+ *
+ * Checks (collectively) if the patterns of R (NULL for hypre_ParMatmulPlan),
+ * A, B and C are those the plan was built for.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRSpGEMMPlanMatches( hypre_ParCSRSpGEMMPlan *plan,
+                               hypre_ParCSRMatrix     *R,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B,
+                               hypre_ParCSRMatrix     *C,
+                               HYPRE_Int              *matches_ptr )
+{
+   HYPRE_Int matches, matches_all;
+
+   matches = (plan != NULL && (R != NULL) == ((plan -> num_stages) == 2));
+   if (matches)
+   {
+      matches = (R == NULL || hypre_ParCSRMatrixPatternFingerprint(R) == (plan -> fingerprint)[0]) &&
+                hypre_ParCSRMatrixPatternFingerprint(A) == (plan -> fingerprint)[1] &&
+                hypre_ParCSRMatrixPatternFingerprint(B) == (plan -> fingerprint)[2] &&
+                hypre_ParCSRMatrixPatternFingerprint(C) == (plan -> fingerprint)[3];
+   }
+
+   hypre_MPI_Allreduce(&matches, &matches_all, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+   *matches_ptr = matches_all;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanBextData
+ *
+ * Numeric exchange of the external rows of B.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Complex *
+hypre_ParCSRSpGEMMPlanBextData( hypre_ParCSRSpGEMMPlan *plan,
+                                hypre_ParCSRMatrix     *A,
+                                hypre_ParCSRMatrix     *B )
+{
+   hypre_CSRMatrix        *B_diag        = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int              *B_diag_i      = hypre_CSRMatrixI(B_diag);
+   HYPRE_Complex          *B_diag_data   = hypre_CSRMatrixData(B_diag);
+   hypre_CSRMatrix        *B_offd        = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int              *B_offd_i      = hypre_CSRMatrixI(B_offd);
+   HYPRE_Complex          *B_offd_data   = hypre_CSRMatrixData(B_offd);
+   hypre_ParCSRCommPkg    *Bext_comm_pkg = (plan -> Bext_comm_pkg);
+   HYPRE_Int               num_sends     = hypre_ParCSRCommPkgNumSends(Bext_comm_pkg);
+   HYPRE_Int               num_recvs     = hypre_ParCSRCommPkgNumRecvs(Bext_comm_pkg);
+   HYPRE_Int               send_size     = hypre_ParCSRCommPkgSendMapStart(Bext_comm_pkg,
+                                                                           num_sends);
+   HYPRE_Int               recv_size     = hypre_ParCSRCommPkgRecvVecStart(Bext_comm_pkg,
+                                                                           num_recvs);
+   hypre_ParCSRCommPkg    *comm_pkg_A;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int              *send_map_starts, *send_map_elmts;
+   HYPRE_Complex          *send_data, *Bext_data;
+   HYPRE_Int               i, j, k, row;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg_A      = hypre_ParCSRMatrixCommPkg(A);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+
+   send_data = hypre_TAlloc(HYPRE_Complex, send_size, HYPRE_MEMORY_HOST);
+   Bext_data = hypre_TAlloc(HYPRE_Complex, recv_size, HYPRE_MEMORY_HOST);
+
+   for (i = 0, k = 0; i < send_map_starts[hypre_ParCSRCommPkgNumSends(comm_pkg_A)]; i++)
+   {
+      row = send_map_elmts[i];
+      for (j = B_diag_i[row]; j < B_diag_i[row + 1]; j++)
+      {
+         send_data[k++] = B_diag_data[j];
+      }
+      for (j = B_offd_i[row]; j < B_offd_i[row + 1]; j++)
+      {
+         send_data[k++] = B_offd_data[j];
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, Bext_comm_pkg, send_data, Bext_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+
+   return Bext_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanRowAB
+ *
+ * acc += row i of A*B (in the column space of Q).
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParCSRSpGEMMPlanRowAB( hypre_ParCSRSpGEMMPlan *plan,
+                             hypre_ParCSRMatrix     *A,
+                             hypre_ParCSRMatrix     *B,
+                             HYPRE_Complex          *Bext_data,
+                             HYPRE_Int               i,
+                             HYPRE_Complex          *acc )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex   *A_offd_data = hypre_CSRMatrixData(A_offd);
+   hypre_CSRMatrix *B_diag      = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int       *B_diag_i    = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int       *B_diag_j    = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex   *B_diag_data = hypre_CSRMatrixData(B_diag);
+   hypre_CSRMatrix *B_offd      = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int       *B_offd_i    = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int       *B_offd_j    = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex   *B_offd_data = hypre_CSRMatrixData(B_offd);
+   HYPRE_Complex   *acc_offd    = acc + (plan -> num_cols_diag_B);
+   HYPRE_Int       *map_B_to_Q  = (plan -> map_B_to_Q);
+   HYPRE_Int       *Bext_i      = (plan -> Bext_i);
+   HYPRE_Int       *Bext_j      = (plan -> Bext_j);
+   HYPRE_Complex    a;
+   HYPRE_Int        jj, kk, k;
+
+   for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+   {
+      k = A_diag_j[jj];
+      a = A_diag_data[jj];
+      for (kk = B_diag_i[k]; kk < B_diag_i[k + 1]; kk++)
+      {
+         acc[B_diag_j[kk]] += a * B_diag_data[kk];
+      }
+      for (kk = B_offd_i[k]; kk < B_offd_i[k + 1]; kk++)
+      {
+         acc_offd[map_B_to_Q[B_offd_j[kk]]] += a * B_offd_data[kk];
+      }
+   }
+   for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+   {
+      k = A_offd_j[jj];
+      a = A_offd_data[jj];
+      for (kk = Bext_i[k]; kk < Bext_i[k + 1]; kk++)
+      {
+         acc[Bext_j[kk]] += a * Bext_data[kk];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanRowRTQ
+ *
+ * acc += row i of RT*Q.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParCSRSpGEMMPlanRowRTQ( hypre_ParCSRSpGEMMPlan *plan,
+                              hypre_CSRMatrix        *RT,
+                              HYPRE_Complex          *Q_data,
+                              HYPRE_Int               i,
+                              HYPRE_Complex          *acc )
+{
+   HYPRE_Int      *RT_i    = hypre_CSRMatrixI(RT);
+   HYPRE_Int      *RT_j    = hypre_CSRMatrixJ(RT);
+   HYPRE_Complex  *RT_data = hypre_CSRMatrixData(RT);
+   HYPRE_Int      *Q_i     = (plan -> Q_i);
+   HYPRE_Int      *Q_j     = (plan -> Q_j);
+   HYPRE_Complex   r;
+   HYPRE_Int       jj, kk, k;
+
+   for (jj = RT_i[i]; jj < RT_i[i + 1]; jj++)
+   {
+      k = RT_j[jj];
+      r = RT_data[jj];
+      for (kk = Q_i[k]; kk < Q_i[k + 1]; kk++)
+      {
+         acc[Q_j[kk]] += r * Q_data[kk];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanRowC
+ *
+ * job = 0: zeros the entries of acc in the pattern of row i of C.
+ * job = 1: copies them to the values of row i of C.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ParCSRSpGEMMPlanRowC( hypre_ParCSRSpGEMMPlan *plan,
+                            hypre_ParCSRMatrix     *C,
+                            HYPRE_Int               i,
+                            HYPRE_Int               job,
+                            HYPRE_Complex          *acc )
+{
+   hypre_CSRMatrix *C_diag      = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int       *C_diag_i    = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int       *C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex   *C_diag_data = hypre_CSRMatrixData(C_diag);
+   hypre_CSRMatrix *C_offd      = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int       *C_offd_i    = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int       *C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex   *C_offd_data = hypre_CSRMatrixData(C_offd);
+   HYPRE_Complex   *acc_offd    = acc + (plan -> num_cols_diag_B);
+   HYPRE_Int       *map_C_to_Q  = (plan -> map_C_to_Q);
+   HYPRE_Int        jj, q;
+
+   if (job == 0)
+   {
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         acc[C_diag_j[jj]] = 0.0;
+      }
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         q = map_C_to_Q[C_offd_j[jj]];
+         if (q > -1)
+         {
+            acc_offd[q] = 0.0;
+         }
+      }
+   }
+   else
+   {
+      for (jj = C_diag_i[i]; jj < C_diag_i[i + 1]; jj++)
+      {
+         C_diag_data[jj] = acc[C_diag_j[jj]];
+      }
+      for (jj = C_offd_i[i]; jj < C_offd_i[i + 1]; jj++)
+      {
+         q = map_C_to_Q[C_offd_j[jj]];
+         C_offd_data[jj] = (q > -1) ? acc_offd[q] : 0.0;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSpGEMMPlanPrepareC
+ *
+ * Makes sure C has double precision values that can be overwritten, and
+ * drops data derived from the old values.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSpGEMMPlanPrepareC( hypre_ParCSRMatrix *C )
+{
+   hypre_CSRMatrix *mats[2];
+   HYPRE_Int        i;
+
+   mats[0] = hypre_ParCSRMatrixDiag(C);
+   mats[1] = hypre_ParCSRMatrixOffd(C);
+
+   for (i = 0; i < 2; i++)
+   {
+      hypre_CSRMatrixDestroySellData(mats[i]);
+      if (!hypre_CSRMatrixData(mats[i]))
+      {
+         hypre_TFree(hypre_CSRMatrixDataSP(mats[i]), HYPRE_MEMORY_HOST);
+         hypre_CSRMatrixData(mats[i]) = hypre_TAlloc(HYPRE_Complex,
+                                                     hypre_CSRMatrixNumNonzeros(mats[i]),
+                                                     HYPRE_MEMORY_HOST);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanCreate
+ *
+ * Builds the plan for computing C = A*B into the pattern of C, where C is
+ * the result of a previous product of matrices with the same patterns as A
+ * and B, e.g., from hypre_ParMatmul. On return, *plan_ptr is NULL if the
+ * pattern of C does not contain the one of A*B on some process.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanCreate( hypre_ParCSRMatrix      *A,
+                           hypre_ParCSRMatrix      *B,
+                           hypre_ParCSRMatrix      *C,
+                           hypre_ParCSRSpGEMMPlan **plan_ptr )
+{
+   MPI_Comm                comm     = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int               num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   hypre_ParCSRSpGEMMPlan *plan;
+   HYPRE_BigInt           *col_map_offd_Q;
+   HYPRE_Int              *marker, *marker_C, *cols;
+   HYPRE_Int               nQ, cnt, i, failed = 0;
+
+   *plan_ptr = NULL;
+
+   if (hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(A)) !=
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(B)) ||
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(C)) != num_rows ||
+       hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(C)) !=
+       hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(B)) ||
+       hypre_ParCSRMatrixFirstColDiag(C) != hypre_ParCSRMatrixFirstColDiag(B))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible matrix dimensions in ParMatmulPlan");
+      return hypre_error_flag;
+   }
+
+   plan = hypre_CTAlloc(hypre_ParCSRSpGEMMPlan, 1, HYPRE_MEMORY_HOST);
+   (plan -> num_stages) = 1;
+
+   hypre_ParCSRSpGEMMPlanSetupBext(plan, A, B, &col_map_offd_Q);
+   hypre_ParCSRSpGEMMPlanSetupMapC(plan, C, col_map_offd_Q);
+   hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+
+   /* check that the pattern of C contains the one of A*B */
+   nQ       = (plan -> num_cols_diag_B) + (plan -> num_cols_offd_Q);
+   marker   = hypre_TAlloc(HYPRE_Int, nQ, HYPRE_MEMORY_HOST);
+   marker_C = hypre_TAlloc(HYPRE_Int, nQ, HYPRE_MEMORY_HOST);
+   cols     = hypre_TAlloc(HYPRE_Int, nQ, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nQ; i++)
+   {
+      marker[i]   = -1;
+      marker_C[i] = -1;
+   }
+   for (i = 0; i < num_rows && !failed; i++)
+   {
+      cnt    = hypre_ParCSRSpGEMMPlanRowPatternAB(plan, A, B, i, marker, cols);
+      failed = hypre_ParCSRSpGEMMPlanRowCheckC(plan, C, i, cnt, cols, marker_C);
+   }
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_C, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+
+   (plan -> fingerprint)[1] = hypre_ParCSRMatrixPatternFingerprint(A);
+   (plan -> fingerprint)[2] = hypre_ParCSRMatrixPatternFingerprint(B);
+   (plan -> fingerprint)[3] = hypre_ParCSRMatrixPatternFingerprint(C);
+
+   *plan_ptr = plan;
+   hypre_ParCSRSpGEMMPlanFinalize(comm, failed, plan_ptr);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanCompute
+ *
+ * Numeric phase of C = A*B. The values of C are overwritten; the patterns
+ * of A, B and C must be the ones of hypre_ParMatmulPlanCreate (see
+ * hypre_ParCSRSpGEMMPlanMatches).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanCompute( hypre_ParCSRSpGEMMPlan *plan,
+                            hypre_ParCSRMatrix     *A,
+                            hypre_ParCSRMatrix     *B,
+                            hypre_ParCSRMatrix     *C )
+{
+   HYPRE_Int       num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int       nQ       = (plan -> num_cols_diag_B) + (plan -> num_cols_offd_Q);
+   HYPRE_Complex  *Bext_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   Bext_data = hypre_ParCSRSpGEMMPlanBextData(plan, A, B);
+   hypre_ParCSRSpGEMMPlanPrepareC(C);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Complex *acc = hypre_TAlloc(HYPRE_Complex, nQ, HYPRE_MEMORY_HOST);
+      HYPRE_Int      i, i_begin, i_end;
+
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_rows);
+      for (i = i_begin; i < i_end; i++)
+      {
+         hypre_ParCSRSpGEMMPlanRowC(plan, C, i, 0, acc);
+         hypre_ParCSRSpGEMMPlanRowAB(plan, A, B, Bext_data, i, acc);
+         hypre_ParCSRSpGEMMPlanRowC(plan, C, i, 1, acc);
+      }
+      hypre_TFree(acc, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(Bext_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPPlanCreate
+ *
+ * Builds the plan for computing C = R^T*A*P into the pattern of C, where C
+ * is the result of a previous triple product of matrices with the same
+ * patterns as R, A and P, e.g., from hypre_ParCSRMatrixRAPKT or
+ * hypre_BoomerAMGBuildCoarseOperatorKT. On return, *plan_ptr is NULL if the
+ * pattern of C does not contain the one of R^T*A*P on some process.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPPlanCreate( hypre_ParCSRMatrix      *R,
+                                 hypre_ParCSRMatrix      *A,
+                                 hypre_ParCSRMatrix      *P,
+                                 hypre_ParCSRMatrix      *C,
+                                 hypre_ParCSRSpGEMMPlan **plan_ptr )
+{
+   MPI_Comm                comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int               num_rows_A      = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrix        *C_diag          = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int              *C_diag_i        = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int              *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Int               num_rows_C      = hypre_CSRMatrixNumRows(C_diag);
+   HYPRE_Int               num_cols_diag_C = hypre_CSRMatrixNumCols(C_diag);
+   hypre_CSRMatrix        *C_offd          = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int              *C_offd_i        = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int              *C_offd_j        = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Int               num_cols_offd_C = hypre_CSRMatrixNumCols(C_offd);
+   HYPRE_BigInt           *col_map_offd_C  = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_BigInt            first_col_C     = hypre_ParCSRMatrixFirstColDiag(C);
+   HYPRE_Int               num_cols_offd_R = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(R));
+
+   hypre_ParCSRSpGEMMPlan *plan;
+   hypre_ParCSRCommPkg    *comm_pkg_R;
+   hypre_CSRMatrix        *RT_diag, *RT_offd, *C_int, *C_ext;
+   HYPRE_BigInt           *col_map_offd_Q, *C_int_j, *C_ext_j;
+   HYPRE_BigInt            big_col;
+   HYPRE_Int              *Q_i, *Q_j, *Cint_i, *Cint_j, *Cext_pos, *C_ext_i, *send_map_elmts;
+   HYPRE_Int              *marker, *marker_C, *cols;
+   HYPRE_Int               nB, nQ, cnt, i, jj, kk, row, col, pos;
+   HYPRE_Int               num_elmts_send, failed = 0;
+   void                   *request;
+
+   *plan_ptr = NULL;
+
+   if (hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(R)) != num_rows_A ||
+       hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(A)) !=
+       hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(P)) ||
+       hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(R)) != num_rows_C ||
+       hypre_ParCSRMatrixFirstColDiag(R) != hypre_ParCSRMatrixFirstRowIndex(C) ||
+       hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(P)) != num_cols_diag_C ||
+       hypre_ParCSRMatrixFirstColDiag(P) != first_col_C)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible matrix dimensions in RAPPlan");
+      return hypre_error_flag;
+   }
+
+   plan = hypre_CTAlloc(hypre_ParCSRSpGEMMPlan, 1, HYPRE_MEMORY_HOST);
+   (plan -> num_stages) = 2;
+
+   hypre_ParCSRSpGEMMPlanSetupBext(plan, A, P, &col_map_offd_Q);
+   hypre_ParCSRSpGEMMPlanSetupMapC(plan, C, col_map_offd_Q);
+
+   nB       = (plan -> num_cols_diag_B);
+   nQ       = nB + (plan -> num_cols_offd_Q);
+   marker   = hypre_TAlloc(HYPRE_Int, nQ, HYPRE_MEMORY_HOST);
+   marker_C = hypre_TAlloc(HYPRE_Int, nQ, HYPRE_MEMORY_HOST);
+   cols     = hypre_TAlloc(HYPRE_Int, nQ, HYPRE_MEMORY_HOST);
+
+   /* pattern of Q = A*P */
+   Q_i = hypre_TAlloc(HYPRE_Int, num_rows_A + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nQ; i++)
+   {
+      marker[i] = -1;
+   }
+   Q_i[0] = 0;
+   for (i = 0; i < num_rows_A; i++)
+   {
+      Q_i[i + 1] = Q_i[i] + hypre_ParCSRSpGEMMPlanRowPatternAB(plan, A, P, i, marker, cols);
+   }
+   Q_j = hypre_TAlloc(HYPRE_Int, Q_i[num_rows_A], HYPRE_MEMORY_HOST);
+   for (i = 0; i < nQ; i++)
+   {
+      marker[i] = -1;
+   }
+   for (i = 0; i < num_rows_A; i++)
+   {
+      hypre_ParCSRSpGEMMPlanRowPatternAB(plan, A, P, i, marker, Q_j + Q_i[i]);
+   }
+   (plan -> Q_i) = Q_i;
+   (plan -> Q_j) = Q_j;
+
+   /* pattern of R^T */
+   hypre_ParCSRSpGEMMPlanTranspose(hypre_ParCSRMatrixDiag(R), &RT_diag, &(plan -> RT_diag_perm));
+   hypre_ParCSRSpGEMMPlanTranspose(hypre_ParCSRMatrixOffd(R), &RT_offd, &(plan -> RT_offd_perm));
+   (plan -> RT_diag) = RT_diag;
+   (plan -> RT_offd) = RT_offd;
+
+   /* check that the local part of the pattern of C contains the one of RT_diag*Q */
+   for (i = 0; i < nQ; i++)
+   {
+      marker[i]   = -1;
+      marker_C[i] = -1;
+   }
+   for (i = 0; i < num_rows_C && !failed; i++)
+   {
+      cnt    = hypre_ParCSRSpGEMMPlanRowPatternRTQ(plan, RT_diag, i, i, marker, cols);
+      failed = hypre_ParCSRSpGEMMPlanRowCheckC(plan, C, i, cnt, cols, marker_C);
+   }
+
+   /* pattern of the rows RT_offd*Q owned by other processes */
+   for (i = 0; i < nQ; i++)
+   {
+      marker[i] = -1;
+   }
+   Cint_i = hypre_TAlloc(HYPRE_Int, num_cols_offd_R + 1, HYPRE_MEMORY_HOST);
+   Cint_i[0] = 0;
+   for (i = 0; i < num_cols_offd_R; i++)
+   {
+      Cint_i[i + 1] = Cint_i[i] +
+                      hypre_ParCSRSpGEMMPlanRowPatternRTQ(plan, RT_offd, i, i, marker, cols);
+   }
+   Cint_j = hypre_TAlloc(HYPRE_Int, Cint_i[num_cols_offd_R], HYPRE_MEMORY_HOST);
+   for (i = 0; i < nQ; i++)
+   {
+      marker[i] = -1;
+   }
+   for (i = 0; i < num_cols_offd_R; i++)
+   {
+      hypre_ParCSRSpGEMMPlanRowPatternRTQ(plan, RT_offd, i, i, marker, Cint_j + Cint_i[i]);
+   }
+   (plan -> Cint_i) = Cint_i;
+   (plan -> Cint_j) = Cint_j;
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_C, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+
+   /* send the patterns of these rows to their owners */
+   if (!hypre_ParCSRMatrixCommPkg(R))
+   {
+      hypre_MatvecCommPkgCreate(R);
+   }
+   comm_pkg_R = hypre_ParCSRMatrixCommPkg(R);
+
+   C_int = hypre_CSRMatrixCreate(num_cols_offd_R, 0, Cint_i[num_cols_offd_R]);
+   hypre_CSRMatrixMemoryLocation(C_int) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(C_int) = hypre_TAlloc(HYPRE_Int, num_cols_offd_R + 1, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixBigJ(C_int) = C_int_j = hypre_TAlloc(HYPRE_BigInt, Cint_i[num_cols_offd_R],
+                                                       HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixData(C_int) = hypre_CTAlloc(HYPRE_Complex, Cint_i[num_cols_offd_R],
+                                              HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_cols_offd_R; i++)
+   {
+      hypre_CSRMatrixI(C_int)[i] = Cint_i[i];
+   }
+   for (i = 0; i < Cint_i[num_cols_offd_R]; i++)
+   {
+      col = Cint_j[i];
+      C_int_j[i] = (col < nB) ? first_col_C + (HYPRE_BigInt) col : col_map_offd_Q[col - nB];
+   }
+
+   hypre_ExchangeExternalRowsInit(C_int, comm_pkg_R, &request);
+   C_ext = hypre_ExchangeExternalRowsWait(request);
+   hypre_CSRMatrixDestroy(C_int);
+   hypre_TFree(col_map_offd_Q, HYPRE_MEMORY_HOST);
+
+   /* positions of the received contributions in C */
+   num_elmts_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg_R,
+                                                    hypre_ParCSRCommPkgNumSends(comm_pkg_R));
+   send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_R);
+   C_ext_i        = hypre_CSRMatrixI(C_ext);
+   C_ext_j        = hypre_CSRMatrixBigJ(C_ext);
+   Cext_pos       = hypre_TAlloc(HYPRE_Int, C_ext_i[num_elmts_send], HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_elmts_send; i++)
+   {
+      row = send_map_elmts[i];
+      for (jj = C_ext_i[i]; jj < C_ext_i[i + 1]; jj++)
+      {
+         big_col = C_ext_j[jj];
+         pos = 0;
+         if (big_col >= first_col_C && big_col < first_col_C + (HYPRE_BigInt) num_cols_diag_C)
+         {
+            col = (HYPRE_Int) (big_col - first_col_C);
+            for (kk = C_diag_i[row]; kk < C_diag_i[row + 1]; kk++)
+            {
+               if (C_diag_j[kk] == col)
+               {
+                  break;
+               }
+            }
+            if (kk < C_diag_i[row + 1])
+            {
+               pos = kk;
+            }
+            else
+            {
+               failed = 1;
+            }
+         }
+         else
+         {
+            col = hypre_BigBinarySearch(col_map_offd_C, big_col, num_cols_offd_C);
+            for (kk = C_offd_i[row]; col > -1 && kk < C_offd_i[row + 1]; kk++)
+            {
+               if (C_offd_j[kk] == col)
+               {
+                  break;
+               }
+            }
+            if (col > -1 && kk < C_offd_i[row + 1])
+            {
+               pos = -kk - 1;
+            }
+            else
+            {
+               failed = 1;
+            }
+         }
+         Cext_pos[jj] = pos;
+      }
+   }
+   (plan -> Cext_pos) = Cext_pos;
+
+   /* values of these rows are sent as they are: note the reversed direction */
+   (plan -> Cext_comm_pkg) =
+      hypre_ParCSRSpGEMMPlanCommPkg(comm,
+                                    hypre_ParCSRCommPkgNumRecvs(comm_pkg_R),
+                                    hypre_ParCSRCommPkgRecvProcs(comm_pkg_R),
+                                    hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_R), Cint_i,
+                                    hypre_ParCSRCommPkgNumSends(comm_pkg_R),
+                                    hypre_ParCSRCommPkgSendProcs(comm_pkg_R),
+                                    hypre_ParCSRCommPkgSendMapStarts(comm_pkg_R), C_ext_i);
+   hypre_CSRMatrixDestroy(C_ext);
+
+   (plan -> fingerprint)[0] = hypre_ParCSRMatrixPatternFingerprint(R);
+   (plan -> fingerprint)[1] = hypre_ParCSRMatrixPatternFingerprint(A);
+   (plan -> fingerprint)[2] = hypre_ParCSRMatrixPatternFingerprint(P);
+   (plan -> fingerprint)[3] = hypre_ParCSRMatrixPatternFingerprint(C);
+
+   *plan_ptr = plan;
+   hypre_ParCSRSpGEMMPlanFinalize(comm, failed, plan_ptr);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPPlanCompute
+ *
+ * Numeric phase of C = R^T*A*P. The values of C are overwritten; the
+ * patterns of R, A, P and C must be the ones of
+ * hypre_ParCSRMatrixRAPPlanCreate (see hypre_ParCSRSpGEMMPlanMatches).
+ * The contributions to rows owned by other processes are computed first,
+ * and their exchange is overlapped with the computation of the local rows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPPlanCompute( hypre_ParCSRSpGEMMPlan *plan,
+                                  hypre_ParCSRMatrix     *R,
+                                  hypre_ParCSRMatrix     *A,
+                                  hypre_ParCSRMatrix     *P,
+                                  hypre_ParCSRMatrix     *C )
+{
+   HYPRE_Int               num_rows_A    = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int               num_rows_C    = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(C));
+   hypre_CSRMatrix        *R_diag        = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix        *R_offd        = hypre_ParCSRMatrixOffd(R);
+   HYPRE_Complex          *R_diag_data   = hypre_CSRMatrixData(R_diag);
+   HYPRE_Complex          *R_offd_data   = hypre_CSRMatrixData(R_offd);
+   HYPRE_Int               R_diag_nnz    = hypre_CSRMatrixNumNonzeros(R_diag);
+   HYPRE_Int               R_offd_nnz    = hypre_CSRMatrixNumNonzeros(R_offd);
+   hypre_CSRMatrix        *RT_diag       = (plan -> RT_diag);
+   hypre_CSRMatrix        *RT_offd       = (plan -> RT_offd);
+   HYPRE_Complex          *RT_diag_data  = hypre_CSRMatrixData(RT_diag);
+   HYPRE_Complex          *RT_offd_data  = hypre_CSRMatrixData(RT_offd);
+   HYPRE_Int              *RT_diag_perm  = (plan -> RT_diag_perm);
+   HYPRE_Int              *RT_offd_perm  = (plan -> RT_offd_perm);
+   HYPRE_Int               num_rows_Cint = hypre_CSRMatrixNumRows(RT_offd);
+   HYPRE_Int              *Q_i           = (plan -> Q_i);
+   HYPRE_Int              *Q_j           = (plan -> Q_j);
+   HYPRE_Int              *Cint_i        = (plan -> Cint_i);
+   HYPRE_Int              *Cint_j        = (plan -> Cint_j);
+   HYPRE_Int              *Cext_pos      = (plan -> Cext_pos);
+   hypre_ParCSRCommPkg    *Cext_comm_pkg = (plan -> Cext_comm_pkg);
+   HYPRE_Int               Cext_size     = hypre_ParCSRCommPkgRecvVecStart(Cext_comm_pkg,
+                                                                           hypre_ParCSRCommPkgNumRecvs(Cext_comm_pkg));
+   HYPRE_Int               nQ            = (plan -> num_cols_diag_B) + (plan -> num_cols_offd_Q);
+   HYPRE_Complex          *C_diag_data, *C_offd_data;
+   HYPRE_Complex          *Bext_data, *Q_data, *Cint_data, *Cext_data;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               i, pos;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   Bext_data = hypre_ParCSRSpGEMMPlanBextData(plan, A, P);
+   Q_data    = hypre_TAlloc(HYPRE_Complex, Q_i[num_rows_A], HYPRE_MEMORY_HOST);
+   Cint_data = hypre_TAlloc(HYPRE_Complex, Cint_i[num_rows_Cint], HYPRE_MEMORY_HOST);
+   Cext_data = hypre_TAlloc(HYPRE_Complex, Cext_size, HYPRE_MEMORY_HOST);
+
+   /* values of R^T */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < R_diag_nnz; i++)
+   {
+      RT_diag_data[RT_diag_perm[i]] = R_diag_data[i];
+   }
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < R_offd_nnz; i++)
+   {
+      RT_offd_data[RT_offd_perm[i]] = R_offd_data[i];
+   }
+
+   /* Q = A*P and the rows RT_offd*Q owned by other processes */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Complex *acc = hypre_TAlloc(HYPRE_Complex, nQ, HYPRE_MEMORY_HOST);
+      HYPRE_Int      ii, jj, i_begin, i_end;
+
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_rows_A);
+      for (ii = i_begin; ii < i_end; ii++)
+      {
+         for (jj = Q_i[ii]; jj < Q_i[ii + 1]; jj++)
+         {
+            acc[Q_j[jj]] = 0.0;
+         }
+         hypre_ParCSRSpGEMMPlanRowAB(plan, A, P, Bext_data, ii, acc);
+         for (jj = Q_i[ii]; jj < Q_i[ii + 1]; jj++)
+         {
+            Q_data[jj] = acc[Q_j[jj]];
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_rows_Cint);
+      for (ii = i_begin; ii < i_end; ii++)
+      {
+         for (jj = Cint_i[ii]; jj < Cint_i[ii + 1]; jj++)
+         {
+            acc[Cint_j[jj]] = 0.0;
+         }
+         hypre_ParCSRSpGEMMPlanRowRTQ(plan, RT_offd, Q_data, ii, acc);
+         for (jj = Cint_i[ii]; jj < Cint_i[ii + 1]; jj++)
+         {
+            Cint_data[jj] = acc[Cint_j[jj]];
+         }
+      }
+      hypre_TFree(acc, HYPRE_MEMORY_HOST);
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, Cext_comm_pkg, Cint_data, Cext_data);
+
+   /* local rows of C, overlapped with the exchange */
+   hypre_ParCSRSpGEMMPlanPrepareC(C);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Complex *acc = hypre_TAlloc(HYPRE_Complex, nQ, HYPRE_MEMORY_HOST);
+      HYPRE_Int      ii, i_begin, i_end;
+
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_rows_C);
+      for (ii = i_begin; ii < i_end; ii++)
+      {
+         hypre_ParCSRSpGEMMPlanRowC(plan, C, ii, 0, acc);
+         hypre_ParCSRSpGEMMPlanRowRTQ(plan, RT_diag, Q_data, ii, acc);
+         hypre_ParCSRSpGEMMPlanRowC(plan, C, ii, 1, acc);
+      }
+      hypre_TFree(acc, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* add the contributions of the other processes */
+   C_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(C));
+   C_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(C));
+   for (i = 0; i < Cext_size; i++)
+   {
+      pos = Cext_pos[i];
+      if (pos > -1)
+      {
+         C_diag_data[pos] += Cext_data[i];
+      }
+      else
+      {
+         C_offd_data[-pos - 1] += Cext_data[i];
+      }
+   }
+
+   hypre_TFree(Bext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Q_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Cint_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Cext_data, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
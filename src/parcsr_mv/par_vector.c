@@ -55,6 +55,8 @@ hypre_ParVectorCreate( MPI_Comm      comm,
    local_size = (HYPRE_Int) (partitioning[1] - partitioning[0]);
 
    hypre_ParVectorAssumedPartition(vector) = NULL;
+   hypre_ParVectorMappedData(vector)       = NULL;
+   hypre_ParVectorMappedSize(vector)       = 0;
 
    hypre_ParVectorComm(vector)            = comm;
    hypre_ParVectorGlobalSize(vector)      = global_size;
@@ -99,6 +101,12 @@ hypre_ParVectorDestroy( hypre_ParVector *vector )
       if ( hypre_ParVectorOwnsData(vector) )
       {
          hypre_SeqVectorDestroy(hypre_ParVectorLocalVector(vector));
+
+         if (hypre_ParVectorMappedData(vector))
+         {
+            hypre_CheckpointUnmap(hypre_ParVectorMappedData(vector),
+                                  hypre_ParVectorMappedSize(vector));
+         }
       }
 
       if (hypre_ParVectorAssumedPartition(vector))
@@ -42,6 +42,10 @@ typedef struct hypre_ParVector_struct
 
    hypre_IJAssumedPart  *assumed_partition; /* only populated if this partition needed
                                               (for setting off-proc elements, for example)*/
+
+   /* File mapping that `local_vector' points into (single-rank checkpoint reads) */
+   void                 *mapped_data;
+   size_t                mapped_size;
 } hypre_ParVector;
 
 /*--------------------------------------------------------------------------
@@ -65,6 +69,8 @@ typedef struct hypre_ParVector_struct
 #define hypre_ParVectorEntryIJ(vector, i, j)    (hypre_VectorEntryIJ((vector) -> local_vector, i, j))
 
 #define hypre_ParVectorAssumedPartition(vector) ((vector) -> assumed_partition)
+#define hypre_ParVectorMappedData(vector)       ((vector) -> mapped_data)
+#define hypre_ParVectorMappedSize(vector)       ((vector) -> mapped_size)
 
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
@@ -72,4 +78,16 @@ hypre_ParVectorMemoryLocation(hypre_ParVector *vector)
    return hypre_VectorMemoryLocation(hypre_ParVectorLocalVector(vector));
 }
 
+/*--------------------------------------------------------------------------
+ * Handle of a non-blocking block inner product
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int          num_values;
+   HYPRE_Real        *local_result;  /* send buffer of the reduction */
+   hypre_MPI_Request  request;
+
+} hypre_ParVectorReduceHandle;
+
 #endif
@@ -136,3 +136,191 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorComponentInnerProds
+ *
+ * Inner products of the matching components of two multivectors stored by
+ * columns, result[k] = <x_k, y_k>, computed with a single reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorComponentInnerProds( hypre_ParVector *x,
+                                    hypre_ParVector *y,
+                                    HYPRE_Real      *result )
+{
+   MPI_Comm      comm        = hypre_ParVectorComm(x);
+   hypre_Vector *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Int     num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Real   *local_result;
+   hypre_Vector  x_comp, y_comp;
+   HYPRE_Int     k;
+
+   if (hypre_VectorNumVectors(y_local) != num_vectors ||
+       hypre_VectorIndexStride(x_local) != 1 || hypre_VectorIndexStride(y_local) != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Component inner products require multivectors stored by columns");
+      return hypre_error_flag;
+   }
+
+   /* single component views of x and y */
+   x_comp = *x_local;
+   y_comp = *y_local;
+   hypre_VectorNumVectors(&x_comp) = 1;
+   hypre_VectorNumVectors(&y_comp) = 1;
+   hypre_VectorOwnsData(&x_comp)   = 0;
+   hypre_VectorOwnsData(&y_comp)   = 0;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < num_vectors; k++)
+   {
+      hypre_VectorData(&x_comp) = hypre_VectorData(x_local) + k * hypre_VectorVectorStride(x_local);
+      hypre_VectorData(&y_comp) = hypre_VectorData(y_local) + k * hypre_VectorVectorStride(y_local);
+      local_result[k] = hypre_SeqVectorInnerProd(&x_comp, &y_comp);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProd
+ *
+ * Computes result[i] = <x[i], y[i]> for 0 <= i < n with a single global
+ * reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProd( HYPRE_Int         n,
+                               hypre_ParVector **x,
+                               hypre_ParVector **y,
+                               HYPRE_Real       *result )
+{
+   MPI_Comm    comm;
+   HYPRE_Real *local_result;
+   HYPRE_Int   i;
+
+   if (n < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   comm         = hypre_ParVectorComm(x[0]);
+   local_result = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      local_result[i] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[i]),
+                                                 hypre_ParVectorLocalVector(y[i]));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, n, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProdStart
+ *
+ * Non-blocking version of hypre_ParVectorBlockInnerProd. The local products
+ * are computed immediately and their global reduction is started; the values
+ * in result are only valid after hypre_ParVectorBlockInnerProdWait has been
+ * called on the returned handle. Neither result nor the vectors may be
+ * modified before then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProdStart( HYPRE_Int                     n,
+                                    hypre_ParVector             **x,
+                                    hypre_ParVector             **y,
+                                    HYPRE_Real                   *result,
+                                    hypre_ParVectorReduceHandle **handle_ptr )
+{
+   hypre_ParVectorReduceHandle *handle;
+   MPI_Comm                     comm;
+   HYPRE_Int                    i;
+
+   handle = hypre_CTAlloc(hypre_ParVectorReduceHandle, 1, HYPRE_MEMORY_HOST);
+   handle -> num_values = n;
+   handle -> request    = hypre_MPI_REQUEST_NULL;
+   *handle_ptr = handle;
+
+   if (n < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParVectorComm(x[0]);
+   handle -> local_result = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      (handle -> local_result)[i] =
+         hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[i]),
+                                  hypre_ParVectorLocalVector(y[i]));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Iallreduce(handle -> local_result, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, &(handle -> request));
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProdWait
+ *
+ * Completes the reduction started by hypre_ParVectorBlockInnerProdStart and
+ * destroys the handle.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProdWait( hypre_ParVectorReduceHandle *handle )
+{
+   hypre_MPI_Status status;
+
+   if (!handle)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(&(handle -> request), &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(handle -> local_result, HYPRE_MEMORY_HOST);
+   hypre_TFree(handle, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -47,6 +47,9 @@ HYPRE_Int HYPRE_ParCSRMatrixBigInitialize ( HYPRE_ParCSRMatrix matrix );
 HYPRE_Int HYPRE_ParCSRMatrixRead ( MPI_Comm comm, const char *file_name,
                                    HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixPrint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixPrintCheckpoint ( HYPRE_ParCSRMatrix matrix, const char *file_name );
+HYPRE_Int HYPRE_ParCSRMatrixReadCheckpoint ( MPI_Comm comm, const char *file_name,
+                                             HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixGetComm ( HYPRE_ParCSRMatrix matrix, MPI_Comm *comm );
 HYPRE_Int HYPRE_ParCSRMatrixGetDims ( HYPRE_ParCSRMatrix matrix, HYPRE_BigInt *M, HYPRE_BigInt *N );
 HYPRE_Int HYPRE_ParCSRMatrixGetRowPartitioning ( HYPRE_ParCSRMatrix matrix,
@@ -69,6 +72,7 @@ HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A,
                                      HYPRE_Complex beta, HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, HYPRE_ParCSRMatrix A, HYPRE_ParVector x,
                                       HYPRE_Complex beta, HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixInvalidateSpMVData ( HYPRE_ParCSRMatrix matrix );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm, HYPRE_BigInt global_size,
@@ -80,6 +84,9 @@ HYPRE_Int HYPRE_ParVectorInitialize ( HYPRE_ParVector vector );
 HYPRE_Int HYPRE_ParVectorRead ( MPI_Comm comm, const char *file_name, HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorPrint ( HYPRE_ParVector vector, const char *file_name );
 HYPRE_Int HYPRE_ParVectorPrintBinaryIJ ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorPrintCheckpoint ( HYPRE_ParVector vector, const char *file_name );
+HYPRE_Int HYPRE_ParVectorReadCheckpoint ( MPI_Comm comm, const char *file_name,
+                                          HYPRE_ParVector *vector );
 HYPRE_Int HYPRE_ParVectorSetConstantValues ( HYPRE_ParVector vector, HYPRE_Complex value );
 HYPRE_Int HYPRE_ParVectorSetRandomValues ( HYPRE_ParVector vector, HYPRE_Int seed );
 HYPRE_Int HYPRE_ParVectorCopy ( HYPRE_ParVector x, HYPRE_ParVector y );
@@ -234,6 +241,15 @@ hypre_ParCSRBooleanMatrix *hypre_CSRBooleanMatrixToParCSRBooleanMatrix ( MPI_Com
 HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A,
                                              hypre_ParCSRBooleanMatrix *matrix, HYPRE_BigInt first_col_diag, HYPRE_BigInt last_col_diag );
 
+/* par_csr_checkpoint.c */
+HYPRE_Int hypre_CheckpointUnmap ( void *data, size_t size );
+HYPRE_Int hypre_ParCSRMatrixPrintCheckpoint ( hypre_ParCSRMatrix *matrix, const char *filename );
+HYPRE_Int hypre_ParCSRMatrixReadCheckpoint ( MPI_Comm comm, const char *filename,
+                                             hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParVectorPrintCheckpoint ( hypre_ParVector *vector, const char *filename );
+HYPRE_Int hypre_ParVectorReadCheckpoint ( MPI_Comm comm, const char *filename,
+                                          hypre_ParVector **vector_ptr );
+
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg,
                                                        void *send_data, void *recv_data );
@@ -472,6 +488,7 @@ HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetPatternOnly( hypre_ParCSRMatrix *matrix, HYPRE_Int pattern_only);
+HYPRE_Int hypre_ParCSRMatrixConvertToSinglePrecision( hypre_ParCSRMatrix *matrix );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixCreateFromDenseBlockMatrix(MPI_Comm comm,
                                                                  HYPRE_BigInt global_num_rows,
                                                                  HYPRE_BigInt global_num_cols,
@@ -548,6 +565,18 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceDevice ( HYPRE_Complex alpha, hypre_
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, hypre_ParVector *x,
                                      HYPRE_Complex beta, hypre_ParVector *y );
+// r = b - A*x, r_norm = ||r||_2
+HYPRE_Int hypre_ParCSRMatrixResidual ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                       hypre_ParVector *b, hypre_ParVector *r, HYPRE_Real *r_norm );
+HYPRE_Int hypre_ParCSRMatrixResidualHost ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                           hypre_ParVector *b, hypre_ParVector *r, HYPRE_Real *r_norm );
+// r = b - A*x, y = R^T*r
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                               hypre_ParVector *b, hypre_ParCSRMatrix *R,
+                                               hypre_ParVector *r, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrictHost ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                                   hypre_ParVector *b, hypre_ParCSRMatrix *R,
+                                                   hypre_ParVector *r, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                       hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecTDevice ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
@@ -559,6 +588,22 @@ HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_spgemm_plan.c */
+HYPRE_Int hypre_ParCSRSpGEMMPlanDestroy( hypre_ParCSRSpGEMMPlan *plan );
+HYPRE_Int hypre_ParCSRSpGEMMPlanMatches( hypre_ParCSRSpGEMMPlan *plan, hypre_ParCSRMatrix *R,
+                                         hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                         hypre_ParCSRMatrix *C, HYPRE_Int *matches_ptr );
+HYPRE_Int hypre_ParMatmulPlanCreate( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B,
+                                     hypre_ParCSRMatrix *C, hypre_ParCSRSpGEMMPlan **plan_ptr );
+HYPRE_Int hypre_ParMatmulPlanCompute( hypre_ParCSRSpGEMMPlan *plan, hypre_ParCSRMatrix *A,
+                                      hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatrixRAPPlanCreate( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A,
+                                           hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *C,
+                                           hypre_ParCSRSpGEMMPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPPlanCompute( hypre_ParCSRSpGEMMPlan *plan, hypre_ParCSRMatrix *R,
+                                            hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                            hypre_ParCSRMatrix *C );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -628,6 +673,14 @@ HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
                                        HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x, HYPRE_Real *prod_y );
+HYPRE_Int hypre_ParVectorComponentInnerProds ( hypre_ParVector *x, hypre_ParVector *y,
+                                               HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( HYPRE_Int n, hypre_ParVector **x, hypre_ParVector **y,
+                                         HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorBlockInnerProdStart ( HYPRE_Int n, hypre_ParVector **x,
+                                              hypre_ParVector **y, HYPRE_Real *result,
+                                              hypre_ParVectorReduceHandle **handle_ptr );
+HYPRE_Int hypre_ParVectorBlockInnerProdWait ( hypre_ParVectorReduceHandle *handle );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm, hypre_Vector *v,
                                            HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
@@ -1587,6 +1587,8 @@ hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
 {
    HYPRE_Int ierr = 0;
 
+   hypre_CSRMatrixDestroySellData(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2016,6 +2018,8 @@ hypre_CSRMatrixScale( hypre_CSRMatrix *A,
    HYPRE_Int      i;
    HYPRE_Int      k = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixDestroySellData(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -2144,6 +2148,8 @@ hypre_CSRMatrixDiagScale( hypre_CSRMatrix *A,
       return hypre_error_flag;
    }
 
+   hypre_CSRMatrixDestroySellData(A);
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_ExecutionPolicy exec;
 
@@ -2188,6 +2194,8 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
    HYPRE_Int i;
    HYPRE_Int nnz = hypre_CSRMatrixNumNonzeros(A);
 
+   hypre_CSRMatrixDestroySellData(A);
+
    if (!hypre_CSRMatrixData(A))
    {
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
@@ -40,6 +40,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixSellData(matrix)       = NULL;
+   hypre_CSRMatrixDataSP(matrix)         = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -70,12 +72,15 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
          hypre_TFree(hypre_CSRMatrixData(matrix), memory_location);
+         hypre_TFree(hypre_CSRMatrixDataSP(matrix), memory_location);
          hypre_TFree(hypre_CSRMatrixJ(matrix),    memory_location);
          /* RL: TODO There might be cases BigJ cannot be freed FIXME
           * Not so clear how to do it */
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
 
+      hypre_CSRMatrixDestroySellData(matrix);
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
       hypre_TFree(hypre_CSRMatrixSortedData(matrix), memory_location);
       hypre_TFree(hypre_CSRMatrixSortedJ(matrix), memory_location);
@@ -89,6 +94,52 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixFirstTouchHost
+ *
+ * Zeroes the given column index and value arrays of a host matrix with the
+ * OpenMP threads, each thread handling the nonzeros of the rows it owns in
+ * hypre_GetSimpleThreadPartition. This places the pages on the NUMA node of
+ * the thread that later works on the corresponding rows.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixFirstTouchHost( hypre_CSRMatrix *matrix,
+                               HYPRE_Int       *A_j,
+                               HYPRE_BigInt    *A_big_j,
+                               HYPRE_Complex   *A_data )
+{
+   HYPRE_Int  num_rows = hypre_CSRMatrixNumRows(matrix);
+   HYPRE_Int *A_i      = hypre_CSRMatrixI(matrix);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int  ib, ie, nb, ne;
+
+      hypre_GetSimpleThreadPartition(&ib, &ie, num_rows);
+      nb = A_i[ib];
+      ne = A_i[ie];
+
+      if (ne > nb)
+      {
+         if (A_j)
+         {
+            memset(A_j + nb, 0, (size_t) (ne - nb) * sizeof(HYPRE_Int));
+         }
+         if (A_big_j)
+         {
+            memset(A_big_j + nb, 0, (size_t) (ne - nb) * sizeof(HYPRE_BigInt));
+         }
+         if (A_data)
+         {
+            memset(A_data + nb, 0, (size_t) (ne - nb) * sizeof(HYPRE_Complex));
+         }
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixInitialize
  *--------------------------------------------------------------------------*/
@@ -102,14 +153,35 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix      *matrix,
    HYPRE_Int  num_nonzeros = hypre_CSRMatrixNumNonzeros(matrix);
    /* HYPRE_Int  num_rownnz = hypre_CSRMatrixNumRownnz(matrix); */
 
+   HYPRE_Int      *A_i         = hypre_CSRMatrixI(matrix);
+   HYPRE_Int      *new_j       = NULL;
+   HYPRE_BigInt   *new_big_j   = NULL;
+   HYPRE_Complex  *new_data    = NULL;
+   HYPRE_Int       first_touch = 0;
+
    hypre_CSRMatrixMemoryLocation(matrix) = memory_location;
 
    /* Caveat: for pre-existing i, j, data, their memory location must be guaranteed to be consistent with `memory_location'
     * Otherwise, mismatches will exist and problems will be encountered when being used, and freed */
 
+   /* With NUMA first touch (HYPRE_SetHostFirstTouch), new j and data arrays are
+      zeroed by the threads owning the rows, which requires a complete row pointer */
+   if (num_nonzeros && A_i && hypre_HostFirstTouchActive(memory_location))
+   {
+      first_touch = (A_i[0] == 0 && A_i[num_rows] == num_nonzeros);
+   }
+
    if ( !hypre_CSRMatrixData(matrix) && num_nonzeros )
    {
-      hypre_CSRMatrixData(matrix) = hypre_CTAlloc(HYPRE_Complex, num_nonzeros, memory_location);
+      if (first_touch)
+      {
+         new_data = hypre_TAlloc(HYPRE_Complex, num_nonzeros, memory_location);
+         hypre_CSRMatrixData(matrix) = new_data;
+      }
+      else
+      {
+         hypre_CSRMatrixData(matrix) = hypre_CTAlloc(HYPRE_Complex, num_nonzeros, memory_location);
+      }
    }
    /*
    else
@@ -134,17 +206,38 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix      *matrix,
    {
       if ( !hypre_CSRMatrixBigJ(matrix) && num_nonzeros )
       {
-         hypre_CSRMatrixBigJ(matrix) = hypre_CTAlloc(HYPRE_BigInt, num_nonzeros, memory_location);
+         if (first_touch)
+         {
+            new_big_j = hypre_TAlloc(HYPRE_BigInt, num_nonzeros, memory_location);
+            hypre_CSRMatrixBigJ(matrix) = new_big_j;
+         }
+         else
+         {
+            hypre_CSRMatrixBigJ(matrix) = hypre_CTAlloc(HYPRE_BigInt, num_nonzeros, memory_location);
+         }
       }
    }
    else
    {
       if ( !hypre_CSRMatrixJ(matrix) && num_nonzeros )
       {
-         hypre_CSRMatrixJ(matrix) = hypre_CTAlloc(HYPRE_Int, num_nonzeros, memory_location);
+         if (first_touch)
+         {
+            new_j = hypre_TAlloc(HYPRE_Int, num_nonzeros, memory_location);
+            hypre_CSRMatrixJ(matrix) = new_j;
+         }
+         else
+         {
+            hypre_CSRMatrixJ(matrix) = hypre_CTAlloc(HYPRE_Int, num_nonzeros, memory_location);
+         }
       }
    }
 
+   if (first_touch)
+   {
+      hypre_CSRMatrixFirstTouchHost(matrix, new_j, new_big_j, new_data);
+   }
+
    return hypre_error_flag;
 }
 
@@ -865,6 +958,8 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   hypre_CSRMatrixDestroySellData(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_rownnz)
@@ -1412,6 +1507,59 @@ hypre_CSRMatrixGetLoadBalancedPartitionEnd(hypre_CSRMatrix *A)
    return hypre_CSRMatrixGetLoadBalancedPartitionBoundary(A, hypre_GetThreadNum() + 1);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToSinglePrecision
+ *
+ * Replaces the values of a host matrix by a single precision copy, which is
+ * used by the host Matvec kernels (accumulating in HYPRE_Complex). The
+ * double precision `data' array is freed and set to NULL, so this is only
+ * meant for matrices that are not modified afterwards, e.g., coarse grid
+ * operators of a multigrid hierarchy. Does nothing in single precision or
+ * complex builds, or if the matrix does not own its data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToSinglePrecision( hypre_CSRMatrix *A )
+{
+#if defined(HYPRE_SINGLE) || defined(HYPRE_COMPLEX)
+   HYPRE_UNUSED_VAR(A);
+#else
+   HYPRE_Complex  *data         = hypre_CSRMatrixData(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   hypre_float    *data_sp;
+   HYPRE_Int       i;
+
+   if (!data || hypre_CSRMatrixDataSP(A) || !hypre_CSRMatrixOwnsData(A))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Single precision storage is only available for host matrices");
+      return hypre_error_flag;
+   }
+
+   data_sp = hypre_TAlloc(hypre_float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data_sp[i] = (hypre_float) data[i];
+   }
+
+   hypre_CSRMatrixDestroySellData(A);
+   hypre_TFree(data, hypre_CSRMatrixMemoryLocation(A));
+   hypre_CSRMatrixData(A)   = NULL;
+   hypre_CSRMatrixDataSP(A) = data_sp;
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixPrefetch
  *--------------------------------------------------------------------------*/
@@ -26,6 +26,48 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sorted sliced ELLPACK) companion storage used by the host
+ * SpMV kernels. Rows are sorted by length inside windows of `sigma' rows and
+ * grouped in chunks of `chunk_size' rows. Each chunk is stored column-major
+ * and padded to the length of its longest row, so that consecutive entries
+ * of a chunk map to consecutive SIMD lanes.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_CHUNK_SIZE 8
+#define HYPRE_SELL_SIGMA      256
+
+typedef struct
+{
+   HYPRE_Int       num_rows;
+   HYPRE_Int       num_chunks;
+   HYPRE_Int       num_entries;     /* including padding */
+   HYPRE_Int       beneficial;      /* 0: padding overhead too large, CSR kernels are used */
+   HYPRE_Int      *chunk_ptr;       /* offset of each chunk in `j' and `data' */
+   HYPRE_Int      *chunk_len;       /* number of columns of each chunk */
+   HYPRE_Int      *perm;            /* original row of each slot, -1 for padded slots */
+   HYPRE_Int      *j;
+   HYPRE_Complex  *data;
+
+   /* CSR arrays the layout was built from (used for detecting staleness) */
+   HYPRE_Complex  *csr_data;
+   HYPRE_Int      *csr_j;
+   HYPRE_Int       csr_num_nonzeros;
+} hypre_CSRSellData;
+
+#define hypre_CSRSellDataNumRows(sell)              ((sell) -> num_rows)
+#define hypre_CSRSellDataNumChunks(sell)            ((sell) -> num_chunks)
+#define hypre_CSRSellDataNumEntries(sell)           ((sell) -> num_entries)
+#define hypre_CSRSellDataBeneficial(sell)           ((sell) -> beneficial)
+#define hypre_CSRSellDataChunkPtr(sell)             ((sell) -> chunk_ptr)
+#define hypre_CSRSellDataChunkLen(sell)             ((sell) -> chunk_len)
+#define hypre_CSRSellDataPerm(sell)                 ((sell) -> perm)
+#define hypre_CSRSellDataJ(sell)                    ((sell) -> j)
+#define hypre_CSRSellDataData(sell)                 ((sell) -> data)
+#define hypre_CSRSellDataCSRData(sell)              ((sell) -> csr_data)
+#define hypre_CSRSellDataCSRJ(sell)                 ((sell) -> csr_j)
+#define hypre_CSRSellDataCSRNumNonzeros(sell)       ((sell) -> csr_num_nonzeros)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -46,6 +88,8 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_CSRSellData    *sell;            /* SELL-C-sigma layout for host SpMV (built lazily) */
+   hypre_float          *data_sp;         /* single precision values (replace `data' when set) */
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
@@ -73,6 +117,8 @@ typedef struct
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixPatternOnly(matrix)          ((matrix) -> pattern_only)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSellData(matrix)             ((matrix) -> sell)
+#define hypre_CSRMatrixDataSP(matrix)               ((matrix) -> data_sp)
 
 #if defined(HYPRE_USING_CUSPARSE)  ||\
     defined(HYPRE_USING_ROCSPARSE) ||\
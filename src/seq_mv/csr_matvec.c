@@ -112,6 +112,79 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
       x_data = hypre_VectorData(x_tmp);
    }
 
+   /*-----------------------------------------------------------------------
+    * Single precision values of A, accumulated in HYPRE_Complex
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_CSRMatrixDataSP(A))
+   {
+      hypre_float *A_data_sp = hypre_CSRMatrixDataSP(A);
+
+      if (num_vectors > 1)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Single precision Matvec doesn't support multicomponent vectors");
+      }
+      else if (beta == 0.0)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data_sp[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] = alpha * tempx;
+         }
+      }
+      else
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data_sp[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] = alpha * tempx + beta * b_data[i];
+         }
+      }
+
+      if (x == y)
+      {
+         hypre_SeqVectorDestroy(x_tmp);
+      }
+
+      return ierr;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Use the SELL-C-sigma layout of A when requested
+    *-----------------------------------------------------------------------*/
+
+   if (num_vectors == 1 && offset == 0 && hypre_HandleSpMVUseSell(hypre_handle()))
+   {
+      hypre_CSRSellData *sell = hypre_CSRMatrixGetSellData(A);
+
+      if (sell)
+      {
+         hypre_CSRMatrixSellMatvecHost(alpha, sell, x_data, beta, b_data, y_data);
+
+         if (x == y)
+         {
+            hypre_SeqVectorDestroy(x_tmp);
+         }
+
+         return ierr;
+      }
+   }
+
    temp = beta / alpha;
 
    if (num_vectors > 1)
@@ -944,6 +1017,8 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
    HYPRE_Int         ierr  = 0;
 
    hypre_Vector     *x_tmp = NULL;
+   hypre_CSRSellData *sell = NULL;
+   hypre_float      *A_data_sp = hypre_CSRMatrixDataSP(A);
 
    /*---------------------------------------------------------------------
     *  Check for size compatibility.  MatvecT returns ierr = 1 if
@@ -972,6 +1047,14 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
    {
       ierr = 3;
    }
+
+   if (A_data_sp && num_vectors > 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Single precision MatvecT doesn't support multicomponent vectors");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation - RDF: USE MACHINE EPS
     *-----------------------------------------------------------------------*/
@@ -1028,12 +1111,79 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
    /*-----------------------------------------------------------------
     * y += A^T*x
     *-----------------------------------------------------------------*/
+   if (num_vectors == 1 && hypre_HandleSpMVUseSell(hypre_handle()))
+   {
+      sell = hypre_CSRMatrixGetSellData(A);
+   }
+
    num_threads = hypre_NumThreads();
    if (num_threads > 1)
    {
       y_data_expand = hypre_CTAlloc(HYPRE_Complex,  num_threads * y_size, HYPRE_MEMORY_HOST);
 
-      if ( num_vectors == 1 )
+      if (sell)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel private(i,j,my_thread_num,offset)
+#endif
+         {
+            HYPRE_Int chunk_begin, chunk_end;
+
+            my_thread_num = hypre_GetThreadNum();
+            offset =  y_size * my_thread_num;
+
+            hypre_GetSimpleThreadPartition(&chunk_begin, &chunk_end,
+                                           hypre_CSRSellDataNumChunks(sell));
+            hypre_CSRMatrixSellMatvecTHost(sell, x_data, y_data_expand + offset,
+                                           chunk_begin, chunk_end);
+
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp barrier
+            #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < y_size; i++)
+            {
+               for (j = 0; j < num_threads; j++)
+               {
+                  y_data[i] += y_data_expand[j * y_size + i];
+               }
+            }
+         } /* end parallel threaded region */
+      }
+      else if (A_data_sp)
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel private(i,jj,j,my_thread_num,offset)
+#endif
+         {
+            my_thread_num = hypre_GetThreadNum();
+            offset =  y_size * my_thread_num;
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < num_rows; i++)
+            {
+               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+               {
+                  j = A_j[jj];
+                  y_data_expand[offset + j] += A_data_sp[jj] * x_data[i];
+               }
+            }
+
+            /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < y_size; i++)
+            {
+               for (j = 0; j < num_threads; j++)
+               {
+                  y_data[i] += y_data_expand[j * y_size + i];
+               }
+            }
+         } /* end parallel threaded region */
+      }
+      else if ( num_vectors == 1 )
       {
 
 #ifdef HYPRE_USING_OPENMP
@@ -1089,6 +1239,21 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
       hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
 
    }
+   else if (sell)
+   {
+      hypre_CSRMatrixSellMatvecTHost(sell, x_data, y_data, 0, hypre_CSRSellDataNumChunks(sell));
+   }
+   else if (A_data_sp)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            j = A_j[jj];
+            y_data[j] += A_data_sp[jj] * x_data[i];
+         }
+      }
+   }
    else
    {
       for (i = 0; i < num_rows; i++)
@@ -0,0 +1,422 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma companion storage and host SpMV kernels for hypre_CSRMatrix.
+ *
+ * The SELL layout is built lazily from the CSR arrays the first time a host
+ * matvec is performed with HYPRE_SetSpMVUseSell(1). The explicit SIMD kernels
+ * are only compiled for double precision real values with 32-bit HYPRE_Int
+ * and when the compiler targets AVX-512 or AVX2 (e.g., -march=native).
+ * Otherwise, portable kernels written over the chunk lanes are used.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && \
+    !defined(HYPRE_LONG_DOUBLE) && !defined(HYPRE_BIGINT)
+#if defined(__AVX512F__)
+#define HYPRE_SELL_USING_AVX512
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define HYPRE_SELL_USING_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+/* Maximum ratio between SELL entries (including padding) and CSR nonzeros */
+#define HYPRE_SELL_MAX_FILL 1.5
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRSellDataDestroy( hypre_CSRSellData *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRSellDataChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataPerm(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataJ(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRSellDataData(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRSellDataCreate
+ *
+ * Builds the SELL-C-sigma layout of a host CSR matrix. If the padding
+ * overhead exceeds HYPRE_SELL_MAX_FILL, only the header is kept and the
+ * layout is flagged as not beneficial.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRSellDataCreate( hypre_CSRMatrix *A )
+{
+   HYPRE_Int          num_rows     = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int          num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Int         *A_i          = hypre_CSRMatrixI(A);
+   HYPRE_Int         *A_j          = hypre_CSRMatrixJ(A);
+   HYPRE_Complex     *A_data       = hypre_CSRMatrixData(A);
+
+   HYPRE_Int          chunk_size   = HYPRE_SELL_CHUNK_SIZE;
+   HYPRE_Int          sigma        = HYPRE_SELL_SIGMA;
+   HYPRE_Int          num_chunks   = (num_rows + chunk_size - 1) / chunk_size;
+   HYPRE_Int          num_slots    = num_chunks * chunk_size;
+
+   hypre_CSRSellData *sell;
+   HYPRE_Int         *chunk_ptr;
+   HYPRE_Int         *chunk_len;
+   HYPRE_Int         *perm;
+   HYPRE_Int         *row_len;
+   HYPRE_Int         *sell_j;
+   HYPRE_Complex     *sell_data;
+   HYPRE_Int          c, i, k, r, w, num_entries;
+
+   sell = hypre_CTAlloc(hypre_CSRSellData, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CSRSellDataNumRows(sell)          = num_rows;
+   hypre_CSRSellDataCSRData(sell)          = A_data;
+   hypre_CSRSellDataCSRJ(sell)             = A_j;
+   hypre_CSRSellDataCSRNumNonzeros(sell)   = num_nonzeros;
+   hypre_CSRSellDataBeneficial(sell)       = 0;
+
+   if (num_rows < chunk_size || num_nonzeros <= 0)
+   {
+      return sell;
+   }
+
+   /* Sort rows by decreasing length inside each sigma-window.
+      Padded slots are kept at the end of the last chunk */
+   perm    = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   row_len = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      perm[i]    = i;
+      row_len[i] = -(A_i[i + 1] - A_i[i]);
+   }
+   for (i = num_rows; i < num_slots; i++)
+   {
+      perm[i]    = -1;
+      row_len[i] = 0;
+   }
+
+   for (i = 0; i < num_rows; i += sigma)
+   {
+      hypre_qsort2i(row_len, perm, i, hypre_min(i + sigma, num_rows) - 1);
+   }
+
+   /* Compute chunk widths and offsets */
+   chunk_ptr = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_TAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      w = 0;
+      for (r = 0; r < chunk_size; r++)
+      {
+         w = hypre_max(w, -row_len[c * chunk_size + r]);
+      }
+      chunk_len[c]     = w;
+      chunk_ptr[c + 1] = chunk_ptr[c] + w * chunk_size;
+   }
+   num_entries = chunk_ptr[num_chunks];
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   hypre_CSRSellDataNumChunks(sell)  = num_chunks;
+   hypre_CSRSellDataNumEntries(sell) = num_entries;
+
+   if ((HYPRE_Real) num_entries > HYPRE_SELL_MAX_FILL * (HYPRE_Real) num_nonzeros)
+   {
+      hypre_TFree(perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(chunk_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(chunk_len, HYPRE_MEMORY_HOST);
+
+      return sell;
+   }
+
+   /* Fill chunks column-major. Padded entries repeat the last column index
+      of the row (or column zero for empty rows) with a zero coefficient */
+   sell_j    = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   sell_data = hypre_TAlloc(HYPRE_Complex, num_entries, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c,r,k,i,w) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Int offset = chunk_ptr[c];
+
+      w = chunk_len[c];
+      for (r = 0; r < chunk_size; r++)
+      {
+         HYPRE_Int row   = perm[c * chunk_size + r];
+         HYPRE_Int start = (row < 0) ? 0 : A_i[row];
+         HYPRE_Int n     = (row < 0) ? 0 : A_i[row + 1] - start;
+         HYPRE_Int pad_j = (n > 0) ? A_j[start + n - 1] : 0;
+
+         for (k = 0; k < n; k++)
+         {
+            i = offset + k * chunk_size + r;
+            sell_j[i]    = A_j[start + k];
+            sell_data[i] = A_data[start + k];
+         }
+         for (k = n; k < w; k++)
+         {
+            i = offset + k * chunk_size + r;
+            sell_j[i]    = pad_j;
+            sell_data[i] = 0.0;
+         }
+      }
+   }
+
+   hypre_CSRSellDataChunkPtr(sell)   = chunk_ptr;
+   hypre_CSRSellDataChunkLen(sell)   = chunk_len;
+   hypre_CSRSellDataPerm(sell)       = perm;
+   hypre_CSRSellDataJ(sell)          = sell_j;
+   hypre_CSRSellDataData(sell)       = sell_data;
+   hypre_CSRSellDataBeneficial(sell) = 1;
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixDestroySellData
+ *
+ * Frees the SELL layout of A. This must be called whenever the values or
+ * the sparsity pattern of A are modified in place after a host matvec.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixDestroySellData( hypre_CSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_CSRSellDataDestroy(hypre_CSRMatrixSellData(A));
+      hypre_CSRMatrixSellData(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixGetSellData
+ *
+ * Returns the SELL layout of A, building it if needed. Returns NULL when
+ * the layout is not beneficial for A or cannot be used.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRSellData *
+hypre_CSRMatrixGetSellData( hypre_CSRMatrix *A )
+{
+   hypre_CSRSellData *sell = hypre_CSRMatrixSellData(A);
+
+   if (hypre_CSRMatrixPatternOnly(A) || !hypre_CSRMatrixData(A))
+   {
+      return NULL;
+   }
+
+   /* Rebuild if the CSR arrays have been replaced */
+   if (sell &&
+       (hypre_CSRSellDataCSRData(sell)        != hypre_CSRMatrixData(A) ||
+        hypre_CSRSellDataCSRJ(sell)           != hypre_CSRMatrixJ(A)    ||
+        hypre_CSRSellDataCSRNumNonzeros(sell) != hypre_CSRMatrixNumNonzeros(A) ||
+        hypre_CSRSellDataNumRows(sell)        != hypre_CSRMatrixNumRows(A)))
+   {
+      hypre_CSRMatrixDestroySellData(A);
+      sell = NULL;
+   }
+
+   if (!sell)
+   {
+      sell = hypre_CSRSellDataCreate(A);
+      hypre_CSRMatrixSellData(A) = sell;
+   }
+
+   return hypre_CSRSellDataBeneficial(sell) ? sell : NULL;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellMatvecHost
+ *
+ * y = alpha*A*x + beta*b using the SELL layout of A. b is not accessed
+ * when beta is zero.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellMatvecHost( HYPRE_Complex      alpha,
+                               hypre_CSRSellData *sell,
+                               HYPRE_Complex     *x_data,
+                               HYPRE_Complex      beta,
+                               HYPRE_Complex     *b_data,
+                               HYPRE_Complex     *y_data )
+{
+   HYPRE_Int       num_chunks = hypre_CSRSellDataNumChunks(sell);
+   HYPRE_Int      *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int      *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int      *perm       = hypre_CSRSellDataPerm(sell);
+   HYPRE_Int      *sell_j     = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex  *sell_data  = hypre_CSRSellDataData(sell);
+   HYPRE_Int       c, k, r;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(c,k,r) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Int       w    = chunk_len[c];
+      HYPRE_Int      *cj   = sell_j + chunk_ptr[c];
+      HYPRE_Complex  *cval = sell_data + chunk_ptr[c];
+      HYPRE_Int      *crow = perm + c * HYPRE_SELL_CHUNK_SIZE;
+      HYPRE_Complex   sum[HYPRE_SELL_CHUNK_SIZE];
+
+#if defined(HYPRE_SELL_USING_AVX512)
+      __m512d acc = _mm512_setzero_pd();
+      for (k = 0; k < w; k++)
+      {
+         __m256i idx = _mm256_loadu_si256((const __m256i *) (cj + k * HYPRE_SELL_CHUNK_SIZE));
+         __m512d val = _mm512_loadu_pd(cval + k * HYPRE_SELL_CHUNK_SIZE);
+         __m512d xv  = _mm512_i32gather_pd(idx, x_data, 8);
+         acc = _mm512_fmadd_pd(val, xv, acc);
+      }
+      _mm512_storeu_pd(sum, acc);
+#elif defined(HYPRE_SELL_USING_AVX2)
+      __m256d acc0 = _mm256_setzero_pd();
+      __m256d acc1 = _mm256_setzero_pd();
+      for (k = 0; k < w; k++)
+      {
+         HYPRE_Int     *kj  = cj + k * HYPRE_SELL_CHUNK_SIZE;
+         HYPRE_Complex *kv  = cval + k * HYPRE_SELL_CHUNK_SIZE;
+         __m256d        xv0 = _mm256_i32gather_pd(x_data, _mm_loadu_si128((const __m128i *) kj), 8);
+         __m256d        xv1 = _mm256_i32gather_pd(x_data, _mm_loadu_si128((const __m128i *) (kj + 4)),
+                                                  8);
+#if defined(__FMA__)
+         acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(kv), xv0, acc0);
+         acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(kv + 4), xv1, acc1);
+#else
+         acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(_mm256_loadu_pd(kv), xv0));
+         acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(_mm256_loadu_pd(kv + 4), xv1));
+#endif
+      }
+      _mm256_storeu_pd(sum, acc0);
+      _mm256_storeu_pd(sum + 4, acc1);
+#else
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         sum[r] = 0.0;
+      }
+      for (k = 0; k < w; k++)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            sum[r] += cval[k * HYPRE_SELL_CHUNK_SIZE + r] * x_data[cj[k * HYPRE_SELL_CHUNK_SIZE + r]];
+         }
+      }
+#endif
+
+      if (beta == 0.0)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            if (crow[r] >= 0)
+            {
+               y_data[crow[r]] = alpha * sum[r];
+            }
+         }
+      }
+      else
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            if (crow[r] >= 0)
+            {
+               y_data[crow[r]] = alpha * sum[r] + beta * b_data[crow[r]];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellMatvecTHost
+ *
+ * y += A^T*x restricted to chunks [chunk_begin, chunk_end) of the SELL
+ * layout of A. Not threaded: callers provide per-thread output arrays.
+ * Products are formed with SIMD, while the scatter into y stays scalar
+ * since lanes of a chunk may share a column index.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellMatvecTHost( hypre_CSRSellData *sell,
+                                HYPRE_Complex     *x_data,
+                                HYPRE_Complex     *y_data,
+                                HYPRE_Int          chunk_begin,
+                                HYPRE_Int          chunk_end )
+{
+   HYPRE_Int      *chunk_ptr  = hypre_CSRSellDataChunkPtr(sell);
+   HYPRE_Int      *chunk_len  = hypre_CSRSellDataChunkLen(sell);
+   HYPRE_Int      *perm       = hypre_CSRSellDataPerm(sell);
+   HYPRE_Int      *sell_j     = hypre_CSRSellDataJ(sell);
+   HYPRE_Complex  *sell_data  = hypre_CSRSellDataData(sell);
+   HYPRE_Int       c, k, r;
+
+   for (c = chunk_begin; c < chunk_end; c++)
+   {
+      HYPRE_Int       w    = chunk_len[c];
+      HYPRE_Int      *cj   = sell_j + chunk_ptr[c];
+      HYPRE_Complex  *cval = sell_data + chunk_ptr[c];
+      HYPRE_Int      *crow = perm + c * HYPRE_SELL_CHUNK_SIZE;
+      HYPRE_Complex   xr[HYPRE_SELL_CHUNK_SIZE];
+      HYPRE_Complex   prod[HYPRE_SELL_CHUNK_SIZE];
+
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         xr[r] = (crow[r] >= 0) ? x_data[crow[r]] : 0.0;
+      }
+
+#if defined(HYPRE_SELL_USING_AVX512)
+      __m512d xv = _mm512_loadu_pd(xr);
+#elif defined(HYPRE_SELL_USING_AVX2)
+      __m256d xv0 = _mm256_loadu_pd(xr);
+      __m256d xv1 = _mm256_loadu_pd(xr + 4);
+#endif
+
+      for (k = 0; k < w; k++)
+      {
+         HYPRE_Int     *kj = cj + k * HYPRE_SELL_CHUNK_SIZE;
+         HYPRE_Complex *kv = cval + k * HYPRE_SELL_CHUNK_SIZE;
+
+#if defined(HYPRE_SELL_USING_AVX512)
+         _mm512_storeu_pd(prod, _mm512_mul_pd(_mm512_loadu_pd(kv), xv));
+#elif defined(HYPRE_SELL_USING_AVX2)
+         _mm256_storeu_pd(prod, _mm256_mul_pd(_mm256_loadu_pd(kv), xv0));
+         _mm256_storeu_pd(prod + 4, _mm256_mul_pd(_mm256_loadu_pd(kv + 4), xv1));
+#else
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            prod[r] = kv[r] * xr[r];
+         }
+#endif
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            y_data[kj[r]] += prod[r];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
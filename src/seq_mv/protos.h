@@ -147,6 +147,7 @@ hypre_CSRMatrix *hypre_CSRMatrixUnion( hypre_CSRMatrix *A,
                                        HYPRE_BigInt *col_map_offd_A,
                                        HYPRE_BigInt *col_map_offd_B,
                                        HYPRE_BigInt **col_map_offd_C );
+HYPRE_Int hypre_CSRMatrixConvertToSinglePrecision( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows,
@@ -165,6 +166,18 @@ HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_CSRMatrix *A, hy
                                      HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int *CF_marker_x, HYPRE_Int *CF_marker_y,
                                      HYPRE_Int fpt );
 
+/* csr_matvec_sell.c */
+HYPRE_Int hypre_CSRSellDataDestroy( hypre_CSRSellData *sell );
+hypre_CSRSellData *hypre_CSRSellDataCreate( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixDestroySellData( hypre_CSRMatrix *A );
+hypre_CSRSellData *hypre_CSRMatrixGetSellData( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellMatvecHost( HYPRE_Complex alpha, hypre_CSRSellData *sell,
+                                         HYPRE_Complex *x_data, HYPRE_Complex beta,
+                                         HYPRE_Complex *b_data, HYPRE_Complex *y_data );
+HYPRE_Int hypre_CSRMatrixSellMatvecTHost( hypre_CSRSellData *sell, HYPRE_Complex *x_data,
+                                          HYPRE_Complex *y_data, HYPRE_Int chunk_begin,
+                                          HYPRE_Int chunk_end );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A,
                                       hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
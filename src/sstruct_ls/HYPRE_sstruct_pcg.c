@@ -235,6 +235,12 @@ HYPRE_SStructDiagScale( HYPRE_SStructSolver solver,
          sx = hypre_SStructPVectorSVector(px, vi);
          sy = hypre_SStructPVectorSVector(py, vi);
 
+         if (hypre_SStructPMatrixMatrixFree(pA))
+         {
+            hypre_SStructPMatrixCoefDiagScale(pA, vi, sy, sx);
+            continue;
+         }
+
          HYPRE_StructDiagScale( (HYPRE_StructSolver) solver,
                                 (HYPRE_StructMatrix) sA,
                                 (HYPRE_StructVector) sy,
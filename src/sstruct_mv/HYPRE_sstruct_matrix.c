@@ -55,6 +55,8 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
    hypre_SStructMatrixPMatrices(matrix) = pmatrices;
    symmetric = hypre_TAlloc(HYPRE_Int **,  nparts, HYPRE_MEMORY_HOST);
    hypre_SStructMatrixSymmetric(matrix) = symmetric;
+   hypre_SStructMatrixCoefs(matrix) = hypre_CTAlloc(hypre_SStructCoef **, nparts,
+                                                    HYPRE_MEMORY_HOST);
    /* is this a rectangular matrix? */
    rectangular = 0;
    if (hypre_SStructGraphGrid(graph) != hypre_SStructGraphDomainGrid(graph))
@@ -141,6 +143,7 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
    /* GEC0902 setting the default of the object_type to HYPRE_SSTRUCT */
 
    hypre_SStructMatrixObjectType(matrix) = HYPRE_SSTRUCT;
+   hypre_SStructMatrixDirectParCSR(matrix) = 0;
 
    *matrix_ptr = matrix;
 
@@ -158,6 +161,7 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
    HYPRE_Int               nparts;
    hypre_SStructPMatrix  **pmatrices;
    HYPRE_Int            ***symmetric;
+   hypre_SStructCoef    ***coefs;
    hypre_SStructPGrid     *pgrid;
    HYPRE_Int               nvars;
    HYPRE_Int               part, var;
@@ -175,6 +179,7 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
          nparts       = hypre_SStructMatrixNParts(matrix);
          pmatrices    = hypre_SStructMatrixPMatrices(matrix);
          symmetric    = hypre_SStructMatrixSymmetric(matrix);
+         coefs        = hypre_SStructMatrixCoefs(matrix);
          for (part = 0; part < nparts; part++)
          {
             pgrid = hypre_SStructGraphPGrid(graph, part);
@@ -183,15 +188,28 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
             {
                hypre_TFree(splits[part][var], HYPRE_MEMORY_HOST);
                hypre_TFree(symmetric[part][var], HYPRE_MEMORY_HOST);
+               if (coefs[part])
+               {
+                  hypre_TFree(coefs[part][var], HYPRE_MEMORY_HOST);
+               }
             }
             hypre_TFree(splits[part], HYPRE_MEMORY_HOST);
             hypre_TFree(symmetric[part], HYPRE_MEMORY_HOST);
+            hypre_TFree(coefs[part], HYPRE_MEMORY_HOST);
             hypre_SStructPMatrixDestroy(pmatrices[part]);
          }
          HYPRE_SStructGraphDestroy(graph);
          hypre_TFree(splits, HYPRE_MEMORY_HOST);
          hypre_TFree(pmatrices, HYPRE_MEMORY_HOST);
          hypre_TFree(symmetric, HYPRE_MEMORY_HOST);
+         hypre_TFree(coefs, HYPRE_MEMORY_HOST);
+         if (hypre_SStructMatrixIJMatrix(matrix) &&
+             hypre_SStructMatrixParCSRMatrix(matrix) !=
+             hypre_IJMatrixObject(hypre_SStructMatrixIJMatrix(matrix)))
+         {
+            /* ParCSR matrix built directly from the S-matrix */
+            hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+         }
          HYPRE_IJMatrixDestroy(hypre_SStructMatrixIJMatrix(matrix));
          hypre_TFree(hypre_SStructMatrixSEntries(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_SStructMatrixUEntries(matrix), HYPRE_MEMORY_HOST);
@@ -218,8 +236,10 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
    hypre_SStructGraph     *graph     = hypre_SStructMatrixGraph(matrix);
    hypre_SStructPMatrix  **pmatrices = hypre_SStructMatrixPMatrices(matrix);
    HYPRE_Int            ***symmetric = hypre_SStructMatrixSymmetric(matrix);
+   hypre_SStructCoef    ***coefs     = hypre_SStructMatrixCoefs(matrix);
    hypre_SStructStencil ***stencils  = hypre_SStructGraphStencils(graph);
    HYPRE_Int              *split;
+   hypre_SStructCoef      *coef;
 
    MPI_Comm                pcomm;
    hypre_SStructPGrid     *pgrid;
@@ -240,6 +260,46 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
    HYPRE_BigInt            ilower, iupper, jlower, jupper;
    HYPRE_Int               matrix_type = hypre_SStructMatrixObjectType(matrix);
 
+#if defined(HYPRE_USING_GPU)
+   hypre_SStructMatrixDirectParCSR(matrix) = 0;
+#endif
+   if (matrix_type != HYPRE_PARCSR ||
+       hypre_SStructGraphGrid(graph) != hypre_SStructGraphDomainGrid(graph))
+   {
+      hypre_SStructMatrixDirectParCSR(matrix) = 0;
+   }
+
+   /* For a direct ParCSR conversion, put the stencil coefficients back in the
+    * S-matrix (see HYPRE_SStructMatrixCreate) */
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid = hypre_SStructGraphPGrid(graph, part);
+         nvars = hypre_SStructPGridNVars(pgrid);
+         for (var = 0; var < nvars; var++)
+         {
+            split = hypre_SStructMatrixSplit(matrix, part, var);
+            stencil_size = hypre_SStructStencilSize(stencils[part][var]);
+            stencil_vars = hypre_SStructStencilVars(stencils[part][var]);
+            pstencil_size = 0;
+            for (i = 0; i < stencil_size; i++)
+            {
+               if (hypre_SStructPGridVarType(pgrid, stencil_vars[i]) ==
+                   hypre_SStructPGridVarType(pgrid, var))
+               {
+                  split[i] = pstencil_size;
+                  pstencil_size++;
+               }
+               else
+               {
+                  split[i] = -1;
+               }
+            }
+         }
+      }
+   }
+
    /* S-matrix */
    for (part = 0; part < nparts; part++)
    {
@@ -283,6 +343,33 @@ HYPRE_SStructMatrixInitialize( HYPRE_SStructMatrix matrix )
                                              symmetric[part][var][i]);
          }
       }
+      if (coefs[part] != NULL)
+      {
+         /* matrix-free part: hand the coefficient functions to the pmatrix */
+         if (matrix_type != HYPRE_SSTRUCT)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "Matrix-free parts require the HYPRE_SSTRUCT object type!\n");
+            return hypre_error_flag;
+         }
+         for (var = 0; var < nvars; var++)
+         {
+            split = hypre_SStructMatrixSplit(matrix, part, var);
+            stencil_size = hypre_SStructStencilSize(stencils[part][var]);
+            for (i = 0; i < stencil_size; i++)
+            {
+               coef = &coefs[part][var][i];
+               if (split[i] < 0 || coef -> fcn == NULL)
+               {
+                  hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                                    "Invalid or missing coefficient function!\n");
+                  return hypre_error_flag;
+               }
+               hypre_SStructPMatrixSetCoefFunction(pmatrices[part], var, split[i],
+                                                   coef -> fcn, coef -> data);
+            }
+         }
+      }
       hypre_SStructPMatrixInitialize(pmatrices[part]);
    }
 
@@ -748,7 +835,9 @@ HYPRE_SStructMatrixAssemble( HYPRE_SStructMatrix matrix )
       recv_matrix = hypre_SStructPMatrixSMatrix(
                        hypre_SStructMatrixPMatrix(matrix, recv_part), recv_var, recv_var);
 
-      if ((send_matrix != NULL) && (recv_matrix != NULL))
+      if ((send_matrix != NULL) && (recv_matrix != NULL) &&
+          !hypre_SStructPMatrixMatrixFree(hypre_SStructMatrixPMatrix(matrix, send_part)) &&
+          !hypre_SStructPMatrixMatrixFree(hypre_SStructMatrixPMatrix(matrix, recv_part)))
       {
          hypre_StructStencil *send_stencil = hypre_StructMatrixStencil(send_matrix);
          hypre_StructStencil *recv_stencil = hypre_StructMatrixStencil(recv_matrix);
@@ -922,6 +1011,57 @@ HYPRE_SStructMatrixSetNSSymmetric( HYPRE_SStructMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixSetCoefFunction( HYPRE_SStructMatrix   matrix,
+                                    HYPRE_Int             part,
+                                    HYPRE_Int             var,
+                                    HYPRE_Int             entry,
+                                    HYPRE_SStructCoefFcn  fcn,
+                                    void                 *fcn_data )
+{
+   hypre_SStructGraph     *graph = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructCoef    ***coefs = hypre_SStructMatrixCoefs(matrix);
+   hypre_SStructStencil ***stencils = hypre_SStructGraphStencils(graph);
+   hypre_SStructPGrid     *pgrid;
+   HYPRE_Int               nvars, vi;
+
+   if (part < 0 || part >= hypre_SStructMatrixNParts(matrix))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   pgrid = hypre_SStructGraphPGrid(graph, part);
+   nvars = hypre_SStructPGridNVars(pgrid);
+   if (var < 0 || var >= nvars)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   if (entry < 0 || entry >= hypre_SStructStencilSize(stencils[part][var]))
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (coefs[part] == NULL)
+   {
+      coefs[part] = hypre_TAlloc(hypre_SStructCoef *, nvars, HYPRE_MEMORY_HOST);
+      for (vi = 0; vi < nvars; vi++)
+      {
+         coefs[part][vi] = hypre_CTAlloc(hypre_SStructCoef,
+                                         hypre_SStructStencilSize(stencils[part][vi]),
+                                         HYPRE_MEMORY_HOST);
+      }
+   }
+   coefs[part][var][entry].fcn  = fcn;
+   coefs[part][var][entry].data = fcn_data;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -963,6 +1103,24 @@ HYPRE_SStructMatrixSetObjectType( HYPRE_SStructMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR( HYPRE_SStructMatrix  matrix,
+                                    HYPRE_Int            direct )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_SStructMatrixDirectParCSR(matrix) = direct;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1116,6 +1274,11 @@ HYPRE_SStructMatrixPrint( const char          *filename,
          for (vj = 0; vj < nvars; vj++)
          {
             smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
+            /* no data is stored for matrix-free parts */
+            if (hypre_SStructPMatrixMatrixFree(pmatrix))
+            {
+               smatrix = NULL;
+            }
             data_size = (smatrix) ? hypre_StructMatrixDataSize(smatrix) : 0;
 
             hypre_fprintf(file, "\nData - (Part %d, Vi %d, Vj %d): %d\n",
@@ -787,6 +787,45 @@ HYPRE_Int
 HYPRE_SStructMatrixSetNSSymmetric(HYPRE_SStructMatrix matrix,
                                   HYPRE_Int           symmetric);
 
+/**
+ * Coefficient callback for matrix-free stencil entries.  On return, \e value
+ * holds the coefficient of the stencil entry at the grid point \e index.
+ * The function must return zero on success; a nonzero return is reported as
+ * a hypre error by the routine that evaluated it.  It is called from inside
+ * a (possibly OpenMP-threaded) BoxLoop, so it must be thread-safe: several
+ * threads may call it at once with the same \e fcn_data.
+ *
+ * @see HYPRE_SStructMatrixSetCoefFunction
+ **/
+typedef HYPRE_Int (*HYPRE_SStructCoefFcn)(void          *fcn_data,
+                                          HYPRE_Int     *index,
+                                          HYPRE_Complex *value);
+
+/**
+ * (Optional) Register a coefficient function for stencil entry \e entry of
+ * variable \e var on part \e part.  A part with registered functions is
+ * matrix-free: no coefficient storage is allocated for it and its stencil
+ * coefficients are evaluated on the fly in the matrix-vector product, so
+ * Krylov solvers and diagonal scaling can be used without assembling the
+ * operator.  If used, this routine must be called before
+ * \ref HYPRE_SStructMatrixInitialize, and every stencil entry of every
+ * variable on the part must be given a function.
+ *
+ * Restrictions: the object type must be \c HYPRE_SSTRUCT, the entries must
+ * couple variables of the same type (i.e., they must not require the
+ * unstructured component of the matrix), coefficients of couplings that leave
+ * the part must be returned as zero, and values may not be set on the part
+ * with the SetValues routines.  The callback is invoked from host code,
+ * possibly from several threads at once (see \ref HYPRE_SStructCoefFcn).
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixSetCoefFunction(HYPRE_SStructMatrix   matrix,
+                                   HYPRE_Int             part,
+                                   HYPRE_Int             var,
+                                   HYPRE_Int             entry,
+                                   HYPRE_SStructCoefFcn  fcn,
+                                   void                 *fcn_data);
+
 /**
  * Set the storage type of the matrix object to be constructed.  Currently, \e
  * type can be either \c HYPRE_SSTRUCT (the default), \c HYPRE_STRUCT,
@@ -798,6 +837,27 @@ HYPRE_Int
 HYPRE_SStructMatrixSetObjectType(HYPRE_SStructMatrix  matrix,
                                  HYPRE_Int            type);
 
+/**
+ * (Optional) For matrices of type \c HYPRE_PARCSR, store the stencil
+ * coefficients in structured form and build the ParCSR matrix directly from
+ * them at assembly time, instead of passing every coefficient through the IJ
+ * interface.  This is usually much faster for large stencil problems.  Only
+ * the non-stencil entries (and couplings between parts) go through the IJ
+ * interface.  Values must then be set with the SStruct routines; the IJ
+ * matrix obtained from the matrix only holds the non-stencil entries.  This
+ * routine must be called before \ref HYPRE_SStructMatrixInitialize.  It is
+ * ignored for device builds.
+ *
+ * Re-assembling the matrix with an unchanged sparsity pattern updates the
+ * values of the ParCSR matrix in place.  If the pattern changes, or if the
+ * matrix is initialized again, the ParCSR matrix is rebuilt and the object
+ * returned by \ref HYPRE_SStructMatrixGetObject before that is freed, so
+ * \ref HYPRE_SStructMatrixGetObject must be called again.
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixSetDirectParCSR(HYPRE_SStructMatrix  matrix,
+                                   HYPRE_Int            direct);
+
 /**
  * Get a reference to the constructed matrix object.
  *
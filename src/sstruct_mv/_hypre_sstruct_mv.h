@@ -548,6 +548,17 @@ typedef struct hypre_SStructGraph_struct
 #ifndef hypre_SSTRUCT_MATRIX_HEADER
 #define hypre_SSTRUCT_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructCoef: user coefficient function for a matrix-free entry
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_SStructCoefFcn    fcn;
+   void                   *data;
+
+} hypre_SStructCoef;
+
 /*--------------------------------------------------------------------------
  * hypre_SStructMatrix:
  *--------------------------------------------------------------------------*/
@@ -571,6 +582,10 @@ typedef struct
 
    HYPRE_Int               accumulated;  /* AddTo values accumulated? */
 
+   /* matrix-free parts: no coefficient data is stored in the smatrices */
+   HYPRE_Int               matrix_free;
+   hypre_SStructCoef     **coefs;        /* nvar x (split) stencil size */
+
    HYPRE_Int               ref_count;
 
 } hypre_SStructPMatrix;
@@ -587,10 +602,18 @@ typedef struct hypre_SStructMatrix_struct
    hypre_SStructPMatrix  **pmatrices;
    HYPRE_Int            ***symmetric;    /* Stencil entries symmetric?
                                           * (nparts x nvar x nvar array) */
+   hypre_SStructCoef    ***coefs;        /* Coefficient functions, NULL for
+                                          * stored parts (nparts x nvar x
+                                          * graph stencil size array) */
 
    /* U-matrix info */
    HYPRE_IJMatrix          ijmatrix;
-   hypre_ParCSRMatrix     *parcsrmatrix;
+   hypre_ParCSRMatrix     *parcsrmatrix; /* For HYPRE_PARCSR matrices built
+                                          * directly from the S-matrix, this
+                                          * is S + U and is not the IJ
+                                          * matrix object */
+   HYPRE_Int               direct_parcsr; /* Convert S-matrix to ParCSR
+                                           * directly (HYPRE_PARCSR only)? */
 
    /* temporary storage for SetValues routines */
    HYPRE_Int               entries_size;
@@ -628,8 +651,10 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixPMatrices(mat)            ((mat) -> pmatrices)
 #define hypre_SStructMatrixPMatrix(mat, part)        ((mat) -> pmatrices[part])
 #define hypre_SStructMatrixSymmetric(mat)            ((mat) -> symmetric)
+#define hypre_SStructMatrixCoefs(mat)                ((mat) -> coefs)
 #define hypre_SStructMatrixIJMatrix(mat)             ((mat) -> ijmatrix)
 #define hypre_SStructMatrixParCSRMatrix(mat)         ((mat) -> parcsrmatrix)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
 #define hypre_SStructMatrixEntriesSize(mat)          ((mat) -> entries_size)
 #define hypre_SStructMatrixSEntries(mat)             ((mat) -> Sentries)
 #define hypre_SStructMatrixUEntries(mat)             ((mat) -> Uentries)
@@ -668,6 +693,9 @@ hypre_SStructPGridNDim(hypre_SStructPMatrixPGrid(pmat))
 #define hypre_SStructPMatrixSEntriesSize(pmat)      ((pmat) -> sentries_size)
 #define hypre_SStructPMatrixSEntries(pmat)          ((pmat) -> sentries)
 #define hypre_SStructPMatrixAccumulated(pmat)       ((pmat) -> accumulated)
+#define hypre_SStructPMatrixMatrixFree(pmat)        ((pmat) -> matrix_free)
+#define hypre_SStructPMatrixCoefs(pmat)             ((pmat) -> coefs)
+#define hypre_SStructPMatrixCoef(pmat, var, entry)  (&((pmat) -> coefs[var][entry]))
 #define hypre_SStructPMatrixRefCount(pmat)          ((pmat) -> ref_count)
 
 #endif
@@ -859,6 +887,7 @@ HYPRE_Int HYPRE_SStructMatrixSetSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_In
                                             HYPRE_Int var, HYPRE_Int to_var, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix, HYPRE_Int symmetric );
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix, HYPRE_Int type );
+HYPRE_Int HYPRE_SStructMatrixSetDirectParCSR ( HYPRE_SStructMatrix matrix, HYPRE_Int direct );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix, void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename, HYPRE_SStructMatrix matrix,
                                      HYPRE_Int all );
@@ -1018,6 +1047,11 @@ HYPRE_Int hypre_SStructPMatrixAccumulate ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixAssemble ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPRE_Int var,
                                              HYPRE_Int to_var, HYPRE_Int symmetric );
+HYPRE_Int hypre_SStructPMatrixSetCoefFunction ( hypre_SStructPMatrix *pmatrix, HYPRE_Int var,
+                                                HYPRE_Int entry, HYPRE_SStructCoefFcn fcn,
+                                                void *fcn_data );
+HYPRE_Int hypre_SStructPMatrixCoefDiagScale ( hypre_SStructPMatrix *pmatrix, HYPRE_Int var,
+                                              hypre_StructVector *y, hypre_StructVector *x );
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename, hypre_SStructPMatrix *pmatrix,
                                       HYPRE_Int all );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
@@ -1028,6 +1062,7 @@ HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_I
                                             hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                             HYPRE_Complex *values, HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
+HYPRE_Int hypre_SStructMatrixAssembleParCSR ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Int *nSentries_ptr,
@@ -159,6 +159,9 @@ hypre_SStructPMatrixCreate( MPI_Comm               comm,
    hypre_SStructPMatrixSEntriesSize(pmatrix) = size;
    hypre_SStructPMatrixSEntries(pmatrix) = hypre_TAlloc(HYPRE_Int,  size, HYPRE_MEMORY_HOST);
 
+   hypre_SStructPMatrixMatrixFree(pmatrix) = 0;
+   hypre_SStructPMatrixCoefs(pmatrix)      = NULL;
+
    hypre_SStructPMatrixRefCount(pmatrix) = 1;
 
    *pmatrix_ptr = pmatrix;
@@ -178,6 +181,7 @@ hypre_SStructPMatrixDestroy( hypre_SStructPMatrix *pmatrix )
    hypre_StructStencil  ***sstencils;
    hypre_StructMatrix   ***smatrices;
    HYPRE_Int             **symmetric;
+   hypre_SStructCoef     **coefs;
    HYPRE_Int               vi, vj;
 
    if (pmatrix)
@@ -191,8 +195,13 @@ hypre_SStructPMatrixDestroy( hypre_SStructPMatrix *pmatrix )
          sstencils = hypre_SStructPMatrixSStencils(pmatrix);
          smatrices = hypre_SStructPMatrixSMatrices(pmatrix);
          symmetric = hypre_SStructPMatrixSymmetric(pmatrix);
+         coefs     = hypre_SStructPMatrixCoefs(pmatrix);
          for (vi = 0; vi < nvars; vi++)
          {
+            if (coefs)
+            {
+               hypre_TFree(coefs[vi], HYPRE_MEMORY_HOST);
+            }
             HYPRE_SStructStencilDestroy(stencils[vi]);
             hypre_TFree(smaps[vi], HYPRE_MEMORY_HOST);
             for (vj = 0; vj < nvars; vj++)
@@ -209,6 +218,7 @@ hypre_SStructPMatrixDestroy( hypre_SStructPMatrix *pmatrix )
          hypre_TFree(sstencils, HYPRE_MEMORY_HOST);
          hypre_TFree(smatrices, HYPRE_MEMORY_HOST);
          hypre_TFree(symmetric, HYPRE_MEMORY_HOST);
+         hypre_TFree(coefs, HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_SStructPMatrixSEntries(pmatrix), HYPRE_MEMORY_HOST);
          hypre_TFree(pmatrix, HYPRE_MEMORY_HOST);
       }
@@ -243,7 +253,12 @@ hypre_SStructPMatrixInitialize( hypre_SStructPMatrix *pmatrix )
       for (vj = 0; vj < nvars; vj++)
       {
          smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
-         if (smatrix != NULL)
+         if (smatrix != NULL && hypre_SStructPMatrixMatrixFree(pmatrix))
+         {
+            /* coefficients are computed on the fly, so allocate no data */
+            hypre_StructMatrixInitializeShell(smatrix);
+         }
+         else if (smatrix != NULL)
          {
             HYPRE_StructMatrixSetSymmetric(smatrix, symmetric[vi][vj]);
             /* hypre_StructMatrixSetNumGhost(smatrix, num_ghost); */
@@ -283,6 +298,12 @@ hypre_SStructPMatrixSetValues( hypre_SStructPMatrix *pmatrix,
    HYPRE_Int            *sentries;
    HYPRE_Int             i;
 
+   if (hypre_SStructPMatrixMatrixFree(pmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "No coefficients stored on a matrix-free part!\n");
+      return hypre_error_flag;
+   }
+
    smatrix = hypre_SStructPMatrixSMatrix(pmatrix, var, vars[entries[0]]);
 
    sentries = hypre_SStructPMatrixSEntries(pmatrix);
@@ -379,6 +400,12 @@ hypre_SStructPMatrixSetBoxValues( hypre_SStructPMatrix *pmatrix,
    HYPRE_Int            *sentries;
    HYPRE_Int             i, j;
 
+   if (hypre_SStructPMatrixMatrixFree(pmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "No coefficients stored on a matrix-free part!\n");
+      return hypre_error_flag;
+   }
+
    smatrix = hypre_SStructPMatrixSMatrix(pmatrix, var, vars[entries[0]]);
 
    sentries = hypre_SStructPMatrixSEntries(pmatrix);
@@ -490,8 +517,9 @@ hypre_SStructPMatrixAccumulate( hypre_SStructPMatrix *pmatrix )
    hypre_CommPkg         *comm_pkg;
    hypre_CommHandle      *comm_handle;
 
-   /* if values already accumulated, just return */
-   if (hypre_SStructPMatrixAccumulated(pmatrix))
+   /* if values already accumulated (or there are none), just return */
+   if (hypre_SStructPMatrixAccumulated(pmatrix) ||
+       hypre_SStructPMatrixMatrixFree(pmatrix))
    {
       return hypre_error_flag;
    }
@@ -546,6 +574,11 @@ hypre_SStructPMatrixAssemble( hypre_SStructPMatrix *pmatrix )
    hypre_StructMatrix    *smatrix;
    HYPRE_Int              vi, vj;
 
+   if (hypre_SStructPMatrixMatrixFree(pmatrix))
+   {
+      return hypre_error_flag;
+   }
+
    hypre_SStructPMatrixAccumulate(pmatrix);
 
    for (vi = 0; vi < nvars; vi++)
@@ -603,6 +636,135 @@ hypre_SStructPMatrixSetSymmetric( hypre_SStructPMatrix *pmatrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Register a coefficient function for the (split) stencil entry 'entry' of
+ * variable 'var'.  This makes the part matrix-free, and must be called
+ * before hypre_SStructPMatrixInitialize().
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixSetCoefFunction( hypre_SStructPMatrix *pmatrix,
+                                     HYPRE_Int             var,
+                                     HYPRE_Int             entry,
+                                     HYPRE_SStructCoefFcn  fcn,
+                                     void                 *fcn_data )
+{
+   HYPRE_Int            nvars = hypre_SStructPMatrixNVars(pmatrix);
+   hypre_SStructCoef  **coefs = hypre_SStructPMatrixCoefs(pmatrix);
+   hypre_SStructCoef   *coef;
+   HYPRE_Int            vi, size;
+
+   if (coefs == NULL)
+   {
+      coefs = hypre_TAlloc(hypre_SStructCoef *, nvars, HYPRE_MEMORY_HOST);
+      for (vi = 0; vi < nvars; vi++)
+      {
+         size = hypre_SStructStencilSize(hypre_SStructPMatrixStencil(pmatrix, vi));
+         coefs[vi] = hypre_CTAlloc(hypre_SStructCoef, size, HYPRE_MEMORY_HOST);
+      }
+      hypre_SStructPMatrixCoefs(pmatrix) = coefs;
+   }
+   hypre_SStructPMatrixMatrixFree(pmatrix) = 1;
+
+   coef = hypre_SStructPMatrixCoef(pmatrix, var, entry);
+   coef -> fcn  = fcn;
+   coef -> data = fcn_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Diagonal scaling x = y / diag(A) for variable 'var' of a matrix-free part,
+ * evaluating the diagonal coefficient with the user's function.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixCoefDiagScale( hypre_SStructPMatrix *pmatrix,
+                                   HYPRE_Int             var,
+                                   hypre_StructVector   *y,
+                                   hypre_StructVector   *x )
+{
+   HYPRE_Int             ndim    = hypre_SStructPMatrixNDim(pmatrix);
+   hypre_SStructStencil *stencil = hypre_SStructPMatrixStencil(pmatrix, var);
+   hypre_Index          *shape   = hypre_SStructStencilShape(stencil);
+   HYPRE_Int            *vars    = hypre_SStructStencilVars(stencil);
+   HYPRE_Int             size    = hypre_SStructStencilSize(stencil);
+   hypre_StructGrid     *sgrid   = hypre_StructVectorGrid(y);
+   hypre_BoxArray       *boxes   = hypre_StructGridBoxes(sgrid);
+   hypre_SStructCoef    *coef    = NULL;
+
+   hypre_Box            *box, *x_dbox, *y_dbox;
+   hypre_IndexRef        start;
+   hypre_Index           ustride, loop_size;
+   HYPRE_Complex        *xp, *yp;
+   HYPRE_Int             e, i;
+   HYPRE_Int             num_failed = 0;
+
+   for (e = 0; e < size; e++)
+   {
+      if (vars[e] == var && hypre_IndexEqual(shape[e], 0, ndim))
+      {
+         coef = hypre_SStructPMatrixCoef(pmatrix, var, e);
+         break;
+      }
+   }
+   if (coef == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free part has no diagonal entry!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_SetIndex(ustride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      start  = hypre_BoxIMin(box);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+#define HYPRE_BOX_REDUCTION reduction(+:num_failed)
+
+      /* user functions live on the host */
+      hypre_BoxLoop2ReductionBeginHost(ndim, loop_size,
+                                       x_dbox, start, ustride, xi,
+                                       y_dbox, start, ustride, yi, num_failed);
+      {
+         hypre_Index   index;
+         HYPRE_Complex value;
+
+         hypre_BoxLoopGetIndexHost(index);
+         hypre_AddIndexes(index, start, ndim, index);
+         if ((coef -> fcn)(coef -> data, index, &value))
+         {
+            num_failed++;
+            xp[xi] = 0.0;
+         }
+         else
+         {
+            xp[xi] = yp[yi] / value;
+         }
+      }
+      hypre_BoxLoop2ReductionEndHost(xi, yi, num_failed);
+
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+   }
+
+   if (num_failed)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Coefficient function returned an error!");
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -616,6 +778,11 @@ hypre_SStructPMatrixPrint( const char           *filename,
    HYPRE_Int           vi, vj;
    char                new_filename[255];
 
+   if (hypre_SStructPMatrixMatrixFree(pmatrix))
+   {
+      return hypre_error_flag;
+   }
+
    for (vi = 0; vi < nvars; vi++)
    {
       for (vj = 0; vj < nvars; vj++)
@@ -777,6 +944,13 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
                                                            HYPRE_MEMORY_HOST);
 
    HYPRE_IJMatrixInitialize(ijmatrix);
+
+   /* ParCSR matrix built directly from the S-matrix by a previous assembly */
+   if (hypre_SStructMatrixParCSRMatrix(matrix) &&
+       hypre_SStructMatrixParCSRMatrix(matrix) != hypre_IJMatrixObject(ijmatrix))
+   {
+      hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+   }
    HYPRE_IJMatrixGetObject(ijmatrix,
                            (void **) &hypre_SStructMatrixParCSRMatrix(matrix));
 
@@ -1301,6 +1475,472 @@ hypre_SStructUMatrixAssemble( hypre_SStructMatrix *matrix )
 
    HYPRE_IJMatrixAssemble(ijmatrix);
 
+   if (hypre_SStructMatrixDirectParCSR(matrix))
+   {
+      hypre_SStructMatrixAssembleParCSR(matrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Build the ParCSR matrix of a HYPRE_PARCSR matrix directly from the S-matrix
+ * box data and the assembled U-matrix.  The column index of every stencil
+ * coefficient is computed from the box manager strides, so no coefficient
+ * passes through the IJ interface.  Duplicate (row, column) pairs, e.g.,
+ * stencil entries that land on the same index or that also appear in the
+ * U-matrix, are summed.  If the sparsity pattern is that of the previous
+ * assembly, the values of the existing ParCSR matrix are overwritten in place;
+ * otherwise, a new ParCSR matrix replaces it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructMatrixAssembleParCSR( hypre_SStructMatrix *matrix )
+{
+   HYPRE_Int               ndim      = hypre_SStructMatrixNDim(matrix);
+   MPI_Comm                comm      = hypre_SStructMatrixComm(matrix);
+   hypre_SStructGraph     *graph     = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid      *grid      = hypre_SStructGraphGrid(graph);
+   HYPRE_Int               nparts    = hypre_SStructMatrixNParts(matrix);
+   HYPRE_IJMatrix          ijmatrix  = hypre_SStructMatrixIJMatrix(matrix);
+   hypre_ParCSRMatrix     *umatrix   = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix);
+   hypre_CSRMatrix        *u_diag    = hypre_ParCSRMatrixDiag(umatrix);
+   hypre_CSRMatrix        *u_offd    = hypre_ParCSRMatrixOffd(umatrix);
+   HYPRE_Int              *u_diag_i  = hypre_CSRMatrixI(u_diag);
+   HYPRE_Int              *u_diag_j  = hypre_CSRMatrixJ(u_diag);
+   HYPRE_Complex          *u_diag_a  = hypre_CSRMatrixData(u_diag);
+   HYPRE_Int              *u_offd_i  = hypre_CSRMatrixI(u_offd);
+   HYPRE_Int              *u_offd_j  = hypre_CSRMatrixJ(u_offd);
+   HYPRE_Complex          *u_offd_a  = hypre_CSRMatrixData(u_offd);
+   HYPRE_BigInt           *u_colmap  = hypre_ParCSRMatrixColMapOffd(umatrix);
+   HYPRE_BigInt            first_row = hypre_ParCSRMatrixFirstRowIndex(umatrix);
+   HYPRE_BigInt            first_col = hypre_ParCSRMatrixFirstColDiag(umatrix);
+   HYPRE_Int               nrows     = hypre_CSRMatrixNumRows(u_diag);
+   HYPRE_Int               ncols     = hypre_CSRMatrixNumCols(u_diag);
+
+   hypre_ParCSRMatrix     *parcsr;
+   HYPRE_Int              *A_diag_i, *A_offd_i;
+   HYPRE_Int              *A_diag_j, *A_offd_j;
+   HYPRE_Complex          *A_diag_a, *A_offd_a;
+   HYPRE_BigInt           *col_map_offd, *A_colmap;
+   HYPRE_Int               nnz_diag, nnz_offd, num_cols_offd, same_pattern;
+
+   hypre_SStructPMatrix   *pmatrix;
+   hypre_SStructPGrid     *pgrid;
+   hypre_SStructStencil   *pstencil;
+   hypre_StructMatrix     *smatrix;
+   hypre_StructGrid       *sgrid;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *data_box;
+   hypre_Box              *row_box  = hypre_BoxCreate(ndim);
+   hypre_Box              *to_box   = hypre_BoxCreate(ndim);
+   hypre_Box              *map_box  = hypre_BoxCreate(ndim);
+   hypre_Box              *int_box  = hypre_BoxCreate(ndim);
+   hypre_BoxManEntry     **row_entries, **col_entries;
+   HYPRE_Int               nrow_entries, ncol_entries;
+   hypre_IndexRef          start, offset;
+   hypre_Index             stride, loop_size, index, rs, cs;
+   HYPRE_BigInt            row_base, col_base;
+   HYPRE_Int              *smap, *vars;
+   hypre_Index            *shape;
+   HYPRE_Complex          *Ap;
+
+   HYPRE_Int               nS, size, nvars, psize, topart;
+   HYPRE_Int              *S_i, *S_row, *S_pos;
+   HYPRE_BigInt           *S_col, *S_j;
+   HYPRE_Complex          *S_val, *S_a;
+   HYPRE_Int              *W_i;
+   HYPRE_BigInt           *W_j, col;
+   HYPRE_Complex          *W_a, val;
+   HYPRE_Int               part, var, b, e, ii, jj, i, j, k, kstart, d;
+
+   /* count the S-matrix coefficients */
+   size = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      pmatrix = hypre_SStructMatrixPMatrix(matrix, part);
+      pgrid   = hypre_SStructPMatrixPGrid(pmatrix);
+      nvars   = hypre_SStructPMatrixNVars(pmatrix);
+      for (var = 0; var < nvars; var++)
+      {
+         psize = hypre_SStructStencilSize(hypre_SStructPMatrixStencil(pmatrix, var));
+         sgrid = hypre_SStructPGridSGrid(pgrid, var);
+         size += psize * hypre_StructGridLocalSize(sgrid);
+      }
+   }
+
+   /*------------------------------------------------------
+    * Collect (row, column, value) triplets from the S-matrix
+    *------------------------------------------------------*/
+
+   S_row = hypre_TAlloc(HYPRE_Int,     size, HYPRE_MEMORY_HOST);
+   S_col = hypre_TAlloc(HYPRE_BigInt,  size, HYPRE_MEMORY_HOST);
+   S_val = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+   nS = 0;
+
+   hypre_SetIndex(stride, 1);
+   for (part = 0; part < nparts; part++)
+   {
+      pmatrix = hypre_SStructMatrixPMatrix(matrix, part);
+      pgrid   = hypre_SStructPMatrixPGrid(pmatrix);
+      nvars   = hypre_SStructPMatrixNVars(pmatrix);
+      for (var = 0; var < nvars; var++)
+      {
+         pstencil = hypre_SStructPMatrixStencil(pmatrix, var);
+         psize    = hypre_SStructStencilSize(pstencil);
+         shape    = hypre_SStructStencilShape(pstencil);
+         vars     = hypre_SStructStencilVars(pstencil);
+         smap     = hypre_SStructPMatrixSMap(pmatrix, var);
+         sgrid    = hypre_SStructPGridSGrid(pgrid, var);
+         boxes    = hypre_StructGridBoxes(sgrid);
+
+         hypre_ForBoxI(b, boxes)
+         {
+            hypre_SStructGridIntersect(grid, part, var, hypre_BoxArrayBox(boxes, b), 0,
+                                       &row_entries, &nrow_entries);
+            for (ii = 0; ii < nrow_entries; ii++)
+            {
+               hypre_SStructBoxManEntryGetStrides(row_entries[ii], rs, HYPRE_PARCSR);
+               hypre_BoxManEntryGetExtents(row_entries[ii],
+                                           hypre_BoxIMin(map_box), hypre_BoxIMax(map_box));
+               hypre_IntersectBoxes(hypre_BoxArrayBox(boxes, b), map_box, row_box);
+
+               for (e = 0; e < psize; e++)
+               {
+                  smatrix  = hypre_SStructPMatrixSMatrix(pmatrix, var, vars[e]);
+                  data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(smatrix), b);
+                  Ap       = hypre_StructMatrixBoxData(smatrix, b, smap[e]);
+
+                  /* the neighbor box manager also holds the periodic images */
+                  offset = shape[e];
+                  hypre_CopyBox(row_box, to_box);
+                  hypre_BoxShiftPos(to_box, offset);
+                  hypre_SStructGridIntersect(grid, part, vars[e], to_box, -1,
+                                             &col_entries, &ncol_entries);
+                  for (jj = 0; jj < ncol_entries; jj++)
+                  {
+                     /* couplings to other parts were moved to the U-matrix */
+                     hypre_SStructBoxManEntryGetPart(col_entries[jj], part, &topart);
+                     if (topart != part)
+                     {
+                        continue;
+                     }
+                     hypre_SStructBoxManEntryGetStrides(col_entries[jj], cs, HYPRE_PARCSR);
+                     hypre_BoxManEntryGetExtents(col_entries[jj],
+                                                 hypre_BoxIMin(map_box), hypre_BoxIMax(map_box));
+                     hypre_IntersectBoxes(to_box, map_box, int_box);
+                     hypre_SStructBoxManEntryGetGlobalRank(col_entries[jj], hypre_BoxIMin(int_box),
+                                                           &col_base, HYPRE_PARCSR);
+                     hypre_BoxShiftNeg(int_box, offset);
+                     hypre_SStructBoxManEntryGetGlobalRank(row_entries[ii], hypre_BoxIMin(int_box),
+                                                           &row_base, HYPRE_PARCSR);
+
+                     if (nS + hypre_BoxVolume(int_box) > size)
+                     {
+                        k = size;
+                        size = 2 * size + hypre_BoxVolume(int_box);
+                        S_row = hypre_TReAlloc_v2(S_row, HYPRE_Int, k, HYPRE_Int, size,
+                                                  HYPRE_MEMORY_HOST);
+                        S_col = hypre_TReAlloc_v2(S_col, HYPRE_BigInt, k, HYPRE_BigInt, size,
+                                                  HYPRE_MEMORY_HOST);
+                        S_val = hypre_TReAlloc_v2(S_val, HYPRE_Complex, k, HYPRE_Complex, size,
+                                                  HYPRE_MEMORY_HOST);
+                     }
+
+                     start = hypre_BoxIMin(int_box);
+                     hypre_BoxGetSize(int_box, loop_size);
+                     hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                               data_box, start, stride, Ai);
+                     {
+                        zypre_BoxLoopGetIndex(index);
+                        S_row[nS] = (HYPRE_Int) (row_base - first_row);
+                        S_col[nS] = col_base;
+                        for (d = 0; d < ndim; d++)
+                        {
+                           S_row[nS] += index[d] * rs[d];
+                           S_col[nS] += index[d] * cs[d];
+                        }
+                        S_val[nS] = Ap[Ai];
+                        nS++;
+                     }
+                     hypre_SerialBoxLoop1End(Ai);
+                  }
+                  hypre_TFree(col_entries, HYPRE_MEMORY_HOST);
+               }
+            }
+            hypre_TFree(row_entries, HYPRE_MEMORY_HOST);
+         }
+      }
+   }
+
+   hypre_BoxDestroy(row_box);
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(map_box);
+   hypre_BoxDestroy(int_box);
+
+   /* stable counting sort by row, keeping the stencil order within a row */
+   S_i   = hypre_CTAlloc(HYPRE_Int,     nrows + 1, HYPRE_MEMORY_HOST);
+   S_pos = hypre_TAlloc(HYPRE_Int,     nrows,     HYPRE_MEMORY_HOST);
+   S_j   = hypre_TAlloc(HYPRE_BigInt,  nS,        HYPRE_MEMORY_HOST);
+   S_a   = hypre_TAlloc(HYPRE_Complex, nS,        HYPRE_MEMORY_HOST);
+   for (k = 0; k < nS; k++)
+   {
+      S_i[S_row[k] + 1]++;
+   }
+   for (i = 0; i < nrows; i++)
+   {
+      S_i[i + 1] += S_i[i];
+      S_pos[i] = S_i[i];
+   }
+   for (k = 0; k < nS; k++)
+   {
+      j = S_pos[S_row[k]]++;
+      S_j[j] = S_col[k];
+      S_a[j] = S_val[k];
+   }
+   hypre_TFree(S_row, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_col, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_val, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_pos, HYPRE_MEMORY_HOST);
+
+   /*------------------------------------------------------
+    * Merge the S- and U-matrix rows, diagonal first
+    *------------------------------------------------------*/
+
+   size = nS + u_diag_i[nrows] + u_offd_i[nrows];
+   W_i  = hypre_TAlloc(HYPRE_Int,     nrows + 1, HYPRE_MEMORY_HOST);
+   W_j  = hypre_TAlloc(HYPRE_BigInt,  size,      HYPRE_MEMORY_HOST);
+   W_a  = hypre_TAlloc(HYPRE_Complex, size,      HYPRE_MEMORY_HOST);
+
+   nnz_diag = 0;
+   nnz_offd = 0;
+   k = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      kstart = k;
+      W_i[i] = kstart;
+      size = (S_i[i + 1] - S_i[i]) + (u_diag_i[i + 1] - u_diag_i[i]) +
+             (u_offd_i[i + 1] - u_offd_i[i]);
+      for (jj = 0; jj < size; jj++)
+      {
+         ii = S_i[i] + jj;
+         if (ii < S_i[i + 1])
+         {
+            col = S_j[ii];
+            val = S_a[ii];
+         }
+         else
+         {
+            ii += u_diag_i[i] - S_i[i + 1];
+            if (ii < u_diag_i[i + 1])
+            {
+               col = first_col + (HYPRE_BigInt) u_diag_j[ii];
+               val = u_diag_a[ii];
+            }
+            else
+            {
+               ii += u_offd_i[i] - u_diag_i[i + 1];
+               col = u_colmap[u_offd_j[ii]];
+               val = u_offd_a[ii];
+            }
+         }
+         for (j = kstart; j < k; j++)
+         {
+            if (W_j[j] == col)
+            {
+               break;
+            }
+         }
+         if (j < k)
+         {
+            W_a[j] += val;
+         }
+         else
+         {
+            W_j[k] = col;
+            W_a[k] = val;
+            k++;
+         }
+      }
+
+      for (j = kstart + 1; j < k; j++)
+      {
+         if (W_j[j] == first_row + i)
+         {
+            col = W_j[j];     W_j[j] = W_j[kstart];     W_j[kstart] = col;
+            val = W_a[j];     W_a[j] = W_a[kstart];     W_a[kstart] = val;
+            break;
+         }
+      }
+      for (j = kstart; j < k; j++)
+      {
+         if (W_j[j] >= first_col && W_j[j] < first_col + ncols)
+         {
+            nnz_diag++;
+         }
+         else
+         {
+            nnz_offd++;
+         }
+      }
+   }
+   W_i[nrows] = k;
+   hypre_TFree(S_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_a, HYPRE_MEMORY_HOST);
+
+   /* off-processor column map */
+   col_map_offd = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+   num_cols_offd = 0;
+   for (k = 0; k < W_i[nrows]; k++)
+   {
+      if (W_j[k] < first_col || W_j[k] >= first_col + ncols)
+      {
+         col_map_offd[num_cols_offd++] = W_j[k];
+      }
+   }
+   if (num_cols_offd > 0)
+   {
+      hypre_BigQsort0(col_map_offd, 0, num_cols_offd - 1);
+      for (k = 1, j = 1; k < num_cols_offd; k++)
+      {
+         if (col_map_offd[k] != col_map_offd[j - 1])
+         {
+            col_map_offd[j++] = col_map_offd[k];
+         }
+      }
+      num_cols_offd = j;
+   }
+
+   /*------------------------------------------------------
+    * Reuse the ParCSR matrix of the previous assembly if it has the same
+    * sparsity pattern, so that references to it stay valid
+    *------------------------------------------------------*/
+
+   parcsr = hypre_SStructMatrixParCSRMatrix(matrix);
+   same_pattern = 0;
+   if (parcsr && parcsr != umatrix &&
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(parcsr)) == nnz_diag &&
+       hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(parcsr)) == nnz_offd &&
+       hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(parcsr)) == num_cols_offd)
+   {
+      A_diag_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(parcsr));
+      A_diag_j = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(parcsr));
+      A_offd_i = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(parcsr));
+      A_offd_j = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(parcsr));
+      A_colmap = hypre_ParCSRMatrixColMapOffd(parcsr);
+
+      same_pattern = 1;
+      for (k = 0; k < num_cols_offd; k++)
+      {
+         if (A_colmap[k] != col_map_offd[k])
+         {
+            same_pattern = 0;
+            break;
+         }
+      }
+
+      ii = 0;
+      jj = 0;
+      for (i = 0; (i < nrows) && same_pattern; i++)
+      {
+         if (A_diag_i[i] != ii || A_offd_i[i] != jj)
+         {
+            same_pattern = 0;
+            break;
+         }
+         for (k = W_i[i]; k < W_i[i + 1]; k++)
+         {
+            if (W_j[k] >= first_col && W_j[k] < first_col + ncols)
+            {
+               if (first_col + (HYPRE_BigInt) A_diag_j[ii++] != W_j[k])
+               {
+                  same_pattern = 0;
+                  break;
+               }
+            }
+            else
+            {
+               if (A_colmap[A_offd_j[jj++]] != W_j[k])
+               {
+                  same_pattern = 0;
+                  break;
+               }
+            }
+         }
+      }
+   }
+
+   if (!same_pattern)
+   {
+      parcsr = hypre_ParCSRMatrixCreate(comm,
+                                        hypre_ParCSRMatrixGlobalNumRows(umatrix),
+                                        hypre_ParCSRMatrixGlobalNumCols(umatrix),
+                                        hypre_ParCSRMatrixRowStarts(umatrix),
+                                        hypre_ParCSRMatrixColStarts(umatrix),
+                                        num_cols_offd, nnz_diag, nnz_offd);
+      hypre_ParCSRMatrixInitialize_v2(parcsr, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(parcsr), col_map_offd, HYPRE_BigInt,
+                    num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(col_map_offd, HYPRE_MEMORY_HOST);
+
+   A_diag_i = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(parcsr));
+   A_diag_j = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(parcsr));
+   A_diag_a = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(parcsr));
+   A_offd_i = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(parcsr));
+   A_offd_j = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(parcsr));
+   A_offd_a = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(parcsr));
+   A_colmap = hypre_ParCSRMatrixColMapOffd(parcsr);
+
+   /* for an unchanged pattern, this only overwrites the values */
+   nnz_diag = 0;
+   nnz_offd = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      A_diag_i[i] = nnz_diag;
+      A_offd_i[i] = nnz_offd;
+      for (k = W_i[i]; k < W_i[i + 1]; k++)
+      {
+         if (W_j[k] >= first_col && W_j[k] < first_col + ncols)
+         {
+            A_diag_j[nnz_diag] = (HYPRE_Int) (W_j[k] - first_col);
+            A_diag_a[nnz_diag] = W_a[k];
+            nnz_diag++;
+         }
+         else
+         {
+            A_offd_j[nnz_offd] = hypre_BigBinarySearch(A_colmap, W_j[k], num_cols_offd);
+            A_offd_a[nnz_offd] = W_a[k];
+            nnz_offd++;
+         }
+      }
+   }
+   A_diag_i[nrows] = nnz_diag;
+   A_offd_i[nrows] = nnz_offd;
+   hypre_TFree(W_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(W_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(W_a, HYPRE_MEMORY_HOST);
+
+   if (same_pattern)
+   {
+      hypre_CSRMatrixDestroySellData(hypre_ParCSRMatrixDiag(parcsr));
+      hypre_CSRMatrixDestroySellData(hypre_ParCSRMatrixOffd(parcsr));
+   }
+   else
+   {
+      hypre_ParCSRMatrixSetNumNonzeros(parcsr);
+      hypre_ParCSRMatrixDNumNonzeros(parcsr) = (HYPRE_Real) hypre_ParCSRMatrixNumNonzeros(parcsr);
+      hypre_MatvecCommPkgCreate(parcsr);
+
+      /* replace the ParCSR matrix from the previous assembly, if any */
+      if (hypre_SStructMatrixParCSRMatrix(matrix) != umatrix)
+      {
+         hypre_ParCSRMatrixDestroy(hypre_SStructMatrixParCSRMatrix(matrix));
+      }
+      hypre_SStructMatrixParCSRMatrix(matrix) = parcsr;
+   }
+
    return hypre_error_flag;
 }
 
@@ -14,6 +14,17 @@
 #ifndef hypre_SSTRUCT_MATRIX_HEADER
 #define hypre_SSTRUCT_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructCoef: user coefficient function for a matrix-free entry
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_SStructCoefFcn    fcn;
+   void                   *data;
+
+} hypre_SStructCoef;
+
 /*--------------------------------------------------------------------------
  * hypre_SStructMatrix:
  *--------------------------------------------------------------------------*/
@@ -37,6 +48,10 @@ typedef struct
 
    HYPRE_Int               accumulated;  /* AddTo values accumulated? */
 
+   /* matrix-free parts: no coefficient data is stored in the smatrices */
+   HYPRE_Int               matrix_free;
+   hypre_SStructCoef     **coefs;        /* nvar x (split) stencil size */
+
    HYPRE_Int               ref_count;
 
 } hypre_SStructPMatrix;
@@ -53,10 +68,18 @@ typedef struct hypre_SStructMatrix_struct
    hypre_SStructPMatrix  **pmatrices;
    HYPRE_Int            ***symmetric;    /* Stencil entries symmetric?
                                           * (nparts x nvar x nvar array) */
+   hypre_SStructCoef    ***coefs;        /* Coefficient functions, NULL for
+                                          * stored parts (nparts x nvar x
+                                          * graph stencil size array) */
 
    /* U-matrix info */
    HYPRE_IJMatrix          ijmatrix;
-   hypre_ParCSRMatrix     *parcsrmatrix;
+   hypre_ParCSRMatrix     *parcsrmatrix; /* For HYPRE_PARCSR matrices built
+                                          * directly from the S-matrix, this
+                                          * is S + U and is not the IJ
+                                          * matrix object */
+   HYPRE_Int               direct_parcsr; /* Convert S-matrix to ParCSR
+                                           * directly (HYPRE_PARCSR only)? */
 
    /* temporary storage for SetValues routines */
    HYPRE_Int               entries_size;
@@ -94,8 +117,10 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixPMatrices(mat)            ((mat) -> pmatrices)
 #define hypre_SStructMatrixPMatrix(mat, part)        ((mat) -> pmatrices[part])
 #define hypre_SStructMatrixSymmetric(mat)            ((mat) -> symmetric)
+#define hypre_SStructMatrixCoefs(mat)                ((mat) -> coefs)
 #define hypre_SStructMatrixIJMatrix(mat)             ((mat) -> ijmatrix)
 #define hypre_SStructMatrixParCSRMatrix(mat)         ((mat) -> parcsrmatrix)
+#define hypre_SStructMatrixDirectParCSR(mat)         ((mat) -> direct_parcsr)
 #define hypre_SStructMatrixEntriesSize(mat)          ((mat) -> entries_size)
 #define hypre_SStructMatrixSEntries(mat)             ((mat) -> Sentries)
 #define hypre_SStructMatrixUEntries(mat)             ((mat) -> Uentries)
@@ -134,6 +159,9 @@ hypre_SStructPGridNDim(hypre_SStructPMatrixPGrid(pmat))
 #define hypre_SStructPMatrixSEntriesSize(pmat)      ((pmat) -> sentries_size)
 #define hypre_SStructPMatrixSEntries(pmat)          ((pmat) -> sentries)
 #define hypre_SStructPMatrixAccumulated(pmat)       ((pmat) -> accumulated)
+#define hypre_SStructPMatrixMatrixFree(pmat)        ((pmat) -> matrix_free)
+#define hypre_SStructPMatrixCoefs(pmat)             ((pmat) -> coefs)
+#define hypre_SStructPMatrixCoef(pmat, var, entry)  (&((pmat) -> coefs[var][entry]))
 #define hypre_SStructPMatrixRefCount(pmat)          ((pmat) -> ref_count)
 
 #endif
@@ -25,6 +25,7 @@ typedef struct
 {
    HYPRE_Int     nvars;
    void ***smatvec_data;
+   hypre_ComputePkg ***compute_pkgs;  /* matrix-free parts only */
 
 } hypre_SStructPMatvecData;
 
@@ -55,21 +56,45 @@ hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
    hypre_SStructPMatvecData   *pmatvec_data = (hypre_SStructPMatvecData   *)pmatvec_vdata;
    HYPRE_Int                   nvars;
    void                     ***smatvec_data;
+   hypre_ComputePkg         ***compute_pkgs = NULL;
+   hypre_ComputeInfo          *compute_info;
    hypre_StructMatrix         *sA;
    hypre_StructVector         *sx;
+   hypre_StructGrid           *sgrid;
    HYPRE_Int                   vi, vj;
 
    nvars = hypre_SStructPMatrixNVars(pA);
    smatvec_data = hypre_TAlloc(void **,  nvars, HYPRE_MEMORY_HOST);
+   if (hypre_SStructPMatrixMatrixFree(pA))
+   {
+      compute_pkgs = hypre_TAlloc(hypre_ComputePkg **, nvars, HYPRE_MEMORY_HOST);
+   }
    for (vi = 0; vi < nvars; vi++)
    {
       smatvec_data[vi] = hypre_TAlloc(void *,  nvars, HYPRE_MEMORY_HOST);
+      if (compute_pkgs)
+      {
+         compute_pkgs[vi] = hypre_TAlloc(hypre_ComputePkg *, nvars, HYPRE_MEMORY_HOST);
+      }
       for (vj = 0; vj < nvars; vj++)
       {
          sA = hypre_SStructPMatrixSMatrix(pA, vi, vj);
          sx = hypre_SStructPVectorSVector(px, vj);
          smatvec_data[vi][vj] = NULL;
-         if (sA != NULL)
+         if (compute_pkgs)
+         {
+            /* no stored coefficients: only the ghost exchange is needed */
+            compute_pkgs[vi][vj] = NULL;
+            if (sA != NULL)
+            {
+               sgrid = hypre_StructMatrixGrid(sA);
+               hypre_CreateComputeInfo(sgrid, hypre_StructMatrixStencil(sA),
+                                       &compute_info);
+               hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(sx),
+                                      1, sgrid, &compute_pkgs[vi][vj]);
+            }
+         }
+         else if (sA != NULL)
          {
             smatvec_data[vi][vj] = hypre_StructMatvecCreate();
             hypre_StructMatvecSetup(smatvec_data[vi][vj], sA, sx);
@@ -78,6 +103,140 @@ hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
    }
    (pmatvec_data -> nvars)        = nvars;
    (pmatvec_data -> smatvec_data) = smatvec_data;
+   (pmatvec_data -> compute_pkgs) = compute_pkgs;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Matrix-free block product y += alpha * A(vi,vj) * x, where the stencil
+ * coefficients of block (vi,vj) are evaluated with the user's coefficient
+ * functions.  The exchange of x ghost values is overlapped with the
+ * computation on the independent boxes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecComputeCoefs( hypre_ComputePkg     *compute_pkg,
+                                  HYPRE_Complex         alpha,
+                                  hypre_SStructPMatrix *pA,
+                                  HYPRE_Int             vi,
+                                  HYPRE_Int             vj,
+                                  hypre_StructVector   *x,
+                                  hypre_StructVector   *y )
+{
+   HYPRE_Int             ndim    = hypre_StructVectorNDim(x);
+   hypre_SStructStencil *stencil = hypre_SStructPMatrixStencil(pA, vi);
+   hypre_Index          *shape   = hypre_SStructStencilShape(stencil);
+   HYPRE_Int            *vars    = hypre_SStructStencilVars(stencil);
+   HYPRE_Int             size    = hypre_SStructStencilSize(stencil);
+
+   hypre_SStructCoef   **coefs;
+   HYPRE_Int            *xoffs;
+   HYPRE_Int             ncoefs;
+   HYPRE_Int             num_failed = 0;
+
+   hypre_CommHandle     *comm_handle;
+   hypre_BoxArrayArray  *compute_box_aa;
+   hypre_BoxArray       *compute_box_a;
+   hypre_Box            *compute_box;
+   hypre_Box            *x_dbox, *y_dbox;
+   hypre_IndexRef        start;
+   hypre_Index           ustride, loop_size;
+   HYPRE_Complex        *xp, *yp;
+   HYPRE_Int             compute_i, i, j, e;
+
+   coefs = hypre_TAlloc(hypre_SStructCoef *, size, HYPRE_MEMORY_HOST);
+   xoffs = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+   hypre_SetIndex(ustride, 1);
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      switch (compute_i)
+      {
+         case 0:
+         {
+            xp = hypre_StructVectorData(x);
+            hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+            compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+         }
+         break;
+
+         case 1:
+         {
+            hypre_FinalizeIndtComputations(comm_handle);
+            compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+         }
+         break;
+      }
+
+      hypre_ForBoxArrayI(i, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         y_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+         xp = hypre_StructVectorBoxData(x, i);
+         yp = hypre_StructVectorBoxData(y, i);
+
+         ncoefs = 0;
+         for (e = 0; e < size; e++)
+         {
+            if (vars[e] == vj)
+            {
+               coefs[ncoefs] = hypre_SStructPMatrixCoef(pA, vi, e);
+               xoffs[ncoefs] = hypre_BoxOffsetDistance(x_dbox, shape[e]);
+               ncoefs++;
+            }
+         }
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+            start = hypre_BoxIMin(compute_box);
+            hypre_BoxGetSize(compute_box, loop_size);
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+#define HYPRE_BOX_REDUCTION reduction(+:num_failed)
+
+            /* user functions live on the host */
+            hypre_BoxLoop2ReductionBeginHost(ndim, loop_size,
+                                             x_dbox, start, ustride, xi,
+                                             y_dbox, start, ustride, yi, num_failed);
+            {
+               hypre_Index   index;
+               HYPRE_Complex value, sum = 0.0;
+               HYPRE_Int     c;
+
+               hypre_BoxLoopGetIndexHost(index);
+               hypre_AddIndexes(index, start, ndim, index);
+               for (c = 0; c < ncoefs; c++)
+               {
+                  if ((coefs[c] -> fcn)(coefs[c] -> data, index, &value))
+                  {
+                     num_failed++;
+                     value = 0.0;
+                  }
+                  sum += value * xp[xi + xoffs[c]];
+               }
+               yp[yi] += alpha * sum;
+            }
+            hypre_BoxLoop2ReductionEndHost(xi, yi, num_failed);
+
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+         }
+      }
+   }
+
+   hypre_TFree(coefs, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoffs, HYPRE_MEMORY_HOST);
+
+   if (num_failed)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Coefficient function returned an error!");
+   }
 
    return hypre_error_flag;
 }
@@ -97,6 +256,7 @@ hypre_SStructPMatvecCompute( void                 *pmatvec_vdata,
    hypre_SStructPMatvecData   *pmatvec_data = (hypre_SStructPMatvecData   *)pmatvec_vdata;
    HYPRE_Int                   nvars        = (pmatvec_data -> nvars);
    void                     ***smatvec_data = (pmatvec_data -> smatvec_data);
+   hypre_ComputePkg         ***compute_pkgs = (pmatvec_data -> compute_pkgs);
 
    void                       *sdata;
    hypre_StructMatrix         *sA;
@@ -109,6 +269,25 @@ hypre_SStructPMatvecCompute( void                 *pmatvec_vdata,
    {
       sy = hypre_SStructPVectorSVector(py, vi);
 
+      /* matrix-free part */
+      if (compute_pkgs)
+      {
+         hypre_StructScale(beta, sy);
+         if (alpha != 0.0)
+         {
+            for (vj = 0; vj < nvars; vj++)
+            {
+               if (compute_pkgs[vi][vj] != NULL)
+               {
+                  sx = hypre_SStructPVectorSVector(px, vj);
+                  hypre_SStructPMatvecComputeCoefs(compute_pkgs[vi][vj], alpha,
+                                                   pA, vi, vj, sx, sy);
+               }
+            }
+         }
+         continue;
+      }
+
       /* diagonal block computation */
       if (smatvec_data[vi][vi] != NULL)
       {
@@ -148,12 +327,14 @@ hypre_SStructPMatvecDestroy( void *pmatvec_vdata )
    hypre_SStructPMatvecData   *pmatvec_data = (hypre_SStructPMatvecData   *)pmatvec_vdata;
    HYPRE_Int                   nvars;
    void                     ***smatvec_data;
+   hypre_ComputePkg         ***compute_pkgs;
    HYPRE_Int                   vi, vj;
 
    if (pmatvec_data)
    {
       nvars        = (pmatvec_data -> nvars);
       smatvec_data = (pmatvec_data -> smatvec_data);
+      compute_pkgs = (pmatvec_data -> compute_pkgs);
       for (vi = 0; vi < nvars; vi++)
       {
          for (vj = 0; vj < nvars; vj++)
@@ -162,10 +343,19 @@ hypre_SStructPMatvecDestroy( void *pmatvec_vdata )
             {
                hypre_StructMatvecDestroy(smatvec_data[vi][vj]);
             }
+            if (compute_pkgs)
+            {
+               hypre_ComputePkgDestroy(compute_pkgs[vi][vj]);
+            }
          }
          hypre_TFree(smatvec_data[vi], HYPRE_MEMORY_HOST);
+         if (compute_pkgs)
+         {
+            hypre_TFree(compute_pkgs[vi], HYPRE_MEMORY_HOST);
+         }
       }
       hypre_TFree(smatvec_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(compute_pkgs, HYPRE_MEMORY_HOST);
       hypre_TFree(pmatvec_data, HYPRE_MEMORY_HOST);
    }
 
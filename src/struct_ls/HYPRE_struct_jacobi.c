@@ -126,6 +126,16 @@ HYPRE_StructJacobiSetNonZeroGuess( HYPRE_StructSolver solver )
    return ( hypre_JacobiSetZeroGuess( (void *) solver, 0 ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructJacobiSetTemporalBlock( HYPRE_StructSolver solver,
+                                    HYPRE_Int          temporal_block )
+{
+   return ( hypre_JacobiSetTemporalBlock( (void *) solver, temporal_block ) );
+}
+
 
 /* NOT YET IMPLEMENTED */
 
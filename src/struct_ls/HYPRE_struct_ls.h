@@ -137,6 +137,15 @@ HYPRE_Int HYPRE_StructJacobiGetZeroGuess(HYPRE_StructSolver solver,
  **/
 HYPRE_Int HYPRE_StructJacobiSetNonZeroGuess(HYPRE_StructSolver solver);
 
+/**
+ * (Optional) Do up to \e temporal_block sweeps per ghost exchange, see
+ * \e HYPRE_StructPFMGSetTemporalBlock.  This is only used when the
+ * convergence tolerance is zero (no convergence testing), e.g., when Jacobi is
+ * used as a preconditioner.  Must be called before setup.
+ **/
+HYPRE_Int HYPRE_StructJacobiSetTemporalBlock(HYPRE_StructSolver solver,
+                                             HYPRE_Int          temporal_block);
+
 /**
  * Return the number of iterations taken.
  **/
@@ -257,6 +266,9 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Line Jacobi along the coarsening direction of each level, using
+ *          batched tridiagonal solves (Jacobi is used on levels with constant
+ *          coefficients or without a full 3-point stencil along the lines)
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -320,6 +332,42 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Do up to \e temporal_block relaxation sweeps per ghost exchange
+ * (temporal blocking).  The relaxation then works on copies of the level
+ * operators and vectors with \e temporal_block wider ghost layers (twice that
+ * for Red/Black Gauss-Seidel), updates the overlapping ghost points
+ * redundantly, and runs all sweeps on one cache-sized tile of a box before
+ * moving on to the next.  This reduces the number of messages and the memory
+ * traffic per V-cycle when several sweeps are done per level, at the cost of an
+ * extra copy of each level matrix.  The iterates are the same as without
+ * temporal blocking.  Only variable coefficient matrices without symmetric
+ * storage on the host are supported; other levels relax as usual.  Values
+ * less than 2 turn temporal blocking off (default).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetTemporalBlock(HYPRE_StructSolver solver,
+                                           HYPRE_Int          temporal_block);
+
+HYPRE_Int HYPRE_StructPFMGGetTemporalBlock(HYPRE_StructSolver solver,
+                                           HYPRE_Int *temporal_block);
+
+/**
+ * (Optional) Store the coarse grid operators in mostly-constant form.  For
+ * each box, one stencil row is kept for the interior, and the rows that differ
+ * from it (typically next to the boundary) are kept in a small table.  For
+ * constant coefficient problems with variable coefficients near the boundary,
+ * this reduces the coarse operator memory by an order of magnitude.  A level
+ * is only compressed if its memory is at least halved, so fully variable
+ * coefficient problems are not affected.  Results agree with the regular
+ * storage up to round-off.  Temporal blocking is not used on the compressed
+ * levels.  Only supported on the host.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetMostlyConstant(HYPRE_StructSolver solver,
+                                            HYPRE_Int          mostly_constant);
+
+HYPRE_Int HYPRE_StructPFMGGetMostlyConstant(HYPRE_StructSolver solver,
+                                            HYPRE_Int *mostly_constant);
+
 /*
  * RE-VISIT
  **/
@@ -476,6 +524,18 @@ HYPRE_Int HYPRE_StructSMGSetNumPostRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructSMGGetNumPostRelax(HYPRE_StructSolver solver,
                                          HYPRE_Int *num_post_relax);
 
+/**
+ * (Optional) Solve the line systems in the relaxation with batched
+ * tridiagonal (Thomas) solves instead of cyclic reduction.  The batched
+ * solves are used where every line lies entirely on one process and is not
+ * periodic; otherwise, cyclic reduction is used.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructSMGSetBatchedLineSolve(HYPRE_StructSolver solver,
+                                             HYPRE_Int          batched);
+
+HYPRE_Int HYPRE_StructSMGGetBatchedLineSolve(HYPRE_StructSolver solver,
+                                             HYPRE_Int *batched);
+
 /**
  * (Optional) Set the amount of logging to do.
  **/
@@ -250,6 +250,40 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return ( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetTemporalBlock( HYPRE_StructSolver solver,
+                                  HYPRE_Int          temporal_block )
+{
+   return ( hypre_PFMGSetTemporalBlock( (void *) solver, temporal_block) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetTemporalBlock( HYPRE_StructSolver solver,
+                                  HYPRE_Int        * temporal_block )
+{
+   return ( hypre_PFMGGetTemporalBlock( (void *) solver, temporal_block) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetMostlyConstant( HYPRE_StructSolver solver,
+                                   HYPRE_Int          mostly_constant )
+{
+   return ( hypre_PFMGSetMostlyConstant( (void *) solver, mostly_constant) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetMostlyConstant( HYPRE_StructSolver solver,
+                                   HYPRE_Int        * mostly_constant )
+{
+   return ( hypre_PFMGGetMostlyConstant( (void *) solver, mostly_constant) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -185,6 +185,23 @@ HYPRE_StructSMGGetNumPostRelax( HYPRE_StructSolver solver,
    return ( hypre_SMGGetNumPostRelax( (void *) solver, num_post_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSMGSetBatchedLineSolve( HYPRE_StructSolver solver,
+                                    HYPRE_Int          batched )
+{
+   return ( hypre_SMGSetBatchedLineSolve( (void *) solver, batched) );
+}
+
+HYPRE_Int
+HYPRE_StructSMGGetBatchedLineSolve( HYPRE_StructSolver solver,
+                                    HYPRE_Int        * batched )
+{
+   return ( hypre_SMGGetBatchedLineSolve( (void *) solver, batched) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
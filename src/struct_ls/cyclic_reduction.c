@@ -19,6 +19,9 @@
  * Macros
  *--------------------------------------------------------------------------*/
 
+/* number of lines eliminated together in a batched line solve */
+#define HYPRE_CYCRED_BATCH_SIZE 64
+
 #define hypre_CycRedSetCIndex(base_index, base_stride, level, cdir, cindex) \
    {                                                                    \
       if (level > 0)                                                    \
@@ -78,6 +81,12 @@ typedef struct
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
+
+   /* batched tridiagonal (Thomas) solves of whole lines */
+   HYPRE_Int             batched;      /* requested by the user */
+   HYPRE_Int             use_batched;  /* possible for this grid */
+   HYPRE_Real           *batch_cp;     /* modified upper coefficients */
+   HYPRE_Int            *batch_lines;  /* line starts in A, x, and b */
 } hypre_CyclicReductionData;
 
 /*--------------------------------------------------------------------------
@@ -96,6 +105,8 @@ hypre_CyclicReductionCreate( MPI_Comm  comm )
    (cyc_red_data -> cdir) = 0;
    (cyc_red_data -> time_index)  = hypre_InitializeTiming("CyclicReduction");
    (cyc_red_data -> max_levels)  = -1;
+   (cyc_red_data -> batched)     = 0;
+   (cyc_red_data -> use_batched) = 0;
 
    /* set defaults */
    hypre_SetIndex3((cyc_red_data -> base_index), 0, 0, 0);
@@ -460,6 +471,95 @@ hypre_CycRedSetupCoarseOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSetupBatched
+ *
+ * Decide whether the lines can be solved directly with batched Thomas
+ * solves instead of cyclic reduction.  This requires every (non-empty) line
+ * to be complete on one process, i.e., every local box must span the global
+ * bounding box in the cdir direction, and the lines must not be periodic.
+ * The decision is made collectively so that all processes take the same
+ * path.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedSetupBatched( hypre_CyclicReductionData *cyc_red_data,
+                          hypre_StructMatrix        *A,
+                          hypre_StructVector        *x )
+{
+   MPI_Comm             comm        = (cyc_red_data -> comm);
+   HYPRE_Int            cdir        = (cyc_red_data -> cdir);
+   hypre_IndexRef       base_index  = (cyc_red_data -> base_index);
+   hypre_IndexRef       base_stride = (cyc_red_data -> base_stride);
+   hypre_StructGrid    *grid        = hypre_StructMatrixGrid(A);
+   HYPRE_Int            ndim        = hypre_StructGridNDim(grid);
+   hypre_Box           *bbox        = hypre_StructGridBoundingBox(grid);
+
+   hypre_BoxArray      *base_points;
+   hypre_Box           *box;
+   hypre_Index          loop_size;
+   HYPRE_Int            eligible, global_eligible;
+   HYPRE_Int            max_volume, max_nlines, volume, nlines;
+   HYPRE_Int            flop_divisor;
+   HYPRE_Int            i;
+
+   eligible = (hypre_IndexD(base_stride, cdir) == 1) &&
+              (hypre_IndexD(hypre_StructGridPeriodic(grid), cdir) == 0) &&
+              (hypre_StructMatrixConstantCoefficient(A) == 0) &&
+              (hypre_GetActualMemLocation(hypre_StructMatrixMemoryLocation(A)) ==
+               hypre_MEMORY_HOST);
+
+   base_points = hypre_BoxArrayDuplicate(hypre_StructGridBoxes(grid));
+   hypre_ProjectBoxArray(base_points, base_index, base_stride);
+
+   max_volume = 0;
+   max_nlines = 0;
+   hypre_ForBoxI(i, base_points)
+   {
+      box = hypre_BoxArrayBox(base_points, i);
+      hypre_BoxGetStrideSize(box, base_stride, loop_size);
+      hypre_BoxGetStrideVolume(box, base_stride, &volume);
+      if (volume > 0)
+      {
+         if ( (hypre_BoxIMinD(box, cdir) != hypre_BoxIMinD(bbox, cdir)) ||
+              (hypre_BoxIMaxD(box, cdir) != hypre_BoxIMaxD(bbox, cdir)) )
+         {
+            eligible = 0;
+         }
+         nlines = volume / hypre_IndexD(loop_size, cdir);
+         max_volume = hypre_max(max_volume, volume);
+         max_nlines = hypre_max(max_nlines, nlines);
+      }
+   }
+
+   hypre_MPI_Allreduce(&eligible, &global_eligible, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+
+   if (!global_eligible)
+   {
+      hypre_BoxArrayDestroy(base_points);
+      (cyc_red_data -> use_batched) = 0;
+
+      return hypre_error_flag;
+   }
+
+   (cyc_red_data -> ndim)        = ndim;
+   (cyc_red_data -> num_levels)  = 0;
+   (cyc_red_data -> base_points) = base_points;
+   (cyc_red_data -> batch_cp)    = hypre_TAlloc(HYPRE_Real, max_volume, HYPRE_MEMORY_HOST);
+   (cyc_red_data -> batch_lines) = hypre_TAlloc(HYPRE_Int, 3 * max_nlines, HYPRE_MEMORY_HOST);
+   (cyc_red_data -> use_batched) = 1;
+
+   /* forward elimination (6 flops) plus back substitution (2 flops) */
+   flop_divisor = (hypre_IndexX(base_stride) *
+                   hypre_IndexY(base_stride) *
+                   hypre_IndexZ(base_stride)  );
+   (cyc_red_data -> solve_flops) =
+      8 * hypre_StructVectorGlobalSize(x) / (HYPRE_BigInt)flop_divisor;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionSetup
  *--------------------------------------------------------------------------*/
@@ -506,6 +606,19 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    HYPRE_MemoryLocation    memory_location = hypre_StructMatrixMemoryLocation(A);
 
+   /*-----------------------------------------------------
+    * Use batched line solves when possible
+    *-----------------------------------------------------*/
+
+   if (cyc_red_data -> batched)
+   {
+      hypre_CycRedSetupBatched(cyc_red_data, A, x);
+      if (cyc_red_data -> use_batched)
+      {
+         return hypre_error_flag;
+      }
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -751,6 +864,165 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSolveBatched
+ *
+ * Solve all lines of each box with the Thomas algorithm.  The lines of a box
+ * are processed in batches, and within a batch the elimination steps sweep
+ * across the lines so that the inner loop is independent and vectorizable.
+ * As in the cyclic reduction solve, x values in the ghost zones at the ends
+ * of the lines are treated as known boundary data.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedSolveBatched( hypre_CyclicReductionData *cyc_red_data,
+                          hypre_StructMatrix        *A,
+                          hypre_StructVector        *b,
+                          hypre_StructVector        *x )
+{
+   HYPRE_Int             ndim        = (cyc_red_data -> ndim);
+   HYPRE_Int             cdir        = (cyc_red_data -> cdir);
+   hypre_IndexRef        base_stride = (cyc_red_data -> base_stride);
+   hypre_BoxArray       *base_points = (cyc_red_data -> base_points);
+   HYPRE_Real           *cp          = (cyc_red_data -> batch_cp);
+   HYPRE_Int            *lines       = (cyc_red_data -> batch_lines);
+
+   hypre_Box            *compute_box;
+   hypre_Box            *A_dbox;
+   hypre_Box            *x_dbox;
+   hypre_Box            *b_dbox;
+
+   HYPRE_Real           *Ap, *Awp, *Aep;
+   HYPRE_Real           *xp;
+   HYPRE_Real           *bp;
+
+   hypre_Index           index;
+   hypre_Index           loop_size;
+   hypre_Index           start;
+
+   HYPRE_Int             Astride, xstride, bstride;
+   HYPRE_Int             n, nlines, nbatches, batch;
+   HYPRE_Int             fi, j;
+
+   hypre_BeginTiming(cyc_red_data -> time_index);
+
+   hypre_ForBoxI(fi, base_points)
+   {
+      compute_box = hypre_BoxArrayBox(base_points, fi);
+
+      hypre_BoxGetStrideVolume(compute_box, base_stride, &nlines);
+      if (nlines == 0)
+      {
+         continue;
+      }
+      hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+      n = hypre_IndexD(loop_size, cdir);
+      nlines /= n;
+
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), fi);
+
+      hypre_SetIndex3(index, 0, 0, 0);
+      Ap = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_IndexD(index, cdir) = -1;
+      Awp = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_IndexD(index, cdir) = 1;
+      Aep = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+      Astride = hypre_BoxOffsetDistance(A_dbox, index);
+      xstride = hypre_BoxOffsetDistance(x_dbox, index);
+      bstride = hypre_BoxOffsetDistance(b_dbox, index);
+
+      xp = hypre_StructVectorBoxData(x, fi);
+      bp = hypre_StructVectorBoxData(b, fi);
+
+      /* collect the first point of each line */
+      hypre_CopyIndex(hypre_BoxIMin(compute_box), start);
+      hypre_IndexD(loop_size, cdir) = 1;
+
+      j = 0;
+      hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                A_dbox, start, base_stride, Ai,
+                                x_dbox, start, base_stride, xi);
+      {
+         lines[3 * j]     = Ai;
+         lines[3 * j + 1] = xi;
+         j++;
+      }
+      hypre_SerialBoxLoop2End(Ai, xi);
+
+      j = 0;
+      hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                b_dbox, start, base_stride, bi);
+      {
+         lines[3 * j + 2] = bi;
+         j++;
+      }
+      hypre_SerialBoxLoop1End(bi);
+
+      nbatches = (nlines + HYPRE_CYCRED_BATCH_SIZE - 1) / HYPRE_CYCRED_BATCH_SIZE;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(batch) HYPRE_SMP_SCHEDULE
+#endif
+      for (batch = 0; batch < nbatches; batch++)
+      {
+         HYPRE_Int   jstart = batch * HYPRE_CYCRED_BATCH_SIZE;
+         HYPRE_Int   jend   = hypre_min(jstart + HYPRE_CYCRED_BATCH_SIZE, nlines);
+         HYPRE_Real *cpk, *cpkm;
+         HYPRE_Real  r, c, denom;
+         HYPRE_Int   jj, k, Ai, xi, bi;
+
+         /* forward elimination (x holds the modified right-hand side) */
+         for (k = 0; k < n; k++)
+         {
+            cpk  = cp + k * nlines;
+            cpkm = cpk - nlines;
+            for (jj = jstart; jj < jend; jj++)
+            {
+               Ai = lines[3 * jj]     + k * Astride;
+               xi = lines[3 * jj + 1] + k * xstride;
+               bi = lines[3 * jj + 2] + k * bstride;
+
+               r     = bp[bi] - Awp[Ai] * xp[xi - xstride];
+               c     = Aep[Ai];
+               denom = Ap[Ai];
+               if (k > 0)
+               {
+                  denom -= Awp[Ai] * cpkm[jj];
+               }
+               if (k == n - 1)
+               {
+                  r -= c * xp[xi + xstride];
+                  c  = 0.0;
+               }
+               denom    = (denom != 0.0) ? (1.0 / denom) : 0.0;
+               cpk[jj]  = c * denom;
+               xp[xi]   = r * denom;
+            }
+         }
+
+         /* back substitution */
+         for (k = n - 2; k >= 0; k--)
+         {
+            cpk = cp + k * nlines;
+            for (jj = jstart; jj < jend; jj++)
+            {
+               xi = lines[3 * jj + 1] + k * xstride;
+
+               xp[xi] -= cpk[jj] * xp[xi + xstride];
+            }
+         }
+      }
+   }
+
+   hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+   hypre_EndTiming(cyc_red_data -> time_index);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReduction
  *
@@ -812,6 +1084,11 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
 
    HYPRE_Int             compute_i, fi, ci, j, l;
 
+   if (cyc_red_data -> use_batched)
+   {
+      return hypre_CycRedSolveBatched(cyc_red_data, A, b, x);
+   }
+
    hypre_BeginTiming(cyc_red_data -> time_index);
 
 
@@ -1202,6 +1479,24 @@ hypre_CyclicReductionSetCDir( void        *cyc_red_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CyclicReductionSetBatched
+ *
+ * Request batched Thomas solves of whole lines.  This is only used when all
+ * lines are local to one process; otherwise, cyclic reduction is used.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CyclicReductionSetBatched( void        *cyc_red_vdata,
+                                 HYPRE_Int    batched )
+{
+   hypre_CyclicReductionData *cyc_red_data = (hypre_CyclicReductionData *)cyc_red_vdata;
+
+   (cyc_red_data -> batched) = batched;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionDestroy
  *--------------------------------------------------------------------------*/
@@ -1217,6 +1512,18 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
    {
       HYPRE_MemoryLocation memory_location = cyc_red_data -> memory_location;
 
+      if (cyc_red_data -> use_batched)
+      {
+         hypre_BoxArrayDestroy(cyc_red_data -> base_points);
+         hypre_TFree(cyc_red_data -> batch_cp, HYPRE_MEMORY_HOST);
+         hypre_TFree(cyc_red_data -> batch_lines, HYPRE_MEMORY_HOST);
+
+         hypre_FinalizeTiming(cyc_red_data -> time_index);
+         hypre_TFree(cyc_red_data, HYPRE_MEMORY_HOST);
+
+         return hypre_error_flag;
+      }
+
       hypre_BoxArrayDestroy(cyc_red_data -> base_points);
       hypre_StructGridDestroy(cyc_red_data -> grid_l[0]);
       hypre_StructMatrixDestroy(cyc_red_data -> A_l[0]);
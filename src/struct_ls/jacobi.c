@@ -155,6 +155,20 @@ hypre_JacobiSetZeroGuess( void  *jacobi_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_JacobiSetTemporalBlock( void      *jacobi_vdata,
+                              HYPRE_Int  temporal_block )
+{
+   hypre_JacobiData *jacobi_data = (hypre_JacobiData *)jacobi_vdata;
+
+   hypre_PointRelaxSetTemporalBlock((jacobi_data -> relax_data), temporal_block);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
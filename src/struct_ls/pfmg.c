@@ -37,6 +37,8 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)     = 1;
    (pfmg_data -> num_post_relax)    = 1;
    (pfmg_data -> skip_relax)        = 1;
+   (pfmg_data -> temporal_block)    = 0;
+   (pfmg_data -> mostly_constant)   = 0;
    (pfmg_data -> logging)           = 0;
    (pfmg_data -> print_level)       = 0;
 
@@ -406,6 +408,56 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetTemporalBlock( void      *pfmg_vdata,
+                            HYPRE_Int  temporal_block )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> temporal_block) = temporal_block;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetTemporalBlock( void      *pfmg_vdata,
+                            HYPRE_Int *temporal_block )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *temporal_block = (pfmg_data -> temporal_block);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetMostlyConstant( void      *pfmg_vdata,
+                             HYPRE_Int  mostly_constant )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> mostly_constant) = mostly_constant;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetMostlyConstant( void      *pfmg_vdata,
+                             HYPRE_Int *mostly_constant )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *mostly_constant = (pfmg_data -> mostly_constant);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -17,6 +17,18 @@ typedef struct
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
+   /* line relaxation (relax_type 4) */
+   MPI_Comm                comm;
+   HYPRE_Int               line_dir;
+   HYPRE_Int               line_relax;      /* 0 if falling back to Jacobi */
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   hypre_StructVector     *temp_vec;
+   hypre_StructMatrix     *A_line;          /* mask of A along line_dir */
+   hypre_StructMatrix     *A_rem;           /* mask of the rest of A */
+   void                   *line_solve_data;
+   void                   *line_matvec_data;
+
 } hypre_PFMGRelaxData;
 
 /*--------------------------------------------------------------------------
@@ -32,10 +44,156 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> comm)       = comm;
+   (pfmg_relax_data -> line_dir)   = 0;
+   (pfmg_relax_data -> max_iter)   = 1;
 
    return (void *) pfmg_relax_data;
 }
 
+/*--------------------------------------------------------------------------
+ * Free the line relaxation data
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRelaxDestroyLine( hypre_PFMGRelaxData *pfmg_relax_data )
+{
+   if (pfmg_relax_data -> line_solve_data)
+   {
+      hypre_CyclicReductionDestroy(pfmg_relax_data -> line_solve_data);
+      (pfmg_relax_data -> line_solve_data) = NULL;
+   }
+   if (pfmg_relax_data -> line_matvec_data)
+   {
+      hypre_StructMatvecDestroy(pfmg_relax_data -> line_matvec_data);
+      (pfmg_relax_data -> line_matvec_data) = NULL;
+   }
+   hypre_StructMatrixDestroy(pfmg_relax_data -> A_line);
+   hypre_StructMatrixDestroy(pfmg_relax_data -> A_rem);
+   (pfmg_relax_data -> A_line)     = NULL;
+   (pfmg_relax_data -> A_rem)      = NULL;
+   (pfmg_relax_data -> line_relax) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up line relaxation along line_dir.  The matrix is split into the
+ * tridiagonal part A_line (the coefficients along line_dir) and the
+ * remainder A_rem, both of which are masks sharing the data of A.  The line
+ * systems are solved with the batched Thomas solver in cyclic reduction.
+ *
+ * Line relaxation requires a variable-coefficient matrix with a complete
+ * 3-point stencil along line_dir; otherwise, Jacobi is used instead.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRelaxSetupLine( hypre_PFMGRelaxData *pfmg_relax_data,
+                          hypre_StructMatrix  *A,
+                          hypre_StructVector  *b,
+                          hypre_StructVector  *x )
+{
+   HYPRE_Int             line_dir      = (pfmg_relax_data -> line_dir);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             ndim          = hypre_StructStencilNDim(stencil);
+
+   HYPRE_Int            *line_indices;
+   HYPRE_Int            *rem_indices;
+   HYPRE_Int             num_line_indices = 0;
+   HYPRE_Int             num_rem_indices = 0;
+   HYPRE_Int             i, d, on_line;
+
+   hypre_PFMGRelaxDestroyLine(pfmg_relax_data);
+
+   line_indices = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   rem_indices  = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < stencil_size; i++)
+   {
+      on_line = (hypre_abs(hypre_IndexD(stencil_shape[i], line_dir)) <= 1);
+      for (d = 0; d < ndim; d++)
+      {
+         if ((d != line_dir) && (hypre_IndexD(stencil_shape[i], d) != 0))
+         {
+            on_line = 0;
+         }
+      }
+      if (on_line)
+      {
+         line_indices[num_line_indices++] = i;
+      }
+      else
+      {
+         rem_indices[num_rem_indices++] = i;
+      }
+   }
+
+   /* Mostly-constant (compressed) operators have no data for the masks */
+   if ((num_line_indices == 3) &&
+       (hypre_StructMatrixConstantCoefficient(A) == 0) &&
+       !hypre_StructMatrixMostlyConstant(A))
+   {
+      (pfmg_relax_data -> A_line) =
+         hypre_StructMatrixCreateMask(A, num_line_indices, line_indices);
+      if (num_rem_indices > 0)
+      {
+         (pfmg_relax_data -> A_rem) =
+            hypre_StructMatrixCreateMask(A, num_rem_indices, rem_indices);
+         (pfmg_relax_data -> line_matvec_data) = hypre_StructMatvecCreate();
+         hypre_StructMatvecSetup((pfmg_relax_data -> line_matvec_data),
+                                 (pfmg_relax_data -> A_rem), x);
+      }
+
+      (pfmg_relax_data -> line_solve_data) =
+         hypre_CyclicReductionCreate(pfmg_relax_data -> comm);
+      hypre_CyclicReductionSetCDir((pfmg_relax_data -> line_solve_data), line_dir);
+      hypre_CyclicReductionSetBatched((pfmg_relax_data -> line_solve_data), 1);
+      hypre_CyclicReductionSetup((pfmg_relax_data -> line_solve_data),
+                                 (pfmg_relax_data -> A_line), b, x);
+
+      (pfmg_relax_data -> line_relax) = 1;
+   }
+   else
+   {
+      hypre_PointRelaxSetup((pfmg_relax_data -> relax_data), A, b, x);
+   }
+
+   hypre_TFree(line_indices, HYPRE_MEMORY_HOST);
+   hypre_TFree(rem_indices, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Line Jacobi: each sweep solves A_line x = b - A_rem x for all lines
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRelaxLine( hypre_PFMGRelaxData *pfmg_relax_data,
+                     hypre_StructVector  *b,
+                     hypre_StructVector  *x )
+{
+   hypre_StructMatrix  *A_rem    = (pfmg_relax_data -> A_rem);
+   hypre_StructVector  *t        = (pfmg_relax_data -> temp_vec);
+   HYPRE_Int            max_iter = (pfmg_relax_data -> max_iter);
+   HYPRE_Int            iter;
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      hypre_StructCopy(b, t);
+      if (A_rem && !(iter == 0 && (pfmg_relax_data -> zero_guess)))
+      {
+         hypre_StructMatvecCompute((pfmg_relax_data -> line_matvec_data),
+                                   -1.0, A_rem, x, 1.0, t);
+      }
+      hypre_CyclicReduction((pfmg_relax_data -> line_solve_data),
+                            (pfmg_relax_data -> A_line), t, x);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -48,6 +206,8 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_PFMGRelaxDestroyLine(pfmg_relax_data);
+      hypre_StructVectorDestroy(pfmg_relax_data -> temp_vec);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -85,6 +245,16 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
 
+         break;
+      case 4:
+         if (pfmg_relax_data -> line_relax)
+         {
+            hypre_PFMGRelaxLine(pfmg_relax_data, b, x);
+         }
+         else
+         {
+            hypre_PointRelax((pfmg_relax_data -> relax_data), A, b, x);
+         }
          break;
    }
 
@@ -114,6 +284,9 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_PFMGRelaxSetupLine(pfmg_relax_data, A, b, x);
+         break;
    }
 
    if (relax_type == 1)
@@ -139,6 +312,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
    switch (relax_type)
    {
       case 0: /* Jacobi */
+      case 4: /* Line Jacobi (falls back to Jacobi) */
       {
          hypre_Index  stride;
          hypre_Index  indices[1];
@@ -187,6 +361,7 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
    {
       case 1: /* Weighted Jacobi */
       case 0: /* Jacobi */
+      case 4: /* Line Jacobi */
          break;
 
       case 2: /* Red-Black Gauss-Seidel */
@@ -214,6 +389,7 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
    {
       case 1: /* Weighted Jacobi */
       case 0: /* Jacobi */
+      case 4: /* Line Jacobi */
          break;
 
       case 2: /* Red-Black Gauss-Seidel */
@@ -254,6 +430,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   (pfmg_relax_data -> max_iter) = max_iter;
 
    return hypre_error_flag;
 }
@@ -269,6 +446,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   (pfmg_relax_data -> zero_guess) = zero_guess;
 
    return hypre_error_flag;
 }
@@ -283,7 +461,38 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
 
    hypre_PointRelaxSetTempVec((pfmg_relax_data -> relax_data), t);
+   hypre_StructVectorDestroy(pfmg_relax_data -> temp_vec);
+   (pfmg_relax_data -> temp_vec) = hypre_StructVectorRef(t);
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Set the direction of the lines used in line relaxation (relax_type 4)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDir( void      *pfmg_relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> line_dir) = line_dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTemporalBlock( void      *pfmg_relax_vdata,
+                                 HYPRE_Int  temporal_block )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_PointRelaxSetTemporalBlock((pfmg_relax_data -> relax_data), temporal_block);
+   hypre_RedBlackGSSetTemporalBlock((pfmg_relax_data -> rb_relax_data), temporal_block);
+
+   return hypre_error_flag;
+}
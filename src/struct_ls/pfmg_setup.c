@@ -73,6 +73,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight = (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             temporal_block =   (pfmg_data -> temporal_block);
+   HYPRE_Int             mostly_constant =  (pfmg_data -> mostly_constant);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -434,8 +436,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       A_l[l + 1] = hypre_PFMGCreateRAPOp(RT_l[l], A_l[l], P_l[l],
                                          grid_l[l + 1], cdir, rap_type);
       hypre_StructMatrixInitializeShell(A_l[l + 1]);
-      data_size += hypre_StructMatrixDataSize(A_l[l + 1]);
-      data_size_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      if (!mostly_constant)
+      {
+         data_size += hypre_StructMatrixDataSize(A_l[l + 1]);
+         data_size_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      }
 
       b_l[l + 1] = hypre_StructVectorCreate(comm, grid_l[l + 1]);
       hypre_StructVectorSetNumGhost(b_l[l + 1], b_num_ghost);
@@ -511,9 +516,21 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       }
 #endif
 
-      hypre_StructMatrixInitializeData(A_l[l + 1], data, data_const);
-      data += hypre_StructMatrixDataSize(A_l[l + 1]);
-      data_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      if (mostly_constant)
+      {
+         /* separate storage, so that it can be released after compression */
+         hypre_StructMatrixInitializeData(
+            A_l[l + 1],
+            hypre_CTAlloc(HYPRE_Real, hypre_StructMatrixDataSize(A_l[l + 1]), memory_location),
+            hypre_CTAlloc(HYPRE_Real, hypre_StructMatrixDataConstSize(A_l[l + 1]), HYPRE_MEMORY_HOST));
+         hypre_StructMatrixDataAlloced(A_l[l + 1]) = 1;
+      }
+      else
+      {
+         hypre_StructMatrixInitializeData(A_l[l + 1], data, data_const);
+         data += hypre_StructMatrixDataSize(A_l[l + 1]);
+         data_const += hypre_StructMatrixDataConstSize(A_l[l + 1]);
+      }
 
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
       if (data_location != HYPRE_MEMORY_HOST)
@@ -645,6 +662,20 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       active_l[l] = 0;
    }
 
+   /*-----------------------------------------------------
+    * Switch the coarse grid operators to mostly-constant
+    * storage.  This must come after the last use of their
+    * data above and before the relaxation setup.
+    *-----------------------------------------------------*/
+
+   if (mostly_constant)
+   {
+      for (l = 1; l < num_levels; l++)
+      {
+         hypre_StructMatrixCompressMostlyConstant(A_l[l]);
+      }
+   }
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    if (hypre_StructGridDataLocation(grid) != HYPRE_MEMORY_HOST)
    {
@@ -663,7 +694,12 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   if (num_levels > 1)
+   {
+      hypre_PFMGRelaxSetLineDir(relax_data_l[0], cdir_l[0]);
+   }
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   hypre_PFMGRelaxSetTemporalBlock(relax_data_l[0], temporal_block);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -683,7 +719,12 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            if (l < (num_levels - 1))
+            {
+               hypre_PFMGRelaxSetLineDir(relax_data_l[l], cdir_l[l]);
+            }
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            hypre_PFMGRelaxSetTemporalBlock(relax_data_l[l], temporal_block);
          }
       }
 
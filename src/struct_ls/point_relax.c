@@ -43,6 +43,9 @@ typedef struct
 
    hypre_ComputePkg      **compute_pkgs;
 
+   HYPRE_Int               temporal_block;  /* sweeps per exchange (if > 1) */
+   void                   *tblock_data;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -83,6 +86,8 @@ hypre_PointRelaxCreate( MPI_Comm  comm )
    (relax_data -> x)                = NULL;
    (relax_data -> t)                = NULL;
    (relax_data -> compute_pkgs)     = NULL;
+   (relax_data -> temporal_block)   = 0;
+   (relax_data -> tblock_data)      = NULL;
 
    hypre_SetIndex3(stride, 1, 1, 1);
    hypre_SetIndex3(indices[0], 0, 0, 0);
@@ -123,6 +128,7 @@ hypre_PointRelaxDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_StructVectorDestroy(relax_data -> t);
       hypre_TFree(relax_data -> compute_pkgs, HYPRE_MEMORY_HOST);
+      hypre_StructTBlockDestroy(relax_data -> tblock_data);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -284,6 +290,30 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    (relax_data -> diag_rank)    = diag_rank;
    (relax_data -> compute_pkgs) = compute_pkgs;
 
+   /*----------------------------------------------------------
+    * Set up temporal blocking (plain Jacobi on all points only)
+    *----------------------------------------------------------*/
+
+   hypre_StructTBlockDestroy(relax_data -> tblock_data);
+   (relax_data -> tblock_data) = NULL;
+   if ((relax_data -> temporal_block) > 1 && num_pointsets == 1 && pointset_sizes[0] == 1)
+   {
+      stride = pointset_strides[0];
+      index  = pointset_indices[0][0];
+      for (i = 0; i < ndim; i++)
+      {
+         if (hypre_IndexD(stride, i) != 1 || hypre_IndexD(index, i) != 0)
+         {
+            break;
+         }
+      }
+      if (i == ndim)
+      {
+         (relax_data -> tblock_data) =
+            hypre_StructTBlockCreate(A, (relax_data -> temporal_block), 2);
+      }
+   }
+
    /*-----------------------------------------------------
     * Compute flops
     *-----------------------------------------------------*/
@@ -352,6 +382,7 @@ hypre_PointRelax( void               *relax_vdata,
    hypre_Index            loop_size;
 
    HYPRE_Int              constant_coefficient;
+   HYPRE_Int              mostly_constant;
 
    HYPRE_Int              iter, p, compute_i, i, j;
    HYPRE_Int              pointset;
@@ -387,7 +418,11 @@ hypre_PointRelax( void               *relax_vdata,
    }
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
-   if (constant_coefficient) { hypre_StructVectorClearBoundGhostValues(x, 0); }
+   mostly_constant = hypre_StructMatrixMostlyConstant(A);
+   if (constant_coefficient || mostly_constant)
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
 
    rsumsq = 0.0;
    if ( tol > 0.0 )
@@ -457,8 +492,15 @@ hypre_PointRelax( void               *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
+               if (mostly_constant)
+               {
+                  hypre_PointRelax_coreMC(relax_vdata, A, 1, compute_box,
+                                          bp, xp, xp, i,
+                                          b_data_box, x_data_box, x_data_box,
+                                          stride);
+               }
                /* all matrix coefficients are constant */
-               if ( constant_coefficient == 1 )
+               else if ( constant_coefficient == 1 )
                {
                   Ai = hypre_CCBoxIndexRank( A_data_box, start );
                   AAp0 = 1 / Ap[Ai];
@@ -513,6 +555,16 @@ hypre_PointRelax( void               *relax_vdata,
       }
    }
 
+   /*----------------------------------------------------------
+    * Do the remaining iterations in temporally blocked mode
+    *----------------------------------------------------------*/
+
+   if ((relax_data -> tblock_data) && tol <= 0.0 && (max_iter - iter) > 1)
+   {
+      hypre_PointRelaxTBlock(relax_vdata, A, b, x, max_iter - iter);
+      iter = max_iter;
+   }
+
    /*----------------------------------------------------------
     * Do regular iterations
     *----------------------------------------------------------*/
@@ -568,7 +620,15 @@ hypre_PointRelax( void               *relax_vdata,
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
-               if ( constant_coefficient == 1 || constant_coefficient == 2 )
+               if (mostly_constant)
+               {
+                  /* also divides by the diagonal */
+                  hypre_PointRelax_coreMC(relax_vdata, A, 0, compute_box,
+                                          bp, xp, tp, i,
+                                          b_data_box, x_data_box, t_data_box,
+                                          stride);
+               }
+               else if ( constant_coefficient == 1 || constant_coefficient == 2 )
                {
                   hypre_PointRelax_core12(
                      relax_vdata, A, constant_coefficient,
@@ -590,7 +650,8 @@ hypre_PointRelax( void               *relax_vdata,
 
                Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
 
-               if ( constant_coefficient == 0 || constant_coefficient == 2 )
+               if ( !mostly_constant &&
+                    (constant_coefficient == 0 || constant_coefficient == 2) )
                   /* divide by the variable diagonal */
                {
                   start  = hypre_BoxIMin(compute_box);
@@ -605,6 +666,11 @@ hypre_PointRelax( void               *relax_vdata,
                   hypre_BoxLoop2End(Ai, ti);
 #undef DEVICE_VAR
                }
+
+               if (compute_i == 0)
+               {
+                  hypre_ProgressIndtComputations(comm_handle);
+               }
             }
          }
       }
@@ -1204,6 +1270,245 @@ hypre_PointRelax_core12( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/* for mostly-constant storage: the constant row of the box is used for all
+   points, then the exceptions in the compute box are redone with their own
+   rows.  Unlike the other cores, this also divides by the diagonal.  With
+   zero_guess, x is taken to be zero and only b is read. */
+HYPRE_Int
+hypre_PointRelax_coreMC( void               *relax_vdata,
+                         hypre_StructMatrix *A,
+                         HYPRE_Int           zero_guess,
+                         hypre_Box          *compute_box,
+                         HYPRE_Real         *bp,
+                         HYPRE_Real         *xp,
+                         HYPRE_Real         *tp,
+                         HYPRE_Int           boxarray_id,
+                         hypre_Box          *b_data_box,
+                         hypre_Box          *x_data_box,
+                         hypre_Box          *t_data_box,
+                         hypre_IndexRef      stride
+                       )
+{
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   HYPRE_Int              diag_rank     = (relax_data -> diag_rank);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             *mc_starts     = hypre_StructMatrixMCStarts(A);
+   hypre_Index           *mc_indices    = hypre_StructMatrixMCIndices(A);
+
+   HYPRE_Real            *cp;
+   HYPRE_Real            *ep;
+   HYPRE_Int             *xoff;
+   HYPRE_Real             sum;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Int              bi, xi, ti, e, si;
+
+   cp   = hypre_StructMatrixMCBoxValues(A, boxarray_id);
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (si = 0; si < stencil_size; si++)
+   {
+      xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+   }
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+   hypre_BoxLoop3BeginHost(hypre_StructMatrixNDim(A), loop_size,
+                           b_data_box, start, stride, Bi,
+                           x_data_box, start, stride, Xi,
+                           t_data_box, start, stride, Ti);
+   {
+      HYPRE_Real  csum = bp[Bi];
+      HYPRE_Int   ci;
+
+      if (!zero_guess)
+      {
+         for (ci = 0; ci < stencil_size; ci++)
+         {
+            if (ci != diag_rank)
+            {
+               csum -= cp[ci] * xp[Xi + xoff[ci]];
+            }
+         }
+      }
+      tp[Ti] = csum / cp[diag_rank];
+   }
+   hypre_BoxLoop3EndHost(Bi, Xi, Ti);
+
+   for (e = mc_starts[boxarray_id]; e < mc_starts[boxarray_id + 1]; e++)
+   {
+      if (!hypre_StructMatrixMCExceptionInBox(A, e, compute_box, stride))
+      {
+         continue;
+      }
+
+      ep  = hypre_StructMatrixMCExceptionValues(A, e);
+      bi  = hypre_BoxIndexRank(b_data_box, mc_indices[e]);
+      xi  = hypre_BoxIndexRank(x_data_box, mc_indices[e]);
+      ti  = hypre_BoxIndexRank(t_data_box, mc_indices[e]);
+      sum = bp[bi];
+      if (!zero_guess)
+      {
+         for (si = 0; si < stencil_size; si++)
+         {
+            if (si != diag_rank)
+            {
+               sum -= ep[si] * xp[xi + xoff[si]];
+            }
+         }
+      }
+      tp[ti] = sum / ep[diag_rank];
+   }
+
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Do num_sweeps (unweighted or weighted) Jacobi sweeps on all points with one
+ * ghost exchange per temporal_block sweeps.  See relax_tblock.c.  The update
+ * is computed exactly as in the regular iterations, so the results agree.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxTBlock( void               *relax_vdata,
+                        hypre_StructMatrix *A,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x,
+                        HYPRE_Int           num_sweeps )
+{
+   hypre_PointRelaxData  *relax_data  = (hypre_PointRelaxData *)relax_vdata;
+   void                  *tblock_data = (relax_data -> tblock_data);
+   HYPRE_Real             weight      = (relax_data -> weight);
+   HYPRE_Real             weightc     = 1 - weight;
+   HYPRE_Int              diag_rank   = (relax_data -> diag_rank);
+   HYPRE_Int              ndim        = hypre_StructMatrixNDim(A);
+
+   hypre_StructMatrix    *A_wide;
+   hypre_StructVector    *b_wide;
+   hypre_StructVector    *x_wide;
+   hypre_StructVector    *y_wide;
+   hypre_StructVector    *src;
+   hypre_StructVector    *dst;
+
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *tile_box;
+   hypre_Box             *A_data_box;
+   hypre_Box             *v_data_box;
+
+   HYPRE_Real            *Ap;
+   HYPRE_Real            *bp;
+   HYPRE_Real            *sp;
+   HYPRE_Real            *dp;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   hypre_Index            unit_stride;
+
+   HYPRE_Int              depth, num_steps, num_tiles, tile_size;
+   HYPRE_Int              i, tile, step;
+
+   hypre_StructTBlockLoad(tblock_data, A, b, x);
+   hypre_StructTBlockGetData(tblock_data, &depth, &A_wide, &b_wide, &x_wide, &y_wide);
+
+   hypre_SetIndex(unit_stride, 1);
+   boxes    = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   tile_box = hypre_BoxCreate(ndim);
+
+   while (num_sweeps > 0)
+   {
+      num_steps = hypre_min(depth, num_sweeps);
+
+      hypre_StructTBlockExchange(tblock_data, x_wide);
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+
+         /* all wide vectors have the same data space */
+         A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A_wide), i);
+         v_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x_wide), i);
+
+         Ap = hypre_StructMatrixBoxData(A_wide, i, diag_rank);
+         bp = hypre_StructVectorBoxData(b_wide, i);
+
+         num_tiles = hypre_StructTBlockNumTiles(tblock_data, box, num_steps, &tile_size);
+         for (tile = 0; tile < num_tiles; tile++)
+         {
+            for (step = 0; step < num_steps; step++)
+            {
+               hypre_StructTBlockTileBox(tblock_data, box, num_steps, step,
+                                         tile, tile_size, tile_box);
+               if (hypre_BoxVolume(tile_box) == 0)
+               {
+                  continue;
+               }
+
+               /* alternate between the two buffers */
+               src = (step % 2) ? y_wide : x_wide;
+               dst = (step % 2) ? x_wide : y_wide;
+               sp  = hypre_StructVectorBoxData(src, i);
+               dp  = hypre_StructVectorBoxData(dst, i);
+
+               hypre_PointRelax_core0(relax_vdata, A_wide, 0, tile_box,
+                                      bp, sp, dp, i,
+                                      A_data_box, v_data_box, v_data_box, v_data_box,
+                                      unit_stride);
+
+               start = hypre_BoxIMin(tile_box);
+               hypre_BoxGetSize(tile_box, loop_size);
+               if (weight != 1.0)
+               {
+#define DEVICE_VAR is_device_ptr(dp,sp,Ap)
+                  hypre_BoxLoop2Begin(ndim, loop_size,
+                                      A_data_box, start, unit_stride, Ai,
+                                      v_data_box, start, unit_stride, vi);
+                  {
+                     dp[vi] /= Ap[Ai];
+                     dp[vi] = weight * dp[vi] + weightc * sp[vi];
+                  }
+                  hypre_BoxLoop2End(Ai, vi);
+#undef DEVICE_VAR
+               }
+               else
+               {
+#define DEVICE_VAR is_device_ptr(dp,Ap)
+                  hypre_BoxLoop2Begin(ndim, loop_size,
+                                      A_data_box, start, unit_stride, Ai,
+                                      v_data_box, start, unit_stride, vi);
+                  {
+                     dp[vi] /= Ap[Ai];
+                  }
+                  hypre_BoxLoop2End(Ai, vi);
+#undef DEVICE_VAR
+               }
+            }
+         }
+      }
+
+      /* the latest iterate is in y_wide after an odd number of steps */
+      if (num_steps % 2)
+      {
+         src    = x_wide;
+         x_wide = y_wide;
+         y_wide = src;
+      }
+      num_sweeps -= num_steps;
+   }
+
+   hypre_StructCopy(x_wide, x);
+
+   hypre_BoxDestroy(tile_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1416,6 +1721,23 @@ hypre_PointRelaxSetTempVec( void               *relax_vdata,
 }
 
 
+/*--------------------------------------------------------------------------
+ * Set the number of sweeps done per ghost exchange (temporal blocking).
+ * Values <= 1 turn it off.  Must be called before hypre_PointRelaxSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxSetTemporalBlock( void      *relax_vdata,
+                                  HYPRE_Int  temporal_block )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   (relax_data -> temporal_block) = temporal_block;
+
+   return hypre_error_flag;
+}
+
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -26,6 +26,7 @@ HYPRE_Int hypre_CyclicReduction ( void *cyc_red_vdata, hypre_StructMatrix *A, hy
 HYPRE_Int hypre_CyclicReductionSetCDir ( void *cyc_red_vdata, HYPRE_Int cdir );
 HYPRE_Int hypre_CyclicReductionSetBase ( void *cyc_red_vdata, hypre_Index base_index,
                                          hypre_Index base_stride );
+HYPRE_Int hypre_CyclicReductionSetBatched ( void *cyc_red_vdata, HYPRE_Int batched );
 HYPRE_Int hypre_CyclicReductionDestroy ( void *cyc_red_vdata );
 HYPRE_Int hypre_CyclicReductionSetMaxLevel( void   *cyc_red_vdata, HYPRE_Int   max_level  );
 
@@ -83,6 +84,7 @@ HYPRE_Int hypre_JacobiSetMaxIter ( void *jacobi_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_JacobiGetMaxIter ( void *jacobi_vdata, HYPRE_Int *max_iter );
 HYPRE_Int hypre_JacobiSetZeroGuess ( void *jacobi_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_JacobiGetZeroGuess ( void *jacobi_vdata, HYPRE_Int *zero_guess );
+HYPRE_Int hypre_JacobiSetTemporalBlock ( void *jacobi_vdata, HYPRE_Int temporal_block );
 HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata, hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata, HYPRE_Real *norm );
@@ -211,6 +213,10 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata, HYPRE_Int num_post_relax
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata, HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata, HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata, HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetTemporalBlock ( void *pfmg_vdata, HYPRE_Int temporal_block );
+HYPRE_Int hypre_PFMGGetTemporalBlock ( void *pfmg_vdata, HYPRE_Int *temporal_block );
+HYPRE_Int hypre_PFMGSetMostlyConstant ( void *pfmg_vdata, HYPRE_Int mostly_constant );
+HYPRE_Int hypre_PFMGGetMostlyConstant ( void *pfmg_vdata, HYPRE_Int *mostly_constant );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata, HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata, HYPRE_Int *logging );
@@ -236,6 +242,8 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetTemporalBlock ( void *pfmg_relax_vdata, HYPRE_Int temporal_block );
+HYPRE_Int hypre_PFMGRelaxSetLineDir ( void *pfmg_relax_vdata, HYPRE_Int line_dir );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -349,6 +357,12 @@ HYPRE_Int hypre_PointRelax_core12 ( void *relax_vdata, hypre_StructMatrix *A,
                                     HYPRE_Int constant_coefficient, hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp,
                                     HYPRE_Real *tp, HYPRE_Int boxarray_id, hypre_Box *A_data_box, hypre_Box *b_data_box,
                                     hypre_Box *x_data_box, hypre_Box *t_data_box, hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelax_coreMC ( void *relax_vdata, hypre_StructMatrix *A, HYPRE_Int zero_guess,
+                                    hypre_Box *compute_box, HYPRE_Real *bp, HYPRE_Real *xp, HYPRE_Real *tp,
+                                    HYPRE_Int boxarray_id, hypre_Box *b_data_box, hypre_Box *x_data_box,
+                                    hypre_Box *t_data_box, hypre_IndexRef stride );
+HYPRE_Int hypre_PointRelaxTBlock ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                   hypre_StructVector *x, HYPRE_Int num_sweeps );
 HYPRE_Int hypre_PointRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PointRelaxGetTol ( void *relax_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_PointRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
@@ -363,6 +377,7 @@ HYPRE_Int hypre_PointRelaxSetPointset ( void *relax_vdata, HYPRE_Int pointset,
 HYPRE_Int hypre_PointRelaxSetPointsetRank ( void *relax_vdata, HYPRE_Int pointset,
                                             HYPRE_Int pointset_rank );
 HYPRE_Int hypre_PointRelaxSetTempVec ( void *relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PointRelaxSetTemporalBlock ( void *relax_vdata, HYPRE_Int temporal_block );
 HYPRE_Int hypre_PointRelaxGetFinalRelativeResidualNorm ( void *relax_vdata, HYPRE_Real *norm );
 HYPRE_Int hypre_relax_wtx ( void *relax_vdata, HYPRE_Int pointset, hypre_StructVector *t,
                             hypre_StructVector *x );
@@ -380,11 +395,34 @@ HYPRE_Int hypre_RedBlackGSSetup ( void *relax_vdata, hypre_StructMatrix *A, hypr
                                   hypre_StructVector *x );
 HYPRE_Int hypre_RedBlackGS ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
                              hypre_StructVector *x );
+HYPRE_Int hypre_RedBlackGSRelaxBox ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                     hypre_StructVector *x, HYPRE_Int box_id, hypre_Box *compute_box, HYPRE_Int rb );
+HYPRE_Int hypre_RedBlackGSRelaxBoxMC ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                       hypre_StructVector *x, HYPRE_Int box_id, hypre_Box *compute_box, HYPRE_Int rb,
+                                       HYPRE_Int zero_guess );
+HYPRE_Int hypre_RedBlackGSTBlock ( void *relax_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                   hypre_StructVector *x, HYPRE_Int rb, HYPRE_Int num_half_sweeps );
 HYPRE_Int hypre_RedBlackGSSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_RedBlackGSSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_RedBlackGSSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_RedBlackGSSetStartRed ( void *relax_vdata );
 HYPRE_Int hypre_RedBlackGSSetStartBlack ( void *relax_vdata );
+HYPRE_Int hypre_RedBlackGSSetTemporalBlock ( void *relax_vdata, HYPRE_Int temporal_block );
+
+/* relax_tblock.c */
+void *hypre_StructTBlockCreate ( hypre_StructMatrix *A, HYPRE_Int num_steps,
+                                 HYPRE_Int num_vectors );
+HYPRE_Int hypre_StructTBlockDestroy ( void *tblock_vdata );
+HYPRE_Int hypre_StructTBlockLoad ( void *tblock_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                   hypre_StructVector *x );
+HYPRE_Int hypre_StructTBlockGetData ( void *tblock_vdata, HYPRE_Int *num_steps_ptr,
+                                      hypre_StructMatrix **A_ptr, hypre_StructVector **b_ptr, hypre_StructVector **x_ptr,
+                                      hypre_StructVector **y_ptr );
+HYPRE_Int hypre_StructTBlockExchange ( void *tblock_vdata, hypre_StructVector *v );
+HYPRE_Int hypre_StructTBlockNumTiles ( void *tblock_vdata, hypre_Box *box, HYPRE_Int num_steps,
+                                       HYPRE_Int *tile_size_ptr );
+HYPRE_Int hypre_StructTBlockTileBox ( void *tblock_vdata, hypre_Box *box, HYPRE_Int num_steps,
+                                      HYPRE_Int step, HYPRE_Int tile, HYPRE_Int tile_size, hypre_Box *tile_box );
 
 /* semi.c */
 HYPRE_Int hypre_StructInterpAssemble ( hypre_StructMatrix *A, hypre_StructMatrix *P,
@@ -449,6 +487,8 @@ void *hypre_SMGCreate ( MPI_Comm comm );
 HYPRE_Int hypre_SMGDestroy ( void *smg_vdata );
 HYPRE_Int hypre_SMGSetMemoryUse ( void *smg_vdata, HYPRE_Int memory_use );
 HYPRE_Int hypre_SMGGetMemoryUse ( void *smg_vdata, HYPRE_Int *memory_use );
+HYPRE_Int hypre_SMGSetBatchedLineSolve ( void *smg_vdata, HYPRE_Int batched );
+HYPRE_Int hypre_SMGGetBatchedLineSolve ( void *smg_vdata, HYPRE_Int *batched );
 HYPRE_Int hypre_SMGSetTol ( void *smg_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_SMGGetTol ( void *smg_vdata, HYPRE_Real *tol );
 HYPRE_Int hypre_SMGSetMaxIter ( void *smg_vdata, HYPRE_Int max_iter );
@@ -492,6 +532,7 @@ HYPRE_Int hypre_SMGRelaxSetupASol ( void *relax_vdata, hypre_StructMatrix *A, hy
                                     hypre_StructVector *x );
 HYPRE_Int hypre_SMGRelaxSetTempVec ( void *relax_vdata, hypre_StructVector *temp_vec );
 HYPRE_Int hypre_SMGRelaxSetMemoryUse ( void *relax_vdata, HYPRE_Int memory_use );
+HYPRE_Int hypre_SMGRelaxSetBatchedLineSolve ( void *relax_vdata, HYPRE_Int batched );
 HYPRE_Int hypre_SMGRelaxSetTol ( void *relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_SMGRelaxSetMaxIter ( void *relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_SMGRelaxSetZeroGuess ( void *relax_vdata, HYPRE_Int zero_guess );
@@ -471,6 +471,11 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
 
                   }  /* switch(stencil_size) */
                }     /* else */
+
+               if (compute_i == 0)
+               {
+                  hypre_ProgressIndtComputations(comm_handle);
+               }
             }
          }
       }
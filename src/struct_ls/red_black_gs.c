@@ -39,6 +39,8 @@ hypre_RedBlackGSCreate( MPI_Comm  comm )
    (relax_data -> b)           = NULL;
    (relax_data -> x)           = NULL;
    (relax_data -> compute_pkg) = NULL;
+   (relax_data -> temporal_block) = 0;
+   (relax_data -> tblock_data) = NULL;
 
    return (void *) relax_data;
 }
@@ -57,6 +59,7 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> b);
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+      hypre_StructTBlockDestroy(relax_data -> tblock_data);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -112,6 +115,15 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    (relax_data -> diag_rank) = diag_rank;
    (relax_data -> compute_pkg) = compute_pkg;
 
+   /* one full sweep is two dependent half-sweeps */
+   hypre_StructTBlockDestroy(relax_data -> tblock_data);
+   (relax_data -> tblock_data) = NULL;
+   if ((relax_data -> temporal_block) > 1)
+   {
+      (relax_data -> tblock_data) =
+         hypre_StructTBlockCreate(A, 2 * (relax_data -> temporal_block), 1);
+   }
+
    return hypre_error_flag;
 }
 
@@ -146,21 +158,14 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              Astart, Ani, Anj;
    HYPRE_Int              bstart, bni, bnj;
    HYPRE_Int              xstart, xni, xnj;
-   HYPRE_Int              xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
 
    HYPRE_Real            *Ap;
-   HYPRE_Real            *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
    HYPRE_Real            *bp;
    HYPRE_Real            *xp;
 
    hypre_IndexRef         start;
    hypre_Index            loop_size;
 
-   hypre_StructStencil   *stencil;
-   hypre_Index           *stencil_shape;
-   HYPRE_Int              stencil_size;
-   HYPRE_Int              offd[6];
-
    HYPRE_Int              iter, rb, redblack, d;
    HYPRE_Int              compute_i, i, j;
    HYPRE_Int              ni, nj, nk;
@@ -192,22 +197,10 @@ hypre_RedBlackGS( void               *relax_vdata,
       hypre_EndTiming(relax_data -> time_index);
       return hypre_error_flag;
    }
-   else
-   {
-      stencil       = hypre_StructMatrixStencil(A);
-      stencil_shape = hypre_StructStencilShape(stencil);
-      stencil_size  = hypre_StructStencilSize(stencil);
 
-      /* get off-diag entry ranks ready */
-      i = 0;
-      for (j = 0; j < stencil_size; j++)
-      {
-         if (j != diag_rank)
-         {
-            offd[i] = j;
-            i++;
-         }
-      }
+   if (hypre_StructMatrixMostlyConstant(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
    }
 
    /*----------------------------------------------------------
@@ -252,6 +245,12 @@ hypre_RedBlackGS( void               *relax_vdata,
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
+               if (hypre_StructMatrixMostlyConstant(A))
+               {
+                  hypre_RedBlackGSRelaxBoxMC(relax_vdata, A, b, x, i, compute_box, rb, 1);
+                  continue;
+               }
+
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetSize(compute_box, loop_size);
 
@@ -303,6 +302,16 @@ hypre_RedBlackGS( void               *relax_vdata,
       iter++;
    }
 
+   /*----------------------------------------------------------
+    * Do the remaining iterations in temporally blocked mode
+    *----------------------------------------------------------*/
+
+   if ((relax_data -> tblock_data) && (2 * max_iter - iter) > 1)
+   {
+      hypre_RedBlackGSTBlock(relax_vdata, A, b, x, rb, 2 * max_iter - iter);
+      iter = 2 * max_iter;
+   }
+
    /*----------------------------------------------------------
     * Do regular iterations
     *----------------------------------------------------------*/
@@ -333,150 +342,453 @@ hypre_RedBlackGS( void               *relax_vdata,
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
 
-            A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
-            b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
-            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
-
-            Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
-            bp = hypre_StructVectorBoxData(b, i);
-            xp = hypre_StructVectorBoxData(x, i);
-
             hypre_ForBoxI(j, compute_box_a)
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
-               start  = hypre_BoxIMin(compute_box);
-               hypre_BoxGetSize(compute_box, loop_size);
-
-               /* Are we relaxing index start or start+(1,0,0)? */
-               redblack = rb;
-               for (d = 0; d < ndim; d++)
+               if (hypre_StructMatrixMostlyConstant(A))
                {
-                  redblack += hypre_IndexD(start, d);
+                  hypre_RedBlackGSRelaxBoxMC(relax_vdata, A, b, x, i, compute_box, rb, 0);
                }
-               redblack = hypre_abs(redblack) % 2;
-
-               Astart = hypre_BoxIndexRank(A_dbox, start);
-               bstart = hypre_BoxIndexRank(b_dbox, start);
-               xstart = hypre_BoxIndexRank(x_dbox, start);
-               ni = hypre_IndexX(loop_size);
-               nj = hypre_IndexY(loop_size);
-               nk = hypre_IndexZ(loop_size);
-               Ani = hypre_BoxSizeX(A_dbox);
-               bni = hypre_BoxSizeX(b_dbox);
-               xni = hypre_BoxSizeX(x_dbox);
-               Anj = hypre_BoxSizeY(A_dbox);
-               bnj = hypre_BoxSizeY(b_dbox);
-               xnj = hypre_BoxSizeY(x_dbox);
-               if (ndim < 3)
+               else
                {
-                  nk = 1;
-                  if (ndim < 2)
-                  {
-                     nj = 1;
-                  }
+                  hypre_RedBlackGSRelaxBox(relax_vdata, A, b, x, i, compute_box, rb);
                }
 
-               switch (stencil_size)
+               if (compute_i == 0)
                {
-                  case 7:
-                     Ap5 = hypre_StructMatrixBoxData(A, i, offd[5]);
-                     Ap4 = hypre_StructMatrixBoxData(A, i, offd[4]);
-                     xoff5 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[5]]);
-                     xoff4 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[4]]);
-                  // fall through
-
-                  case 5:
-                     Ap3 = hypre_StructMatrixBoxData(A, i, offd[3]);
-                     Ap2 = hypre_StructMatrixBoxData(A, i, offd[2]);
-                     xoff3 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[3]]);
-                     xoff2 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[2]]);
-                  // fall through
-
-                  case 3:
-                     Ap1 = hypre_StructMatrixBoxData(A, i, offd[1]);
-                     Ap0 = hypre_StructMatrixBoxData(A, i, offd[0]);
-                     xoff1 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[1]]);
-                     xoff0 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[0]]);
-                     break;
+                  hypre_ProgressIndtComputations(comm_handle);
                }
+            }
+         }
+      }
 
-               switch (stencil_size)
-               {
-                  case 7:
-                     hypre_RedBlackLoopInit();
+      rb = (rb + 1) % 2;
+      iter++;
+   }
+
+   (relax_data -> num_iterations) = iter / 2;
+
+   /*-----------------------------------------------------------------------
+    * Return
+    *-----------------------------------------------------------------------*/
+
+   hypre_IncFLOPCount(relax_data -> flops);
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Relax the points of one color (rb) in compute_box of box box_id.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSRelaxBox( void               *relax_vdata,
+                          hypre_StructMatrix *A,
+                          hypre_StructVector *b,
+                          hypre_StructVector *x,
+                          HYPRE_Int           box_id,
+                          hypre_Box          *compute_box,
+                          HYPRE_Int           rb )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   HYPRE_Int              diag_rank   = (relax_data -> diag_rank);
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+
+   hypre_Box             *A_dbox;
+   hypre_Box             *b_dbox;
+   hypre_Box             *x_dbox;
+
+   HYPRE_Int              Astart, Ani, Anj;
+   HYPRE_Int              bstart, bni, bnj;
+   HYPRE_Int              xstart, xni, xnj;
+   HYPRE_Int              xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
+
+   HYPRE_Real            *Ap;
+   HYPRE_Real            *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
+   HYPRE_Real            *bp;
+   HYPRE_Real            *xp;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+   HYPRE_Int              offd[6];
+
+   HYPRE_Int              redblack, d, i, j;
+   HYPRE_Int              ni, nj, nk;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   /* get off-diag entry ranks ready */
+   i = 0;
+   for (j = 0; j < stencil_size; j++)
+   {
+      if (j != diag_rank)
+      {
+         offd[i] = j;
+         i++;
+      }
+   }
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), box_id);
+   b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), box_id);
+   x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), box_id);
+
+   Ap = hypre_StructMatrixBoxData(A, box_id, diag_rank);
+   bp = hypre_StructVectorBoxData(b, box_id);
+   xp = hypre_StructVectorBoxData(x, box_id);
+
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetSize(compute_box, loop_size);
+
+   /* Are we relaxing index start or start+(1,0,0)? */
+   redblack = rb;
+   for (d = 0; d < ndim; d++)
+   {
+      redblack += hypre_IndexD(start, d);
+   }
+   redblack = hypre_abs(redblack) % 2;
+
+   Astart = hypre_BoxIndexRank(A_dbox, start);
+   bstart = hypre_BoxIndexRank(b_dbox, start);
+   xstart = hypre_BoxIndexRank(x_dbox, start);
+   ni = hypre_IndexX(loop_size);
+   nj = hypre_IndexY(loop_size);
+   nk = hypre_IndexZ(loop_size);
+   Ani = hypre_BoxSizeX(A_dbox);
+   bni = hypre_BoxSizeX(b_dbox);
+   xni = hypre_BoxSizeX(x_dbox);
+   Anj = hypre_BoxSizeY(A_dbox);
+   bnj = hypre_BoxSizeY(b_dbox);
+   xnj = hypre_BoxSizeY(x_dbox);
+   if (ndim < 3)
+   {
+      nk = 1;
+      if (ndim < 2)
+      {
+         nj = 1;
+      }
+   }
+
+   switch (stencil_size)
+   {
+      case 7:
+         Ap5 = hypre_StructMatrixBoxData(A, box_id, offd[5]);
+         Ap4 = hypre_StructMatrixBoxData(A, box_id, offd[4]);
+         xoff5 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[5]]);
+         xoff4 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[4]]);
+      // fall through
+
+      case 5:
+         Ap3 = hypre_StructMatrixBoxData(A, box_id, offd[3]);
+         Ap2 = hypre_StructMatrixBoxData(A, box_id, offd[2]);
+         xoff3 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[3]]);
+         xoff2 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[2]]);
+      // fall through
+
+      case 3:
+         Ap1 = hypre_StructMatrixBoxData(A, box_id, offd[1]);
+         Ap0 = hypre_StructMatrixBoxData(A, box_id, offd[0]);
+         xoff1 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[1]]);
+         xoff0 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[0]]);
+         break;
+   }
+
+   switch (stencil_size)
+   {
+      case 7:
+         hypre_RedBlackLoopInit();
 #define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap)
-                     hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
-                                             Astart, Ani, Anj, Ai,
-                                             bstart, bni, bnj, bi,
-                                             xstart, xni, xnj, xi);
-                     {
-                        xp[xi] =
-                           (bp[bi] -
-                            Ap0[Ai] * xp[xi + xoff0] -
-                            Ap1[Ai] * xp[xi + xoff1] -
-                            Ap2[Ai] * xp[xi + xoff2] -
-                            Ap3[Ai] * xp[xi + xoff3] -
-                            Ap4[Ai] * xp[xi + xoff4] -
-                            Ap5[Ai] * xp[xi + xoff5]) / Ap[Ai];
-                     }
-                     hypre_RedBlackLoopEnd();
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1] -
+                Ap2[Ai] * xp[xi + xoff2] -
+                Ap3[Ai] * xp[xi + xoff3] -
+                Ap4[Ai] * xp[xi + xoff4] -
+                Ap5[Ai] * xp[xi + xoff5]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
 #undef DEVICE_VAR
-                     break;
+         break;
 
-                  case 5:
-                     hypre_RedBlackLoopInit();
+      case 5:
+         hypre_RedBlackLoopInit();
 #define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap)
-                     hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
-                                             Astart, Ani, Anj, Ai,
-                                             bstart, bni, bnj, bi,
-                                             xstart, xni, xnj, xi);
-                     {
-                        xp[xi] =
-                           (bp[bi] -
-                            Ap0[Ai] * xp[xi + xoff0] -
-                            Ap1[Ai] * xp[xi + xoff1] -
-                            Ap2[Ai] * xp[xi + xoff2] -
-                            Ap3[Ai] * xp[xi + xoff3]) / Ap[Ai];
-                     }
-                     hypre_RedBlackLoopEnd();
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1] -
+                Ap2[Ai] * xp[xi + xoff2] -
+                Ap3[Ai] * xp[xi + xoff3]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
 #undef DEVICE_VAR
-                     break;
+         break;
 
-                  case 3:
-                     hypre_RedBlackLoopInit();
+      case 3:
+         hypre_RedBlackLoopInit();
 #define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap)
-                     hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
-                                             Astart, Ani, Anj, Ai,
-                                             bstart, bni, bnj, bi,
-                                             xstart, xni, xnj, xi);
-                     {
-                        xp[xi] =
-                           (bp[bi] -
-                            Ap0[Ai] * xp[xi + xoff0] -
-                            Ap1[Ai] * xp[xi + xoff1]) / Ap[Ai];
-                     }
-                     hypre_RedBlackLoopEnd();
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
 #undef DEVICE_VAR
 
-                     break;
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Relax one color of compute_box for a matrix in mostly-constant storage.  The
+ * constant row of the box is used for all points of the color, then the
+ * exceptions of that color are redone with their own rows.  With zero_guess,
+ * x is taken to be zero and only b is read.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSRelaxBoxMC( void               *relax_vdata,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *b,
+                            hypre_StructVector *x,
+                            HYPRE_Int           box_id,
+                            hypre_Box          *compute_box,
+                            HYPRE_Int           rb,
+                            HYPRE_Int           zero_guess )
+{
+   hypre_RedBlackGSData  *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   HYPRE_Int              diag_rank     = (relax_data -> diag_rank);
+   HYPRE_Int              ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             *mc_starts     = hypre_StructMatrixMCStarts(A);
+   hypre_Index           *mc_indices    = hypre_StructMatrixMCIndices(A);
+
+   hypre_Box             *b_dbox;
+   hypre_Box             *x_dbox;
+
+   HYPRE_Int              bstart, bni, bnj, bi;
+   HYPRE_Int              xstart, xni, xnj, xi;
+   HYPRE_Int             *xoff;
+
+   HYPRE_Real            *cp;
+   HYPRE_Real            *ep;
+   HYPRE_Real            *bp;
+   HYPRE_Real            *xp;
+   HYPRE_Real             sum;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   hypre_Index            unit_stride;
+
+   HYPRE_Int              redblack, color, d, e, s;
+   HYPRE_Int              ii, jj, kk, ni, nj, nk;
+
+   b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), box_id);
+   x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), box_id);
+
+   cp = hypre_StructMatrixMCBoxValues(A, box_id);
+   bp = hypre_StructVectorBoxData(b, box_id);
+   xp = hypre_StructVectorBoxData(x, box_id);
+
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   for (s = 0; s < stencil_size; s++)
+   {
+      xoff[s] = hypre_BoxOffsetDistance(x_dbox, stencil_shape[s]);
+   }
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetSize(compute_box, loop_size);
+
+   /* Are we relaxing index start or start+(1,0,0)? */
+   redblack = rb;
+   for (d = 0; d < ndim; d++)
+   {
+      redblack += hypre_IndexD(start, d);
+   }
+   redblack = hypre_abs(redblack) % 2;
+
+   bstart = hypre_BoxIndexRank(b_dbox, start);
+   xstart = hypre_BoxIndexRank(x_dbox, start);
+   ni = hypre_IndexX(loop_size);
+   nj = hypre_IndexY(loop_size);
+   nk = hypre_IndexZ(loop_size);
+   bni = hypre_BoxSizeX(b_dbox);
+   xni = hypre_BoxSizeX(x_dbox);
+   bnj = hypre_BoxSizeY(b_dbox);
+   xnj = hypre_BoxSizeY(x_dbox);
+   if (ndim < 3)
+   {
+      nk = 1;
+      if (ndim < 2)
+      {
+         nj = 1;
+      }
+   }
+
+   /* the data is on the host, so this loop is never offloaded */
+   for (kk = 0; kk < nk; kk++)
+   {
+      for (jj = 0; jj < nj; jj++)
+      {
+         ii = (kk + jj + redblack) % 2;
+         bi = bstart + kk * bnj * bni + jj * bni + ii;
+         xi = xstart + kk * xnj * xni + jj * xni + ii;
+         for (; ii < ni; ii += 2, bi += 2, xi += 2)
+         {
+            sum = bp[bi];
+            if (!zero_guess)
+            {
+               for (s = 0; s < stencil_size; s++)
+               {
+                  if (s != diag_rank)
+                  {
+                     sum -= cp[s] * xp[xi + xoff[s]];
+                  }
                }
             }
+            xp[xi] = sum / cp[diag_rank];
          }
       }
+   }
+
+   /* the points of color rb are those with index sum of parity rb */
+   hypre_SetIndex(unit_stride, 1);
+   for (e = mc_starts[box_id]; e < mc_starts[box_id + 1]; e++)
+   {
+      if (!hypre_StructMatrixMCExceptionInBox(A, e, compute_box, unit_stride))
+      {
+         continue;
+      }
+      color = rb;
+      for (d = 0; d < ndim; d++)
+      {
+         color += hypre_IndexD(mc_indices[e], d);
+      }
+      if (hypre_abs(color) % 2)
+      {
+         continue;
+      }
 
-      rb = (rb + 1) % 2;
-      iter++;
+      ep  = hypre_StructMatrixMCExceptionValues(A, e);
+      bi  = hypre_BoxIndexRank(b_dbox, mc_indices[e]);
+      xi  = hypre_BoxIndexRank(x_dbox, mc_indices[e]);
+      sum = bp[bi];
+      if (!zero_guess)
+      {
+         for (s = 0; s < stencil_size; s++)
+         {
+            if (s != diag_rank)
+            {
+               sum -= ep[s] * xp[xi + xoff[s]];
+            }
+         }
+      }
+      xp[xi] = sum / ep[diag_rank];
    }
 
-   (relax_data -> num_iterations) = iter / 2;
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
 
-   /*-----------------------------------------------------------------------
-    * Return
-    *-----------------------------------------------------------------------*/
+   return hypre_error_flag;
+}
 
-   hypre_IncFLOPCount(relax_data -> flops);
-   hypre_EndTiming(relax_data -> time_index);
+/*--------------------------------------------------------------------------
+ * Do num_half_sweeps half-sweeps, starting with color rb, with one ghost
+ * exchange per temporal_block full sweeps.  See relax_tblock.c.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSTBlock( void               *relax_vdata,
+                        hypre_StructMatrix *A,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x,
+                        HYPRE_Int           rb,
+                        HYPRE_Int           num_half_sweeps )
+{
+   hypre_RedBlackGSData  *relax_data  = (hypre_RedBlackGSData *)relax_vdata;
+   void                  *tblock_data = (relax_data -> tblock_data);
+   HYPRE_Int              ndim        = hypre_StructMatrixNDim(A);
+
+   hypre_StructMatrix    *A_wide;
+   hypre_StructVector    *b_wide;
+   hypre_StructVector    *x_wide;
+   hypre_StructVector    *y_wide;
+
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *tile_box;
+
+   HYPRE_Int              max_steps, num_steps, num_tiles, tile_size;
+   HYPRE_Int              i, tile, step;
+
+   hypre_StructTBlockLoad(tblock_data, A, b, x);
+   hypre_StructTBlockGetData(tblock_data, &max_steps, &A_wide, &b_wide, &x_wide, &y_wide);
+
+   boxes    = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   tile_box = hypre_BoxCreate(ndim);
+
+   while (num_half_sweeps > 0)
+   {
+      num_steps = hypre_min(max_steps, num_half_sweeps);
+
+      hypre_StructTBlockExchange(tblock_data, x_wide);
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+
+         num_tiles = hypre_StructTBlockNumTiles(tblock_data, box, num_steps, &tile_size);
+         for (tile = 0; tile < num_tiles; tile++)
+         {
+            for (step = 0; step < num_steps; step++)
+            {
+               hypre_StructTBlockTileBox(tblock_data, box, num_steps, step,
+                                         tile, tile_size, tile_box);
+               if (hypre_BoxVolume(tile_box) > 0)
+               {
+                  hypre_RedBlackGSRelaxBox(relax_vdata, A_wide, b_wide, x_wide, i,
+                                           tile_box, (rb + step) % 2);
+               }
+            }
+         }
+      }
+
+      rb = (rb + num_steps) % 2;
+      num_half_sweeps -= num_steps;
+   }
+
+   hypre_StructCopy(x_wide, x);
+
+   hypre_BoxDestroy(tile_box);
 
    return hypre_error_flag;
 }
@@ -548,3 +860,19 @@ hypre_RedBlackGSSetStartBlack( void *relax_vdata )
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Set the number of full sweeps done per ghost exchange (temporal blocking).
+ * Values <= 1 turn it off.  Must be called before hypre_RedBlackGSSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetTemporalBlock( void      *relax_vdata,
+                                  HYPRE_Int  temporal_block )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   (relax_data -> temporal_block) = temporal_block;
+
+   return hypre_error_flag;
+}
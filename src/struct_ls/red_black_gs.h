@@ -27,6 +27,9 @@ typedef struct
 
    hypre_ComputePkg       *compute_pkg;
 
+   HYPRE_Int               temporal_block;     /* sweeps per exchange (if > 1) */
+   void                   *tblock_data;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -0,0 +1,404 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Support for temporally blocked relaxation.
+ *
+ * The relaxation routines normally exchange one ghost layer before every
+ * sweep.  In temporally blocked mode they work on private copies of A, b, and
+ * x that carry num_steps*radius ghost layers, where radius is the largest
+ * stencil offset and num_steps is the number of dependent update steps done
+ * per exchange.  After one exchange, step s (s = 0, 1, ...) is computed on the
+ * box grown by (num_steps-1-s)*radius, so the ghost zone shrinks by one
+ * radius per step and no further communication is needed.  The ghost zones of
+ * the matrix copy hold the neighbor rows (and the identity along the domain
+ * boundary, see hypre_StructMatrixAssemble), so the redundant updates there
+ * reproduce what the neighbors compute.
+ *
+ * Each box is also cut into tiles along its slowest dimension, and all steps
+ * are run on one tile before moving on to the next.  The tile of step s is
+ * shifted back by s*radius planes, so every value it reads has already been
+ * produced by step s-1 and has not yet been overwritten by step s+1.  This
+ * keeps the data of a tile in cache across the steps.
+ *
+ * Only variable coefficient, non-symmetric storage on the host is handled;
+ * hypre_StructTBlockCreate() returns NULL for anything else and the callers
+ * then fall back to the usual one-exchange-per-sweep algorithm.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/* rough per-tile working set that we try to keep in cache */
+#define hypre_TBLOCK_CACHE_BYTES (1 << 20)
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int               num_steps;  /* dependent steps per exchange */
+   HYPRE_Int               radius;     /* stencil radius */
+
+   hypre_StructMatrix     *A;          /* matrix the copy was made from */
+   hypre_StructMatrix     *A_wide;
+   hypre_StructVector     *b_wide;
+   hypre_StructVector     *x_wide;
+   hypre_StructVector     *y_wide;     /* second buffer, or NULL */
+
+   hypre_CommPkg          *comm_pkg;   /* exchange of num_steps*radius layers */
+
+} hypre_StructTBlockData;
+
+/*--------------------------------------------------------------------------
+ * Create the wide copies for num_steps dependent steps per exchange.  If
+ * num_vectors is 2, a second vector buffer is allocated (for relaxation
+ * methods that do not update in place).  Returns NULL if the matrix is not
+ * supported, or if the wide ghost layer reaches past the neighbor distance
+ * known to the grid, a periodic extent, or a local box.  The decision is made
+ * collectively so that all processes take the same communication path.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_StructTBlockCreate( hypre_StructMatrix *A,
+                          HYPRE_Int           num_steps,
+                          HYPRE_Int           num_vectors )
+{
+   hypre_StructTBlockData *tblock_data;
+
+   MPI_Comm                comm    = hypre_StructMatrixComm(A);
+   hypre_StructGrid       *grid    = hypre_StructMatrixGrid(A);
+   hypre_StructStencil    *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index            *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int               stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int               ndim = hypre_StructMatrixNDim(A);
+
+   hypre_StructMatrix     *A_wide;
+   hypre_StructVector     *b_wide;
+   hypre_StructVector     *x_wide;
+   hypre_StructVector     *y_wide = NULL;
+   hypre_CommInfo         *comm_info;
+   hypre_CommPkg          *comm_pkg;
+
+   hypre_BoxArray         *boxes = hypre_StructGridBoxes(grid);
+   hypre_IndexRef          max_distance = hypre_StructGridMaxDistance(grid);
+   hypre_IndexRef          periodic = hypre_StructGridPeriodic(grid);
+   hypre_Box              *box;
+
+   HYPRE_Int               num_ghost[2 * HYPRE_MAXDIM];
+   HYPRE_Int               radius, width, d, s, i;
+   HYPRE_Int               supported, global_supported;
+
+   if ( num_steps < 2 ||
+        hypre_StructMatrixConstantCoefficient(A) != 0 ||
+        hypre_StructMatrixSymmetric(A) ||
+        hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST )
+   {
+      return NULL;
+   }
+
+   radius = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         radius = hypre_max(radius, hypre_abs(hypre_IndexD(stencil_shape[s], d)));
+      }
+   }
+   width = num_steps * radius;
+
+   /* mostly-constant storage is decided per process */
+   supported = (radius > 0) && !hypre_StructMatrixMostlyConstant(A);
+   for (d = 0; d < ndim; d++)
+   {
+      if ( width > hypre_IndexD(max_distance, d) ||
+           (hypre_IndexD(periodic, d) > 0 && width >= hypre_IndexD(periodic, d)) )
+      {
+         supported = 0;
+      }
+   }
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_BoxSizeD(box, d) < width)
+         {
+            supported = 0;
+         }
+      }
+   }
+   hypre_MPI_Allreduce(&supported, &global_supported, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+   if (!global_supported)
+   {
+      return NULL;
+   }
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2 * ndim) ? width : 0;
+   }
+
+   A_wide = hypre_StructMatrixCreate(comm, grid, hypre_StructMatrixUserStencil(A));
+   hypre_StructMatrixSetNumGhost(A_wide, num_ghost);
+   hypre_StructMatrixInitialize(A_wide);
+
+   b_wide = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(b_wide, num_ghost);
+   hypre_StructVectorInitialize(b_wide);
+   hypre_StructVectorAssemble(b_wide);
+
+   x_wide = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(x_wide, num_ghost);
+   hypre_StructVectorInitialize(x_wide);
+   hypre_StructVectorAssemble(x_wide);
+
+   if (num_vectors > 1)
+   {
+      y_wide = hypre_StructVectorCreate(comm, grid);
+      hypre_StructVectorSetNumGhost(y_wide, num_ghost);
+      hypre_StructVectorInitialize(y_wide);
+      hypre_StructVectorAssemble(y_wide);
+   }
+
+   /* all wide vectors share a data space, so one package serves them all */
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(x_wide),
+                       hypre_StructVectorDataSpace(x_wide),
+                       1, NULL, 0, comm, &comm_pkg);
+   hypre_CommInfoDestroy(comm_info);
+
+   tblock_data = hypre_CTAlloc(hypre_StructTBlockData, 1, HYPRE_MEMORY_HOST);
+   (tblock_data -> num_steps) = num_steps;
+   (tblock_data -> radius)    = radius;
+   (tblock_data -> A)         = NULL;
+   (tblock_data -> A_wide)    = A_wide;
+   (tblock_data -> b_wide)    = b_wide;
+   (tblock_data -> x_wide)    = x_wide;
+   (tblock_data -> y_wide)    = y_wide;
+   (tblock_data -> comm_pkg)  = comm_pkg;
+
+   return (void *) tblock_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTBlockDestroy( void *tblock_vdata )
+{
+   hypre_StructTBlockData *tblock_data = (hypre_StructTBlockData *)tblock_vdata;
+
+   if (tblock_data)
+   {
+      hypre_StructMatrixDestroy(tblock_data -> A);
+      hypre_StructMatrixDestroy(tblock_data -> A_wide);
+      hypre_StructVectorDestroy(tblock_data -> b_wide);
+      hypre_StructVectorDestroy(tblock_data -> x_wide);
+      hypre_StructVectorDestroy(tblock_data -> y_wide);
+      hypre_CommPkgDestroy(tblock_data -> comm_pkg);
+      hypre_TFree(tblock_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Load A (only if it changed since the last call), b, and x into the wide
+ * copies.  The ghost layers of b are exchanged here; those of x are exchanged
+ * by hypre_StructTBlockExchange() at the start of every block of steps.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTBlockLoad( void               *tblock_vdata,
+                        hypre_StructMatrix *A,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x )
+{
+   hypre_StructTBlockData *tblock_data = (hypre_StructTBlockData *)tblock_vdata;
+   hypre_StructMatrix     *A_wide      = (tblock_data -> A_wide);
+
+   hypre_BoxArray         *boxes;
+   hypre_Box              *box;
+   hypre_Box              *A_dbox;
+   hypre_Box              *W_dbox;
+   HYPRE_Real             *Ap;
+   HYPRE_Real             *Wp;
+   hypre_IndexRef          start;
+   hypre_Index             loop_size;
+   hypre_Index             unit_stride;
+   HYPRE_Int               stencil_size;
+   HYPRE_Int               i, s;
+
+   if ((tblock_data -> A) != A)
+   {
+      if (hypre_StructMatrixGrid(A) != hypre_StructMatrixGrid(A_wide) ||
+          hypre_StructMatrixUserStencil(A) != hypre_StructMatrixUserStencil(A_wide))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix does not match the temporal blocking data");
+         return hypre_error_flag;
+      }
+
+      hypre_SetIndex(unit_stride, 1);
+      stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+      boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         start  = hypre_BoxIMin(box);
+         A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         W_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A_wide), i);
+         hypre_BoxGetSize(box, loop_size);
+
+         for (s = 0; s < stencil_size; s++)
+         {
+            Ap = hypre_StructMatrixBoxData(A, i, s);
+            Wp = hypre_StructMatrixBoxData(A_wide, i, s);
+
+#define DEVICE_VAR is_device_ptr(Wp,Ap)
+            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
+                                A_dbox, start, unit_stride, Ai,
+                                W_dbox, start, unit_stride, Wi);
+            {
+               Wp[Wi] = Ap[Ai];
+            }
+            hypre_BoxLoop2End(Ai, Wi);
+#undef DEVICE_VAR
+         }
+      }
+
+      /* fill the ghost layers */
+      hypre_StructMatrixAssemble(A_wide);
+
+      hypre_StructMatrixDestroy(tblock_data -> A);
+      (tblock_data -> A) = hypre_StructMatrixRef(A);
+   }
+
+   hypre_StructCopy(b, (tblock_data -> b_wide));
+   hypre_StructTBlockExchange(tblock_vdata, (tblock_data -> b_wide));
+   hypre_StructCopy(x, (tblock_data -> x_wide));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTBlockGetData( void                *tblock_vdata,
+                           HYPRE_Int           *num_steps_ptr,
+                           hypre_StructMatrix **A_ptr,
+                           hypre_StructVector **b_ptr,
+                           hypre_StructVector **x_ptr,
+                           hypre_StructVector **y_ptr )
+{
+   hypre_StructTBlockData *tblock_data = (hypre_StructTBlockData *)tblock_vdata;
+
+   *num_steps_ptr = (tblock_data -> num_steps);
+   *A_ptr = (tblock_data -> A_wide);
+   *b_ptr = (tblock_data -> b_wide);
+   *x_ptr = (tblock_data -> x_wide);
+   *y_ptr = (tblock_data -> y_wide);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Update all ghost layers of a wide vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTBlockExchange( void               *tblock_vdata,
+                            hypre_StructVector *v )
+{
+   hypre_StructTBlockData *tblock_data = (hypre_StructTBlockData *)tblock_vdata;
+   hypre_CommHandle       *comm_handle;
+
+   hypre_InitializeCommunication((tblock_data -> comm_pkg),
+                                 hypre_StructVectorData(v),
+                                 hypre_StructVectorData(v), 0, 0, &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Return the number of tiles needed to run num_steps steps on box, along
+ * with the tile thickness (in planes of the slowest dimension).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTBlockNumTiles( void      *tblock_vdata,
+                            hypre_Box *box,
+                            HYPRE_Int  num_steps,
+                            HYPRE_Int *tile_size_ptr )
+{
+   hypre_StructTBlockData *tblock_data = (hypre_StructTBlockData *)tblock_vdata;
+   HYPRE_Int               radius      = (tblock_data -> radius);
+   HYPRE_Int               ndim        = hypre_BoxNDim(box);
+   HYPRE_Int               halo        = (num_steps - 1) * radius;
+   HYPRE_Int               nvalues;
+   HYPRE_Int               plane_size, num_planes, tile_size;
+   HYPRE_Int               d;
+
+   /* stencil coefficients plus b and the vector buffers, per point */
+   nvalues = hypre_StructStencilSize(hypre_StructMatrixStencil(tblock_data -> A_wide)) + 3;
+
+   plane_size = 1;
+   for (d = 0; d < ndim - 1; d++)
+   {
+      plane_size *= hypre_BoxSizeD(box, d) + 2 * halo;
+   }
+   num_planes = hypre_BoxSizeD(box, ndim - 1) + 2 * halo;
+
+   tile_size = hypre_TBLOCK_CACHE_BYTES /
+               (plane_size * nvalues * (HYPRE_Int) sizeof(HYPRE_Real));
+   tile_size = hypre_max(tile_size, 2 * radius);
+   tile_size = hypre_min(tile_size, num_planes);
+   tile_size = hypre_max(tile_size, 1);
+
+   *tile_size_ptr = tile_size;
+
+   return (num_planes + tile_size - 1) / tile_size;
+}
+
+/*--------------------------------------------------------------------------
+ * Compute the region updated by step 'step' (0 <= step < num_steps) of tile
+ * 'tile'.  The result may be empty.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructTBlockTileBox( void      *tblock_vdata,
+                           hypre_Box *box,
+                           HYPRE_Int  num_steps,
+                           HYPRE_Int  step,
+                           HYPRE_Int  tile,
+                           HYPRE_Int  tile_size,
+                           hypre_Box *tile_box )
+{
+   hypre_StructTBlockData *tblock_data = (hypre_StructTBlockData *)tblock_vdata;
+   HYPRE_Int               radius      = (tblock_data -> radius);
+   HYPRE_Int               ndim        = hypre_BoxNDim(box);
+   HYPRE_Int               d           = ndim - 1;
+   HYPRE_Int               tmin, tmax;
+
+   hypre_CopyBox(box, tile_box);
+   hypre_BoxGrowByValue(tile_box, (num_steps - 1 - step) * radius);
+
+   tmin  = hypre_BoxIMinD(box, d) - (num_steps - 1) * radius;
+   tmin += tile * tile_size - step * radius;
+   tmax  = tmin + tile_size - 1;
+
+   hypre_BoxIMinD(tile_box, d) = hypre_max(hypre_BoxIMinD(tile_box, d), tmin);
+   hypre_BoxIMaxD(tile_box, d) = hypre_min(hypre_BoxIMaxD(tile_box, d), tmax);
+
+   return hypre_error_flag;
+}
@@ -29,6 +29,7 @@ hypre_SMGCreate( MPI_Comm  comm )
    (smg_data -> rel_change) = 0;
    (smg_data -> zero_guess) = 0;
    (smg_data -> max_levels) = 0;
+   (smg_data -> batched_line_solve) = 0;
    (smg_data -> num_pre_relax)  = 1;
    (smg_data -> num_post_relax) = 1;
    (smg_data -> cdir) = 2;
@@ -157,6 +158,31 @@ hypre_SMGGetMemoryUse( void *smg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGSetBatchedLineSolve( void *smg_vdata,
+                              HYPRE_Int   batched )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   (smg_data -> batched_line_solve) = batched;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SMGGetBatchedLineSolve( void *smg_vdata,
+                              HYPRE_Int * batched )
+{
+   hypre_SMGData *smg_data = (hypre_SMGData *)smg_vdata;
+
+   *batched = (smg_data -> batched_line_solve);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -28,6 +28,7 @@ typedef struct
    HYPRE_Int             rel_change;
    HYPRE_Int             zero_guess;
    HYPRE_Int             max_levels;  /* max_level <= 0 means no limit */
+   HYPRE_Int             batched_line_solve;
 
    HYPRE_Int             num_levels;
 
@@ -105,6 +105,33 @@ HYPRE_StructGridSetNumGhost( HYPRE_StructGrid grid, HYPRE_Int *num_ghost )
    return ( hypre_StructGridSetNumGhost(grid, num_ghost) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSetBoxLoopTileSize( HYPRE_Int tile_size )
+{
+   return ( hypre_BoxLoopSetTileSize(tile_size) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSetCommOverlapSize( HYPRE_Int overlap_size )
+{
+   return ( hypre_SetComputeOverlapSize(overlap_size) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructSetPersistentComm( HYPRE_Int persistent )
+{
+   return ( hypre_CommSetPersistent(persistent) );
+}
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 HYPRE_Int
 HYPRE_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_MemoryLocation data_location )
@@ -99,6 +99,41 @@ HYPRE_Int HYPRE_StructGridSetPeriodic(HYPRE_StructGrid  grid,
 HYPRE_Int HYPRE_StructGridSetNumGhost(HYPRE_StructGrid  grid,
                                       HYPRE_Int        *num_ghost);
 
+/**
+ * Set the number of loop points per tile used by the threaded host box loops.
+ * The loops cut each box into tiles of about \e tile_size points, keeping the
+ * unit-stride dimension as long as possible, and distribute the tiles to the
+ * threads dynamically.  A value of 0 gives one slab per thread along the
+ * slowest dimension.  The default is 8192.
+ *
+ * @note This only has an effect when hypre is configured with box-loop tiling
+ * (HYPRE_ENABLE_BOXLOOP_TILING in CMake, or --enable-boxloop-tiling).
+ **/
+HYPRE_Int HYPRE_StructSetBoxLoopTileSize(HYPRE_Int tile_size);
+
+/**
+ * Overlap the ghost-layer exchange with computation in matrix-vector products
+ * and relaxation.  The interior points, which do not depend on ghost values,
+ * are computed in chunks of about \e overlap_size points while the exchange is
+ * in flight, and MPI progress is tested between chunks.  The points along the
+ * box borders are computed after the exchange completes.  A value of 0 turns
+ * the overlap off.  This only affects objects set up after the call.  The
+ * default is 0.
+ **/
+HYPRE_Int HYPRE_StructSetCommOverlapSize(HYPRE_Int overlap_size);
+
+/**
+ * Use persistent communication for the ghost exchanges of objects set up
+ * after this call.  After the first exchange of a communication package,
+ * later exchanges reuse fixed message buffers and persistent MPI requests,
+ * and pack and unpack the buffers with precomputed index lists instead of
+ * recomputing the box loops.  This saves setup work in solvers that repeat the
+ * same exchanges many times (e.g., in each V-cycle), at the cost of keeping
+ * the buffers allocated.  It only applies to host memory.  The default is 0
+ * (off).
+ **/
+HYPRE_Int HYPRE_StructSetPersistentComm(HYPRE_Int persistent);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -501,10 +501,25 @@ typedef struct hypre_BoxManEntry_struct
 
    void *boxman; /* The owning manager (populated in addentry) */
 
-   struct hypre_BoxManEntry_struct  *next;
-
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * BoxManNode: a node of the bounding volume hierarchy that organizes the
+ * entries spatially.  Extents are given in cells of the indexes arrays.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int cmin[HYPRE_MAXDIM]; /* Cell extents of the entries below */
+   HYPRE_Int cmax[HYPRE_MAXDIM];
+
+   HYPRE_Int child; /* Position of the first of two children (the second one
+                       follows it), or -1 for a leaf */
+   HYPRE_Int first; /* Range of the entries below in the node_items array */
+   HYPRE_Int num;
+
+} hypre_BoxManNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -561,18 +576,25 @@ typedef struct
    HYPRE_Int          local_proc_offset; /* Position of local information in
                                             offsets */
 
-   /* Here is the table  that organizes the entries spatially (by index) */
-   hypre_BoxManEntry **index_table; /* This points into 'entries' array and
-                                       corresponds to the index arays */
-
+   /* Here is the hierarchy that organizes the entries spatially (by index) */
    HYPRE_Int          *indexes[HYPRE_MAXDIM]; /* Indexes (ordered) for imin and
                                                  imax of each box in the entries
                                                  array */
-   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many indexes in each
-                                              direction */
-
-   HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
-                                                    indexes map */
+   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many cells (intervals between
+                                              indexes) in each direction */
+
+   HYPRE_Int          *cells; /* Cell extents of each entry: 2*ndim values per
+                                 entry (cell imin then cell imax) */
+   HYPRE_Int           num_nodes; /* Number of nodes in the hierarchy */
+   hypre_BoxManNode   *nodes; /* The hierarchy - node 0 is the root */
+   HYPRE_Int          *node_items; /* Entry positions, ordered by leaf */
+
+   /* Incremental updates of an assembled manager */
+   HYPRE_Int           num_adds; /* Entries added since the last assemble (these
+                                    are stored after the nentries entries) */
+   HYPRE_Int           num_deletes; /* Entries to be deleted */
+   HYPRE_Int           max_deletes;
+   HYPRE_Int          *deletes; /* Positions of the entries to be deleted */
 
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
@@ -625,10 +647,17 @@ typedef struct
 
 #define hypre_BoxManFirstLocal(manager)         ((manager) -> first_local)
 
-#define hypre_BoxManIndexTable(manager)         ((manager) -> index_table)
 #define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
 #define hypre_BoxManSize(manager)               ((manager) -> size)
-#define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManCells(manager)              ((manager) -> cells)
+#define hypre_BoxManNumNodes(manager)           ((manager) -> num_nodes)
+#define hypre_BoxManNodes(manager)              ((manager) -> nodes)
+#define hypre_BoxManNodeItems(manager)          ((manager) -> node_items)
+
+#define hypre_BoxManNumAdds(manager)            ((manager) -> num_adds)
+#define hypre_BoxManNumDeletes(manager)         ((manager) -> num_deletes)
+#define hypre_BoxManMaxDeletes(manager)         ((manager) -> max_deletes)
+#define hypre_BoxManDeletes(manager)            ((manager) -> deletes)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -643,10 +672,9 @@ typedef struct
 
 #define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
 #define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
-#define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
 
 #define hypre_BoxManInfoObject(manager, i) \
-(void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
+(void *) ((char *)hypre_BoxManInfoObjects(manager) + (i) * hypre_BoxManEntryInfoSize(manager))
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_BoxManEntry
@@ -659,7 +687,6 @@ typedef struct
 #define hypre_BoxManEntryId(entry)       ((entry) -> id)
 #define hypre_BoxManEntryPosition(entry) ((entry) -> position)
 #define hypre_BoxManEntryNumGhost(entry) ((entry) -> num_ghost)
-#define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
 #endif
@@ -921,6 +948,19 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+   /* persistent communication (set up after the first communication) */
+   HYPRE_Int            persistent;
+   HYPRE_Int            persistent_tag;
+   HYPRE_Int            persistent_busy;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex       *persistent_send_buffer;
+   HYPRE_Complex       *persistent_recv_buffer;
+   /* send_data offsets (-1 = zero) for each send buffer value */
+   HYPRE_Int           *send_indices;
+   /* recv_data offsets for each recv buffer value */
+   HYPRE_Int           *recv_indices;
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -946,6 +986,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* uses the persistent requests and buffers of comm_pkg? */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1039,6 +1082,16 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentBusy(comm_pkg)             (comm_pkg -> persistent_busy)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffer(comm_pkg)       (comm_pkg -> persistent_send_buffer)
+#define hypre_CommPkgPersistentRecvBuffer(comm_pkg)       (comm_pkg -> persistent_recv_buffer)
+#define hypre_CommPkgSendIndices(comm_pkg)                (comm_pkg -> send_indices)
+#define hypre_CommPkgRecvIndices(comm_pkg)                (comm_pkg -> recv_indices)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1054,6 +1107,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
 /******************************************************************************
@@ -1177,6 +1231,17 @@ typedef struct hypre_StructMatrix_struct
                                                        or 2 for constant coefficient
                                                        with variable diagonal */
 
+   HYPRE_Int             mostly_constant;           /* Boolean: data is stored as one
+                                                       constant stencil row per box
+                                                       plus a table of exceptions */
+   HYPRE_Complex        *mc_values;                 /* num-boxes by stencil-size array
+                                                       of constant stencil rows */
+   HYPRE_Int            *mc_starts;                 /* Exceptions of box b are numbered
+                                                       mc_starts[b] to mc_starts[b+1]-1 */
+   hypre_Index          *mc_indices;                /* Grid index of each exception */
+   HYPRE_Complex        *mc_exceptions;             /* num-exceptions by stencil-size
+                                                       array of stencil rows */
+
    HYPRE_Int             symmetric;                 /* Is the matrix symmetric */
    HYPRE_Int            *symm_elements;             /* Which elements are "symmetric" */
    HYPRE_Int             num_ghost[2 * HYPRE_MAXDIM]; /* Num ghost layers in each direction */
@@ -1208,6 +1273,11 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixDataConstSize(matrix)       ((matrix) -> data_const_size)
 #define hypre_StructMatrixDataIndices(matrix)         ((matrix) -> data_indices)
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
+#define hypre_StructMatrixMostlyConstant(matrix)      ((matrix) -> mostly_constant)
+#define hypre_StructMatrixMCValues(matrix)            ((matrix) -> mc_values)
+#define hypre_StructMatrixMCStarts(matrix)            ((matrix) -> mc_starts)
+#define hypre_StructMatrixMCIndices(matrix)           ((matrix) -> mc_indices)
+#define hypre_StructMatrixMCExceptions(matrix)        ((matrix) -> mc_exceptions)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
@@ -1228,6 +1298,14 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_BoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+#define hypre_StructMatrixMCBoxValues(matrix, b) \
+(hypre_StructMatrixMCValues(matrix) + \
+ (b) * hypre_StructStencilSize(hypre_StructMatrixStencil(matrix)))
+
+#define hypre_StructMatrixMCExceptionValues(matrix, e) \
+(hypre_StructMatrixMCExceptions(matrix) + \
+ (e) * hypre_StructStencilSize(hypre_StructMatrixStencil(matrix)))
+
 #define hypre_CCStructMatrixBoxDataValue(matrix, b, s, index) \
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
@@ -1410,6 +1488,8 @@ HYPRE_Int hypre_AppendBoxArray ( hypre_BoxArray *box_array_0, hypre_BoxArray *bo
 hypre_BoxArrayArray *hypre_BoxArrayArrayCreate ( HYPRE_Int size, HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayArrayDestroy ( hypre_BoxArrayArray *box_array_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayDuplicate ( hypre_BoxArrayArray *box_array_array );
+HYPRE_Int hypre_BoxLoopSetTileSize ( HYPRE_Int tile_size );
+HYPRE_Int hypre_BoxLoopGetTileSize ( void );
 
 /* box_manager.c */
 HYPRE_Int hypre_BoxManEntryGetInfo ( hypre_BoxManEntry *entry, void **info_ptr );
@@ -1449,6 +1529,8 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManDeleteEntry ( hypre_BoxManager *manager, HYPRE_Int proc, HYPRE_Int id );
+HYPRE_Int hypre_BoxManAssembleIncremental ( hypre_BoxManager *manager );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -1487,6 +1569,8 @@ HYPRE_Int hypre_ComputeInfoProjectRecv ( hypre_ComputeInfo *compute_info, hypre_
 HYPRE_Int hypre_ComputeInfoProjectComp ( hypre_ComputeInfo *compute_info, hypre_Index index,
                                          hypre_Index stride );
 HYPRE_Int hypre_ComputeInfoDestroy ( hypre_ComputeInfo *compute_info );
+HYPRE_Int hypre_SetComputeOverlapSize ( HYPRE_Int overlap_size );
+HYPRE_Int hypre_GetComputeOverlapSize ( void );
 HYPRE_Int hypre_CreateComputeInfo ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                     hypre_ComputeInfo **compute_info_ptr );
 HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArray *data_space,
@@ -1495,6 +1579,7 @@ HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
 HYPRE_Int hypre_InitializeIndtComputations ( hypre_ComputePkg *compute_pkg, HYPRE_Complex *data,
                                              hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeIndtComputations ( hypre_CommHandle *comm_handle );
+HYPRE_Int hypre_ProgressIndtComputations ( hypre_CommHandle *comm_handle );
 
 /* HYPRE_struct_grid.c */
 HYPRE_Int HYPRE_StructGridCreate ( MPI_Comm comm, HYPRE_Int dim, HYPRE_StructGrid *grid );
@@ -1504,6 +1589,9 @@ HYPRE_Int HYPRE_StructGridSetExtents ( HYPRE_StructGrid grid, HYPRE_Int *ilower,
 HYPRE_Int HYPRE_StructGridSetPeriodic ( HYPRE_StructGrid grid, HYPRE_Int *periodic );
 HYPRE_Int HYPRE_StructGridAssemble ( HYPRE_StructGrid grid );
 HYPRE_Int HYPRE_StructGridSetNumGhost ( HYPRE_StructGrid grid, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_StructSetBoxLoopTileSize ( HYPRE_Int tile_size );
+HYPRE_Int HYPRE_StructSetCommOverlapSize ( HYPRE_Int overlap_size );
+HYPRE_Int HYPRE_StructSetPersistentComm ( HYPRE_Int persistent );
 
 /* HYPRE_struct_matrix.c */
 HYPRE_Int HYPRE_StructMatrixCreate ( MPI_Comm comm, HYPRE_StructGrid grid,
@@ -1592,6 +1680,8 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_communication.c */
+HYPRE_Int hypre_CommSetPersistent ( HYPRE_Int persistent );
+HYPRE_Int hypre_CommGetPersistent ( void );
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
                                 hypre_BoxArray *recv_data_space, HYPRE_Int num_values, HYPRE_Int **orders, HYPRE_Int reverse,
                                 MPI_Comm comm, hypre_CommPkg **comm_pkg_ptr );
@@ -1601,6 +1691,11 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
+HYPRE_Int hypre_InitializePersistentCommunication ( hypre_CommPkg *comm_pkg,
+                                                    HYPRE_Complex *send_data, HYPRE_Complex *recv_data, HYPRE_Int action,
+                                                    hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_FinalizePersistentCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -1694,6 +1789,9 @@ hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
                                       hypre_StructMatrix *to_matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
+HYPRE_Int hypre_StructMatrixCompressMostlyConstant ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixMCExceptionInBox ( hypre_StructMatrix *matrix, HYPRE_Int e,
+                                               hypre_Box *box, hypre_IndexRef stride );
 
 /* struct_matrix_mask.c */
 hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix,
@@ -1705,6 +1803,11 @@ HYPRE_Int hypre_StructMatvecSetup ( void *matvec_vdata, hypre_StructMatrix *A,
                                     hypre_StructVector *x );
 HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
+HYPRE_Int hypre_StructMatvecFusedSupported ( hypre_StructMatrix *A, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFused ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                    hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMC ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                 hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
@@ -2370,6 +2473,8 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #define OMP1
 #endif /* #if defined(HYPRE_USING_OPENMP) */
 
+#if !defined(HYPRE_USING_BOXLOOP_TILING)
+
 #define zypre_BoxLoop0Begin(ndim, loop_size)                                  \
 {                                                                             \
    zypre_BoxLoopDeclare();                                                    \
@@ -2585,6 +2690,281 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
          {
 
+#else /* #if !defined(HYPRE_USING_BOXLOOP_TILING) */
+
+/*--------------------------------------------------------------------------
+ * Tiled BoxLoop macros:
+ *
+ * The loop space is cut into tiles of about hypre_BoxLoopGetTileSize()
+ * points, keeping the unit-stride dimension as long as possible, and the
+ * tiles are handed out to the threads with dynamic scheduling.  A tile size
+ * of 0 gives one slab per thread along the slowest dimension.  Loop bodies
+ * see the same indices (and hypre_BoxLoopGetIndex values) as in the untiled
+ * loops, only the iteration order changes.  These assume HYPRE_MAXDIM = 3.
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_OPENMP)
+#define OMPT Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION schedule(dynamic))
+#else
+#define OMPT
+#endif
+
+#define zypre_TileLoopDeclare() \
+HYPRE_Int  hypre__tvol;\
+HYPRE_Int  hypre__tm[HYPRE_MAXDIM], hypre__ts[HYPRE_MAXDIM], hypre__tn[HYPRE_MAXDIM]
+
+/* set the loop extents (hypre__tm), tile extents (hypre__ts) and number of
+ * tiles (hypre__tn) in each dimension, and the total number of tiles */
+#define zypre_TileLoopInit() \
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__tm[hypre__d] = (hypre__d < hypre__ndim) ? hypre__n[hypre__d] : 1;\
+   hypre__ts[hypre__d] = hypre_max(hypre__tm[hypre__d], 1);\
+}\
+hypre__tvol = hypre_BoxLoopGetTileSize();\
+if (hypre__tvol > 0)\
+{\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__ts[hypre__d] = hypre_min(hypre__ts[hypre__d], hypre__tvol);\
+      hypre__tvol = hypre_max(hypre__tvol / hypre__ts[hypre__d], 1);\
+   }\
+}\
+else\
+{\
+   hypre__d = hypre__ndim - 1;\
+   hypre__ts[hypre__d] = (hypre__ts[hypre__d] + hypre_NumThreads() - 1) / hypre_NumThreads();\
+}\
+hypre__num_blocks = 1;\
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__tn[hypre__d] = (hypre__tm[hypre__d] + hypre__ts[hypre__d] - 1) / hypre__ts[hypre__d];\
+   hypre__num_blocks *= hypre__tn[hypre__d];\
+}
+
+/* set the loop bounds hypre__lo/hypre__hi of tile hypre__block */
+#define zypre_TileLoopSet() \
+HYPRE_Int  hypre__lo[HYPRE_MAXDIM], hypre__hi[HYPRE_MAXDIM];\
+hypre__J = hypre__block;\
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__lo[hypre__d] = (hypre__J % hypre__tn[hypre__d]) * hypre__ts[hypre__d];\
+   hypre__hi[hypre__d] = hypre_min(hypre__lo[hypre__d] + hypre__ts[hypre__d], hypre__tm[hypre__d]);\
+   hypre__J /= hypre__tn[hypre__d];\
+}
+
+/* set ik to the start of the current row of the tile */
+#define zypre_TileLoopSetK(k, ik) \
+ik = hypre__ikstart##k + hypre__lo[0]*hypre__sk##k[0];\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   ik += hypre__i[hypre__d]*hypre__sk##k[hypre__d];\
+}
+
+#define zypre_TileLoopRowsBegin()                                             \
+      for (hypre__i[2] = hypre__lo[2]; hypre__i[2] < hypre__hi[2]; hypre__i[2]++) \
+      {                                                                       \
+         for (hypre__i[1] = hypre__lo[1]; hypre__i[1] < hypre__hi[1]; hypre__i[1]++) \
+         {
+
+#define zypre_TileLoopRowsEnd()                                               \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_BoxLoop0Begin(ndim, loop_size)                                  \
+{                                                                             \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop0End()                                                   \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop1Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1)                       \
+{                                                                             \
+   HYPRE_Int i1;                                                              \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1;                                                           \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop1End(i1)                                                 \
+               i1 += hypre__i0inc1;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop2Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1,                       \
+                            dbox2, start2, stride2, i2)                       \
+{                                                                             \
+   HYPRE_Int i1, i2;                                                          \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop2End(i1, i2)                                             \
+               i1 += hypre__i0inc1;                                           \
+               i2 += hypre__i0inc2;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop3Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1,                       \
+                            dbox2, start2, stride2, i2,                       \
+                            dbox3, start3, stride3, i3)                       \
+{                                                                             \
+   HYPRE_Int i1, i2, i3;                                                      \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopDeclareK(3);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3;                                                   \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            zypre_TileLoopSetK(3, i3);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop3End(i1, i2, i3)                                         \
+               i1 += hypre__i0inc1;                                           \
+               i2 += hypre__i0inc2;                                           \
+               i3 += hypre__i0inc3;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop4Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1,                       \
+                            dbox2, start2, stride2, i2,                       \
+                            dbox3, start3, stride3, i3,                       \
+                            dbox4, start4, stride4, i4)                       \
+{                                                                             \
+   HYPRE_Int i1, i2, i3, i4;                                                  \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopDeclareK(3);                                                  \
+   zypre_BoxLoopDeclareK(4);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
+   zypre_BoxLoopInitK(4, dbox4, start4, stride4, i4);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3, i4;                                               \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            zypre_TileLoopSetK(3, i3);                                        \
+            zypre_TileLoopSetK(4, i4);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop4End(i1, i2, i3, i4)                                     \
+               i1 += hypre__i0inc1;                                           \
+               i2 += hypre__i0inc2;                                           \
+               i3 += hypre__i0inc3;                                           \
+               i4 += hypre__i0inc4;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BasicBoxLoop1Begin(ndim, loop_size,                             \
+                                 stride1, i1)                                 \
+{                                                                             \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BasicBoxLoopInitK(1, stride1);                                       \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1;                                                           \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BasicBoxLoop2Begin(ndim, loop_size,                             \
+                                 stride1, i1,                                 \
+                                 stride2, i2)                                 \
+{                                                                             \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BasicBoxLoopInitK(1, stride1);                                       \
+   zypre_BasicBoxLoopInitK(2, stride2);                                       \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#endif /* #if !defined(HYPRE_USING_BOXLOOP_TILING) */
+
 
 #define zypre_LoopBegin(size, idx)                                            \
 {                                                                             \
@@ -2641,7 +3021,15 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
          {
 
-#define hypre_SerialBoxLoop1End(i1)  zypre_BoxLoop1End(i1)
+#define hypre_SerialBoxLoop1End(i1)                                           \
+            i1 += hypre__i0inc1;                                              \
+         }                                                                    \
+         zypre_BoxLoopInc1();                                                 \
+         i1 += hypre__ikinc1[hypre__d];                                       \
+         zypre_BoxLoopInc2();                                                 \
+      }                                                                       \
+   }                                                                          \
+}
 
 #define hypre_SerialBoxLoop2Begin(ndim, loop_size,                            \
                                   dbox1, start1, stride1, i1,                 \
@@ -2665,7 +3053,17 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
          {
 
-#define hypre_SerialBoxLoop2End(i1, i2) zypre_BoxLoop2End(i1, i2)
+#define hypre_SerialBoxLoop2End(i1, i2)                                       \
+            i1 += hypre__i0inc1;                                              \
+            i2 += hypre__i0inc2;                                              \
+         }                                                                    \
+         zypre_BoxLoopInc1();                                                 \
+         i1 += hypre__ikinc1[hypre__d];                                       \
+         i2 += hypre__ikinc2[hypre__d];                                       \
+         zypre_BoxLoopInc2();                                                 \
+      }                                                                       \
+   }                                                                          \
+}
 
 /* Reduction BoxLoop1 */
 #define zypre_BoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
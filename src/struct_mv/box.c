@@ -988,3 +988,36 @@ hypre_BoxArrayArrayDuplicate( hypre_BoxArrayArray *box_array_array )
 
    return new_box_array_array;
 }
+
+/*==========================================================================
+ * BoxLoop settings
+ *==========================================================================*/
+
+/*--------------------------------------------------------------------------
+ * Set the number of loop points per tile used by the host BoxLoops when
+ * hypre is configured with tiling (HYPRE_USING_BOXLOOP_TILING).  A value of
+ * 0 turns tiling off and gives one slab per thread.  Has no effect otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxLoopSetTileSize( HYPRE_Int tile_size )
+{
+   if (tile_size < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleBoxLoopTileSize(hypre_handle()) = tile_size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxLoopGetTileSize( void )
+{
+   return hypre_HandleBoxLoopTileSize(hypre_handle());
+}
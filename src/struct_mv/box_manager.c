@@ -56,6 +56,12 @@ misc. notes/considerations/open questions:
 
 #include "_hypre_struct_mv.h"
 
+/* Maximum number of entries in a leaf of the bounding volume hierarchy */
+#define HYPRE_BOXMAN_LEAF_SIZE  4
+/* Traversal stack size (the hierarchy is balanced, so its depth is at most
+   log2 of the number of entries plus one) */
+#define HYPRE_BOXMAN_STACK_SIZE 64
+
 /******************************************************************************
  * Some specialized sorting routines used only in this file
  *****************************************************************************/
@@ -208,9 +214,6 @@ hypre_BoxManEntryCopy( hypre_BoxManEntry *fromentry,
 
    /* position - we don't copy this! */
 
-   /* copy list pointer */
-   hypre_BoxManEntryNext(toentry) =  hypre_BoxManEntryNext(fromentry);
-
    return hypre_error_flag;
 }
 
@@ -456,7 +459,15 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManInfoObjects(manager) = NULL;
    hypre_BoxManInfoObjects(manager) = hypre_TAlloc(char, max_nentries * info_size, HYPRE_MEMORY_HOST);
 
-   hypre_BoxManIndexTable(manager) = NULL;
+   hypre_BoxManCells(manager)     = NULL;
+   hypre_BoxManNumNodes(manager)  = 0;
+   hypre_BoxManNodes(manager)     = NULL;
+   hypre_BoxManNodeItems(manager) = NULL;
+
+   hypre_BoxManNumAdds(manager)    = 0;
+   hypre_BoxManNumDeletes(manager) = 0;
+   hypre_BoxManMaxDeletes(manager) = 0;
+   hypre_BoxManDeletes(manager)    = NULL;
 
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -575,7 +586,10 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
 
       hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
 
-      hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManCells(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManNodeItems(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManDeletes(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -616,6 +630,11 @@ hypre_BoxManDestroy( hypre_BoxManager *manager )
  * (5) If the id passed in is negative (user doesn't care what it is) ,
  * then use the next_id stored in the box manager to assign the id
  *
+ * (6) On an assembled manager, the entry is held back (and is not visible to
+ * the query routines) until hypre_BoxManAssembleIncremental is called.  The
+ * entries array may still be reallocated to make room for it, so entry
+ * pointers obtained before the call are invalidated.
+ *
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -630,6 +649,7 @@ hypre_BoxManAddEntry( hypre_BoxManager *manager,
    HYPRE_Int           nentries = hypre_BoxManNEntries(manager);
    HYPRE_Int           info_size = hypre_BoxManEntryInfoSize(manager);
    HYPRE_Int           ndim = hypre_BoxManNDim(manager);
+   HYPRE_Int           is_assembled = hypre_BoxManIsAssembled(manager);
 
    hypre_BoxManEntry  *entries  = hypre_BoxManEntries(manager);
    hypre_BoxManEntry  *entry;
@@ -645,11 +665,10 @@ hypre_BoxManAddEntry( hypre_BoxManager *manager,
 
    hypre_Box           *box;
 
-   /* can only use before assembling */
-   if (hypre_BoxManIsAssembled(manager))
+   /* after assembling, new entries are placed behind the pending ones */
+   if (is_assembled)
    {
-      hypre_error_in_arg(1);
-      return hypre_error_flag;
+      nentries += hypre_BoxManNumAdds(manager);
    }
 
    /* check to see if we have a non-zero box volume (only add if non-zero) */
@@ -724,7 +743,6 @@ hypre_BoxManAddEntry( hypre_BoxManager *manager,
       {
          hypre_BoxManEntryNumGhost(entry)[d] = num_ghost[d];
       }
-      hypre_BoxManEntryNext(entry) = NULL;
 
       /* add proc and id to procs_sort and ids_sort array */
       hypre_BoxManProcsSort(manager)[nentries] = proc_id;
@@ -734,7 +752,7 @@ hypre_BoxManAddEntry( hypre_BoxManager *manager,
          speed at the beginning of the assemble - then this gets deleted when
          the entries are sorted. */
 
-      if (proc_id == myid)
+      if (proc_id == myid && !is_assembled)
       {
          HYPRE_Int *my_ids =   hypre_BoxManMyIds(manager);
          hypre_BoxManEntry **my_entries = hypre_BoxManMyEntries(manager);
@@ -748,7 +766,14 @@ hypre_BoxManAddEntry( hypre_BoxManager *manager,
       }
 
       /* increment number of entries */
-      hypre_BoxManNEntries(manager) = nentries + 1;
+      if (is_assembled)
+      {
+         hypre_BoxManNumAdds(manager) ++;
+      }
+      else
+      {
+         hypre_BoxManNEntries(manager) = nentries + 1;
+      }
 
    } /* end of  vol > 0 */
 
@@ -816,17 +841,26 @@ hypre_BoxManGetEntry( hypre_BoxManager *manager,
          }
       }
 
-      else /* otherwise find proc (TO DO: just have procs_sort not contain
-              duplicates - then we could do a regular binary search (though this
-              list is probably short)- this has to be changed in assemble, then
-              also memory management in addentry - but currently this is not
-              necessary because proc = myid for all current hypre calls) */
+      else /* otherwise do a binary search for proc over the first entry of
+              each distinct proc in procs_sort */
       {
+         HYPRE_Int  low  = 0;
+         HYPRE_Int  high = num_proc - 1;
+
          start = -1;
-         for (i = 0; i < num_proc; i++)
+         while (low <= high)
          {
+            i = (low + high) / 2;
             offset = proc_offsets[i];
-            if (proc == procs_sort[offset])
+            if (proc < procs_sort[offset])
+            {
+               high = i - 1;
+            }
+            else if (proc > procs_sort[offset])
+            {
+               low = i + 1;
+            }
+            else
             {
                start = offset;
                finish = proc_offsets[i + 1];
@@ -1082,6 +1116,390 @@ hypre_BoxManGatherEntries(hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Stable (bottom-up merge) sort of the n values in items by the tuples
+ * keys[item*nkeys + k], k = 0, ..., nkeys-1, compared lexicographically.  The
+ * work array must have room for n values.  Merge sort is used here because
+ * many boxes share the same extents, which makes hypre_qsort* quadratic.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManCompareKeys( HYPRE_Int *keys,
+                         HYPRE_Int  nkeys,
+                         HYPRE_Int  a,
+                         HYPRE_Int  b )
+{
+   HYPRE_Int k;
+
+   for (k = 0; k < nkeys; k++)
+   {
+      if (keys[a * nkeys + k] != keys[b * nkeys + k])
+      {
+         return (keys[a * nkeys + k] < keys[b * nkeys + k]) ? -1 : 1;
+      }
+   }
+
+   return 0;
+}
+
+static void
+hypre_BoxManSortItems( HYPRE_Int *items,
+                       HYPRE_Int *work,
+                       HYPRE_Int  n,
+                       HYPRE_Int *keys,
+                       HYPRE_Int  nkeys )
+{
+   HYPRE_Int *src = items;
+   HYPRE_Int *dst = work;
+   HYPRE_Int *tmp;
+   HYPRE_Int  width, lo, mid, hi, i, j, k;
+
+   for (width = 1; width < n; width *= 2)
+   {
+      for (lo = 0; lo < n; lo += 2 * width)
+      {
+         mid = hypre_min(lo + width, n);
+         hi  = hypre_min(lo + 2 * width, n);
+         i = lo;
+         j = mid;
+         for (k = lo; k < hi; k++)
+         {
+            if (i < mid &&
+                (j >= hi || hypre_BoxManCompareKeys(keys, nkeys, src[i], src[j]) <= 0))
+            {
+               dst[k] = src[i++];
+            }
+            else
+            {
+               dst[k] = src[j++];
+            }
+         }
+      }
+      tmp = src;
+      src = dst;
+      dst = tmp;
+   }
+
+   if (src != items)
+   {
+      hypre_TMemcpy(items, src, HYPRE_Int, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Sort the entries (and info objects) by (proc, id) and remove duplicates.
+ * The sort is stable, so the first of a set of duplicate entries is kept.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManSortEntries( hypre_BoxManager *manager )
+{
+   HYPRE_Int           nentries   = hypre_BoxManNEntries(manager);
+   hypre_BoxManEntry  *entries    = hypre_BoxManEntries(manager);
+   HYPRE_Int          *procs_sort = hypre_BoxManProcsSort(manager);
+   HYPRE_Int          *ids_sort   = hypre_BoxManIdsSort(manager);
+   HYPRE_Int           info_size  = hypre_BoxManEntryInfoSize(manager);
+
+   HYPRE_Int          *order_index, *keys, *work;
+   HYPRE_Int           i, k, size, position;
+   hypre_BoxManEntry  *new_entries;
+   void               *new_info, *index_ptr, *info;
+
+   order_index = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   work        = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   keys        = hypre_TAlloc(HYPRE_Int, 2 * nentries, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < nentries; i++)
+   {
+      order_index[i]  = i;
+      keys[2 * i]     = procs_sort[i];
+      keys[2 * i + 1] = ids_sort[i];
+   }
+   hypre_BoxManSortItems(order_index, work, nentries, keys, 2);
+
+   /* purge duplicate (proc, id) pairs while filling procs_sort and ids_sort */
+   size = 0;
+   for (i = 0; i < nentries; i++)
+   {
+      k = order_index[i];
+      if (size == 0 ||
+          keys[2 * k] != procs_sort[size - 1] || keys[2 * k + 1] != ids_sort[size - 1])
+      {
+         procs_sort[size]  = keys[2 * k];
+         ids_sort[size]    = keys[2 * k + 1];
+         order_index[size] = k;
+         size++;
+      }
+   }
+
+   /* create new sorted entries and info arrays - delete old ones */
+   new_entries = hypre_CTAlloc(hypre_BoxManEntry,  size, HYPRE_MEMORY_HOST);
+   new_info = hypre_TAlloc(char, size * info_size, HYPRE_MEMORY_HOST);
+   index_ptr = new_info;
+
+   for (i = 0; i < size; i++)
+   {
+      /* copy the entry */
+      hypre_BoxManEntryCopy(&entries[order_index[i]], &new_entries[i]);
+
+      /* set the new position */
+      hypre_BoxManEntryPosition(&new_entries[i]) = i;
+
+      /* copy the info object */
+      position = hypre_BoxManEntryPosition(&entries[order_index[i]]);
+      info = hypre_BoxManInfoObject(manager, position);
+
+      hypre_TMemcpy(index_ptr,  info, char,  info_size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      index_ptr =  (void *) ((char *) index_ptr + info_size);
+   }
+   hypre_TFree(entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
+
+   hypre_BoxManEntries(manager) = new_entries;
+   hypre_BoxManMaxNEntries(manager) = size;
+   hypre_BoxManNEntries(manager) = size;
+   hypre_BoxManInfoObjects(manager) = new_info;
+
+   hypre_TFree(order_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Create proc_offsets for the sorted entries (local_proc_offset corresponds to
+ * the local id position, and first_local is the position in entries).  These
+ * are negative if a proc does not have any local entries in the manager.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManSetProcOffsets( hypre_BoxManager *manager )
+{
+   HYPRE_Int   nentries   = hypre_BoxManNEntries(manager);
+   HYPRE_Int  *procs_sort = hypre_BoxManProcsSort(manager);
+   HYPRE_Int  *proc_offsets;
+   HYPRE_Int   num_procs_sort, first_local, myoffset;
+   HYPRE_Int   myid, i, j;
+
+   hypre_MPI_Comm_rank(hypre_BoxManComm(manager), &myid);
+
+   num_procs_sort = 0;
+   for (i = 0; i < nentries; i++)
+   {
+      if (i == 0 || procs_sort[i] != procs_sort[i - 1])
+      {
+         num_procs_sort++;
+      }
+   }
+
+   first_local = -1;
+   myoffset = -1;
+   proc_offsets = hypre_CTAlloc(HYPRE_Int,  num_procs_sort + 1, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (i = 0; i < nentries; i++)
+   {
+      if (i == 0 || procs_sort[i] != procs_sort[i - 1])
+      {
+         if (myid == procs_sort[i])
+         {
+            myoffset = j;
+            first_local = i;
+         }
+         proc_offsets[j++] = i;
+      }
+   }
+   proc_offsets[j] = nentries; /* last one */
+
+   hypre_TFree(hypre_BoxManProcsSortOffsets(manager), HYPRE_MEMORY_HOST);
+   hypre_BoxManNumProcsSort(manager) = num_procs_sort;
+   hypre_BoxManProcsSortOffsets(manager) = proc_offsets;
+   hypre_BoxManFirstLocal(manager) = first_local;
+   hypre_BoxManLocalProcOffset(manager) = myoffset;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Build the node (and recursively its children) of the bounding volume
+ * hierarchy that holds the entries node_items[first], ..., [first+num-1].
+ * Nodes are split at the median of the cell centroids along the direction in
+ * which these vary the most.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoxManBuildNode( HYPRE_Int          ndim,
+                       HYPRE_Int         *cells,
+                       HYPRE_Int         *node_items,
+                       HYPRE_Int         *keys,
+                       HYPRE_Int         *work,
+                       hypre_BoxManNode  *nodes,
+                       HYPRE_Int         *num_nodes_ptr,
+                       HYPRE_Int          node,
+                       HYPRE_Int          first,
+                       HYPRE_Int          num )
+{
+   hypre_BoxManNode *nodep = &nodes[node];
+   HYPRE_Int        *ecells;
+   HYPRE_Int         cmin[HYPRE_MAXDIM], cmax[HYPRE_MAXDIM];
+   HYPRE_Int         i, d, c, axis, child;
+
+   for (i = first; i < first + num; i++)
+   {
+      ecells = &cells[2 * ndim * node_items[i]];
+      for (d = 0; d < ndim; d++)
+      {
+         c = ecells[d] + ecells[ndim + d];
+         if (i == first)
+         {
+            nodep -> cmin[d] = ecells[d];
+            nodep -> cmax[d] = ecells[ndim + d];
+            cmin[d] = c;
+            cmax[d] = c;
+         }
+         else
+         {
+            nodep -> cmin[d] = hypre_min(nodep -> cmin[d], ecells[d]);
+            nodep -> cmax[d] = hypre_max(nodep -> cmax[d], ecells[ndim + d]);
+            cmin[d] = hypre_min(cmin[d], c);
+            cmax[d] = hypre_max(cmax[d], c);
+         }
+      }
+   }
+   nodep -> child = -1;
+   nodep -> first = first;
+   nodep -> num   = num;
+
+   if (num <= HYPRE_BOXMAN_LEAF_SIZE)
+   {
+      return;
+   }
+
+   axis = 0;
+   for (d = 1; d < ndim; d++)
+   {
+      if ((cmax[d] - cmin[d]) > (cmax[axis] - cmin[axis]))
+      {
+         axis = d;
+      }
+   }
+   for (i = first; i < first + num; i++)
+   {
+      ecells = &cells[2 * ndim * node_items[i]];
+      keys[node_items[i]] = ecells[axis] + ecells[ndim + axis];
+   }
+   hypre_BoxManSortItems(&node_items[first], work, num, keys, 1);
+
+   child = *num_nodes_ptr;
+   *num_nodes_ptr += 2;
+   nodep -> child = child;
+
+   hypre_BoxManBuildNode(ndim, cells, node_items, keys, work, nodes, num_nodes_ptr,
+                         child, first, num / 2);
+   hypre_BoxManBuildNode(ndim, cells, node_items, keys, work, nodes, num_nodes_ptr,
+                         child + 1, first + num / 2, num - num / 2);
+}
+
+/*--------------------------------------------------------------------------
+ * Build the spatial index of the (sorted) entries: the indexes arrays, the
+ * cell extents of each entry, and the bounding volume hierarchy over these.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManBuildIndex( hypre_BoxManager *manager )
+{
+   HYPRE_Int           ndim     = hypre_BoxManNDim(manager);
+   HYPRE_Int           nentries = hypre_BoxManNEntries(manager);
+   hypre_BoxManEntry  *entries  = hypre_BoxManEntries(manager);
+
+   HYPRE_Int          *indexes, *cells, *values, *items, *work, *node_items;
+   HYPRE_Int           num_nodes, d, e, i, size;
+   hypre_BoxManNode   *nodes;
+
+   /*------------------------------------------------------
+    * Set up the indexes arrays (sorted imin and imax+1 of each entry without
+    * duplicates) and the cell extents of each entry
+    *------------------------------------------------------*/
+
+   cells  = hypre_TAlloc(HYPRE_Int, 2 * ndim * nentries, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Int, 2 * nentries, HYPRE_MEMORY_HOST);
+   items  = hypre_TAlloc(HYPRE_Int, 2 * nentries, HYPRE_MEMORY_HOST);
+   work   = hypre_TAlloc(HYPRE_Int, 2 * nentries, HYPRE_MEMORY_HOST);
+
+   for (d = 0; d < ndim; d++)
+   {
+      for (e = 0; e < nentries; e++)
+      {
+         values[2 * e]     = hypre_BoxManEntryIMin(&entries[e])[d];
+         values[2 * e + 1] = hypre_BoxManEntryIMax(&entries[e])[d] + 1;
+         items[2 * e]      = 2 * e;
+         items[2 * e + 1]  = 2 * e + 1;
+      }
+      hypre_BoxManSortItems(items, work, 2 * nentries, values, 1);
+
+      indexes = hypre_CTAlloc(HYPRE_Int, 2 * nentries, HYPRE_MEMORY_HOST);
+      size = 0;
+      for (i = 0; i < 2 * nentries; i++)
+      {
+         if (size == 0 || values[items[i]] != indexes[size - 1])
+         {
+            indexes[size++] = values[items[i]];
+         }
+         /* imin starts cell size-1, and imax+1 ends cell size-2 */
+         e = items[i] / 2;
+         if (items[i] % 2)
+         {
+            cells[2 * ndim * e + ndim + d] = size - 2;
+         }
+         else
+         {
+            cells[2 * ndim * e + d] = size - 1;
+         }
+      }
+
+      hypre_TFree(hypre_BoxManIndexesD(manager, d), HYPRE_MEMORY_HOST);
+      hypre_BoxManIndexesD(manager, d) = indexes;
+      hypre_BoxManSizeD(manager, d) = (size > 0) ? (size - 1) : 0;
+   }
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(items, HYPRE_MEMORY_HOST);
+
+   /*------------------------------------------------------
+    * Set up the hierarchy
+    *------------------------------------------------------*/
+
+   num_nodes  = 0;
+   nodes      = NULL;
+   node_items = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   if (nentries)
+   {
+      HYPRE_Int *keys = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+
+      for (e = 0; e < nentries; e++)
+      {
+         node_items[e] = e;
+      }
+      nodes = hypre_TAlloc(hypre_BoxManNode, 2 * nentries - 1, HYPRE_MEMORY_HOST);
+      num_nodes = 1;
+      hypre_BoxManBuildNode(ndim, cells, node_items, keys, work, nodes, &num_nodes,
+                            0, 0, nentries);
+
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(hypre_BoxManCells(manager), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_BoxManNodes(manager), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_BoxManNodeItems(manager), HYPRE_MEMORY_HOST);
+   hypre_BoxManCells(manager)     = cells;
+   hypre_BoxManNumNodes(manager)  = num_nodes;
+   hypre_BoxManNodes(manager)     = nodes;
+   hypre_BoxManNodeItems(manager) = node_items;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * In the assemble, we populate the local box manager with global box
  * information to be used by calls to BoxManIntersect().  Global box information
@@ -1123,7 +1541,8 @@ hypre_BoxManGatherEntries(hypre_BoxManager *manager,
  * its box manager
  *
  * 2. The assemble routine is only called once for a box manager (i.e., you
- * don't assemble, then add more entries and then assemble again)
+ * don't assemble, then add more entries and then assemble again).  Use
+ * hypre_BoxManAssembleIncremental() to add or delete entries afterwards.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -1133,8 +1552,8 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    HYPRE_Int  myid, nprocs;
    HYPRE_Int  is_gather, global_is_gather;
    HYPRE_Int  nentries;
-   HYPRE_Int *procs_sort, *ids_sort;
-   HYPRE_Int  i, j, k;
+   HYPRE_Int *procs_sort;
+   HYPRE_Int  i, j;
 
    HYPRE_Int need_to_sort = 1; /* default it to sort */
    //HYPRE_Int short_sort = 0; /*do abreviated sort */
@@ -1143,8 +1562,6 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
 
    HYPRE_Int  global_num_boxes = 0;
 
-   hypre_BoxManEntry *entries;
-
    hypre_BoxArray  *gather_regions;
 
    MPI_Comm comm = hypre_BoxManComm(manager);
@@ -1162,11 +1579,8 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
 
    gather_regions = hypre_BoxManGatherRegions(manager);
    nentries = hypre_BoxManNEntries(manager);
-   entries =  hypre_BoxManEntries(manager);
    procs_sort = hypre_BoxManProcsSort(manager);
 
-   ids_sort = hypre_BoxManIdsSort(manager);
-
    /* do we need to gather entries - check to see if ANY processor called a
     * gather? */
 
@@ -1669,9 +2083,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
                               - hypre_BoxManMaxNEntries(manager));
                   hypre_BoxManIncSize ( manager, inc_size);
 
-                  entries =  hypre_BoxManEntries(manager);
                   procs_sort = hypre_BoxManProcsSort(manager);
-                  ids_sort = hypre_BoxManIdsSort(manager);
                }
 
                index_ptr = entry_response_buf; /* point into response buf */
@@ -1857,9 +2269,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
             hypre_BoxManIncSize ( manager, inc_size);
 
             nentries = hypre_BoxManNEntries(manager);
-            entries =  hypre_BoxManEntries(manager);
             procs_sort = hypre_BoxManProcsSort(manager);
-            ids_sort = hypre_BoxManIdsSort(manager);
          }
 
          /* now "empty" the entries array */
@@ -1952,239 +2362,11 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    /* check for and remove duplicate boxes - based on (proc, id) */
    /* at the same time sort the procs_sort and ids_sort and then sort the
     * entries*/
+   if (need_to_sort)
    {
-      HYPRE_Int *order_index = NULL;
-      HYPRE_Int *delete_array = NULL;
-      HYPRE_Int  tmp_id, start, index;
-      HYPRE_Int  first_local;
-      HYPRE_Int  num_procs_sort;
-      HYPRE_Int *proc_offsets;
-      HYPRE_Int  myoffset;
-      HYPRE_Int size;
-
-      hypre_BoxManEntry  *new_entries;
-
-      /* (TO DO): if we are sorting after the ap gather, then the box ids may
-         already be sorted within processor number (depends on if the check for
-         contacting duplicate processors was performed....if so, then there may
-         be a faster way to sort the proc ids and not mess up the already sorted
-         box ids - also there will not be any duplicates )*/
-
-      /* initial... */
-      nentries = hypre_BoxManNEntries(manager);
-      entries =  hypre_BoxManEntries(manager);
-
-      /* these are negative if a proc does not have any local entries in the
-         manager */
-      first_local = -1;
-      myoffset = -1;
-
-      if (need_to_sort)
-      {
-
-#if 0
-         /* TO DO: add code for the "short sort" - which is don't check for
-            duplicates and the boxids are already sorted within each processor
-            id - but the proc ids are not sorted */
-
-         if (short_sort)
-         {
-            /* TO DO: write this */
-         }
-         else
-         {
-            /*stuff below */
-         }
-#endif
-         order_index = hypre_CTAlloc(HYPRE_Int,  nentries, HYPRE_MEMORY_HOST);
-         delete_array =  hypre_CTAlloc(HYPRE_Int,  nentries, HYPRE_MEMORY_HOST);
-         index = 0;
-
-         for (i = 0; i < nentries; i++)
-         {
-            order_index[i] = i;
-         }
-         /* sort by proc_id */
-         hypre_qsort3i(procs_sort, ids_sort, order_index, 0, nentries - 1);
-         num_procs_sort = 0;
-         /* get first id */
-         if (nentries)
-         {
-            tmp_id = procs_sort[0];
-            num_procs_sort++;
-         }
-
-         /* now sort on ids within each processor number*/
-         start = 0;
-         for (i = 1; i < nentries; i++)
-         {
-            if (procs_sort[i] != tmp_id)
-            {
-               hypre_qsort2i(ids_sort, order_index, start, i - 1);
-               /*now find duplicate ids */
-               for (j = start + 1; j < i; j++)
-               {
-                  if (ids_sort[j] == ids_sort[j - 1])
-                  {
-                     delete_array[index++] = j;
-                  }
-               }
-               /* update start and tmp_id */
-               start = i;
-               tmp_id = procs_sort[i];
-               num_procs_sort++;
-            }
-         }
-         /* final sort and purge (the last group doesn't get caught in the above
-            loop) */
-         if (nentries)
-         {
-            hypre_qsort2i(ids_sort, order_index, start, nentries - 1);
-            /*now find duplicate boxnums */
-            for (j = start + 1; j < nentries; j++)
-            {
-               if (ids_sort[j] == ids_sort[j - 1])
-               {
-                  delete_array[index++] = j;
-               }
-            }
-         }
-         /* now index = the number to delete (in delete_array) */
-
-         if (index)
-         {
-            /* now delete from sort procs and sort ids -use delete_array because
-               these have already been sorted.  also delete from order_index */
-            start = delete_array[0];
-            j = 0;
-            for (i = start; (i + j) < nentries; i++)
-            {
-               if (j < index)
-               {
-                  while ((i + j) == delete_array[j]) /* see if deleting
-                                                    * consec. items */
-                  {
-                     j++; /*increase the shift*/
-                     if (j == index) { break; }
-                  }
-               }
-               if ((i + j) < nentries) /* if deleting the last item then no moving */
-               {
-                  ids_sort[i] = ids_sort[i + j];
-                  procs_sort[i] =  procs_sort[i + j];
-                  order_index[i] = order_index[i + j];
-               }
-            }
-         }
-
-         /*** create new sorted entries and info arrays - delete old one ****/
-         {
-            HYPRE_Int position;
-            HYPRE_Int info_size = hypre_BoxManEntryInfoSize(manager);
-
-            void *index_ptr;
-            void *new_info;
-            void *info;
-
-            size = nentries - index;
-            new_entries =  hypre_CTAlloc(hypre_BoxManEntry,  size, HYPRE_MEMORY_HOST);
-
-            new_info = hypre_TAlloc(char, size * info_size, HYPRE_MEMORY_HOST);
-            index_ptr = new_info;
-
-            for (i = 0; i < size; i++)
-            {
-               /* copy the entry */
-               hypre_BoxManEntryCopy(&entries[order_index[i]], &new_entries[i]);
-
-               /* set the new position */
-               hypre_BoxManEntryPosition(&new_entries[i]) = i;
-
-               /* copy the info object */
-               position = hypre_BoxManEntryPosition(&entries[order_index[i]]);
-               info = hypre_BoxManInfoObject(manager, position);
-
-               hypre_TMemcpy(index_ptr,  info, char,  info_size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-               index_ptr =  (void *) ((char *) index_ptr + info_size);
-
-            }
-            hypre_TFree(entries, HYPRE_MEMORY_HOST);
-            hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
-
-            hypre_BoxManEntries(manager) = new_entries;
-            hypre_BoxManMaxNEntries(manager) = size;
-            hypre_BoxManNEntries(manager) = size;
-
-            hypre_BoxManInfoObjects(manager) = new_info;
-
-            nentries = hypre_BoxManNEntries(manager);
-            entries = hypre_BoxManEntries(manager);
-         }
-
-      } /* end of if (need_to_sort) */
-
-      else
-      {
-         /* no sorting - just get num_procs_sort by looping through procs_sort
-            array*/
-
-         num_procs_sort = 0;
-         if (nentries > 0)
-         {
-            tmp_id = procs_sort[0];
-            num_procs_sort++;
-         }
-         for (i = 1; i < nentries; i++)
-         {
-            if (procs_sort[i] != tmp_id)
-            {
-               num_procs_sort++;
-               tmp_id = procs_sort[i];
-            }
-         }
-      }
-
-      hypre_BoxManNumProcsSort(manager) = num_procs_sort;
-
-      /* finally, create proc_offsets (myoffset corresponds to local id
-         position) first_local is the position in entries; */
-      proc_offsets = hypre_CTAlloc(HYPRE_Int,  num_procs_sort + 1, HYPRE_MEMORY_HOST);
-      proc_offsets[0] = 0;
-      if (nentries > 0)
-      {
-         j = 1;
-         tmp_id = procs_sort[0];
-         if (myid == tmp_id)
-         {
-            myoffset = 0;
-            first_local = 0;
-         }
-
-         for (i = 0; i < nentries; i++)
-         {
-            if (procs_sort[i] != tmp_id)
-            {
-               if (myid == procs_sort[i])
-               {
-                  myoffset = j;
-                  first_local = i;
-               }
-               proc_offsets[j++] = i;
-               tmp_id = procs_sort[i];
-            }
-         }
-         proc_offsets[j] = nentries; /* last one */
-      }
-
-      hypre_BoxManProcsSortOffsets(manager) = proc_offsets;
-      hypre_BoxManFirstLocal(manager) = first_local;
-      hypre_BoxManLocalProcOffset(manager) = myoffset;
-
-      /* clean up from this section of code */
-      hypre_TFree(delete_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(order_index, HYPRE_MEMORY_HOST);
-
-   }/* end bracket for all or the sorting stuff */
+      hypre_BoxManSortEntries(manager);
+   }
+   hypre_BoxManSetProcOffsets(manager);
 
    {
       /* for the assumed partition case, we can check to see if all the global
@@ -2209,219 +2391,12 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
       }
    }
 
-   /*------------------------------INDEX TABLE ---------------------------*/
-
-   /* now build the index_table and indexes array */
-   /* Note: for now we are using the same scheme as in BoxMap  */
-   {
-      HYPRE_Int *indexes[HYPRE_MAXDIM];
-      HYPRE_Int  size[HYPRE_MAXDIM];
-      HYPRE_Int  iminmax[2];
-      HYPRE_Int  index_not_there;
-      HYPRE_Int  d, e, itsize;
-      HYPRE_Int  mystart, myfinish;
-      HYPRE_Int  imin[HYPRE_MAXDIM];
-      HYPRE_Int  imax[HYPRE_MAXDIM];
-      HYPRE_Int  start_loop[HYPRE_MAXDIM];
-      HYPRE_Int  end_loop[HYPRE_MAXDIM];
-      HYPRE_Int  loop, range, loop_num;
-      HYPRE_Int *proc_offsets;
-
-      HYPRE_Int location, spot;
-
-      hypre_BoxManEntry  **index_table;
-      hypre_BoxManEntry   *entry;
-      hypre_Box           *index_box, *table_box;
-      hypre_Index          stride, loop_size;
-
-      hypre_IndexRef entry_imin;
-      hypre_IndexRef entry_imax;
-
-      /* initial */
-      nentries     = hypre_BoxManNEntries(manager);
-      entries      = hypre_BoxManEntries(manager);
-      proc_offsets = hypre_BoxManProcsSortOffsets(manager);
-
-      /*------------------------------------------------------
-       * Set up the indexes array and record the processor's
-       * entries. This will be used in ordering the link list
-       * of BoxManEntry- ones on this processor listed first.
-       *------------------------------------------------------*/
-      itsize = 0;
-      for (d = 0; d < ndim; d++)
-      {
-         /* room for min and max of each entry in each dim */
-         indexes[d] = hypre_CTAlloc(HYPRE_Int,  2 * nentries, HYPRE_MEMORY_HOST);
-         size[d] = 0;
-      }
-      /* loop through each entry and get index */
-      for (e = 0; e < nentries; e++)
-      {
-         entry  = &entries[e]; /* grab the entry - get min and max extents */
-         entry_imin = hypre_BoxManEntryIMin(entry);
-         entry_imax = hypre_BoxManEntryIMax(entry);
-
-         /* in each dim, check if min/max positions are already in the table */
-         for (d = 0; d < ndim; d++)
-         {
-            iminmax[0] = hypre_IndexD(entry_imin, d);
-            iminmax[1] = hypre_IndexD(entry_imax, d) + 1;
-
-            /* do the min then the max */
-            for (i = 0; i < 2; i++)
-            {
-               /* find the new index position in the indexes array */
-               index_not_there = 1;
+   /*------------------------------SPATIAL INDEX ---------------------------*/
 
-               if (!i)
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], 0,
-                                                 size[d] - 1, &j);
-                  if (location != -1) { index_not_there = 0; }
-               }
-               else /* for max, we can start seach at min position */
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], j,
-                                                 size[d] - 1, &j);
-                  if (location != -1) { index_not_there = 0; }
-               }
-
-               /* if the index is already there, don't add it again */
-               if (index_not_there)
-               {
-                  for (k = size[d]; k > j; k--) /* make room for new index */
-                  {
-                     indexes[d][k] = indexes[d][k - 1];
-                  }
-                  indexes[d][j] = iminmax[i];
-                  size[d]++; /* increase the size in that dimension */
-               }
-            } /* end of for min and max */
-         } /* end of for each dimension of the entry */
-      } /* end of for each entry loop */
-
-      if (nentries)
-      {
-         itsize = 1;
-         for (d = 0; d < ndim; d++)
-         {
-            size[d]--;
-            itsize *= size[d];
-         }
-      }
-
-      /*------------------------------------------------------
-       * Set up the table - do offprocessor then on-processor
-       *------------------------------------------------------*/
-
-      /* allocate space for table */
-      index_table = hypre_CTAlloc(hypre_BoxManEntry *,  itsize, HYPRE_MEMORY_HOST);
-
-      index_box = hypre_BoxCreate(ndim);
-      table_box = hypre_BoxCreate(ndim);
-
-      /* create a table_box for use below */
-      hypre_SetIndex(stride, 1);
-      hypre_BoxSetExtents(table_box, stride, size);
-      hypre_BoxShiftNeg(table_box, stride); /* Want box to start at 0*/
-
-      /* which are my entries? (on-processor) */
-      mystart = hypre_BoxManFirstLocal(manager);
-      if (mystart >= 0 ) /*  we have local entries) because
-                             firstlocal = -1 if no local entries */
-      {
-         loop_num = 3;
-         /* basically we have need to do the same code fragment repeated three
-            times so that we can do off-proc then on proc entries - this
-            ordering is because creating the linked list for overlapping
-            boxes */
-
-         myfinish =  proc_offsets[hypre_BoxManLocalProcOffset(manager) + 1];
-         /* #1 do off proc. entries - lower range */
-         start_loop[0] = 0;
-         end_loop[0] = mystart;
-         /* #2 do off proc. entries - upper range */
-         start_loop[1] = myfinish;
-         end_loop[1] = nentries;
-         /* #3 do ON proc. entries */
-         start_loop[2] = mystart;
-         end_loop[2] = myfinish;
-      }
-      else /* no on-proc entries */
-      {
-         loop_num = 1;
-         start_loop[0] = 0;
-         end_loop[0] = nentries;
-      }
-
-      for (loop = 0; loop < loop_num; loop++)
-      {
-         for (range = start_loop[loop]; range < end_loop[loop]; range++)
-         {
-            entry = &entries[range];
-            entry_imin = hypre_BoxManEntryIMin(entry);
-            entry_imax = hypre_BoxManEntryIMax(entry);
-
-            /* find the indexes corresponding to the current box - put in imin
-               and imax */
-            for (d = 0; d < ndim; d++)
-            {
-               /* need to go to size[d] because that contains the last element */
-               location = hypre_BinarySearch2(
-                             indexes[d], hypre_IndexD(entry_imin, d), 0, size[d], &spot);
-               hypre_IndexD(imin, d) = location;
-
-               location = hypre_BinarySearch2(
-                             indexes[d], hypre_IndexD(entry_imax, d) + 1, 0, size[d], &spot);
-               hypre_IndexD(imax, d) = location - 1;
-
-            } /* now have imin and imax location in index array*/
-
-            /* set up index table */
-            hypre_BoxSetExtents(index_box, imin, imax);
-            hypre_BoxGetSize(index_box, loop_size);
-            hypre_SerialBoxLoop1Begin(ndim, loop_size, table_box, imin, stride, ii);
-            {
-               if (!index_table[ii]) /* no entry- add one */
-               {
-                  index_table[ii] = entry;
-               }
-               else /* already an entry there - so add to link list for
-                       BoxMapEntry - overlapping */
-               {
-                  hypre_BoxManEntryNext(entry) = index_table[ii];
-                  index_table[ii] = entry;
-               }
-            }
-            hypre_SerialBoxLoop1End(ii);
-
-         } /* end of subset of entries */
-      }/* end of three loops over subsets */
-
-      /* done with the index_table! */
-      hypre_TFree( hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST); /* in case this is a
-                                                        re-assemble - shouldn't
-                                                        be though */
-      hypre_BoxManIndexTable(manager) = index_table;
-
-      for (d = 0; d < ndim; d++)
-      {
-         hypre_TFree(hypre_BoxManIndexesD(manager,  d), HYPRE_MEMORY_HOST);
-         hypre_BoxManIndexesD(manager, d) = indexes[d];
-         hypre_BoxManSizeD(manager, d) = size[d];
-         hypre_BoxManLastIndexD(manager, d) = 0;
-      }
-
-      hypre_BoxDestroy(index_box);
-      hypre_BoxDestroy(table_box);
-
-   } /* end of building index table group */
+   hypre_BoxManBuildIndex(manager);
 
    /* clean up and update*/
 
-   hypre_BoxManNEntries(manager) = nentries;
-   hypre_BoxManEntries(manager) = entries;
-
    hypre_BoxManIsGatherCalled(manager) = 0;
    hypre_BoxArrayDestroy(gather_regions);
    hypre_BoxManGatherRegions(manager) =  hypre_BoxArrayCreate(0, ndim);
@@ -2454,24 +2429,23 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
                         HYPRE_Int *nentries_ptr )
 {
    HYPRE_Int           ndim = hypre_BoxManNDim(manager);
-   HYPRE_Int           d;
-   HYPRE_Int           find_index_d, current_index_d;
+   HYPRE_Int           man_nentries = hypre_BoxManNEntries(manager);
+   hypre_BoxManEntry  *man_entries = hypre_BoxManEntries(manager);
+   HYPRE_Int          *cells = hypre_BoxManCells(manager);
+   hypre_BoxManNode   *nodes = hypre_BoxManNodes(manager);
+   HYPRE_Int          *node_items = hypre_BoxManNodeItems(manager);
+   HYPRE_Int           d, i, j, e, k;
+   HYPRE_Int           ilower_d, iupper_d;
    HYPRE_Int          *man_indexes_d;
    HYPRE_Int           man_index_size_d;
-   HYPRE_Int           nentries;
-   HYPRE_Int          *marker, position;
-   hypre_Box          *index_box, *table_box;
-   hypre_Index         stride, loop_size;
+   HYPRE_Int           nentries, max_nentries;
+   HYPRE_Int          *positions;
+   HYPRE_Int          *ecells;
+   HYPRE_Int           stack[HYPRE_BOXMAN_STACK_SIZE];
+   HYPRE_Int           nstack;
    hypre_Index         man_ilower, man_iupper;
-   hypre_BoxManEntry **index_table;
+   hypre_BoxManNode   *node;
    hypre_BoxManEntry **entries;
-   hypre_BoxManEntry  *entry;
-
-#if 0
-   HYPRE_Int   i, cnt;
-   HYPRE_Int  *proc_ids, *ids, *unsort;
-   HYPRE_Int   tmp_id, start;
-#endif
 
    /* can only use after assembling */
    if (!hypre_BoxManIsAssembled(manager))
@@ -2481,130 +2455,294 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
    }
 
    /* Check whether the box manager contains any entries */
-   if (hypre_BoxManNEntries(manager) == 0)
+   if (man_nentries == 0)
    {
       *entries_ptr  = NULL;
       *nentries_ptr = 0;
       return hypre_error_flag;
    }
 
-   /* Loop through each dimension */
+   /* Find the range of cells that the box covers in each dimension.  The cell
+    * containing x is the largest k with indexes[k] <= x (or -1). */
    for (d = 0; d < ndim; d++)
    {
-      /* Initialize */
-      man_ilower[d] = 0;
-      man_iupper[d] = 0;
-
       man_indexes_d = hypre_BoxManIndexesD(manager, d);
       man_index_size_d = hypre_BoxManSizeD(manager, d);
 
-      /* -----find location of ilower[d] in  indexes-----*/
-      find_index_d = hypre_IndexD(ilower, d);
-
-      /* Start looking in place indicated by last_index stored in map */
-      current_index_d = hypre_BoxManLastIndexD(manager, d);
-
-      /* Loop downward if target index is less than current location */
-      while ( (current_index_d >= 0 ) &&
-              (find_index_d < man_indexes_d[current_index_d]) )
+      ilower_d = hypre_BinarySearch2(man_indexes_d, hypre_IndexD(ilower, d),
+                                     0, man_index_size_d, &j);
+      if (ilower_d < 0)
       {
-         current_index_d --;
+         ilower_d = j - 1;
       }
-
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
+      if ( ilower_d > (man_index_size_d - 1) )
       {
-         current_index_d ++;
+         *entries_ptr  = NULL;
+         *nentries_ptr = 0;
+         return hypre_error_flag;
       }
 
-      if ( current_index_d > (man_index_size_d - 1) )
+      iupper_d = hypre_BinarySearch2(man_indexes_d, hypre_IndexD(iupper, d),
+                                     0, man_index_size_d, &j);
+      if (iupper_d < 0)
+      {
+         iupper_d = j - 1;
+      }
+      iupper_d = hypre_max(iupper_d, ilower_d);
+      if ( iupper_d < 0 )
       {
          *entries_ptr  = NULL;
          *nentries_ptr = 0;
          return hypre_error_flag;
       }
-      else
-      {
-         man_ilower[d] = hypre_max(current_index_d, 0);
-      }
 
-      /* -----find location of iupper[d] in  indexes-----*/
+      man_ilower[d] = hypre_max(ilower_d, 0);
+      man_iupper[d] = hypre_min(iupper_d, (man_index_size_d - 1));
+   }
+
+   /*-----------------------------------------------------------------
+    * Traverse the hierarchy.  Each entry is stored in exactly one leaf, so the
+    * entries found are unique.
+    *-----------------------------------------------------------------*/
 
-      find_index_d = hypre_IndexD(iupper, d);
+   nentries = 0;
+   max_nentries = 0;
+   positions = NULL;
 
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
+   nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0)
+   {
+      node = &nodes[stack[--nstack]];
+
+      for (d = 0; d < ndim; d++)
       {
-         current_index_d ++;
+         if ((node -> cmin[d] > man_iupper[d]) || (node -> cmax[d] < man_ilower[d]))
+         {
+            break;
+         }
       }
-      if ( current_index_d < 0 )
+      if (d < ndim)
       {
-         *entries_ptr  = NULL;
-         *nentries_ptr = 0;
-         return hypre_error_flag;
+         continue;
+      }
+
+      if (node -> child < 0)
+      {
+         for (i = node -> first; i < (node -> first + node -> num); i++)
+         {
+            e = node_items[i];
+            ecells = &cells[2 * ndim * e];
+            for (d = 0; d < ndim; d++)
+            {
+               if ((ecells[d] > man_iupper[d]) || (ecells[ndim + d] < man_ilower[d]))
+               {
+                  break;
+               }
+            }
+            if (d == ndim)
+            {
+               if (nentries == max_nentries)
+               {
+                  max_nentries = 2 * max_nentries + 8;
+                  positions = hypre_TReAlloc(positions, HYPRE_Int, max_nentries,
+                                             HYPRE_MEMORY_HOST);
+               }
+               positions[nentries++] = e;
+            }
+         }
       }
       else
       {
-         man_iupper[d] = hypre_min(current_index_d, (man_index_size_d - 1));
+         stack[nstack++] = (node -> child) + 1;
+         stack[nstack++] = (node -> child);
       }
    }
 
    /*-----------------------------------------------------------------
-    * If we reach this point, then set up the entries array.
-    * Use a marker array to ensure unique entries.
+    * Order the entries as a sweep over the cells (first dimension fastest)
+    * would find them, with the on-processor entries first within a cell.  An
+    * entry is found at its first cell inside the box.
     *-----------------------------------------------------------------*/
 
-   nentries = hypre_BoxManMaxNEntries(manager);
-   entries  = hypre_CTAlloc(hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST); /* realloc below */
-   marker   = hypre_CTAlloc(HYPRE_Int,  nentries, HYPRE_MEMORY_HOST);
-   index_table = hypre_BoxManIndexTable(manager);
-
-   nentries = 0;
-
-   table_box = hypre_BoxCreate(ndim);
-   index_box = hypre_BoxCreate(ndim);
-
-   hypre_SetIndex(stride, 1);
-   hypre_BoxSetExtents(table_box, stride, hypre_BoxManSize(manager));
-   hypre_BoxShiftNeg(table_box, stride); /* Want box to start at 0*/
-   hypre_BoxSetExtents(index_box, man_ilower, man_iupper);
-   hypre_BoxGetSize(index_box, loop_size);
-   hypre_SerialBoxLoop1Begin(ndim, loop_size, table_box, man_ilower, stride, ii);
+   entries = NULL;
+   if (nentries > 0)
    {
-      entry = index_table[ii];
+      HYPRE_Int  *keys, *order, *work;
+      HYPRE_Int   nkeys = ndim + 1;
+      HYPRE_Int   mystart = hypre_BoxManFirstLocal(manager);
+      HYPRE_Int   myfinish = 0;
+      HYPRE_Int   seq;
+
+      if (mystart >= 0)
+      {
+         myfinish = hypre_BoxManProcsSortOffsets(manager)
+                    [hypre_BoxManLocalProcOffset(manager) + 1];
+      }
 
-      while (entry != NULL)
+      keys  = hypre_TAlloc(HYPRE_Int, nkeys * nentries, HYPRE_MEMORY_HOST);
+      order = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+      work  = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+      for (k = 0; k < nentries; k++)
       {
-         position = hypre_BoxManEntryPosition(entry);
+         e = positions[k];
+         ecells = &cells[2 * ndim * e];
+         for (d = 0; d < ndim; d++)
+         {
+            keys[k * nkeys + (ndim - 1 - d)] = hypre_max(ecells[d], man_ilower[d]);
+         }
 
-         if (marker[position] == 0) /* Add entry and mark as added */
+         /* off-proc entries come before the on-proc ones in sequence, and the
+            later an entry is in sequence, the earlier it is listed */
+         seq = e;
+         if (mystart >= 0)
          {
-            entries[nentries] = entry;
-            marker[position]  = 1;
-            nentries++;
+            if (e >= myfinish)
+            {
+               seq = e - (myfinish - mystart);
+            }
+            else if (e >= mystart)
+            {
+               seq = e + (man_nentries - myfinish);
+            }
          }
+         keys[k * nkeys + ndim] = -seq;
+
+         order[k] = k;
+      }
+      hypre_BoxManSortItems(order, work, nentries, keys, nkeys);
 
-         entry = hypre_BoxManEntryNext(entry);
+      entries = hypre_TAlloc(hypre_BoxManEntry *, nentries, HYPRE_MEMORY_HOST);
+      for (k = 0; k < nentries; k++)
+      {
+         entries[k] = &man_entries[positions[order[k]]];
       }
+
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(order, HYPRE_MEMORY_HOST);
+      hypre_TFree(work, HYPRE_MEMORY_HOST);
    }
-   hypre_SerialBoxLoop1End(ii);
+   hypre_TFree(positions, HYPRE_MEMORY_HOST);
+
+   *entries_ptr  = entries;
+   *nentries_ptr = nentries;
 
-   entries  = hypre_TReAlloc(entries,  hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST);
+   return hypre_error_flag;
+}
 
-   /* Reset the last index in the manager */
-   for (d = 0; d < ndim; d++)
+/*--------------------------------------------------------------------------
+ * Mark the entry with id (proc, id) of an assembled manager for deletion.
+ * The entry stays visible until hypre_BoxManAssembleIncremental is called.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManDeleteEntry( hypre_BoxManager *manager,
+                         HYPRE_Int proc,
+                         HYPRE_Int id )
+{
+   hypre_BoxManEntry *entry;
+   HYPRE_Int          num_deletes = hypre_BoxManNumDeletes(manager);
+
+   /* can only use after assembling */
+   if (!hypre_BoxManIsAssembled(manager))
    {
-      hypre_BoxManLastIndexD(manager, d) = man_ilower[d];
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
    }
 
-   hypre_BoxDestroy(table_box);
-   hypre_BoxDestroy(index_box);
-   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_BoxManGetEntry(manager, proc, id, &entry);
+   if (entry == NULL)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
 
-   *entries_ptr  = entries;
-   *nentries_ptr = nentries;
+   if (num_deletes == hypre_BoxManMaxDeletes(manager))
+   {
+      hypre_BoxManMaxDeletes(manager) = 2 * num_deletes + 10;
+      hypre_BoxManDeletes(manager) =
+         hypre_TReAlloc(hypre_BoxManDeletes(manager), HYPRE_Int,
+                        hypre_BoxManMaxDeletes(manager), HYPRE_MEMORY_HOST);
+   }
+   hypre_BoxManDeletes(manager)[num_deletes] = hypre_BoxManEntryPosition(entry);
+   hypre_BoxManNumDeletes(manager) = num_deletes + 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Apply the entries added (hypre_BoxManAddEntry) and deleted
+ * (hypre_BoxManDeleteEntry) since an assembled manager was last assembled.
+ *
+ * Notes:
+ *
+ * (1) Unlike hypre_BoxManAssemble, this is a purely local operation - there is
+ * no gather or assumed partition communication.  The caller is responsible
+ * for adding every box that is needed by later intersections.
+ *
+ * (2) Only the sorted entry arrays and the spatial index are updated.  Entry
+ * pointers obtained before the call are invalidated (as they are by each
+ * hypre_BoxManAddEntry call on an assembled manager).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxManAssembleIncremental( hypre_BoxManager *manager )
+{
+   HYPRE_Int          num_adds    = hypre_BoxManNumAdds(manager);
+   HYPRE_Int          num_deletes = hypre_BoxManNumDeletes(manager);
+   HYPRE_Int         *deletes     = hypre_BoxManDeletes(manager);
+   hypre_BoxManEntry *entries;
+   HYPRE_Int          nentries, i, j;
+
+   /* can only use after assembling */
+   if (!hypre_BoxManIsAssembled(manager))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ((num_adds == 0) && (num_deletes == 0))
+   {
+      return hypre_error_flag;
+   }
+
+   /* the added entries follow the assembled ones */
+   hypre_BoxManNEntries(manager) += num_adds;
+
+   if (num_deletes > 0)
+   {
+      /* sort the positions and drop repeats */
+      hypre_qsort0(deletes, 0, num_deletes - 1);
+      j = 1;
+      for (i = 1; i < num_deletes; i++)
+      {
+         if (deletes[i] != deletes[j - 1])
+         {
+            deletes[j++] = deletes[i];
+         }
+      }
+      hypre_BoxManDeleteMultipleEntriesAndInfo(manager, deletes, j);
+   }
+
+   /* keep procs_sort and ids_sort in line with the remaining entries */
+   nentries = hypre_BoxManNEntries(manager);
+   entries  = hypre_BoxManEntries(manager);
+   for (i = 0; i < nentries; i++)
+   {
+      hypre_BoxManProcsSort(manager)[i] = hypre_BoxManEntryProc(&entries[i]);
+      hypre_BoxManIdsSort(manager)[i]   = hypre_BoxManEntryId(&entries[i]);
+   }
+
+   /* deleting entries does not change the order of the others */
+   if (num_adds > 0)
+   {
+      hypre_BoxManSortEntries(manager);
+   }
+   hypre_BoxManSetProcOffsets(manager);
+   hypre_BoxManBuildIndex(manager);
+
+   hypre_BoxManNumAdds(manager)    = 0;
+   hypre_BoxManNumDeletes(manager) = 0;
 
    return hypre_error_flag;
 }
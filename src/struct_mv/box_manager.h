@@ -28,10 +28,25 @@ typedef struct hypre_BoxManEntry_struct
 
    void *boxman; /* The owning manager (populated in addentry) */
 
-   struct hypre_BoxManEntry_struct  *next;
-
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * BoxManNode: a node of the bounding volume hierarchy that organizes the
+ * entries spatially.  Extents are given in cells of the indexes arrays.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int cmin[HYPRE_MAXDIM]; /* Cell extents of the entries below */
+   HYPRE_Int cmax[HYPRE_MAXDIM];
+
+   HYPRE_Int child; /* Position of the first of two children (the second one
+                       follows it), or -1 for a leaf */
+   HYPRE_Int first; /* Range of the entries below in the node_items array */
+   HYPRE_Int num;
+
+} hypre_BoxManNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -88,18 +103,25 @@ typedef struct
    HYPRE_Int          local_proc_offset; /* Position of local information in
                                             offsets */
 
-   /* Here is the table  that organizes the entries spatially (by index) */
-   hypre_BoxManEntry **index_table; /* This points into 'entries' array and
-                                       corresponds to the index arays */
-
+   /* Here is the hierarchy that organizes the entries spatially (by index) */
    HYPRE_Int          *indexes[HYPRE_MAXDIM]; /* Indexes (ordered) for imin and
                                                  imax of each box in the entries
                                                  array */
-   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many indexes in each
-                                              direction */
-
-   HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
-                                                    indexes map */
+   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many cells (intervals between
+                                              indexes) in each direction */
+
+   HYPRE_Int          *cells; /* Cell extents of each entry: 2*ndim values per
+                                 entry (cell imin then cell imax) */
+   HYPRE_Int           num_nodes; /* Number of nodes in the hierarchy */
+   hypre_BoxManNode   *nodes; /* The hierarchy - node 0 is the root */
+   HYPRE_Int          *node_items; /* Entry positions, ordered by leaf */
+
+   /* Incremental updates of an assembled manager */
+   HYPRE_Int           num_adds; /* Entries added since the last assemble (these
+                                    are stored after the nentries entries) */
+   HYPRE_Int           num_deletes; /* Entries to be deleted */
+   HYPRE_Int           max_deletes;
+   HYPRE_Int          *deletes; /* Positions of the entries to be deleted */
 
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
@@ -152,10 +174,17 @@ typedef struct
 
 #define hypre_BoxManFirstLocal(manager)         ((manager) -> first_local)
 
-#define hypre_BoxManIndexTable(manager)         ((manager) -> index_table)
 #define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
 #define hypre_BoxManSize(manager)               ((manager) -> size)
-#define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManCells(manager)              ((manager) -> cells)
+#define hypre_BoxManNumNodes(manager)           ((manager) -> num_nodes)
+#define hypre_BoxManNodes(manager)              ((manager) -> nodes)
+#define hypre_BoxManNodeItems(manager)          ((manager) -> node_items)
+
+#define hypre_BoxManNumAdds(manager)            ((manager) -> num_adds)
+#define hypre_BoxManNumDeletes(manager)         ((manager) -> num_deletes)
+#define hypre_BoxManMaxDeletes(manager)         ((manager) -> max_deletes)
+#define hypre_BoxManDeletes(manager)            ((manager) -> deletes)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -170,10 +199,9 @@ typedef struct
 
 #define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
 #define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
-#define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
 
 #define hypre_BoxManInfoObject(manager, i) \
-(void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
+(void *) ((char *)hypre_BoxManInfoObjects(manager) + (i) * hypre_BoxManEntryInfoSize(manager))
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_BoxManEntry
@@ -186,7 +214,6 @@ typedef struct
 #define hypre_BoxManEntryId(entry)       ((entry) -> id)
 #define hypre_BoxManEntryPosition(entry) ((entry) -> position)
 #define hypre_BoxManEntryNumGhost(entry) ((entry) -> num_ghost)
-#define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
 #endif
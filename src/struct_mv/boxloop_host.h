@@ -33,6 +33,8 @@
 #define OMP1
 #endif /* #if defined(HYPRE_USING_OPENMP) */
 
+#if !defined(HYPRE_USING_BOXLOOP_TILING)
+
 #define zypre_BoxLoop0Begin(ndim, loop_size)                                  \
 {                                                                             \
    zypre_BoxLoopDeclare();                                                    \
@@ -248,6 +250,281 @@
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
          {
 
+#else /* #if !defined(HYPRE_USING_BOXLOOP_TILING) */
+
+/*--------------------------------------------------------------------------
+ * Tiled BoxLoop macros:
+ *
+ * The loop space is cut into tiles of about hypre_BoxLoopGetTileSize()
+ * points, keeping the unit-stride dimension as long as possible, and the
+ * tiles are handed out to the threads with dynamic scheduling.  A tile size
+ * of 0 gives one slab per thread along the slowest dimension.  Loop bodies
+ * see the same indices (and hypre_BoxLoopGetIndex values) as in the untiled
+ * loops, only the iteration order changes.  These assume HYPRE_MAXDIM = 3.
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_OPENMP)
+#define OMPT Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_OMP_CLAUSE HYPRE_BOX_REDUCTION schedule(dynamic))
+#else
+#define OMPT
+#endif
+
+#define zypre_TileLoopDeclare() \
+HYPRE_Int  hypre__tvol;\
+HYPRE_Int  hypre__tm[HYPRE_MAXDIM], hypre__ts[HYPRE_MAXDIM], hypre__tn[HYPRE_MAXDIM]
+
+/* set the loop extents (hypre__tm), tile extents (hypre__ts) and number of
+ * tiles (hypre__tn) in each dimension, and the total number of tiles */
+#define zypre_TileLoopInit() \
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__tm[hypre__d] = (hypre__d < hypre__ndim) ? hypre__n[hypre__d] : 1;\
+   hypre__ts[hypre__d] = hypre_max(hypre__tm[hypre__d], 1);\
+}\
+hypre__tvol = hypre_BoxLoopGetTileSize();\
+if (hypre__tvol > 0)\
+{\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__ts[hypre__d] = hypre_min(hypre__ts[hypre__d], hypre__tvol);\
+      hypre__tvol = hypre_max(hypre__tvol / hypre__ts[hypre__d], 1);\
+   }\
+}\
+else\
+{\
+   hypre__d = hypre__ndim - 1;\
+   hypre__ts[hypre__d] = (hypre__ts[hypre__d] + hypre_NumThreads() - 1) / hypre_NumThreads();\
+}\
+hypre__num_blocks = 1;\
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__tn[hypre__d] = (hypre__tm[hypre__d] + hypre__ts[hypre__d] - 1) / hypre__ts[hypre__d];\
+   hypre__num_blocks *= hypre__tn[hypre__d];\
+}
+
+/* set the loop bounds hypre__lo/hypre__hi of tile hypre__block */
+#define zypre_TileLoopSet() \
+HYPRE_Int  hypre__lo[HYPRE_MAXDIM], hypre__hi[HYPRE_MAXDIM];\
+hypre__J = hypre__block;\
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)\
+{\
+   hypre__lo[hypre__d] = (hypre__J % hypre__tn[hypre__d]) * hypre__ts[hypre__d];\
+   hypre__hi[hypre__d] = hypre_min(hypre__lo[hypre__d] + hypre__ts[hypre__d], hypre__tm[hypre__d]);\
+   hypre__J /= hypre__tn[hypre__d];\
+}
+
+/* set ik to the start of the current row of the tile */
+#define zypre_TileLoopSetK(k, ik) \
+ik = hypre__ikstart##k + hypre__lo[0]*hypre__sk##k[0];\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   ik += hypre__i[hypre__d]*hypre__sk##k[hypre__d];\
+}
+
+#define zypre_TileLoopRowsBegin()                                             \
+      for (hypre__i[2] = hypre__lo[2]; hypre__i[2] < hypre__hi[2]; hypre__i[2]++) \
+      {                                                                       \
+         for (hypre__i[1] = hypre__lo[1]; hypre__i[1] < hypre__hi[1]; hypre__i[1]++) \
+         {
+
+#define zypre_TileLoopRowsEnd()                                               \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_BoxLoop0Begin(ndim, loop_size)                                  \
+{                                                                             \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop0End()                                                   \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop1Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1)                       \
+{                                                                             \
+   HYPRE_Int i1;                                                              \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1;                                                           \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop1End(i1)                                                 \
+               i1 += hypre__i0inc1;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop2Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1,                       \
+                            dbox2, start2, stride2, i2)                       \
+{                                                                             \
+   HYPRE_Int i1, i2;                                                          \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop2End(i1, i2)                                             \
+               i1 += hypre__i0inc1;                                           \
+               i2 += hypre__i0inc2;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop3Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1,                       \
+                            dbox2, start2, stride2, i2,                       \
+                            dbox3, start3, stride3, i3)                       \
+{                                                                             \
+   HYPRE_Int i1, i2, i3;                                                      \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopDeclareK(3);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3;                                                   \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            zypre_TileLoopSetK(3, i3);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop3End(i1, i2, i3)                                         \
+               i1 += hypre__i0inc1;                                           \
+               i2 += hypre__i0inc2;                                           \
+               i3 += hypre__i0inc3;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BoxLoop4Begin(ndim, loop_size,                                  \
+                            dbox1, start1, stride1, i1,                       \
+                            dbox2, start2, stride2, i2,                       \
+                            dbox3, start3, stride3, i3,                       \
+                            dbox4, start4, stride4, i4)                       \
+{                                                                             \
+   HYPRE_Int i1, i2, i3, i4;                                                  \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopDeclareK(3);                                                  \
+   zypre_BoxLoopDeclareK(4);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
+   zypre_BoxLoopInitK(4, dbox4, start4, stride4, i4);                         \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3, i4;                                               \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            zypre_TileLoopSetK(3, i3);                                        \
+            zypre_TileLoopSetK(4, i4);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BoxLoop4End(i1, i2, i3, i4)                                     \
+               i1 += hypre__i0inc1;                                           \
+               i2 += hypre__i0inc2;                                           \
+               i3 += hypre__i0inc3;                                           \
+               i4 += hypre__i0inc4;                                           \
+            }                                                                 \
+      zypre_TileLoopRowsEnd()
+
+#define zypre_BasicBoxLoop1Begin(ndim, loop_size,                             \
+                                 stride1, i1)                                 \
+{                                                                             \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BasicBoxLoopInitK(1, stride1);                                       \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1;                                                           \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#define zypre_BasicBoxLoop2Begin(ndim, loop_size,                             \
+                                 stride1, i1,                                 \
+                                 stride2, i2)                                 \
+{                                                                             \
+   zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BasicBoxLoopInitK(1, stride1);                                       \
+   zypre_BasicBoxLoopInitK(2, stride2);                                       \
+   zypre_TileLoopInit();                                                      \
+   OMPT                                                                       \
+   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopRowsBegin()                                               \
+            zypre_TileLoopSetK(1, i1);                                        \
+            zypre_TileLoopSetK(2, i2);                                        \
+            for (hypre__I = hypre__lo[0]; hypre__I < hypre__hi[0]; hypre__I++) \
+            {
+
+#endif /* #if !defined(HYPRE_USING_BOXLOOP_TILING) */
+
 
 #define zypre_LoopBegin(size, idx)                                            \
 {                                                                             \
@@ -304,7 +581,15 @@
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
          {
 
-#define hypre_SerialBoxLoop1End(i1)  zypre_BoxLoop1End(i1)
+#define hypre_SerialBoxLoop1End(i1)                                           \
+            i1 += hypre__i0inc1;                                              \
+         }                                                                    \
+         zypre_BoxLoopInc1();                                                 \
+         i1 += hypre__ikinc1[hypre__d];                                       \
+         zypre_BoxLoopInc2();                                                 \
+      }                                                                       \
+   }                                                                          \
+}
 
 #define hypre_SerialBoxLoop2Begin(ndim, loop_size,                            \
                                   dbox1, start1, stride1, i1,                 \
@@ -328,7 +613,17 @@
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
          {
 
-#define hypre_SerialBoxLoop2End(i1, i2) zypre_BoxLoop2End(i1, i2)
+#define hypre_SerialBoxLoop2End(i1, i2)                                       \
+            i1 += hypre__i0inc1;                                              \
+            i2 += hypre__i0inc2;                                              \
+         }                                                                    \
+         zypre_BoxLoopInc1();                                                 \
+         i1 += hypre__ikinc1[hypre__d];                                       \
+         i2 += hypre__ikinc2[hypre__d];                                       \
+         zypre_BoxLoopInc2();                                                 \
+      }                                                                       \
+   }                                                                          \
+}
 
 /* Reduction BoxLoop1 */
 #define zypre_BoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
@@ -91,11 +91,44 @@ hypre_ComputeInfoDestroy( hypre_ComputeInfo  *compute_info )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Turn on overlapped communication and computation for compute packages
+ * created after this call.  The independent (interior) points are then split
+ * into chunks of about overlap_size points, and communication progress is
+ * tested between chunks.  A value of 0 turns the overlapped mode off.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetComputeOverlapSize( HYPRE_Int overlap_size )
+{
+   if (overlap_size < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleStructOverlapSize(hypre_handle()) = overlap_size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GetComputeOverlapSize( void )
+{
+   return hypre_HandleStructOverlapSize(hypre_handle());
+}
+
 /*--------------------------------------------------------------------------
  * Return descriptions of communications and computations patterns for
- * a given grid-stencil computation.  If HYPRE\_OVERLAP\_COMM\_COMP is
- * defined, then the patterns are computed to allow for overlapping
- * communications and computations.  The default is no overlap.
+ * a given grid-stencil computation.  In the overlapped mode (see
+ * hypre_SetComputeOverlapSize), the independent boxes are the grid boxes
+ * minus a border of the stencil width, split into slabs of about
+ * overlap_size points along the slowest dimension, and the dependent boxes
+ * are the borders.  The default is no overlap, where all boxes are dependent.
+ * Periodic grids that extend past their period are never split.
  *
  * Note: This routine assumes that the grid boxes do not overlap.
  *--------------------------------------------------------------------------*/
@@ -106,6 +139,7 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
                          hypre_ComputeInfo    **compute_info_ptr )
 {
    HYPRE_Int                ndim = hypre_StructGridNDim(grid);
+   HYPRE_Int                overlap_size = hypre_GetComputeOverlapSize();
    hypre_CommInfo          *comm_info;
    hypre_BoxArrayArray     *indt_boxes;
    hypre_BoxArrayArray     *dept_boxes;
@@ -115,15 +149,12 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
    hypre_BoxArray          *cbox_array;
    hypre_Box               *cbox;
 
-   HYPRE_Int                i;
-
-#ifdef HYPRE_OVERLAP_COMM_COMP
    hypre_Box               *rembox;
    hypre_Index             *stencil_shape;
    hypre_Index              lborder, rborder;
    HYPRE_Int                cbox_array_size;
-   HYPRE_Int                s, d;
-#endif
+   HYPRE_Int                num_slabs, slab_size, slab_min, slab_max;
+   HYPRE_Int                i, s, d;
 
    /*------------------------------------------------------
     * Extract needed grid info
@@ -137,122 +168,152 @@ hypre_CreateComputeInfo( hypre_StructGrid      *grid,
 
    hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
 
-#ifdef HYPRE_OVERLAP_COMM_COMP
-
-   /*------------------------------------------------------
-    * Compute border info
-    *------------------------------------------------------*/
+   /* Coarse grids of a periodic problem may extend past the period, so that
+    * boxes overlap through the periodicity.  The border/interior split is
+    * not safe in that case. */
+   for (d = 0; d < ndim; d++)
+   {
+      i = hypre_IndexD(hypre_StructGridPeriodic(grid), d);
+      if (i && (hypre_BoxSizeD(hypre_StructGridBoundingBox(grid), d) > i))
+      {
+         overlap_size = 0;
+      }
+   }
 
-   hypre_SetIndex(lborder, 0);
-   hypre_SetIndex(rborder, 0);
-   stencil_shape = hypre_StructStencilShape(stencil);
-   for (s = 0; s < hypre_StructStencilSize(stencil); s++)
+   if (overlap_size > 0)
    {
-      for (d = 0; d < ndim; d++)
+      /*------------------------------------------------------
+       * Compute border info
+       *------------------------------------------------------*/
+
+      hypre_SetIndex(lborder, 0);
+      hypre_SetIndex(rborder, 0);
+      stencil_shape = hypre_StructStencilShape(stencil);
+      for (s = 0; s < hypre_StructStencilSize(stencil); s++)
       {
-         i = hypre_IndexD(stencil_shape[s], d);
-         if (i < 0)
-         {
-            lborder[d] = hypre_max(lborder[d], -i);
-         }
-         else if (i > 0)
+         for (d = 0; d < ndim; d++)
          {
-            rborder[d] = hypre_max(rborder[d], i);
+            i = hypre_IndexD(stencil_shape[s], d);
+            if (i < 0)
+            {
+               lborder[d] = hypre_max(lborder[d], -i);
+            }
+            else if (i > 0)
+            {
+               rborder[d] = hypre_max(rborder[d], i);
+            }
          }
       }
-   }
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 2 * ndim);
-
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
-      cbox_array_size = 0;
-      for (d = 0; d < ndim; d++)
+      rembox = hypre_BoxCreate(hypre_StructGridNDim(grid));
+      hypre_ForBoxI(i, boxes)
       {
-         if ( (hypre_BoxVolume(rembox)) && lborder[d] )
-         {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMaxD(cbox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
-            hypre_BoxIMinD(rembox, d) =
-               hypre_BoxIMinD(cbox, d) + lborder[d];
-            cbox_array_size++;
-         }
-         if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 2 * ndim);
+
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+         cbox_array_size = 0;
+         for (d = 0; d < ndim; d++)
          {
-            cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
-            hypre_CopyBox(rembox, cbox);
-            hypre_BoxIMinD(cbox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
-            hypre_BoxIMaxD(rembox, d) =
-               hypre_BoxIMaxD(cbox, d) - rborder[d];
-            cbox_array_size++;
+            if ( (hypre_BoxVolume(rembox)) && lborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMaxD(cbox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d] - 1;
+               hypre_BoxIMinD(rembox, d) =
+                  hypre_BoxIMinD(cbox, d) + lborder[d];
+               cbox_array_size++;
+            }
+            if ( (hypre_BoxVolume(rembox)) && rborder[d] )
+            {
+               cbox = hypre_BoxArrayBox(cbox_array, cbox_array_size);
+               hypre_CopyBox(rembox, cbox);
+               hypre_BoxIMinD(cbox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d] + 1;
+               hypre_BoxIMaxD(rembox, d) =
+                  hypre_BoxIMaxD(cbox, d) - rborder[d];
+               cbox_array_size++;
+            }
          }
+         hypre_BoxArraySetSize(cbox_array, cbox_array_size);
       }
-      hypre_BoxArraySetSize(cbox_array, cbox_array_size);
-   }
-   hypre_BoxDestroy(rembox);
 
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the independent boxes, split into slabs
+       *------------------------------------------------------*/
 
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
-
-      for (d = 0; d < ndim; d++)
+      hypre_ForBoxI(i, boxes)
       {
-         if ( lborder[d] )
+         cbox_array = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
+
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), rembox);
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(rembox, d) += lborder[d];
+            hypre_BoxIMaxD(rembox, d) -= rborder[d];
+         }
+
+         /* slice along the slowest dimension with more than one point */
+         for (d = ndim - 1; d > 0; d--)
          {
-            hypre_BoxIMinD(cbox, d) += lborder[d];
+            if (hypre_BoxSizeD(rembox, d) > 1)
+            {
+               break;
+            }
          }
-         if ( rborder[d] )
+         num_slabs = (hypre_BoxVolume(rembox) + overlap_size - 1) / overlap_size;
+         num_slabs = hypre_max(1, hypre_min(num_slabs, hypre_BoxSizeD(rembox, d)));
+         slab_size = (hypre_BoxSizeD(rembox, d) + num_slabs - 1) / num_slabs;
+
+         hypre_BoxArraySetSize(cbox_array, 0);
+         slab_min = hypre_BoxIMinD(rembox, d);
+         do
          {
-            hypre_BoxIMaxD(cbox, d) -= rborder[d];
+            slab_max = hypre_min(slab_min + slab_size - 1, hypre_BoxIMaxD(rembox, d));
+            cbox = hypre_BoxCreate(ndim);
+            hypre_CopyBox(rembox, cbox);
+            hypre_BoxIMinD(cbox, d) = slab_min;
+            hypre_BoxIMaxD(cbox, d) = slab_max;
+            hypre_AppendBox(cbox, cbox_array);
+            hypre_BoxDestroy(cbox);
+            slab_min = slab_max + 1;
          }
+         while (slab_min <= hypre_BoxIMaxD(rembox, d));
       }
+      hypre_BoxDestroy(rembox);
    }
+   else
+   {
+      /*------------------------------------------------------
+       * Set up the independent boxes
+       *------------------------------------------------------*/
 
-#else
-
-   /*------------------------------------------------------
-    * Set up the independent boxes
-    *------------------------------------------------------*/
-
-   indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      indt_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   /*------------------------------------------------------
-    * Set up the dependent boxes
-    *------------------------------------------------------*/
+      /*------------------------------------------------------
+       * Set up the dependent boxes
+       *------------------------------------------------------*/
 
-   dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+      dept_boxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
 
-   hypre_ForBoxI(i, boxes)
-   {
-      cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
-      hypre_BoxArraySetSize(cbox_array, 1);
-      cbox = hypre_BoxArrayBox(cbox_array, 0);
-      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      hypre_ForBoxI(i, boxes)
+      {
+         cbox_array = hypre_BoxArrayArrayBoxArray(dept_boxes, i);
+         hypre_BoxArraySetSize(cbox_array, 1);
+         cbox = hypre_BoxArrayBox(cbox_array, 0);
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), cbox);
+      }
    }
 
-#endif
-
    /*------------------------------------------------------
     * Return
     *------------------------------------------------------*/
@@ -358,3 +419,26 @@ hypre_FinalizeIndtComputations( hypre_CommHandle *comm_handle )
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Test for completion of a communication exchange started with
+ * hypre_InitializeIndtComputations.  Calling this between chunks of the
+ * independent computations lets the MPI library progress the exchange in
+ * the meantime.  The exchange must still be finished with
+ * hypre_FinalizeIndtComputations.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ProgressIndtComputations( hypre_CommHandle *comm_handle )
+{
+   HYPRE_Int  flag;
+
+   if (comm_handle && hypre_CommHandleNumRequests(comm_handle))
+   {
+      hypre_MPI_Testall(hypre_CommHandleNumRequests(comm_handle),
+                        hypre_CommHandleRequests(comm_handle), &flag,
+                        hypre_CommHandleStatus(comm_handle));
+   }
+
+   return hypre_error_flag;
+}
@@ -97,6 +97,8 @@ HYPRE_Int hypre_AppendBoxArray ( hypre_BoxArray *box_array_0, hypre_BoxArray *bo
 hypre_BoxArrayArray *hypre_BoxArrayArrayCreate ( HYPRE_Int size, HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayArrayDestroy ( hypre_BoxArrayArray *box_array_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayDuplicate ( hypre_BoxArrayArray *box_array_array );
+HYPRE_Int hypre_BoxLoopSetTileSize ( HYPRE_Int tile_size );
+HYPRE_Int hypre_BoxLoopGetTileSize ( void );
 
 /* box_manager.c */
 HYPRE_Int hypre_BoxManEntryGetInfo ( hypre_BoxManEntry *entry, void **info_ptr );
@@ -136,6 +138,8 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManDeleteEntry ( hypre_BoxManager *manager, HYPRE_Int proc, HYPRE_Int id );
+HYPRE_Int hypre_BoxManAssembleIncremental ( hypre_BoxManager *manager );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -174,6 +178,8 @@ HYPRE_Int hypre_ComputeInfoProjectRecv ( hypre_ComputeInfo *compute_info, hypre_
 HYPRE_Int hypre_ComputeInfoProjectComp ( hypre_ComputeInfo *compute_info, hypre_Index index,
                                          hypre_Index stride );
 HYPRE_Int hypre_ComputeInfoDestroy ( hypre_ComputeInfo *compute_info );
+HYPRE_Int hypre_SetComputeOverlapSize ( HYPRE_Int overlap_size );
+HYPRE_Int hypre_GetComputeOverlapSize ( void );
 HYPRE_Int hypre_CreateComputeInfo ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                     hypre_ComputeInfo **compute_info_ptr );
 HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArray *data_space,
@@ -182,6 +188,7 @@ HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
 HYPRE_Int hypre_InitializeIndtComputations ( hypre_ComputePkg *compute_pkg, HYPRE_Complex *data,
                                              hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeIndtComputations ( hypre_CommHandle *comm_handle );
+HYPRE_Int hypre_ProgressIndtComputations ( hypre_CommHandle *comm_handle );
 
 /* HYPRE_struct_grid.c */
 HYPRE_Int HYPRE_StructGridCreate ( MPI_Comm comm, HYPRE_Int dim, HYPRE_StructGrid *grid );
@@ -191,6 +198,9 @@ HYPRE_Int HYPRE_StructGridSetExtents ( HYPRE_StructGrid grid, HYPRE_Int *ilower,
 HYPRE_Int HYPRE_StructGridSetPeriodic ( HYPRE_StructGrid grid, HYPRE_Int *periodic );
 HYPRE_Int HYPRE_StructGridAssemble ( HYPRE_StructGrid grid );
 HYPRE_Int HYPRE_StructGridSetNumGhost ( HYPRE_StructGrid grid, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_StructSetBoxLoopTileSize ( HYPRE_Int tile_size );
+HYPRE_Int HYPRE_StructSetCommOverlapSize ( HYPRE_Int overlap_size );
+HYPRE_Int HYPRE_StructSetPersistentComm ( HYPRE_Int persistent );
 
 /* HYPRE_struct_matrix.c */
 HYPRE_Int HYPRE_StructMatrixCreate ( MPI_Comm comm, HYPRE_StructGrid grid,
@@ -279,6 +289,8 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_communication.c */
+HYPRE_Int hypre_CommSetPersistent ( HYPRE_Int persistent );
+HYPRE_Int hypre_CommGetPersistent ( void );
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
                                 hypre_BoxArray *recv_data_space, HYPRE_Int num_values, HYPRE_Int **orders, HYPRE_Int reverse,
                                 MPI_Comm comm, hypre_CommPkg **comm_pkg_ptr );
@@ -288,6 +300,11 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg, HYPRE_Int tag );
+HYPRE_Int hypre_InitializePersistentCommunication ( hypre_CommPkg *comm_pkg,
+                                                    HYPRE_Complex *send_data, HYPRE_Complex *recv_data, HYPRE_Int action,
+                                                    hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_FinalizePersistentCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -381,6 +398,9 @@ hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
                                       hypre_StructMatrix *to_matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
+HYPRE_Int hypre_StructMatrixCompressMostlyConstant ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixMCExceptionInBox ( hypre_StructMatrix *matrix, HYPRE_Int e,
+                                               hypre_Box *box, hypre_IndexRef stride );
 
 /* struct_matrix_mask.c */
 hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix,
@@ -392,6 +412,11 @@ HYPRE_Int hypre_StructMatvecSetup ( void *matvec_vdata, hypre_StructMatrix *A,
                                     hypre_StructVector *x );
 HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
+HYPRE_Int hypre_StructMatvecFusedSupported ( hypre_StructMatrix *A, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFused ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                    hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMC ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                 hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
@@ -19,6 +19,31 @@ FILE      *file;
 #define hypre_CommPrefixSize(ne)                                        \
    ( (((1+ne)*sizeof(HYPRE_Int) + ne*sizeof(hypre_Box))/sizeof(HYPRE_Complex)) + 1 )
 
+/*--------------------------------------------------------------------------
+ * Turn on persistent communication for communication packages created after
+ * this call.  After the first communication of a package, the exchange is
+ * then done with MPI persistent requests on fixed buffers that are packed and
+ * unpacked through precomputed index lists.  Only host memory is supported;
+ * other memory locations use the regular exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommSetPersistent( HYPRE_Int persistent )
+{
+   hypre_HandleStructCommPersistent(hypre_handle()) = persistent;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommGetPersistent( void )
+{
+   return hypre_HandleStructCommPersistent(hypre_handle());
+}
+
 /*--------------------------------------------------------------------------
  * Create a communication package.  A grid-based description of a communication
  * exchange is passed in.  This description is then compiled into an
@@ -129,6 +154,7 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
 
    hypre_CommPkgComm(comm_pkg)      = comm;
    hypre_CommPkgFirstComm(comm_pkg) = 1;
+   hypre_CommPkgPersistent(comm_pkg) = hypre_CommGetPersistent();
    hypre_CommPkgNDim(comm_pkg)      = ndim;
    hypre_CommPkgNumValues(comm_pkg) = num_values;
    hypre_CommPkgNumOrders(comm_pkg) = 0;
@@ -805,6 +831,298 @@ hypre_StructCommunicationReleaseBuffer(HYPRE_Complex       *buffer,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Compute the data offsets of the values in a communication entry, in the
+ * order in which they are packed in a buffer.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommEntryTypeGetIndices( HYPRE_Int  ndim,
+                               HYPRE_Int *length_array,
+                               HYPRE_Int *stride_array,
+                               HYPRE_Int  offset,
+                               HYPRE_Int *indices )
+{
+   HYPRE_Int  index[HYPRE_MAXDIM];
+   HYPRE_Int  size, i, d;
+
+   size = 1;
+   for (d = 0; d < ndim; d++)
+   {
+      index[d] = 0;
+      size *= length_array[d];
+   }
+
+   for (i = 0; i < size; i++)
+   {
+      indices[i] = offset;
+      for (d = 0; d < ndim; d++)
+      {
+         index[d]++;
+         offset += stride_array[d];
+         if (index[d] < length_array[d])
+         {
+            break;
+         }
+         offset -= length_array[d] * stride_array[d];
+         index[d] = 0;
+      }
+   }
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * Set up the persistent communication of a package.  This must be called
+ * after the first communication, when the receive entries are known.  The
+ * buffer offsets of every value are flattened into index lists, the buffers
+ * are allocated once, and the persistent requests are created for 'tag'.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgSetupPersistent( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends  = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm       = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex       *send_buffer;
+   HYPRE_Complex       *recv_buffer;
+   HYPRE_Int           *send_indices;
+   HYPRE_Int           *recv_indices;
+
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   HYPRE_Int           *order;
+   HYPRE_Int            offset, data_offset, size;
+   HYPRE_Int            i, j, k, d, ll;
+
+   send_buffer  = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                HYPRE_MEMORY_HOST);
+   recv_buffer  = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                HYPRE_MEMORY_HOST);
+   send_indices = hypre_TAlloc(HYPRE_Int, hypre_CommPkgSendBufsize(comm_pkg),
+                               HYPRE_MEMORY_HOST);
+   recv_indices = hypre_TAlloc(HYPRE_Int, hypre_CommPkgRecvBufsize(comm_pkg),
+                               HYPRE_MEMORY_HOST);
+   requests     = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs,
+                                HYPRE_MEMORY_HOST);
+
+   /* the buffer sizes may be larger than the data (unused values are -1) */
+   for (k = 0; k < hypre_CommPkgSendBufsize(comm_pkg); k++)
+   {
+      send_indices[k] = -1;
+   }
+   for (k = 0; k < hypre_CommPkgRecvBufsize(comm_pkg); k++)
+   {
+      recv_indices[k] = -1;
+   }
+
+   /* send indices (see the packing loop in hypre_InitializeCommunication) */
+   offset = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      k = offset;
+      offset += hypre_CommTypeBufsize(comm_type);
+      for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+      {
+         comm_entry   = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         order        = hypre_CommEntryTypeOrder(comm_entry);
+         data_offset  = hypre_CommEntryTypeOffset(comm_entry);
+         for (ll = 0; ll < num_values; ll++)
+         {
+            if (order[ll] > -1)
+            {
+               k += hypre_CommEntryTypeGetIndices(ndim, length_array, stride_array,
+                                                  data_offset + order[ll] * stride_array[ndim],
+                                                  &send_indices[k]);
+            }
+            else
+            {
+               /* zero values */
+               size = 1;
+               for (d = 0; d < ndim; d++)
+               {
+                  size *= length_array[d];
+               }
+               k += size;
+            }
+         }
+      }
+   }
+
+   /* recv indices (see the unpacking loop in hypre_FinalizeCommunication) */
+   offset = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      k = offset;
+      offset += hypre_CommTypeBufsize(comm_type);
+      for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+      {
+         comm_entry   = hypre_CommTypeEntry(comm_type, j);
+         length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+         stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+         data_offset  = hypre_CommEntryTypeOffset(comm_entry);
+         for (ll = 0; ll < num_values; ll++)
+         {
+            k += hypre_CommEntryTypeGetIndices(ndim, length_array, stride_array,
+                                               data_offset + ll * stride_array[ndim],
+                                               &recv_indices[k]);
+         }
+      }
+   }
+
+   /* create the persistent requests */
+   j = 0;
+   offset = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffer + offset,
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+      offset += hypre_CommTypeBufsize(comm_type);
+   }
+   offset = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffer + offset,
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+      offset += hypre_CommTypeBufsize(comm_type);
+   }
+
+   hypre_CommPkgPersistentTag(comm_pkg)        = tag;
+   hypre_CommPkgPersistentRequests(comm_pkg)   = requests;
+   hypre_CommPkgPersistentStatus(comm_pkg)     =
+      hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   hypre_CommPkgPersistentSendBuffer(comm_pkg) = send_buffer;
+   hypre_CommPkgPersistentRecvBuffer(comm_pkg) = recv_buffer;
+   hypre_CommPkgSendIndices(comm_pkg)          = send_indices;
+   hypre_CommPkgRecvIndices(comm_pkg)          = recv_indices;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Persistent version of hypre_InitializeCommunication.  The send buffer is
+ * gathered through the send index list and the persistent requests are
+ * started.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_InitializePersistentCommunication( hypre_CommPkg        *comm_pkg,
+                                         HYPRE_Complex        *send_data,
+                                         HYPRE_Complex        *recv_data,
+                                         HYPRE_Int             action,
+                                         hypre_CommHandle    **comm_handle_ptr )
+{
+   hypre_CommHandle    *comm_handle;
+
+   HYPRE_Int            num_requests = hypre_CommPkgNumSends(comm_pkg) +
+                                       hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int            send_bufsize = hypre_CommPkgSendBufsize(comm_pkg);
+   HYPRE_Complex       *send_buffer  = hypre_CommPkgPersistentSendBuffer(comm_pkg);
+   HYPRE_Int           *send_indices = hypre_CommPkgSendIndices(comm_pkg);
+   HYPRE_Int            i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_bufsize; i++)
+   {
+      send_buffer[i] = (send_indices[i] < 0) ? 0.0 : send_data[send_indices[i]];
+   }
+
+   if (num_requests)
+   {
+      hypre_MPI_Startall(num_requests, hypre_CommPkgPersistentRequests(comm_pkg));
+   }
+   hypre_CommPkgPersistentBusy(comm_pkg) = 1;
+
+   hypre_ExchangeLocalData(comm_pkg, send_data, recv_data, action);
+
+   comm_handle = hypre_CTAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_CommHandleSendData(comm_handle)    = send_data;
+   hypre_CommHandleRecvData(comm_handle)    = recv_data;
+   hypre_CommHandleNumRequests(comm_handle) = num_requests;
+   hypre_CommHandleRequests(comm_handle)    = hypre_CommPkgPersistentRequests(comm_pkg);
+   hypre_CommHandleStatus(comm_handle)      = hypre_CommPkgPersistentStatus(comm_pkg);
+   hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandlePersistent(comm_handle)  = 1;
+
+   *comm_handle_ptr = comm_handle;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Persistent version of hypre_FinalizeCommunication.  The requests are
+ * completed (but kept for the next exchange) and the receive buffer is
+ * scattered through the receive index list.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FinalizePersistentCommunication( hypre_CommHandle *comm_handle )
+{
+   hypre_CommPkg       *comm_pkg     = hypre_CommHandleCommPkg(comm_handle);
+   HYPRE_Complex       *recv_data    = hypre_CommHandleRecvData(comm_handle);
+   HYPRE_Int            recv_bufsize = hypre_CommPkgRecvBufsize(comm_pkg);
+   HYPRE_Complex       *recv_buffer  = hypre_CommPkgPersistentRecvBuffer(comm_pkg);
+   HYPRE_Int           *recv_indices = hypre_CommPkgRecvIndices(comm_pkg);
+   HYPRE_Int            i;
+
+   if (hypre_CommHandleNumRequests(comm_handle))
+   {
+      hypre_MPI_Waitall(hypre_CommHandleNumRequests(comm_handle),
+                        hypre_CommHandleRequests(comm_handle),
+                        hypre_CommHandleStatus(comm_handle));
+   }
+
+   /* sequential, since different entries may update the same location */
+   if (hypre_CommHandleAction(comm_handle) > 0)
+   {
+      for (i = 0; i < recv_bufsize; i++)
+      {
+         if (recv_indices[i] > -1)
+         {
+            recv_data[recv_indices[i]] += recv_buffer[i];
+         }
+      }
+   }
+   else
+   {
+      for (i = 0; i < recv_bufsize; i++)
+      {
+         if (recv_indices[i] > -1)
+         {
+            recv_data[recv_indices[i]] = recv_buffer[i];
+         }
+      }
+   }
+
+   hypre_CommPkgPersistentBusy(comm_pkg) = 0;
+
+   hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -858,6 +1176,26 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
    HYPRE_MemoryLocation memory_location     = hypre_HandleMemoryLocation(hypre_handle());
    HYPRE_MemoryLocation memory_location_mpi = memory_location;
 
+   /*--------------------------------------------------------------------
+    * use the persistent exchange when possible
+    *--------------------------------------------------------------------*/
+
+   if ( hypre_CommPkgPersistent(comm_pkg) &&
+        !hypre_CommPkgFirstComm(comm_pkg) &&
+        !hypre_CommPkgPersistentBusy(comm_pkg) &&
+        (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST) )
+   {
+      if (hypre_CommPkgPersistentRequests(comm_pkg) == NULL)
+      {
+         hypre_CommPkgSetupPersistent(comm_pkg, tag);
+      }
+      if (hypre_CommPkgPersistentTag(comm_pkg) == tag)
+      {
+         return hypre_InitializePersistentCommunication(comm_pkg, send_data, recv_data,
+                                                        action, comm_handle_ptr);
+      }
+   }
+
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
@@ -1107,6 +1445,7 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
    hypre_CommHandleAction(comm_handle)         = action;
    hypre_CommHandleSendBuffersMPI(comm_handle) = send_buffers_mpi;
    hypre_CommHandleRecvBuffersMPI(comm_handle) = recv_buffers_mpi;
+   hypre_CommHandlePersistent(comm_handle)     = 0;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1155,6 +1494,11 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    HYPRE_MemoryLocation memory_location     = hypre_HandleMemoryLocation(hypre_handle());
    HYPRE_MemoryLocation memory_location_mpi = memory_location;
 
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      return hypre_FinalizePersistentCommunication(comm_handle);
+   }
+
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    if (!hypre_GetGpuAwareMPI())
    {
@@ -1483,6 +1827,20 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      if (hypre_CommPkgPersistentRequests(comm_pkg))
+      {
+         for (i = 0; i < (hypre_CommPkgNumSends(comm_pkg) + hypre_CommPkgNumRecvs(comm_pkg)); i++)
+         {
+            hypre_MPI_Request_free(&hypre_CommPkgPersistentRequests(comm_pkg)[i]);
+         }
+         hypre_TFree(hypre_CommPkgPersistentRequests(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentSendBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgPersistentRecvBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgSendIndices(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CommPkgRecvIndices(comm_pkg), HYPRE_MEMORY_HOST);
+      }
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -123,6 +123,19 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+   /* persistent communication (set up after the first communication) */
+   HYPRE_Int            persistent;
+   HYPRE_Int            persistent_tag;
+   HYPRE_Int            persistent_busy;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex       *persistent_send_buffer;
+   HYPRE_Complex       *persistent_recv_buffer;
+   /* send_data offsets (-1 = zero) for each send buffer value */
+   HYPRE_Int           *send_indices;
+   /* recv_data offsets for each recv buffer value */
+   HYPRE_Int           *recv_indices;
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -148,6 +161,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* uses the persistent requests and buffers of comm_pkg? */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -241,6 +257,16 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentBusy(comm_pkg)             (comm_pkg -> persistent_busy)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffer(comm_pkg)       (comm_pkg -> persistent_send_buffer)
+#define hypre_CommPkgPersistentRecvBuffer(comm_pkg)       (comm_pkg -> persistent_recv_buffer)
+#define hypre_CommPkgSendIndices(comm_pkg)                (comm_pkg -> send_indices)
+#define hypre_CommPkgRecvIndices(comm_pkg)                (comm_pkg -> recv_indices)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -256,5 +282,6 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
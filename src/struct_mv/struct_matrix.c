@@ -66,6 +66,7 @@ hypre_StructMatrixCreate( MPI_Comm             comm,
    /* set defaults */
    hypre_StructMatrixSymmetric(matrix) = 0;
    hypre_StructMatrixConstantCoefficient(matrix) = 0;
+   hypre_StructMatrixMostlyConstant(matrix) = 0;
    for (i = 0; i < 2 * ndim; i++)
    {
       hypre_StructMatrixNumGhost(matrix)[i] = hypre_StructGridNumGhost(grid)[i];
@@ -106,6 +107,10 @@ hypre_StructMatrixDestroy( hypre_StructMatrix *matrix )
             hypre_TFree(hypre_StructMatrixDataConst(matrix), HYPRE_MEMORY_HOST);
          }
          hypre_TFree(hypre_StructMatrixStencilData(matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_StructMatrixMCValues(matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_StructMatrixMCStarts(matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_StructMatrixMCIndices(matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_StructMatrixMCExceptions(matrix), HYPRE_MEMORY_HOST);
          hypre_CommPkgDestroy(hypre_StructMatrixCommPkg(matrix));
          if (hypre_BoxArraySize(hypre_StructMatrixDataSpace(matrix)) > 0)
          {
@@ -2118,3 +2123,188 @@ hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix)
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCompressMostlyConstant
+ *
+ * Switches a variable coefficient matrix to mostly-constant storage.  For each
+ * box, the stencil row at the center of the box is kept once, and the points
+ * of the box whose rows differ from it (typically the points next to the
+ * boundary) are kept in a table of exceptions.  The variable coefficient data
+ * is then freed.  Nothing is done unless the matrix owns its data on the host
+ * and the new storage takes less than half the memory of the old.
+ *
+ * A compressed matrix can no longer be modified, and is only understood by the
+ * struct matvec and the point and red/black Gauss-Seidel relaxation routines.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixCompressMostlyConstant( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(matrix);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(matrix);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   hypre_BoxArray       *grid_boxes    = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   hypre_BoxArray       *data_space    = hypre_StructMatrixDataSpace(matrix);
+   HYPRE_Int             num_boxes     = hypre_BoxArraySize(grid_boxes);
+
+   HYPRE_Complex        *mc_values;
+   HYPRE_Int            *mc_starts;
+   hypre_Index          *mc_indices;
+   HYPRE_Complex        *mc_exceptions;
+   HYPRE_Complex        *cvalues;
+   HYPRE_Int             num_exceptions;
+   size_t                mc_bytes, data_bytes;
+
+   hypre_Box            *grid_box;
+   hypre_Box            *data_box;
+   hypre_IndexRef        start;
+   hypre_Index           center, stride, loop_size, lindex;
+   HYPRE_Int             pass, e, i, d, s;
+
+   if (hypre_StructMatrixConstantCoefficient(matrix) != 0 ||
+       hypre_StructMatrixMostlyConstant(matrix) ||
+       !hypre_StructMatrixDataAlloced(matrix) ||
+       hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(matrix)) != HYPRE_EXEC_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Pick the constant rows, then count (pass 0) and store (pass 1) the
+    * exceptions
+    *-----------------------------------------------------------------------*/
+
+   mc_values     = hypre_CTAlloc(HYPRE_Complex, num_boxes * stencil_size, HYPRE_MEMORY_HOST);
+   mc_starts     = hypre_CTAlloc(HYPRE_Int, num_boxes + 1, HYPRE_MEMORY_HOST);
+   mc_indices    = NULL;
+   mc_exceptions = NULL;
+
+   hypre_SetIndex(stride, 1);
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      e = 0;
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         grid_box = hypre_BoxArrayBox(grid_boxes, i);
+         data_box = hypre_BoxArrayBox(data_space, i);
+         cvalues  = &mc_values[i * stencil_size];
+
+         mc_starts[i] = e;
+         if (hypre_BoxVolume(grid_box) == 0)
+         {
+            continue;
+         }
+
+         start = hypre_BoxIMin(grid_box);
+         if (pass == 0)
+         {
+            hypre_SetIndex(center, 0);
+            for (d = 0; d < ndim; d++)
+            {
+               hypre_IndexD(center, d) =
+                  (hypre_BoxIMinD(grid_box, d) + hypre_BoxIMaxD(grid_box, d)) / 2;
+            }
+            for (s = 0; s < stencil_size; s++)
+            {
+               cvalues[s] = *hypre_StructMatrixBoxDataValue(matrix, i, s, center);
+            }
+         }
+
+         hypre_BoxGetSize(grid_box, loop_size);
+         hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                   data_box, start, stride, Ai);
+         {
+            for (s = 0; s < stencil_size; s++)
+            {
+               if (hypre_StructMatrixBoxData(matrix, i, s)[Ai] != cvalues[s])
+               {
+                  break;
+               }
+            }
+            if (s < stencil_size)
+            {
+               if (pass == 1)
+               {
+                  zypre_BoxLoopGetIndex(lindex);
+                  hypre_SetIndex(mc_indices[e], 0);
+                  hypre_AddIndexes(lindex, start, ndim, mc_indices[e]);
+                  for (s = 0; s < stencil_size; s++)
+                  {
+                     mc_exceptions[e * stencil_size + s] =
+                        hypre_StructMatrixBoxData(matrix, i, s)[Ai];
+                  }
+               }
+               e++;
+            }
+         }
+         hypre_SerialBoxLoop1End(Ai);
+      }
+      mc_starts[num_boxes] = e;
+
+      if (pass == 0)
+      {
+         num_exceptions = e;
+         mc_bytes   = (size_t) (num_boxes + num_exceptions) * stencil_size * sizeof(HYPRE_Complex) +
+                      (size_t) num_exceptions * sizeof(hypre_Index) +
+                      (size_t) (num_boxes + 1) * sizeof(HYPRE_Int);
+         data_bytes = (size_t) hypre_StructMatrixDataSize(matrix) * sizeof(HYPRE_Complex);
+         if (2 * mc_bytes >= data_bytes)
+         {
+            hypre_TFree(mc_values, HYPRE_MEMORY_HOST);
+            hypre_TFree(mc_starts, HYPRE_MEMORY_HOST);
+            return hypre_error_flag;
+         }
+
+         mc_indices    = hypre_TAlloc(hypre_Index, num_exceptions, HYPRE_MEMORY_HOST);
+         mc_exceptions = hypre_TAlloc(HYPRE_Complex, num_exceptions * stencil_size,
+                                      HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Drop the variable coefficient data
+    *-----------------------------------------------------------------------*/
+
+   hypre_TFree(hypre_StructMatrixData(matrix), hypre_StructMatrixMemoryLocation(matrix));
+   hypre_StructMatrixData(matrix)     = NULL;
+   hypre_StructMatrixDataSize(matrix) = 0;
+
+   hypre_StructMatrixMostlyConstant(matrix) = 1;
+   hypre_StructMatrixMCValues(matrix)       = mc_values;
+   hypre_StructMatrixMCStarts(matrix)       = mc_starts;
+   hypre_StructMatrixMCIndices(matrix)      = mc_indices;
+   hypre_StructMatrixMCExceptions(matrix)   = mc_exceptions;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if exception e of a mostly-constant matrix lies in box on the
+ * lattice with the given stride that starts at the lower corner of box.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixMCExceptionInBox( hypre_StructMatrix *matrix,
+                                    HYPRE_Int           e,
+                                    hypre_Box          *box,
+                                    hypre_IndexRef      stride )
+{
+   hypre_IndexRef  index = hypre_StructMatrixMCIndices(matrix)[e];
+   HYPRE_Int       d;
+
+   if (!hypre_IndexInBox(index, box))
+   {
+      return 0;
+   }
+   for (d = 0; d < hypre_BoxNDim(box); d++)
+   {
+      if ((hypre_IndexD(index, d) - hypre_BoxIMinD(box, d)) % hypre_IndexD(stride, d))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
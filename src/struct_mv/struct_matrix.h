@@ -46,6 +46,17 @@ typedef struct hypre_StructMatrix_struct
                                                        or 2 for constant coefficient
                                                        with variable diagonal */
 
+   HYPRE_Int             mostly_constant;           /* Boolean: data is stored as one
+                                                       constant stencil row per box
+                                                       plus a table of exceptions */
+   HYPRE_Complex        *mc_values;                 /* num-boxes by stencil-size array
+                                                       of constant stencil rows */
+   HYPRE_Int            *mc_starts;                 /* Exceptions of box b are numbered
+                                                       mc_starts[b] to mc_starts[b+1]-1 */
+   hypre_Index          *mc_indices;                /* Grid index of each exception */
+   HYPRE_Complex        *mc_exceptions;             /* num-exceptions by stencil-size
+                                                       array of stencil rows */
+
    HYPRE_Int             symmetric;                 /* Is the matrix symmetric */
    HYPRE_Int            *symm_elements;             /* Which elements are "symmetric" */
    HYPRE_Int             num_ghost[2 * HYPRE_MAXDIM]; /* Num ghost layers in each direction */
@@ -77,6 +88,11 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixDataConstSize(matrix)       ((matrix) -> data_const_size)
 #define hypre_StructMatrixDataIndices(matrix)         ((matrix) -> data_indices)
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
+#define hypre_StructMatrixMostlyConstant(matrix)      ((matrix) -> mostly_constant)
+#define hypre_StructMatrixMCValues(matrix)            ((matrix) -> mc_values)
+#define hypre_StructMatrixMCStarts(matrix)            ((matrix) -> mc_starts)
+#define hypre_StructMatrixMCIndices(matrix)           ((matrix) -> mc_indices)
+#define hypre_StructMatrixMCExceptions(matrix)        ((matrix) -> mc_exceptions)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
@@ -97,6 +113,14 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_BoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+#define hypre_StructMatrixMCBoxValues(matrix, b) \
+(hypre_StructMatrixMCValues(matrix) + \
+ (b) * hypre_StructStencilSize(hypre_StructMatrixStencil(matrix)))
+
+#define hypre_StructMatrixMCExceptionValues(matrix, e) \
+(hypre_StructMatrixMCExceptions(matrix) + \
+ (e) * hypre_StructStencilSize(hypre_StructMatrixStencil(matrix)))
+
 #define hypre_CCStructMatrixBoxDataValue(matrix, b, s, index) \
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
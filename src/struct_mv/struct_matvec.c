@@ -30,8 +30,59 @@ typedef struct
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
 
+   /* independent boxes split into chunks for overlapped communication */
+   HYPRE_Int             num_indt_chunks;
+   hypre_BoxArrayArray **indt_chunks;
+
 } hypre_StructMatvecData;
 
+/*--------------------------------------------------------------------------
+ * Compute y += A*x over the boxes in compute_box_aa, dispatching to the
+ * kernel that matches the storage of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructMatvecComputeBoxes( HYPRE_Complex        alpha,
+                                hypre_StructMatrix  *A,
+                                hypre_StructVector  *x,
+                                hypre_StructVector  *y,
+                                hypre_BoxArrayArray *compute_box_aa,
+                                hypre_IndexRef       stride,
+                                HYPRE_Int            use_fused )
+{
+   if (hypre_StructMatrixMostlyConstant(A))
+   {
+      hypre_StructMatvecMC( alpha, A, x, y, compute_box_aa, stride );
+   }
+   else if (use_fused)
+   {
+      hypre_StructMatvecFused( alpha, A, x, y, compute_box_aa, stride );
+   }
+   else
+   {
+      switch ( hypre_StructMatrixConstantCoefficient(A) )
+      {
+         case 0:
+         {
+            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            break;
+         }
+         case 1:
+         {
+            hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            break;
+         }
+         case 2:
+         {
+            hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
+            break;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCreate
  *--------------------------------------------------------------------------*/
@@ -61,6 +112,11 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    hypre_StructStencil     *stencil;
    hypre_ComputeInfo       *compute_info;
    hypre_ComputePkg        *compute_pkg;
+   hypre_BoxArrayArray     *indt_boxes;
+   hypre_BoxArrayArray    **indt_chunks = NULL;
+   hypre_BoxArray          *box_a;
+   HYPRE_Int                num_indt_chunks = 0;
+   HYPRE_Int                c, i;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -75,13 +131,52 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
+   /*----------------------------------------------------------
+    * Split the independent boxes into chunks, so that communication
+    * progress can be tested between them.  Chunk c holds the c-th
+    * independent box of each grid box.
+    *----------------------------------------------------------*/
+
+   indt_boxes = hypre_ComputePkgIndtBoxes(compute_pkg);
+   hypre_ForBoxArrayI(i, indt_boxes)
+   {
+      box_a = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
+      num_indt_chunks = hypre_max(num_indt_chunks, hypre_BoxArraySize(box_a));
+   }
+   if (num_indt_chunks > 1)
+   {
+      indt_chunks = hypre_TAlloc(hypre_BoxArrayArray *, num_indt_chunks,
+                                 HYPRE_MEMORY_HOST);
+      for (c = 0; c < num_indt_chunks; c++)
+      {
+         indt_chunks[c] = hypre_BoxArrayArrayCreate(
+                             hypre_BoxArrayArraySize(indt_boxes),
+                             hypre_StructGridNDim(grid));
+         hypre_ForBoxArrayI(i, indt_boxes)
+         {
+            box_a = hypre_BoxArrayArrayBoxArray(indt_boxes, i);
+            if (c < hypre_BoxArraySize(box_a))
+            {
+               hypre_AppendBox(hypre_BoxArrayBox(box_a, c),
+                               hypre_BoxArrayArrayBoxArray(indt_chunks[c], i));
+            }
+         }
+      }
+   }
+   else
+   {
+      num_indt_chunks = 0;
+   }
+
    /*----------------------------------------------------------
     * Set up the matvec data structure
     *----------------------------------------------------------*/
 
-   (matvec_data -> A)           = hypre_StructMatrixRef(A);
-   (matvec_data -> x)           = hypre_StructVectorRef(x);
-   (matvec_data -> compute_pkg) = compute_pkg;
+   (matvec_data -> A)               = hypre_StructMatrixRef(A);
+   (matvec_data -> x)               = hypre_StructVectorRef(x);
+   (matvec_data -> compute_pkg)     = compute_pkg;
+   (matvec_data -> num_indt_chunks) = num_indt_chunks;
+   (matvec_data -> indt_chunks)     = indt_chunks;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -119,9 +214,10 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    hypre_IndexRef           stride;
 
    HYPRE_Int                constant_coefficient;
+   HYPRE_Int                use_fused;
 
    HYPRE_Complex            temp;
-   HYPRE_Int                compute_i, i;
+   HYPRE_Int                compute_i, c, i;
 
    hypre_StructVector      *x_tmp = NULL;
 
@@ -132,11 +228,15 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
-   if (constant_coefficient) { hypre_StructVectorClearBoundGhostValues(x, 0); }
+   if (constant_coefficient || hypre_StructMatrixMostlyConstant(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
 
    compute_pkg = (matvec_data -> compute_pkg);
 
    stride = hypre_ComputePkgStride(compute_pkg);
+   use_fused = hypre_StructMatvecFusedSupported(A, stride);
 
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation
@@ -254,25 +354,21 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
-      switch ( constant_coefficient )
+      if ((compute_i == 0) && (matvec_data -> num_indt_chunks))
       {
-         case 0:
+         for (c = 0; c < (matvec_data -> num_indt_chunks); c++)
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
-            break;
-         }
-         case 1:
-         {
-            hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
-            break;
-         }
-         case 2:
-         {
-            hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
-            break;
+            hypre_StructMatvecComputeBoxes(alpha, A, x, y,
+                                           (matvec_data -> indt_chunks)[c],
+                                           stride, use_fused);
+            hypre_ProgressIndtComputations(comm_handle);
          }
       }
-
+      else
+      {
+         hypre_StructMatvecComputeBoxes(alpha, A, x, y, compute_box_aa,
+                                        stride, use_fused);
+      }
    }
 
    if (x_tmp)
@@ -286,6 +382,407 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Fused kernels for the common 5/9-point (2D) and 7/19/27-point (3D)
+ * stencils.  All stencil entries are applied in a single pass over y (the
+ * generic kernels above make one pass per group of MAX_DEPTH entries).  The
+ * kernels are generated for a fixed stencil size so that the entry loop is
+ * unrolled at compile time, and the innermost loop runs along the
+ * unit-stride dimension so that it can be vectorized.  These run on the host
+ * only.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_MATVEC_FUSED_MAX_SIZE 27
+
+/* y = alpha*(y + sum_s Ap[s]*x[xoff[s]]), constant_coefficient == 0 */
+#define hypre_StructMatvecFusedCC0Define(N)                                   \
+static void                                                                   \
+hypre_StructMatvecFusedCC0_##N( HYPRE_Int       ndim,                         \
+                                hypre_Index     loop_size,                    \
+                                hypre_Box      *A_data_box,                   \
+                                hypre_Box      *x_data_box,                   \
+                                hypre_Box      *y_data_box,                   \
+                                hypre_IndexRef  start,                        \
+                                hypre_IndexRef  stride,                       \
+                                HYPRE_Int       n0,                           \
+                                HYPRE_Complex **Ap,                           \
+                                HYPRE_Int      *xoff,                         \
+                                HYPRE_Complex  *xp,                           \
+                                HYPRE_Complex  *yp,                           \
+                                HYPRE_Complex   alpha )                       \
+{                                                                             \
+   hypre_BoxLoop3BeginHost(ndim, loop_size,                                   \
+                           A_data_box, start, stride, Ai,                     \
+                           x_data_box, start, stride, xi,                     \
+                           y_data_box, start, stride, yi);                    \
+   {                                                                          \
+      HYPRE_Int     ii, s;                                                    \
+      HYPRE_Complex sum;                                                      \
+      for (ii = 0; ii < n0; ii++)                                             \
+      {                                                                       \
+         sum = yp[yi + ii];                                                   \
+         for (s = 0; s < N; s++)                                              \
+         {                                                                    \
+            sum += Ap[s][Ai + ii] * xp[xi + ii + xoff[s]];                    \
+         }                                                                    \
+         yp[yi + ii] = alpha * sum;                                           \
+      }                                                                       \
+   }                                                                          \
+   hypre_BoxLoop3EndHost(Ai, xi, yi);                                         \
+}
+
+/* y = y + sum_s cp[s]*x[xoff[s]] when Adp is NULL (constant_coefficient == 1,
+ * cp already scaled by alpha), and y = alpha*(y + Adp*x + sum_s cp[s]*x[xoff[s]])
+ * otherwise (constant_coefficient == 2, cp is zero at the center entry) */
+#define hypre_StructMatvecFusedCC1Define(N)                                   \
+static void                                                                   \
+hypre_StructMatvecFusedCC1_##N( HYPRE_Int       ndim,                         \
+                                hypre_Index     loop_size,                    \
+                                hypre_Box      *A_data_box,                   \
+                                hypre_Box      *x_data_box,                   \
+                                hypre_Box      *y_data_box,                   \
+                                hypre_IndexRef  start,                        \
+                                hypre_IndexRef  stride,                       \
+                                HYPRE_Int       n0,                           \
+                                HYPRE_Complex  *cp,                           \
+                                HYPRE_Complex  *Adp,                          \
+                                HYPRE_Int      *xoff,                         \
+                                HYPRE_Complex  *xp,                           \
+                                HYPRE_Complex  *yp,                           \
+                                HYPRE_Complex   alpha )                       \
+{                                                                             \
+   if (Adp == NULL)                                                           \
+   {                                                                          \
+      hypre_BoxLoop2BeginHost(ndim, loop_size,                                \
+                              x_data_box, start, stride, xi,                  \
+                              y_data_box, start, stride, yi);                 \
+      {                                                                       \
+         HYPRE_Int     ii, s;                                                 \
+         HYPRE_Complex sum;                                                   \
+         for (ii = 0; ii < n0; ii++)                                          \
+         {                                                                    \
+            sum = yp[yi + ii];                                                \
+            for (s = 0; s < N; s++)                                           \
+            {                                                                 \
+               sum += cp[s] * xp[xi + ii + xoff[s]];                          \
+            }                                                                 \
+            yp[yi + ii] = sum;                                                \
+         }                                                                    \
+      }                                                                       \
+      hypre_BoxLoop2EndHost(xi, yi);                                          \
+   }                                                                          \
+   else                                                                       \
+   {                                                                          \
+      hypre_BoxLoop3BeginHost(ndim, loop_size,                                \
+                              A_data_box, start, stride, Ai,                  \
+                              x_data_box, start, stride, xi,                  \
+                              y_data_box, start, stride, yi);                 \
+      {                                                                       \
+         HYPRE_Int     ii, s;                                                 \
+         HYPRE_Complex sum;                                                   \
+         for (ii = 0; ii < n0; ii++)                                          \
+         {                                                                    \
+            sum = yp[yi + ii] + Adp[Ai + ii] * xp[xi + ii];                   \
+            for (s = 0; s < N; s++)                                           \
+            {                                                                 \
+               sum += cp[s] * xp[xi + ii + xoff[s]];                          \
+            }                                                                 \
+            yp[yi + ii] = alpha * sum;                                        \
+         }                                                                    \
+      }                                                                       \
+      hypre_BoxLoop3EndHost(Ai, xi, yi);                                      \
+   }                                                                          \
+}
+
+hypre_StructMatvecFusedCC0Define(5)
+hypre_StructMatvecFusedCC0Define(7)
+hypre_StructMatvecFusedCC0Define(9)
+hypre_StructMatvecFusedCC0Define(19)
+hypre_StructMatvecFusedCC0Define(27)
+
+hypre_StructMatvecFusedCC1Define(5)
+hypre_StructMatvecFusedCC1Define(7)
+hypre_StructMatvecFusedCC1Define(9)
+hypre_StructMatvecFusedCC1Define(19)
+hypre_StructMatvecFusedCC1Define(27)
+
+#undef hypre_StructMatvecFusedCC0Define
+#undef hypre_StructMatvecFusedCC1Define
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFusedSupported
+ * Returns 1 if a fused kernel exists for the stencil and memory location of A
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFusedSupported( hypre_StructMatrix *A,
+                                  hypre_IndexRef      stride )
+{
+   HYPRE_Int  ndim         = hypre_StructMatrixNDim(A);
+   HYPRE_Int  stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   if (hypre_GetExecPolicy1(hypre_StructMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST ||
+       hypre_StructMatrixMostlyConstant(A) || hypre_IndexD(stride, 0) != 1)
+   {
+      return 0;
+   }
+
+   switch (stencil_size)
+   {
+      case 5:
+      case 9:
+         return (ndim == 2);
+      case 7:
+      case 19:
+      case 27:
+         return (ndim == 3);
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFused
+ * Fused single-pass version of hypre_StructMatvecCC0/CC1/CC2.  Should only
+ * be called when hypre_StructMatvecFusedSupported returns 1.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFused( HYPRE_Complex        alpha,
+                         hypre_StructMatrix  *A,
+                         hypre_StructVector  *x,
+                         hypre_StructVector  *y,
+                         hypre_BoxArrayArray *compute_box_aa,
+                         hypre_IndexRef       stride )
+{
+   HYPRE_Int                constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructStencil     *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index             *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int                ndim          = hypre_StructVectorNDim(x);
+
+   HYPRE_Complex           *Ap[HYPRE_MATVEC_FUSED_MAX_SIZE];
+   HYPRE_Complex            cp[HYPRE_MATVEC_FUSED_MAX_SIZE];
+   HYPRE_Int                xoff[HYPRE_MATVEC_FUSED_MAX_SIZE];
+   HYPRE_Complex           *Adp;
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              center_index;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                center_rank, n0;
+   HYPRE_Int                i, j, si;
+
+   hypre_SetIndex(center_index, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center_index);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      Adp = NULL;
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+         switch (constant_coefficient)
+         {
+            case 0:
+               Ap[si] = hypre_StructMatrixBoxData(A, i, si);
+               break;
+            case 1:
+               cp[si] = alpha * hypre_StructMatrixBoxData(A, i, si)[0];
+               break;
+            case 2:
+               if (si == center_rank)
+               {
+                  Adp   = hypre_StructMatrixBoxData(A, i, si);
+                  cp[si] = 0.0;
+               }
+               else
+               {
+                  cp[si] = hypre_StructMatrixBoxData(A, i, si)[0];
+               }
+               break;
+         }
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         /* the box loop runs over rows; the kernel runs along each row */
+         hypre_BoxGetSize(compute_box, loop_size);
+         n0 = hypre_IndexD(loop_size, 0);
+         hypre_IndexD(loop_size, 0) = 1;
+         start = hypre_BoxIMin(compute_box);
+
+#define HYPRE_MATVEC_FUSED_CALL(N)                                            \
+         if (constant_coefficient == 0)                                       \
+         {                                                                    \
+            hypre_StructMatvecFusedCC0_##N(ndim, loop_size, A_data_box,       \
+                                           x_data_box, y_data_box, start,     \
+                                           stride, n0, Ap, xoff, xp, yp,      \
+                                           alpha);                            \
+         }                                                                    \
+         else                                                                 \
+         {                                                                    \
+            hypre_StructMatvecFusedCC1_##N(ndim, loop_size, A_data_box,       \
+                                           x_data_box, y_data_box, start,     \
+                                           stride, n0, cp, Adp, xoff, xp, yp, \
+                                           alpha);                            \
+         }
+
+         switch (stencil_size)
+         {
+            case 5:
+               HYPRE_MATVEC_FUSED_CALL(5);
+               break;
+            case 7:
+               HYPRE_MATVEC_FUSED_CALL(7);
+               break;
+            case 9:
+               HYPRE_MATVEC_FUSED_CALL(9);
+               break;
+            case 19:
+               HYPRE_MATVEC_FUSED_CALL(19);
+               break;
+            case 27:
+               HYPRE_MATVEC_FUSED_CALL(27);
+               break;
+         }
+#undef HYPRE_MATVEC_FUSED_CALL
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecMC
+ * core of struct matvec computation for matrices in mostly-constant storage
+ * (see hypre_StructMatrixCompressMostlyConstant).  The constant rows are
+ * applied to the whole compute box, then the exceptions in the box are
+ * corrected.  Stencil entries reaching outside of the domain must see zero
+ * ghost values in x.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecMC( HYPRE_Complex        alpha,
+                      hypre_StructMatrix  *A,
+                      hypre_StructVector  *x,
+                      hypre_StructVector  *y,
+                      hypre_BoxArrayArray *compute_box_aa,
+                      hypre_IndexRef       stride )
+{
+   hypre_StructStencil     *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index             *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int                ndim          = hypre_StructVectorNDim(x);
+   HYPRE_Int               *mc_starts     = hypre_StructMatrixMCStarts(A);
+   hypre_Index             *mc_indices    = hypre_StructMatrixMCIndices(A);
+
+   HYPRE_Complex           *cp;
+   HYPRE_Complex           *ep;
+   HYPRE_Int               *xoff;
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   HYPRE_Complex            sum;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                xi, yi;
+   HYPRE_Int                i, j, e, si;
+
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+      cp = hypre_StructMatrixMCBoxValues(A, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         start = hypre_BoxIMin(compute_box);
+         hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+         hypre_BoxLoop2BeginHost(ndim, loop_size,
+                                 x_data_box, start, stride, Xi,
+                                 y_data_box, start, stride, Yi);
+         {
+            HYPRE_Complex  csum = yp[Yi];
+            HYPRE_Int      ci;
+
+            for (ci = 0; ci < stencil_size; ci++)
+            {
+               csum += cp[ci] * xp[Xi + xoff[ci]];
+            }
+            yp[Yi] = alpha * csum;
+         }
+         hypre_BoxLoop2EndHost(Xi, Yi);
+
+         for (e = mc_starts[i]; e < mc_starts[i + 1]; e++)
+         {
+            if (!hypre_StructMatrixMCExceptionInBox(A, e, compute_box, stride))
+            {
+               continue;
+            }
+
+            ep  = hypre_StructMatrixMCExceptionValues(A, e);
+            xi  = hypre_BoxIndexRank(x_data_box, mc_indices[e]);
+            yi  = hypre_BoxIndexRank(y_data_box, mc_indices[e]);
+            sum = 0.0;
+            for (si = 0; si < stencil_size; si++)
+            {
+               sum += (ep[si] - cp[si]) * xp[xi + xoff[si]];
+            }
+            yp[yi] += alpha * sum;
+         }
+      }
+   }
+
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC0
  * core of struct matvec computation, for the case constant_coefficient==0
@@ -1389,12 +1886,18 @@ HYPRE_Int
 hypre_StructMatvecDestroy( void *matvec_vdata )
 {
    hypre_StructMatvecData *matvec_data = (hypre_StructMatvecData *)matvec_vdata;
+   HYPRE_Int               c;
 
    if (matvec_data)
    {
       hypre_StructMatrixDestroy(matvec_data -> A);
       hypre_StructVectorDestroy(matvec_data -> x);
       hypre_ComputePkgDestroy(matvec_data -> compute_pkg );
+      for (c = 0; c < (matvec_data -> num_indt_chunks); c++)
+      {
+         hypre_BoxArrayArrayDestroy((matvec_data -> indt_chunks)[c]);
+      }
+      hypre_TFree(matvec_data -> indt_chunks, HYPRE_MEMORY_HOST);
       hypre_TFree(matvec_data, HYPRE_MEMORY_HOST);
    }
 
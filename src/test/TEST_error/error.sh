@@ -27,7 +27,15 @@ FILES="\
 for i in $FILES
 do
   echo "# Output file: $i"
-  tail -21 $i | head -6
+  case $i in
+    # multicomponent runs end with a per-component convergence table
+    ${TNAME}.out.11|${TNAME}.out.16)
+      tail -25 $i | head -6
+      ;;
+    *)
+      tail -21 $i | head -6
+      ;;
+  esac
 done > ${TNAME}.out
 
 # Remove the "hypre error" lines from '.err' file and append them to '.out'
@@ -13,14 +13,20 @@ FILES="\
  ${TNAME}.out.1\
  ${TNAME}.out.2\
  ${TNAME}.out.3\
+ ${TNAME}.out.4\
  ${TNAME}.out.50\
  ${TNAME}.out.51\
  ${TNAME}.out.100\
  ${TNAME}.out.101\
  ${TNAME}.out.102\
  ${TNAME}.out.103\
+ ${TNAME}.out.104\
  ${TNAME}.out.150\
  ${TNAME}.out.151\
+ ${TNAME}.out.152\
+ ${TNAME}.out.153\
+ ${TNAME}.out.154\
+ ${TNAME}.out.155\
 "
 
 for i in $FILES
@@ -41,3 +47,4 @@ fi
 #=============================================================================
 
 rm -rf IJ.out.A.0000?.bin IJ.out.b.0000?.bin IJ.out.x0.0000?.bin IJ.out.x.0000?.bin
+rm -rf IJ.out.A.ckpt IJ.out.b.ckpt
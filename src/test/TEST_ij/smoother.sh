@@ -49,6 +49,8 @@ FILES="\
  ${TNAME}.out.22\
  ${TNAME}.out.23\
  ${TNAME}.out.24\
+ ${TNAME}.out.25\
+ ${TNAME}.out.26\
 "
 
 for i in $FILES
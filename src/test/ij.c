@@ -281,6 +281,8 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    sp_level = -1;
+   HYPRE_Int    numeric_setup = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -301,6 +303,16 @@ main( hypre_int argc,
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
 
+   /* host SpMV storage */
+   HYPRE_Int  spmv_use_sell = 0;
+
+   /* NUMA first touch of host memory */
+   HYPRE_Int  host_first_touch = 0;
+   HYPRE_Int  num_threads = 0;
+
+   /* host memory pool size (MiB) */
+   HYPRE_Int  host_pool_size = 0;
+
 #if defined(HYPRE_USING_GPU)
 #if defined(HYPRE_USING_CUSPARSE) && CUSPARSE_VERSION >= 11000
    /* CUSPARSE_SPMV_ALG_DEFAULT doesn't provide deterministic results */
@@ -370,6 +382,7 @@ main( hypre_int argc,
 
    HYPRE_Int    print_system = 0;
    HYPRE_Int    print_system_binary = 0;
+   HYPRE_Int    print_system_checkpoint = 0;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
    HYPRE_Int    benchmark = 0;
@@ -393,6 +406,9 @@ main( hypre_int argc,
    HYPRE_Int  two_norm = 1;
    HYPRE_Int  skip_break = 0;
    HYPRE_Int  flex = 0;
+   HYPRE_Int  sstep = 0;
+   HYPRE_Int  sstep_basis = 0;
+   HYPRE_Int  pipelined = 0;
    HYPRE_Int  pcgIterations = 0;
    HYPRE_Int  pcgMode = 1;
    HYPRE_Real pcgTol = 1e-2;
@@ -701,6 +717,12 @@ main( hypre_int argc,
          arg_index++;
          log_level = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fromfile-mm") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -3;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-frombinfile") == 0 )
       {
          arg_index++;
@@ -731,6 +753,12 @@ main( hypre_int argc,
          build_matrix_type      = 1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromckptfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 9;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-laplacian") == 0 )
       {
          arg_index++;
@@ -900,6 +928,12 @@ main( hypre_int argc,
          build_rhs_type      = 7;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsfromckptfile") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsisone") == 0 )
       {
          arg_index++;
@@ -1532,6 +1566,26 @@ main( hypre_int argc,
          fsai_kap_tolerance = (HYPRE_Real)atof(argv[arg_index++]);
       }
       /* end FSAI options */
+      else if ( strcmp(argv[arg_index], "-mv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-first_touch") == 0 )
+      {
+         arg_index++;
+         host_first_touch = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-host_pool") == 0 )
+      {
+         arg_index++;
+         host_pool_size = atoi(argv[arg_index++]);
+      }
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-mm_vendor") == 0 )
       {
@@ -1991,6 +2045,21 @@ main( hypre_int argc,
          arg_index++;
          flex  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         sstep  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sstep_basis") == 0 )
+      {
+         arg_index++;
+         sstep_basis  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pipelined  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-var") == 0 )
       {
          arg_index++;
@@ -2169,6 +2238,17 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sp_level") == 0 )
+      {
+         arg_index++;
+         sp_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-numeric_setup") == 0 )
+      {
+         arg_index++;
+         numeric_setup  = atoi(argv[arg_index++]);
+         second_time = 1;
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -2196,6 +2276,11 @@ main( hypre_int argc,
          arg_index++;
          print_system_binary = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printckpt") == 0 )
+      {
+         arg_index++;
+         print_system_checkpoint = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -2325,12 +2410,16 @@ main( hypre_int argc,
          hypre_printf("      2 = Display aggregate memory usage statistics over MPI ranks.\n");
          hypre_printf("  -fromfile <filename>       : ");
          hypre_printf("matrix read from multiple files (IJ format)\n");
+         hypre_printf("  -fromfile-mm <filename>    : ");
+         hypre_printf("matrix read in parallel from a Matrix Market file\n");
          hypre_printf("  -frombinfile <filename>    : ");
          hypre_printf("matrix read from multiple binary files (IJ format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
+         hypre_printf("  -fromckptfile <filename>   : ");
+         hypre_printf("matrix read from a binary checkpoint file (ParCSR)\n");
          hypre_printf("\n");
          hypre_printf("  -laplacian             : build 5pt 2D laplacian problem (default) \n");
          hypre_printf("  -sysL <num functions>  : build SYSTEMS laplacian 7pt operator\n");
@@ -2362,6 +2451,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsfromckptfile       : ");
+         hypre_printf("rhs read from a binary checkpoint file (ParVector)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -2528,6 +2619,9 @@ main( hypre_int argc,
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
+         hypre_printf("  -sstep <val>           : use s-step PCG with s = val (default: 0, classical PCG)\n");
+         hypre_printf("  -sstep_basis <val>     : s-step PCG basis, 0: monomial (default), 1: Newton\n");
+         hypre_printf("  -pipelined <val>       : use pipelined PCG/GMRES if val > 0 (default: 0)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
@@ -2536,6 +2630,10 @@ main( hypre_int argc,
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
+         hypre_printf("  -sp_level  <val>       : store AMG operators from level val on in single precision\n");
+         hypre_printf("  -numeric_setup <val>   : second AMG setup (-solver 0) for 2*A is numeric-only,\n");
+         hypre_printf("                           1: reuse C/F splitting, 2: also keep strength matrices\n");
+         hypre_printf("                           3: as 2, for D*A*D with a random diagonal D\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
@@ -2558,6 +2656,12 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printckpt             : print A and b to binary checkpoint files\n");
+         hypre_printf("\n");
+         hypre_printf("  -mv_sell <val>         : host SpMV storage (0=CSR, 1=SELL-C-sigma)\n");
+         hypre_printf("  -first_touch <val>     : NUMA first touch of host memory by the OpenMP threads\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads (0=OMP_NUM_THREADS)\n");
+         hypre_printf("  -host_pool <val>       : host memory pool size in MiB (0=no pool)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2788,6 +2892,19 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* host SpMV storage */
+   HYPRE_SetSpMVUseSell(spmv_use_sell);
+
+   /* NUMA first touch of host memory */
+   HYPRE_SetHostFirstTouch(host_first_touch);
+   if (num_threads > 0)
+   {
+      hypre_SetNumThreads(num_threads);
+   }
+
+   /* host memory pool */
+   HYPRE_SetHostMemoryPool((size_t) host_pool_size << 20);
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -2815,7 +2932,17 @@ main( hypre_int argc,
 
    time_index = hypre_InitializeTiming("Spatial Operator");
    hypre_BeginTiming(time_index);
-   if ( build_matrix_type == -2 )
+   if ( build_matrix_type == -3 )
+   {
+      ierr = HYPRE_IJMatrixReadMM( argv[build_matrix_arg_index], comm,
+                                   HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
+   else if ( build_matrix_type == -2 )
    {
       ierr = HYPRE_IJMatrixReadBinary( argv[build_matrix_arg_index], comm,
                                        HYPRE_PARCSR, &ij_A );
@@ -2882,6 +3009,15 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 9 )
+   {
+      ierr = HYPRE_ParCSRMatrixReadCheckpoint(comm, argv[build_matrix_arg_index], &parcsr_A);
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
    else
    {
       hypre_printf("You have asked for an unsupported problem with\n");
@@ -3662,6 +3798,31 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if (build_rhs_type == 8)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from checkpoint file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      ij_b = NULL;
+      ierr = HYPRE_ParVectorReadCheckpoint(comm, argv[build_rhs_arg_index], &b);
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the right-hand side!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+
+      /* initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else
    {
       if (build_rhs_type != -1)
@@ -4090,6 +4251,12 @@ main( hypre_int argc,
       }
    }
 
+   if (print_system_checkpoint)
+   {
+      HYPRE_ParCSRMatrixPrintCheckpoint(parcsr_A, "IJ.out.A.ckpt");
+      HYPRE_ParVectorPrintCheckpoint(b, "IJ.out.b.ckpt");
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -4621,6 +4788,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_solver, sp_level);
+      HYPRE_BoomerAMGSetKeepStrength(amg_solver, numeric_setup > 1);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4717,7 +4886,44 @@ main( hypre_int argc,
 
          hypre_GpuProfilingPushRange("AMG-Setup-2");
 
-         if (solver_id == 0)
+         if (solver_id == 0 && numeric_setup == 3)
+         {
+            /* same sparsity pattern, nonuniformly changed values: D*A*D with
+               random D in [1, 2], which changes strength and truncation */
+            HYPRE_ParVector  d, e;
+
+            HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParCSRMatrixGlobalNumRows(parcsr_A),
+                                  hypre_ParCSRMatrixRowStarts(parcsr_A), &d);
+            HYPRE_ParVectorInitialize(d);
+            HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParCSRMatrixGlobalNumRows(parcsr_A),
+                                  hypre_ParCSRMatrixRowStarts(parcsr_A), &e);
+            HYPRE_ParVectorInitialize(e);
+            HYPRE_ParVectorSetRandomValues(d, 2747 + myid);
+            HYPRE_ParVectorScale(0.5, d);
+            HYPRE_ParVectorSetConstantValues(e, 1.5);
+            hypre_ParVectorAxpy(1.0, e, d);
+
+            hypre_ParCSRMatrixDiagScale(parcsr_A, d, d);
+            if (parcsr_M != parcsr_A)
+            {
+               hypre_ParCSRMatrixDiagScale(parcsr_M, d, d);
+            }
+            HYPRE_ParVectorDestroy(d);
+            HYPRE_ParVectorDestroy(e);
+
+            HYPRE_BoomerAMGSetupNumericOnly(amg_solver, parcsr_M, b, x);
+         }
+         else if (solver_id == 0 && numeric_setup)
+         {
+            /* same sparsity pattern, new values */
+            hypre_ParCSRMatrixScale(parcsr_A, 2.0);
+            if (parcsr_M != parcsr_A)
+            {
+               hypre_ParCSRMatrixScale(parcsr_M, 2.0);
+            }
+            HYPRE_BoomerAMGSetupNumericOnly(amg_solver, parcsr_M, b, x);
+         }
+         else if (solver_id == 0)
          {
             HYPRE_BoomerAMGSetup(amg_solver, parcsr_M, b, x);
          }
@@ -4764,6 +4970,27 @@ main( hypre_int argc,
       {
          HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
          HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         if (num_components > 1)
+         {
+            HYPRE_Int  *comp_num_iterations = hypre_CTAlloc(HYPRE_Int, num_components,
+                                                            HYPRE_MEMORY_HOST);
+            HYPRE_Real *comp_res_norms      = hypre_CTAlloc(HYPRE_Real, num_components,
+                                                            HYPRE_MEMORY_HOST);
+
+            HYPRE_BoomerAMGGetComponentNumIterations(amg_solver, comp_num_iterations);
+            HYPRE_BoomerAMGGetComponentRelResidualNorms(amg_solver, comp_res_norms);
+            if (myid == 0)
+            {
+               hypre_printf("\n  Component   Iterations   Relative Residual Norm\n");
+               for (c = 0; c < num_components; c++)
+               {
+                  hypre_printf("  %9d   %10d   %e\n", c, comp_num_iterations[c], comp_res_norms[c]);
+               }
+            }
+            hypre_TFree(comp_num_iterations, HYPRE_MEMORY_HOST);
+            hypre_TFree(comp_res_norms, HYPRE_MEMORY_HOST);
+         }
       }
       else if (solver_id == 90)
       {
@@ -4932,6 +5159,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_solver, sp_level);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -5018,6 +5246,9 @@ main( hypre_int argc,
       HYPRE_PCGSetTol(pcg_solver, tol);
       HYPRE_PCGSetTwoNorm(pcg_solver, 1);
       HYPRE_PCGSetFlex(pcg_solver, flex);
+      HYPRE_PCGSetSStep(pcg_solver, sstep);
+      HYPRE_PCGSetSStepBasis(pcg_solver, sstep_basis);
+      HYPRE_PCGSetPipelined(pcg_solver, pipelined);
       HYPRE_PCGSetSkipBreak(pcg_solver, skip_break);
       HYPRE_PCGSetRelChange(pcg_solver, rel_change);
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
@@ -5155,6 +5386,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5355,6 +5587,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6717,6 +6950,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
       HYPRE_GMRESSetKDim(pcg_solver, k_dim);
+      HYPRE_GMRESSetPipelined(pcg_solver, pipelined);
       HYPRE_GMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_GMRESSetTol(pcg_solver, tol);
       HYPRE_GMRESSetAbsoluteTol(pcg_solver, atol);
@@ -6893,6 +7127,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -7099,6 +7334,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7480,6 +7716,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7706,6 +7943,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8142,6 +8380,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8569,6 +8808,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -8910,6 +9150,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -9314,7 +9555,8 @@ final:
 
    HYPRE_ParVectorDestroy(x0_save);
 
-   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2)
+   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2 ||
+       build_matrix_type == -3)
    {
       if (ij_A)
       {
@@ -9331,8 +9573,9 @@ final:
       HYPRE_IJMatrixDestroy(ij_M);
    }
 
-   /* for build_rhs_type = 1, 6 or 7, we did not create ij_b  - just b*/
-   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7)
+   /* for build_rhs_type = 1, 6, 7 or 8, we did not create ij_b  - just b*/
+   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7 ||
+       build_rhs_type == 8)
    {
       HYPRE_ParVectorDestroy(b);
    }
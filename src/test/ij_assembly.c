@@ -72,6 +72,24 @@ HYPRE_Int test_SetAddSet(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HY
                          HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks, HYPRE_Int *h_nnzrow, HYPRE_Int *nnzrow,
                          HYPRE_BigInt *rows, HYPRE_BigInt *cols, HYPRE_Real *coefs, HYPRE_IJMatrix *ij_AT_ptr);
 
+HYPRE_Int test_AddCOO(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HYPRE_BigInt ilower,
+                      HYPRE_BigInt iupper, HYPRE_BigInt jlower, HYPRE_BigInt jupper,
+                      HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks, HYPRE_BigInt *rows,
+                      HYPRE_BigInt *cols, HYPRE_Real *coefs, HYPRE_Int transpose,
+                      HYPRE_IJMatrix *ij_A_ptr);
+
+HYPRE_Int test_Frozen(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HYPRE_BigInt ilower,
+                      HYPRE_BigInt iupper, HYPRE_BigInt jlower, HYPRE_BigInt jupper,
+                      HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks, HYPRE_BigInt *rows,
+                      HYPRE_BigInt *cols, HYPRE_Real *coefs, HYPRE_Int ncycles,
+                      HYPRE_IJMatrix *ij_AT_ptr);
+
+HYPRE_Int test_SplitNBX(MPI_Comm comm, HYPRE_MemoryLocation memory_location, HYPRE_BigInt ilower,
+                        HYPRE_BigInt iupper, HYPRE_BigInt jlower, HYPRE_BigInt jupper,
+                        HYPRE_BigInt num_nonzeros, HYPRE_Int nchunks, HYPRE_BigInt *rows,
+                        HYPRE_BigInt *cols, HYPRE_Real *coefs, HYPRE_Int ncycles,
+                        HYPRE_IJMatrix *ij_AT_ptr, HYPRE_IJMatrix *ij_BT_ptr);
+
 
 hypre_int
 main( hypre_int  argc,
@@ -151,7 +169,7 @@ main( hypre_int  argc,
    default_exec_policy = HYPRE_EXEC_DEVICE;
 #endif
    memory_location     = HYPRE_MEMORY_DEVICE;
-   mode                = (1 << 6) - 1;
+   mode                = (1 << 9) - 1;
    option              = 1;
    nchunks             = 3;
    base                = 0;
@@ -264,7 +282,11 @@ main( hypre_int  argc,
          hypre_printf("             2 = SetOffProc\n");
          hypre_printf("             4 = SetSet\n");
          hypre_printf("             8 = AddSet\n");
-         hypre_printf("            16 = SetAddSet\n");
+         hypre_printf("            16 = SetAdd\n");
+         hypre_printf("            32 = SetAddSet\n");
+         hypre_printf("            64 = AddCOO\n");
+         hypre_printf("           128 = Frozen (host only)\n");
+         hypre_printf("           256 = SplitNBX\n");
          hypre_printf("      -option <val>          : interface option of Set/AddToValues\n");
          hypre_printf("             1 = CSR-like (default)\n");
          hypre_printf("             2 = COO-like\n");
@@ -310,6 +332,11 @@ main( hypre_int  argc,
    }
 #endif
 
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE)
+   {
+      mode = mode & ~128; /* frozen patterns are host only */
+   }
+
    /*-----------------------------------------------------------
     * Build matrix entries
     *-----------------------------------------------------------*/
@@ -450,6 +477,75 @@ main( hypre_int  argc,
       HYPRE_IJMatrixDestroy(ij_A);
    }
 
+   /* Test AddCOO */
+   if (mode & 64)
+   {
+      test_AddCOO(comm, memory_location, ilower, iupper, jlower, jupper, num_nonzeros,
+                  nchunks, rows_coo, cols, coefs, 0, &ij_A);
+
+      ierr += checkMatrix(parcsr_ref, ij_A) > tol;
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_A, "ij_AddCOO");
+      }
+      HYPRE_IJMatrixDestroy(ij_A);
+
+      /* with (row, col) reversed to test off-proc entries */
+      test_AddCOO(comm, memory_location, jlower, jupper, ilower, iupper, num_nonzeros,
+                  nchunks, rows_coo, cols, coefs, 1, &ij_AT);
+
+      hypre_ParCSRMatrixTranspose(parcsr_ref, &parcsr_trans, 1);
+
+      ierr += checkMatrix(parcsr_trans, ij_AT) > tol;
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_AT, "ij_AddCOOTrans");
+      }
+      HYPRE_IJMatrixDestroy(ij_AT);
+      HYPRE_ParCSRMatrixDestroy(parcsr_trans);
+   }
+
+   /* Test Frozen */
+   if (mode & 128)
+   {
+      test_Frozen(comm, memory_location, ilower, iupper, jlower, jupper, num_nonzeros,
+                  nchunks, rows_coo, cols, coefs, 3, &ij_AT);
+
+      hypre_ParCSRMatrixTranspose(parcsr_ref, &parcsr_trans, 1);
+      hypre_ParCSRMatrixScale(parcsr_trans, 3.0);
+
+      ierr += checkMatrix(parcsr_trans, ij_AT) > tol;
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_AT, "ij_Frozen");
+      }
+      HYPRE_IJMatrixDestroy(ij_AT);
+      HYPRE_ParCSRMatrixDestroy(parcsr_trans);
+   }
+
+   /* Test split-phase assembly with the NBX exchange */
+   if (mode & 256)
+   {
+      test_SplitNBX(comm, memory_location, ilower, iupper, jlower, jupper, num_nonzeros,
+                    nchunks, rows_coo, cols, coefs, 2, &ij_AT, &ij_A);
+
+      hypre_ParCSRMatrixTranspose(parcsr_ref, &parcsr_trans, 1);
+      hypre_ParCSRMatrixScale(parcsr_trans, 2.0);
+
+      ierr += checkMatrix(parcsr_trans, ij_AT) > tol;
+      if (print_matrix)
+      {
+         HYPRE_IJMatrixPrint(ij_AT, "ij_SplitNBX");
+      }
+
+      hypre_ParCSRMatrixScale(parcsr_trans, 2.0);
+
+      ierr += checkMatrix(parcsr_trans, ij_A) > tol;
+      HYPRE_IJMatrixDestroy(ij_A);
+      HYPRE_IJMatrixDestroy(ij_AT);
+      HYPRE_ParCSRMatrixDestroy(parcsr_trans);
+   }
+
    /* Print the error code */
    hypre_ParPrintf(comm, "Test error code = %d\n", ierr);
 
@@ -1383,3 +1479,268 @@ test_SetAddSet(MPI_Comm             comm,
 
    return hypre_error_flag;
 }
+
+/* add values as COO triplets: each coefficient is added in two halves, so that
+ * duplicates are summed at assembly. With transpose, (row, col) are reversed,
+ * i.e., A^T is assembled with off-proc entries. With OpenMP, the chunks are
+ * added concurrently by the threads */
+HYPRE_Int
+test_AddCOO(MPI_Comm             comm,
+            HYPRE_MemoryLocation memory_location,
+            HYPRE_BigInt         ilower,
+            HYPRE_BigInt         iupper,
+            HYPRE_BigInt         jlower,
+            HYPRE_BigInt         jupper,
+            HYPRE_BigInt         num_nonzeros,
+            HYPRE_Int            nchunks,
+            HYPRE_BigInt        *rows,
+            HYPRE_BigInt        *cols,
+            HYPRE_Real          *coefs,
+            HYPRE_Int            transpose,
+            HYPRE_IJMatrix      *ij_A_ptr)
+{
+   HYPRE_IJMatrix  ij_A;
+   HYPRE_Int       i, chunk, chunk_size;
+   HYPRE_Int       time_index;
+   HYPRE_Real     *new_coefs;
+   HYPRE_BigInt   *ii = transpose ? cols : rows;
+   HYPRE_BigInt   *jj = transpose ? rows : cols;
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &ij_A);
+   HYPRE_IJMatrixSetObjectType(ij_A, HYPRE_PARCSR);
+   HYPRE_IJMatrixInitialize_v2(ij_A, memory_location);
+
+   chunk_size = (HYPRE_Int) ((num_nonzeros + nchunks - 1) / nchunks);
+   new_coefs = hypre_TAlloc(HYPRE_Real, num_nonzeros, memory_location);
+
+   if (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+   {
+      for (i = 0; i < num_nonzeros; i++)
+      {
+         new_coefs[i] = 0.5 * coefs[i];
+      }
+   }
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   else
+   {
+      hypre_TMemcpy(new_coefs, coefs, HYPRE_Real, num_nonzeros, memory_location, memory_location);
+      hypreDevice_ComplexScalen(new_coefs, num_nonzeros, new_coefs, 0.5);
+   }
+#endif
+
+#if defined(HYPRE_USING_GPU)
+   hypre_SyncDevice();
+#if defined(CUDA_PROFILER)
+   cudaProfilerStart();
+#endif
+#endif
+
+   time_index = hypre_InitializeTiming("Test AddToValuesCOO");
+   hypre_BeginTiming(time_index);
+
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(chunk) HYPRE_SMP_SCHEDULE
+#endif
+      for (chunk = 0; chunk < nchunks; chunk++)
+      {
+         HYPRE_BigInt first = (HYPRE_BigInt) chunk * chunk_size;
+         HYPRE_Int    size  = (HYPRE_Int) hypre_max(0, hypre_min(chunk_size, num_nonzeros - first));
+
+         HYPRE_IJMatrixAddToValuesCOO(ij_A, size, &ii[first], &jj[first], &new_coefs[first]);
+         HYPRE_IJMatrixAddToValuesCOO(ij_A, size, &ii[first], &jj[first], &new_coefs[first]);
+      }
+   }
+   else
+   {
+      for (chunk = nchunks - 1; chunk >= 0; chunk--)
+      {
+         HYPRE_BigInt first = (HYPRE_BigInt) chunk * chunk_size;
+         HYPRE_Int    size  = (HYPRE_Int) hypre_max(0, hypre_min(chunk_size, num_nonzeros - first));
+
+         HYPRE_IJMatrixAddToValuesCOO(ij_A, size, &ii[first], &jj[first], &new_coefs[first]);
+         HYPRE_IJMatrixAddToValuesCOO(ij_A, size, &ii[first], &jj[first], &new_coefs[first]);
+      }
+   }
+
+   // Assemble matrix
+   HYPRE_IJMatrixAssemble(ij_A);
+
+#if defined(HYPRE_USING_GPU)
+   hypre_SyncDevice();
+#if defined(CUDA_PROFILER)
+   cudaProfilerStop();
+#endif
+#endif
+
+   // Finalize timer
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test AddToValuesCOO", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(new_coefs, memory_location);
+
+   // Set pointer to matrix
+   *ij_A_ptr = ij_A;
+
+   return hypre_error_flag;
+}
+
+/* add the values of A^T (with off-proc entries) to a matrix with a frozen
+ * pattern over ncycles assemblies, with values scaled by the cycle number */
+HYPRE_Int
+test_Frozen(MPI_Comm             comm,
+            HYPRE_MemoryLocation memory_location,
+            HYPRE_BigInt         ilower,
+            HYPRE_BigInt         iupper,
+            HYPRE_BigInt         jlower,
+            HYPRE_BigInt         jupper,
+            HYPRE_BigInt         num_nonzeros,
+            HYPRE_Int            nchunks,
+            HYPRE_BigInt        *rows,
+            HYPRE_BigInt        *cols,
+            HYPRE_Real          *coefs,
+            HYPRE_Int            ncycles,
+            HYPRE_IJMatrix      *ij_AT_ptr)
+{
+   HYPRE_IJMatrix  ij_AT;
+   HYPRE_Int       i, chunk, chunk_size, cycle;
+   HYPRE_Int       time_index;
+   HYPRE_Real     *new_coefs;
+
+   HYPRE_IJMatrixCreate(comm, jlower, jupper, ilower, iupper, &ij_AT);
+   HYPRE_IJMatrixSetObjectType(ij_AT, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetFrozenPattern(ij_AT, 1);
+
+   chunk_size = (HYPRE_Int) ((num_nonzeros + nchunks - 1) / nchunks);
+   new_coefs = hypre_TAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+
+   time_index = hypre_InitializeTiming("Test Frozen");
+   hypre_BeginTiming(time_index);
+
+   for (cycle = 1; cycle <= ncycles; cycle++)
+   {
+      for (i = 0; i < num_nonzeros; i++)
+      {
+         new_coefs[i] = cycle * coefs[i];
+      }
+
+      HYPRE_IJMatrixInitialize_v2(ij_AT, memory_location);
+      if (cycle > 1)
+      {
+         HYPRE_IJMatrixSetConstantValues(ij_AT, 0.0);
+      }
+
+      for (chunk = 0; chunk < nchunks; chunk++)
+      {
+         HYPRE_BigInt first = (HYPRE_BigInt) chunk * chunk_size;
+         HYPRE_Int    size  = (HYPRE_Int) hypre_max(0, hypre_min(chunk_size, num_nonzeros - first));
+
+         HYPRE_IJMatrixAddToValues(ij_AT, size, NULL, &cols[first], &rows[first], &new_coefs[first]);
+      }
+
+      HYPRE_IJMatrixAssemble(ij_AT);
+   }
+
+   // Finalize timer
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test Frozen", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(new_coefs, HYPRE_MEMORY_HOST);
+
+   // Set pointer to matrix
+   *ij_AT_ptr = ij_AT;
+
+   return hypre_error_flag;
+}
+
+/* add the values of A^T and of 2 A^T (with off-proc entries) to two matrices
+ * ncycles times with the split-phase assembly and the NBX exchange; the
+ * first cycle builds the matrices, the others add to the assembled matrices.
+ * The assemblies of the two matrices overlap, so that their exchanges are in
+ * flight at the same time */
+HYPRE_Int
+test_SplitNBX(MPI_Comm             comm,
+              HYPRE_MemoryLocation memory_location,
+              HYPRE_BigInt         ilower,
+              HYPRE_BigInt         iupper,
+              HYPRE_BigInt         jlower,
+              HYPRE_BigInt         jupper,
+              HYPRE_BigInt         num_nonzeros,
+              HYPRE_Int            nchunks,
+              HYPRE_BigInt        *rows,
+              HYPRE_BigInt        *cols,
+              HYPRE_Real          *coefs,
+              HYPRE_Int            ncycles,
+              HYPRE_IJMatrix      *ij_AT_ptr,
+              HYPRE_IJMatrix      *ij_BT_ptr)
+{
+   HYPRE_IJMatrix  ij_AT, ij_BT;
+   HYPRE_Int       i, chunk, chunk_size, cycle;
+   HYPRE_Int       time_index;
+   HYPRE_Real     *new_coefs;
+
+   HYPRE_IJMatrixCreate(comm, jlower, jupper, ilower, iupper, &ij_AT);
+   HYPRE_IJMatrixSetObjectType(ij_AT, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetOffProcExchange(ij_AT, 1);
+   HYPRE_IJMatrixCreate(comm, jlower, jupper, ilower, iupper, &ij_BT);
+   HYPRE_IJMatrixSetObjectType(ij_BT, HYPRE_PARCSR);
+   HYPRE_IJMatrixSetOffProcExchange(ij_BT, 1);
+
+   chunk_size = (HYPRE_Int) ((num_nonzeros + nchunks - 1) / nchunks);
+
+   /* B^T gets twice the values, so that mixed up exchanges are detected */
+   new_coefs = hypre_TAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      new_coefs[i] = 2.0 * coefs[i];
+   }
+
+   time_index = hypre_InitializeTiming("Test SplitNBX");
+   hypre_BeginTiming(time_index);
+
+   for (cycle = 1; cycle <= ncycles; cycle++)
+   {
+      HYPRE_IJMatrixInitialize_v2(ij_AT, memory_location);
+      HYPRE_IJMatrixInitialize_v2(ij_BT, memory_location);
+
+      for (chunk = 0; chunk < nchunks; chunk++)
+      {
+         HYPRE_BigInt first = (HYPRE_BigInt) chunk * chunk_size;
+         HYPRE_Int    size  = (HYPRE_Int) hypre_max(0, hypre_min(chunk_size, num_nonzeros - first));
+
+         HYPRE_IJMatrixAddToValues(ij_AT, size, NULL, &cols[first], &rows[first], &coefs[first]);
+         HYPRE_IJMatrixAddToValues(ij_BT, size, NULL, &cols[first], &rows[first], &new_coefs[first]);
+      }
+
+      HYPRE_IJMatrixAssembleBegin(ij_AT);
+      HYPRE_IJMatrixAssembleBegin(ij_BT);
+      HYPRE_IJMatrixAssembleEnd(ij_BT);
+      HYPRE_IJMatrixAssembleEnd(ij_AT);
+   }
+
+#if defined(HYPRE_USING_GPU)
+   hypre_SyncDevice();
+#endif
+
+   // Finalize timer
+   hypre_EndTiming(time_index);
+   hypre_PrintTiming("Test SplitNBX", hypre_MPI_COMM_WORLD);
+   hypre_FinalizeTiming(time_index);
+   hypre_ClearTiming();
+
+   // Free memory
+   hypre_TFree(new_coefs, HYPRE_MEMORY_HOST);
+
+   // Set pointer to matrices
+   *ij_AT_ptr = ij_AT;
+   *ij_BT_ptr = ij_BT;
+
+   return hypre_error_flag;
+}
@@ -2161,6 +2161,111 @@ SetCosineVector(HYPRE_Real  scale,
    return (0);
 }
 
+/*--------------------------------------------------------------------------
+ * Matrix-free copy of a matrix (-matfree option).  The coefficient functions
+ * read the values back from the stored matrix, so solves with the copy
+ * should reproduce the stored-matrix results.  Only single-part problems
+ * without non-stencil entries are supported.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_StructMatrix  *smatrix;
+   HYPRE_Int            sentry;
+
+} MatFreeData;
+
+HYPRE_Int
+MatFreeCoef( void          *fcn_data,
+             HYPRE_Int     *index,
+             HYPRE_Complex *value )
+{
+   MatFreeData        *mf_data = (MatFreeData *) fcn_data;
+   hypre_StructMatrix *smatrix = (mf_data -> smatrix);
+   hypre_BoxArray     *boxes   = hypre_StructGridBoxes(hypre_StructMatrixGrid(smatrix));
+   hypre_Box          *data_box;
+   HYPRE_Int           i;
+
+   hypre_ForBoxI(i, boxes)
+   {
+      if (hypre_IndexInBox(index, hypre_BoxArrayBox(boxes, i)))
+      {
+         data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(smatrix), i);
+         *value = *(hypre_StructMatrixBoxData(smatrix, i, (mf_data -> sentry)) +
+                    hypre_BoxIndexRank(data_box, index));
+         return 0;
+      }
+   }
+   *value = 0.0;
+
+   return 0;
+}
+
+HYPRE_Int
+MatFreeCreate( HYPRE_SStructMatrix   A,
+               HYPRE_SStructMatrix  *A_mf_ptr,
+               MatFreeData         **mf_data_ptr )
+{
+   MPI_Comm              comm  = hypre_SStructMatrixComm(A);
+   hypre_SStructGraph   *graph = hypre_SStructMatrixGraph(A);
+   hypre_SStructPGrid   *pgrid = hypre_SStructGraphPGrid(graph, 0);
+   HYPRE_Int             nvars = hypre_SStructPGridNVars(pgrid);
+   hypre_SStructPMatrix *pA;
+   hypre_SStructStencil *stencil;
+   HYPRE_SStructMatrix   A_mf;
+   MatFreeData          *mf_data;
+   HYPRE_Int            *split;
+   HYPRE_Int             valid, size, var, entry, k;
+
+   valid = (hypre_SStructMatrixNParts(A) == 1) &&
+           (hypre_SStructGraphNUVEntries(graph) == 0) &&
+           (hypre_SStructMatrixObjectType(A) == HYPRE_SSTRUCT);
+   size = 0;
+   for (var = 0; var < nvars; var++)
+   {
+      stencil = hypre_SStructGraphStencil(graph, 0, var);
+      split   = hypre_SStructMatrixSplit(A, 0, var);
+      for (entry = 0; entry < hypre_SStructStencilSize(stencil); entry++)
+      {
+         if (split[entry] < 0)
+         {
+            valid = 0;
+         }
+         size++;
+      }
+   }
+   hypre_MPI_Allreduce(MPI_IN_PLACE, &valid, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!valid)
+   {
+      return 1;
+   }
+
+   pA = hypre_SStructMatrixPMatrix(A, 0);
+   mf_data = hypre_TAlloc(MatFreeData, size, HYPRE_MEMORY_HOST);
+   HYPRE_SStructMatrixCreate(comm, (HYPRE_SStructGraph) graph, &A_mf);
+   k = 0;
+   for (var = 0; var < nvars; var++)
+   {
+      stencil = hypre_SStructGraphStencil(graph, 0, var);
+      split   = hypre_SStructMatrixSplit(A, 0, var);
+      for (entry = 0; entry < hypre_SStructStencilSize(stencil); entry++)
+      {
+         mf_data[k].smatrix = hypre_SStructPMatrixSMatrix(pA, var,
+                                                          hypre_SStructStencilVar(stencil, entry));
+         mf_data[k].sentry  = hypre_SStructPMatrixSMap(pA, var)[split[entry]];
+         HYPRE_SStructMatrixSetCoefFunction(A_mf, 0, var, entry, MatFreeCoef, &mf_data[k]);
+         k++;
+      }
+   }
+   HYPRE_SStructMatrixInitialize(A_mf);
+   HYPRE_SStructMatrixAssemble(A_mf);
+
+   *A_mf_ptr    = A_mf;
+   *mf_data_ptr = mf_data;
+
+   return 0;
+}
+
 /*--------------------------------------------------------------------------
  * Print usage info
  *--------------------------------------------------------------------------*/
@@ -2255,6 +2360,11 @@ PrintUsage( char *progname,
       hypre_printf("                        1 - Display memory usage statistics for each MPI rank.\n");
       hypre_printf("                        2 - Display aggregate memory usage statistics over MPI ranks.\n");
       hypre_printf("  -print             : print out the system\n");
+      hypre_printf("  -matfree           : solve with a matrix-free copy of the matrix\n");
+      hypre_printf("                       (single-part stencil problems, diagonal\n");
+      hypre_printf("                       scaling or no preconditioner only)\n");
+      hypre_printf("  -directparcsr      : build ParCSR matrices directly from the\n");
+      hypre_printf("                       stencil coefficients (ParCSR solvers only)\n");
       hypre_printf("  -rhsfromcosine     : solution is cosine function (default)\n");
       hypre_printf("  -rhsone            : rhs is vector with unit components\n");
       hypre_printf("  -tol <val>         : convergence tolerance (default 1e-6)\n");
@@ -2365,6 +2475,10 @@ main( hypre_int argc,
    HYPRE_SStructGraph    graph = NULL;
    HYPRE_SStructGraph    G_graph = NULL;
    HYPRE_SStructMatrix   A = NULL;
+   HYPRE_SStructMatrix   A_stored = NULL;
+   MatFreeData          *mf_data = NULL;
+   HYPRE_Int             matfree = 0;
+   HYPRE_Int             direct_parcsr = 0;
    HYPRE_SStructMatrix   G = NULL;
    HYPRE_SStructVector   b = NULL;
    HYPRE_SStructVector   x = NULL;
@@ -2763,6 +2877,16 @@ main( hypre_int argc,
          arg_index++;
          cosine = 0;
       }
+      else if ( strcmp(argv[arg_index], "-matfree") == 0 )
+      {
+         arg_index++;
+         matfree = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-directparcsr") == 0 )
+      {
+         arg_index++;
+         direct_parcsr = 1;
+      }
       else if ( strcmp(argv[arg_index], "-tol") == 0 )
       {
          arg_index++;
@@ -3261,6 +3385,7 @@ main( hypre_int argc,
          {
             HYPRE_SStructMatrixSetObjectType(A, object_type);
          }
+         HYPRE_SStructMatrixSetDirectParCSR(A, direct_parcsr);
 
          HYPRE_SStructMatrixInitialize(A);
 
@@ -3509,6 +3634,24 @@ main( hypre_int argc,
          HYPRE_SStructMatrixAssemble(A);
       }
 
+      /*-----------------------------------------------------------
+       * Replace A by a matrix-free copy (the stored matrix provides
+       * the coefficient values)
+       *-----------------------------------------------------------*/
+
+      if (matfree)
+      {
+         A_stored = A;
+         if (MatFreeCreate(A_stored, &A, &mf_data))
+         {
+            if (myid == 0)
+            {
+               hypre_printf("Matrix-free mode not supported for this problem\n");
+            }
+            A_stored = NULL;
+         }
+      }
+
       /*-----------------------------------------------------------
        * Set up the RHS vector
        *-----------------------------------------------------------*/
@@ -6274,6 +6417,12 @@ main( hypre_int argc,
        *-----------------------------------------------------------*/
 
       HYPRE_SStructMatrixDestroy(A);
+      if (A_stored)
+      {
+         HYPRE_SStructMatrixDestroy(A_stored);
+         A_stored = NULL;
+         hypre_TFree(mf_data, HYPRE_MEMORY_HOST);
+      }
       HYPRE_SStructVectorDestroy(b);
       HYPRE_SStructVectorDestroy(x);
       if (gradient_matrix)
@@ -101,6 +101,12 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks = 0;
    HYPRE_Int           skip;
+   HYPRE_Int           tblock;
+   HYPRE_Int           mostly_constant;
+   HYPRE_Int           tile_size;
+   HYPRE_Int           overlap_size;
+   HYPRE_Int           persistent;
+   HYPRE_Int           batched;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -246,6 +252,12 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tblock = 0;
+   mostly_constant = 0;
+   tile_size = -1;
+   overlap_size = -1;
+   persistent = 0;
+   batched = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -441,6 +453,36 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tblock") == 0 )
+      {
+         arg_index++;
+         tblock = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mc") == 0 )
+      {
+         arg_index++;
+         mostly_constant = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-tile") == 0 )
+      {
+         arg_index++;
+         tile_size = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-overlap") == 0 )
+      {
+         arg_index++;
+         overlap_size = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-persistent") == 0 )
+      {
+         arg_index++;
+         persistent = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-batched") == 0 )
+      {
+         arg_index++;
+         batched = 1;
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -691,8 +733,18 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Line Jacobi (PFMG only)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tblock <k>         : relaxation sweeps per ghost exchange in PFMG\n");
+      hypre_printf("                        and Jacobi (temporal blocking)\n");
+      hypre_printf("  -mc <m>             : mostly-constant coarse operators in PFMG\n");
+      hypre_printf("  -tile <n>           : loop points per tile in the host box loops\n");
+      hypre_printf("                        (tiled builds only, 0 turns tiling off)\n");
+      hypre_printf("  -overlap <n>        : overlap ghost exchange with interior compute\n");
+      hypre_printf("                        in chunks of n points (0 turns overlap off)\n");
+      hypre_printf("  -persistent         : use persistent communication for ghost exchanges\n");
+      hypre_printf("  -batched            : batched tridiagonal line solves in SMG\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -786,6 +838,21 @@ main( hypre_int argc,
       sym = 0;
    }
 
+   if (tile_size > -1)
+   {
+      HYPRE_StructSetBoxLoopTileSize(tile_size);
+   }
+
+   if (overlap_size > -1)
+   {
+      HYPRE_StructSetCommOverlapSize(overlap_size);
+   }
+
+   if (persistent)
+   {
+      HYPRE_StructSetPersistentComm(persistent);
+   }
+
    /*-----------------------------------------------------------
     * Print driver parameters
     *-----------------------------------------------------------*/
@@ -1467,6 +1534,7 @@ main( hypre_int argc,
          HYPRE_StructSMGSetRelChange(solver, 0);
          HYPRE_StructSMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructSMGSetNumPostRelax(solver, n_post);
+         HYPRE_StructSMGSetBatchedLineSolve(solver, batched);
          HYPRE_StructSMGSetPrintLevel(solver, solver_print_level);
          HYPRE_StructSMGSetLogging(solver, 1);
 #if 0//defined(HYPRE_USING_CUDA)
@@ -1542,6 +1610,8 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetTemporalBlock(solver, tblock);
+         HYPRE_StructPFMGSetMostlyConstant(solver, mostly_constant);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, solver_print_level);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1696,6 +1766,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
             HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructSMGSetLogging(precond, 0);
 
@@ -1724,6 +1795,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+            HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1766,6 +1839,7 @@ main( hypre_int argc,
             HYPRE_StructJacobiSetMaxIter(precond, 2);
             HYPRE_StructJacobiSetTol(precond, 0.0);
             HYPRE_StructJacobiSetZeroGuess(precond);
+            HYPRE_StructJacobiSetTemporalBlock(precond, tblock);
             HYPRE_PCGSetPrecond( (HYPRE_Solver) solver,
                                  (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSolve,
                                  (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSetup,
@@ -1866,6 +1940,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetZeroGuess(precond);
                HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+               HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
                HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
                HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -1893,6 +1968,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+               HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1935,6 +2012,7 @@ main( hypre_int argc,
                HYPRE_StructJacobiSetMaxIter(precond, 2);
                HYPRE_StructJacobiSetTol(precond, 0.0);
                HYPRE_StructJacobiSetZeroGuess(precond);
+               HYPRE_StructJacobiSetTemporalBlock(precond, tblock);
                HYPRE_PCGSetPrecond( (HYPRE_Solver) solver,
                                     (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSolve,
                                     (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSetup,
@@ -2117,6 +2195,7 @@ main( hypre_int argc,
                HYPRE_StructSMGSetZeroGuess(precond);
                HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+               HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
                HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
                HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -2144,6 +2223,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+               HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2186,6 +2267,7 @@ main( hypre_int argc,
                HYPRE_StructJacobiSetMaxIter(precond, 2);
                HYPRE_StructJacobiSetTol(precond, 0.0);
                HYPRE_StructJacobiSetZeroGuess(precond);
+               HYPRE_StructJacobiSetTemporalBlock(precond, tblock);
                HYPRE_LOBPCGSetPrecond( (HYPRE_Solver) solver,
                                        (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSolve,
                                        (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSetup,
@@ -2380,6 +2462,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
             HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -2407,6 +2490,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+            HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2504,6 +2589,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
             HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -2531,6 +2617,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+            HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2573,6 +2661,7 @@ main( hypre_int argc,
             HYPRE_StructJacobiSetMaxIter(precond, 2);
             HYPRE_StructJacobiSetTol(precond, 0.0);
             HYPRE_StructJacobiSetZeroGuess(precond);
+            HYPRE_StructJacobiSetTemporalBlock(precond, tblock);
             HYPRE_GMRESSetPrecond( (HYPRE_Solver)solver,
                                    (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSolve,
                                    (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSetup,
@@ -2655,6 +2744,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
             HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -2682,6 +2772,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+            HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2724,6 +2816,7 @@ main( hypre_int argc,
             HYPRE_StructJacobiSetMaxIter(precond, 2);
             HYPRE_StructJacobiSetTol(precond, 0.0);
             HYPRE_StructJacobiSetZeroGuess(precond);
+            HYPRE_StructJacobiSetTemporalBlock(precond, tblock);
             HYPRE_BiCGSTABSetPrecond( (HYPRE_Solver)solver,
                                       (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSolve,
                                       (HYPRE_PtrToSolverFcn) HYPRE_StructJacobiSetup,
@@ -2806,6 +2899,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
             HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -2833,6 +2927,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+            HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2904,6 +3000,7 @@ main( hypre_int argc,
             HYPRE_StructSMGSetZeroGuess(precond);
             HYPRE_StructSMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructSMGSetNumPostRelax(precond, n_post);
+            HYPRE_StructSMGSetBatchedLineSolve(precond, batched);
             HYPRE_StructSMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructSMGSetLogging(precond, 0);
 #if 0 //defined(HYPRE_USING_CUDA)
@@ -2931,6 +3028,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlock(precond, tblock);
+            HYPRE_StructPFMGSetMostlyConstant(precond, mostly_constant);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, prec_print_level);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -0,0 +1,460 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "_hypre_struct_mv.h"
+
+HYPRE_Int GetBlockExtents( HYPRE_Int dim, HYPRE_Int *n, HYPRE_Int *P, HYPRE_Int *b,
+                           HYPRE_Int proc, HYPRE_Int block,
+                           hypre_Index ilower, hypre_Index iupper );
+
+HYPRE_Int CompareEntries( hypre_BoxManEntry *entry1,
+                          hypre_BoxManEntry *entry2 );
+
+/*--------------------------------------------------------------------------
+ * Test driver for the incremental updates of an assembled box manager
+ *--------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------
+ * Every processor builds the same global set of boxes (a PxQxR processor
+ * topology with bx x by x bz blocks per processor).  Boxes are added to and
+ * deleted from an assembled box manager with hypre_BoxManAddEntry,
+ * hypre_BoxManDeleteEntry and hypre_BoxManAssembleIncremental.  The result
+ * is compared (GetAllEntries, GetEntry, Intersect) against a box manager
+ * assembled from scratch with the final set of boxes.  Do `driver -help'
+ * for usage info.
+ *----------------------------------------------------------------------*/
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   HYPRE_Int           arg_index;
+   HYPRE_Int           print_usage;
+   HYPRE_Int           n[3], P[3], b[3];
+   HYPRE_Int           dim;
+
+   HYPRE_Int           num_procs, myid;
+   HYPRE_Int           nprocs, nblocks;
+
+   hypre_BoxManager   *inc_manager, *full_manager;
+   hypre_BoxManEntry  *inc_entry, *full_entry;
+   hypre_BoxManEntry  *inc_all, *full_all;
+   hypre_BoxManEntry **inc_entries, **full_entries;
+   HYPRE_Int           inc_nentries, full_nentries;
+   hypre_Box          *bbox;
+   hypre_Index         ilower, iupper, qlower, qupper;
+   HYPRE_Int           proc, block, tag, kind, id;
+   HYPRE_Int           d, i, k, shift, step;
+
+   HYPRE_Int           check, global_check;
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+   hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );
+   hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
+
+   /*-----------------------------------------------------------
+    * Initialize : must be the first HYPRE function to call
+    *-----------------------------------------------------------*/
+   HYPRE_Initialize();
+
+   /*-----------------------------------------------------------
+    * Set defaults
+    *-----------------------------------------------------------*/
+
+   dim = 3;
+
+   n[0] = 4;
+   n[1] = 4;
+   n[2] = 4;
+
+   P[0] = num_procs;
+   P[1] = 1;
+   P[2] = 1;
+
+   b[0] = 2;
+   b[1] = 2;
+   b[2] = 2;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   print_usage = 0;
+   arg_index = 1;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         n[0] = atoi(argv[arg_index++]);
+         n[1] = atoi(argv[arg_index++]);
+         n[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P[0] = atoi(argv[arg_index++]);
+         P[1] = atoi(argv[arg_index++]);
+         P[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-b") == 0 )
+      {
+         arg_index++;
+         b[0] = atoi(argv[arg_index++]);
+         b[1] = atoi(argv[arg_index++]);
+         b[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-d") == 0 )
+      {
+         arg_index++;
+         dim = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+         break;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Print usage info
+    *-----------------------------------------------------------*/
+
+   if ( (print_usage) && (myid == 0) )
+   {
+      hypre_printf("\n");
+      hypre_printf("Usage: %s [<options>]\n", argv[0]);
+      hypre_printf("\n");
+      hypre_printf("  -n <nx> <ny> <nz>   : size of each block\n");
+      hypre_printf("  -P <Px> <Py> <Pz>   : processor topology of the boxes\n");
+      hypre_printf("  -b <bx> <by> <bz>   : blocking per processor\n");
+      hypre_printf("  -d <dim>            : problem dimension (1, 2 or 3)\n");
+      hypre_printf("\n");
+   }
+
+   if ( print_usage )
+   {
+      exit(1);
+   }
+
+   for (d = dim; d < 3; d++)
+   {
+      n[d] = 1;
+      P[d] = 1;
+      b[d] = 1;
+   }
+   nprocs  = P[0] * P[1] * P[2];
+   nblocks = b[0] * b[1] * b[2];
+
+   /*-----------------------------------------------------------
+    * Print driver parameters
+    *-----------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      hypre_printf("Running with these driver parameters:\n");
+      hypre_printf("  (nx, ny, nz)    = (%d, %d, %d)\n", n[0], n[1], n[2]);
+      hypre_printf("  (Px, Py, Pz)    = (%d, %d, %d)\n", P[0], P[1], P[2]);
+      hypre_printf("  (bx, by, bz)    = (%d, %d, %d)\n", b[0], b[1], b[2]);
+      hypre_printf("  dim             = %d\n", dim);
+   }
+
+   /*-----------------------------------------------------------
+    * Each block (proc, block) is one of four kinds:
+    *
+    *   0: added before the assemble and kept
+    *   1: added before the assemble and deleted afterwards
+    *   2: added after the assemble
+    *   3: as 0, plus an overlapping box (id = nblocks + block) added after
+    *      the assemble
+    *-----------------------------------------------------------*/
+
+   bbox = hypre_BoxCreate(dim);
+   hypre_SetIndex(ilower, 0);
+   hypre_SetIndex(iupper, 0);
+   for (d = 0; d < dim; d++)
+   {
+      hypre_IndexD(ilower, d) = 1;
+      hypre_IndexD(iupper, d) = n[d] * b[d] * P[d] + n[d] / 2;
+   }
+   hypre_BoxSetExtents(bbox, ilower, iupper);
+
+   hypre_BoxManCreate(1, sizeof(HYPRE_Int), dim, bbox, hypre_MPI_COMM_WORLD,
+                      &inc_manager);
+   hypre_BoxManCreate(1, sizeof(HYPRE_Int), dim, bbox, hypre_MPI_COMM_WORLD,
+                      &full_manager);
+   hypre_BoxManSetAllGlobalKnown(inc_manager, 1);
+   hypre_BoxManSetAllGlobalKnown(full_manager, 1);
+
+   /* add the initial boxes (the procs in reverse order) and assemble */
+   for (proc = nprocs - 1; proc >= 0; proc--)
+   {
+      for (block = 0; block < nblocks; block++)
+      {
+         kind = (proc + block) % 4;
+         if (kind != 2)
+         {
+            GetBlockExtents(dim, n, P, b, proc, block, ilower, iupper);
+            tag = proc * nblocks + block;
+            hypre_BoxManAddEntry(inc_manager, ilower, iupper, proc, block, &tag);
+         }
+      }
+   }
+   hypre_BoxManAssemble(inc_manager);
+
+   /* delete boxes (some twice), then add the new ones */
+   for (proc = 0; proc < nprocs; proc++)
+   {
+      for (block = 0; block < nblocks; block++)
+      {
+         kind = (proc + block) % 4;
+         if (kind == 1)
+         {
+            hypre_BoxManDeleteEntry(inc_manager, proc, block);
+            if (block % 2)
+            {
+               hypre_BoxManDeleteEntry(inc_manager, proc, block);
+            }
+         }
+      }
+   }
+   for (proc = 0; proc < nprocs; proc++)
+   {
+      for (block = nblocks - 1; block >= 0; block--)
+      {
+         kind = (proc + block) % 4;
+         GetBlockExtents(dim, n, P, b, proc, block, ilower, iupper);
+         if (kind == 2)
+         {
+            tag = proc * nblocks + block;
+            hypre_BoxManAddEntry(inc_manager, ilower, iupper, proc, block, &tag);
+         }
+         else if (kind == 3)
+         {
+            for (d = 0; d < dim; d++)
+            {
+               shift = n[d] / 2;
+               hypre_IndexD(ilower, d) += shift;
+               hypre_IndexD(iupper, d) += shift;
+            }
+            tag = -(proc * nblocks + block);
+            hypre_BoxManAddEntry(inc_manager, ilower, iupper, proc, nblocks + block, &tag);
+         }
+      }
+   }
+   hypre_BoxManAssembleIncremental(inc_manager);
+
+   /* assemble the final set of boxes from scratch */
+   for (proc = 0; proc < nprocs; proc++)
+   {
+      for (block = 0; block < nblocks; block++)
+      {
+         kind = (proc + block) % 4;
+         GetBlockExtents(dim, n, P, b, proc, block, ilower, iupper);
+         if (kind != 1)
+         {
+            tag = proc * nblocks + block;
+            hypre_BoxManAddEntry(full_manager, ilower, iupper, proc, block, &tag);
+         }
+         if (kind == 3)
+         {
+            for (d = 0; d < dim; d++)
+            {
+               shift = n[d] / 2;
+               hypre_IndexD(ilower, d) += shift;
+               hypre_IndexD(iupper, d) += shift;
+            }
+            tag = -(proc * nblocks + block);
+            hypre_BoxManAddEntry(full_manager, ilower, iupper, proc, nblocks + block, &tag);
+         }
+      }
+   }
+   hypre_BoxManAssemble(full_manager);
+
+   /*-----------------------------------------------------------
+    * Compare the two box managers
+    *-----------------------------------------------------------*/
+
+   check = 0;
+
+   /* all entries */
+   hypre_BoxManGetAllEntries(inc_manager, &inc_nentries, &inc_all);
+   hypre_BoxManGetAllEntries(full_manager, &full_nentries, &full_all);
+   if (inc_nentries != full_nentries)
+   {
+      check++;
+   }
+   else
+   {
+      for (i = 0; i < inc_nentries; i++)
+      {
+         check += CompareEntries(&inc_all[i], &full_all[i]);
+      }
+   }
+
+   /* entries by id, including the deleted ones */
+   for (proc = 0; proc < nprocs; proc++)
+   {
+      for (id = 0; id < 2 * nblocks; id++)
+      {
+         hypre_BoxManGetEntry(inc_manager, proc, id, &inc_entry);
+         hypre_BoxManGetEntry(full_manager, proc, id, &full_entry);
+         check += CompareEntries(inc_entry, full_entry);
+      }
+   }
+
+   /* intersections with boxes of one block size swept over the domain */
+   step = 0;
+   for (k = 0; ; k++)
+   {
+      i = k;
+      for (d = 0; d < dim; d++)
+      {
+         shift = hypre_max(n[d] / 2, 1);
+         hypre_IndexD(qlower, d) = (i % (2 * b[d] * P[d] + 2)) * shift - shift + 1;
+         hypre_IndexD(qupper, d) = hypre_IndexD(qlower, d) + n[d] - 1;
+         i /= (2 * b[d] * P[d] + 2);
+      }
+      if (i > 0)
+      {
+         break;
+      }
+
+      hypre_BoxManIntersect(inc_manager, qlower, qupper, &inc_entries, &inc_nentries);
+      hypre_BoxManIntersect(full_manager, qlower, qupper, &full_entries, &full_nentries);
+      if (inc_nentries != full_nentries)
+      {
+         check++;
+      }
+      else
+      {
+         for (i = 0; i < inc_nentries; i++)
+         {
+            check += CompareEntries(inc_entries[i], full_entries[i]);
+         }
+      }
+      hypre_TFree(inc_entries, HYPRE_MEMORY_HOST);
+      hypre_TFree(full_entries, HYPRE_MEMORY_HOST);
+      step++;
+   }
+
+   hypre_MPI_Allreduce(&check, &global_check, 1, HYPRE_MPI_INT, hypre_MPI_SUM,
+                       hypre_MPI_COMM_WORLD);
+
+   if (myid == 0)
+   {
+      hypre_printf("  entries         = %d\n", hypre_BoxManNEntries(full_manager));
+      hypre_printf("  intersections   = %d\n", step);
+      hypre_printf("\nCheck = %d (success = 0)\n\n", global_check);
+   }
+
+   /*-----------------------------------------------------------
+    * Finalize things
+    *-----------------------------------------------------------*/
+
+   hypre_BoxManDestroy(inc_manager);
+   hypre_BoxManDestroy(full_manager);
+   hypre_BoxDestroy(bbox);
+
+   /* Finalize Hypre */
+   HYPRE_Finalize();
+
+   /* Finalize MPI */
+   hypre_MPI_Finalize();
+
+   return (0);
+}
+
+/*-------------------------------------------------------------------------
+ * Extents of block number 'block' of processor 'proc'.
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+GetBlockExtents( HYPRE_Int    dim,
+                 HYPRE_Int   *n,
+                 HYPRE_Int   *P,
+                 HYPRE_Int   *b,
+                 HYPRE_Int    proc,
+                 HYPRE_Int    block,
+                 hypre_Index  ilower,
+                 hypre_Index  iupper )
+{
+   HYPRE_Int  d, p, ib;
+
+   hypre_SetIndex(ilower, 0);
+   hypre_SetIndex(iupper, 0);
+   for (d = 0; d < dim; d++)
+   {
+      p  = proc % P[d];
+      ib = block % b[d];
+      hypre_IndexD(ilower, d) = 1 + n[d] * (b[d] * p + ib);
+      hypre_IndexD(iupper, d) = n[d] * (b[d] * p + ib + 1);
+      proc  /= P[d];
+      block /= b[d];
+   }
+
+   return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Return 0 if both entries are NULL, or if they have the same id, extents
+ * and info, and 1 otherwise.
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+CompareEntries( hypre_BoxManEntry *entry1,
+                hypre_BoxManEntry *entry2 )
+{
+   hypre_Index  imin1, imax1, imin2, imax2;
+   void        *info1, *info2;
+   HYPRE_Int    d;
+
+   if (entry1 == NULL || entry2 == NULL)
+   {
+      return (entry1 != entry2);
+   }
+
+   if ( hypre_BoxManEntryProc(entry1) != hypre_BoxManEntryProc(entry2) ||
+        hypre_BoxManEntryId(entry1)   != hypre_BoxManEntryId(entry2) )
+   {
+      return 1;
+   }
+
+   hypre_BoxManEntryGetExtents(entry1, imin1, imax1);
+   hypre_BoxManEntryGetExtents(entry2, imin2, imax2);
+   for (d = 0; d < hypre_BoxManEntryNDim(entry1); d++)
+   {
+      if ( hypre_IndexD(imin1, d) != hypre_IndexD(imin2, d) ||
+           hypre_IndexD(imax1, d) != hypre_IndexD(imax2, d) )
+      {
+         return 1;
+      }
+   }
+
+   hypre_BoxManEntryGetInfo(entry1, &info1);
+   hypre_BoxManEntryGetInfo(entry2, &info2);
+   if (*((HYPRE_Int *) info1) != *((HYPRE_Int *) info2))
+   {
+      return 1;
+   }
+
+   return 0;
+}
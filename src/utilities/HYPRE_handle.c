@@ -43,6 +43,26 @@ HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_SetSpMVUseVendor(use_vendor);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVUseSell
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   return hypre_SetSpMVUseSell(use_sell);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetHostFirstTouch
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetHostFirstTouch( HYPRE_Int first_touch )
+{
+   return hypre_SetHostFirstTouch(first_touch);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpGemmUseVendor
  *--------------------------------------------------------------------------*/
@@ -446,6 +446,54 @@ HYPRE_Int HYPRE_SetUmpirePinnedPoolName(const char *pool_name);
 HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HYPRE_Int max_bin,
                                      size_t max_cached_bytes);
 
+/*--------------------------------------------------------------------------
+ * HYPRE host memory
+ *--------------------------------------------------------------------------*/
+
+/**
+ * Specifies whether large host allocations are first touched by the OpenMP threads
+ * (NUMA-aware allocation).
+ *
+ * The following options are available for \e first_touch:
+ *
+ *    - 0 : (default) Host memory is allocated and zeroed by the calling thread.
+ *    - 1 : Host allocations of at least 64 KiB made outside of parallel regions are
+ *          touched by all threads, each one handling the chunk it owns in the static
+ *          thread partition of the host kernels. CSR matrices built by
+ *          hypre_CSRMatrixInitialize and by IJ assembly place the entries of each
+ *          row on the thread that owns the row.
+ *
+ * @param first_touch Indicates whether to use parallel first touch or not.
+ *
+ * @note This only has an effect in OpenMP builds running with more than one thread,
+ *       and relies on the first-touch page placement policy of the operating system.
+ *       Threads must be pinned to cores (e.g., OMP_PROC_BIND=close or spread, and
+ *       OMP_PLACES=cores), otherwise they may migrate away from their memory.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetHostFirstTouch(HYPRE_Int first_touch);
+
+/**
+ * Enables a pooled allocator for host memory, which serves the many short-lived
+ * allocations of setup phases from size classes cached per OpenMP thread instead of
+ * calling malloc and free.
+ *
+ * Blocks of up to 32 MiB are carved from an arena of \e pool_size bytes, which is
+ * reserved by the first call with a nonzero size and is not resized afterwards.
+ * Larger blocks, and all blocks once the arena is exhausted, use malloc. A size of
+ * 0 disables the pool for new allocations.
+ *
+ * @param pool_size The size of the host memory pool in bytes.
+ *
+ * @note Memory freed to the pool is reused by hypre but not returned to the system
+ *       before HYPRE_Finalize. Pool usage is reported by the memory usage logs
+ *       (see HYPRE_SetLogLevel). This option has no effect with Umpire host pools.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetHostMemoryPool(size_t pool_size);
+
 /*--------------------------------------------------------------------------
  * HYPRE handle
  *--------------------------------------------------------------------------*/
@@ -502,6 +550,32 @@ HYPRE_Int HYPRE_SetSpTransUseVendor(HYPRE_Int use_vendor);
  **/
 HYPRE_Int HYPRE_SetSpMVUseVendor(HYPRE_Int use_vendor);
 
+/**
+ * Specifies the storage format used for sparse matrix/vector multiplication in host
+ * (CPU) execution.
+ *
+ * The following options are available for \e use_sell:
+ *
+ *    - 0 : (default) Use the CSR arrays of the matrix.
+ *    - 1 : Use a SELL-C-sigma (sorted sliced ELLPACK) copy of the matrix, which is built
+ *          on the first matrix/vector product and reused afterwards. Matrices whose
+ *          SELL layout would require too much padding keep using CSR.
+ *
+ * @param use_sell Indicates whether to use the SELL-C-sigma layout or not.
+ *
+ * @note AVX-512 and AVX2 kernels are used when hypre is compiled for such targets
+ *       (e.g., -march=native) in double precision with 32-bit integers.
+ *
+ * @note The SELL copy doubles the memory used by the matrix values. It is refreshed
+ *       when matrix values are changed through hypre's interfaces; applications
+ *       modifying the CSR data arrays of a ParCSR matrix directly must call
+ *       HYPRE_ParCSRMatrixInvalidateSpMVData on the modified matrix before the
+ *       next matrix/vector product.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetSpMVUseSell(HYPRE_Int use_sell);
+
 /**
  * Specifies the algorithm used for sparse matrix/matrix multiplication in device builds.
  *
@@ -42,6 +42,26 @@ extern "C" {
 #define HYPRE_UMPIRE_POOL_NAME_MAX_LEN 1024
 #endif /* defined(HYPRE_USING_UMPIRE) */
 
+/* default number of loop points per tile for the tiled host BoxLoops */
+#ifndef HYPRE_BOXLOOP_TILE_SIZE
+#define HYPRE_BOXLOOP_TILE_SIZE 8192
+#endif
+
+/* default number of independent points computed between MPI progress tests
+ * in the overlapped struct computations (0 turns the overlapped mode off) */
+#ifndef HYPRE_OVERLAP_SIZE
+#ifdef HYPRE_OVERLAP_COMM_COMP
+#define HYPRE_OVERLAP_SIZE 8192
+#else
+#define HYPRE_OVERLAP_SIZE 0
+#endif
+#endif
+
+/* default persistent communication mode for new struct communication packages */
+#ifndef HYPRE_COMM_PERSISTENT
+#define HYPRE_COMM_PERSISTENT 0
+#endif
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 typedef void (*GPUMallocFunc)(void **, size_t);
@@ -54,6 +74,17 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
 
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;
+
+   /* host memory options */
+   HYPRE_Int              host_first_touch;
+
+   /* struct options */
+   HYPRE_Int              boxloop_tile_size;
+   HYPRE_Int              struct_overlap_size;
+   HYPRE_Int              struct_comm_persistent;
+
    /* the device buffers needed to do MPI communication for struct comm */
    HYPRE_Complex         *struct_comm_recv_buffer;
    HYPRE_Complex         *struct_comm_send_buffer;
@@ -100,6 +131,11 @@ typedef struct
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                   ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleHostFirstTouch(hypre_handle)                 ((hypre_handle) -> host_first_touch)
+#define hypre_HandleBoxLoopTileSize(hypre_handle)                ((hypre_handle) -> boxloop_tile_size)
+#define hypre_HandleStructOverlapSize(hypre_handle)              ((hypre_handle) -> struct_overlap_size)
+#define hypre_HandleStructCommPersistent(hypre_handle)           ((hypre_handle) -> struct_comm_persistent)
 
 #define hypre_HandleStructCommRecvBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_recv_buffer)
 #define hypre_HandleStructCommSendBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_send_buffer)
@@ -798,6 +834,7 @@ extern "C" {
 #define MPI_Wtime           hypre_MPI_Wtime
 #define MPI_Wtick           hypre_MPI_Wtick
 #define MPI_Barrier         hypre_MPI_Barrier
+#define MPI_Ibarrier        hypre_MPI_Ibarrier
 #define MPI_Comm_create     hypre_MPI_Comm_create
 #define MPI_Comm_dup        hypre_MPI_Comm_dup
 #define MPI_Comm_f2c        hypre_MPI_Comm_f2c
@@ -822,6 +859,7 @@ extern "C" {
 #define MPI_Send            hypre_MPI_Send
 #define MPI_Recv            hypre_MPI_Recv
 #define MPI_Isend           hypre_MPI_Isend
+#define MPI_Issend          hypre_MPI_Issend
 #define MPI_Irecv           hypre_MPI_Irecv
 #define MPI_Send_init       hypre_MPI_Send_init
 #define MPI_Recv_init       hypre_MPI_Recv_init
@@ -835,6 +873,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -973,6 +1012,7 @@ HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm, HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
 HYPRE_Real hypre_MPI_Wtick( void );
 HYPRE_Int hypre_MPI_Barrier( hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Ibarrier( hypre_MPI_Comm comm, hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Comm_create( hypre_MPI_Comm comm, hypre_MPI_Group group,
                                  hypre_MPI_Comm *newcomm );
 HYPRE_Int hypre_MPI_Comm_dup( hypre_MPI_Comm comm, hypre_MPI_Comm *newcomm );
@@ -1016,6 +1056,8 @@ HYPRE_Int hypre_MPI_Recv( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatyp
                           HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Isend( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype, HYPRE_Int dest,
                            HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Issend( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype, HYPRE_Int dest,
+                            HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Irecv( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype,
                            HYPRE_Int source, HYPRE_Int tag, hypre_MPI_Comm comm, hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Send_init( void *buf, HYPRE_Int count, hypre_MPI_Datatype datatype,
@@ -1039,6 +1081,9 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count, hypre_MPI_Request *array_of_reques
                              HYPRE_Int *index, hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
+                                hypre_MPI_Datatype datatype, hypre_MPI_Op op, hypre_MPI_Comm comm,
+                                hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf, void *recvbuf, HYPRE_Int count,
                             hypre_MPI_Datatype datatype, hypre_MPI_Op op, HYPRE_Int root, hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf, void *recvbuf, HYPRE_Int count,
@@ -1282,12 +1327,21 @@ HYPRE_Int hypre_UmpireFinalize(hypre_Handle *hypre_handle_);
 HYPRE_Int hypre_UmpireGetCurrentMemoryUsage(MPI_Comm comm, HYPRE_Real *current);
 HYPRE_Int hypre_UmpireMemoryGetUsage(HYPRE_Real *memory);
 HYPRE_Int hypre_HostMemoryGetUsage(HYPRE_Real *mem);
+HYPRE_Int hypre_HostFirstTouchActive( HYPRE_MemoryLocation location );
 HYPRE_Int hypre_MemoryPrintUsage(MPI_Comm comm, HYPRE_Int level,
                                  const char *function, HYPRE_Int line);
 #define HYPRE_PRINT_MEMORY_USAGE(comm) hypre_MemoryPrintUsage(comm,\
                                                               hypre_HandleLogLevel(hypre_handle()),\
                                                               __func__,\
                                                               __LINE__)
+/* memory_pool.c */
+HYPRE_Int hypre_SetHostMemoryPool( size_t pool_size );
+void *hypre_HostMemoryPoolAlloc( size_t size );
+HYPRE_Int hypre_HostMemoryPoolFree( void *ptr );
+size_t hypre_HostMemoryPoolBlockSize( void *ptr );
+HYPRE_Int hypre_HostMemoryPoolGetUsage( HYPRE_Real *mem );
+HYPRE_Int hypre_HostMemoryPoolDestroy( void );
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -2437,6 +2491,8 @@ HYPRE_Int hypre_GetSyncCudaCompute(HYPRE_Int *cuda_compute_stream_sync_ptr);
 HYPRE_Int hypre_SetLogLevel( HYPRE_Int log_level );
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
+HYPRE_Int hypre_SetSpMVUseSell( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetHostFirstTouch( HYPRE_Int first_touch );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmAlgorithm( HYPRE_Int value );
 HYPRE_Int hypre_SetSpGemmBinned( HYPRE_Int value );
@@ -36,6 +36,11 @@ hypre_HandleCreate(void)
 
    hypre_HandleLogLevel(hypre_handle_) = 0;
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
+   hypre_HandleSpMVUseSell(hypre_handle_) = 0;
+   hypre_HandleHostFirstTouch(hypre_handle_) = 0;
+   hypre_HandleBoxLoopTileSize(hypre_handle_) = HYPRE_BOXLOOP_TILE_SIZE;
+   hypre_HandleStructOverlapSize(hypre_handle_) = HYPRE_OVERLAP_SIZE;
+   hypre_HandleStructCommPersistent(hypre_handle_) = HYPRE_COMM_PERSISTENT;
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
@@ -442,6 +447,9 @@ HYPRE_Finalize(void)
    hypre_HandleDestroy(_hypre_handle);
    _hypre_handle = NULL;
 
+   /* Release the host memory pool (kept if pooled blocks are still in use) */
+   hypre_HostMemoryPoolDestroy();
+
 #if !defined(HYPRE_USING_SYCL)
    hypre_GetDeviceLastError();
 #endif
@@ -58,6 +58,30 @@ hypre_SetSpMVUseVendor( HYPRE_Int use_vendor )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SetSpMVUseSell
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetSpMVUseSell( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSell(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetHostFirstTouch
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetHostFirstTouch( HYPRE_Int first_touch )
+{
+   hypre_HandleHostFirstTouch(hypre_handle()) = first_touch;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SetSpGemmUseVendor
  *--------------------------------------------------------------------------*/
@@ -26,6 +26,26 @@
 #define HYPRE_UMPIRE_POOL_NAME_MAX_LEN 1024
 #endif /* defined(HYPRE_USING_UMPIRE) */
 
+/* default number of loop points per tile for the tiled host BoxLoops */
+#ifndef HYPRE_BOXLOOP_TILE_SIZE
+#define HYPRE_BOXLOOP_TILE_SIZE 8192
+#endif
+
+/* default number of independent points computed between MPI progress tests
+ * in the overlapped struct computations (0 turns the overlapped mode off) */
+#ifndef HYPRE_OVERLAP_SIZE
+#ifdef HYPRE_OVERLAP_COMM_COMP
+#define HYPRE_OVERLAP_SIZE 8192
+#else
+#define HYPRE_OVERLAP_SIZE 0
+#endif
+#endif
+
+/* default persistent communication mode for new struct communication packages */
+#ifndef HYPRE_COMM_PERSISTENT
+#define HYPRE_COMM_PERSISTENT 0
+#endif
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 typedef void (*GPUMallocFunc)(void **, size_t);
@@ -38,6 +58,17 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
 
+   /* host SpMV options */
+   HYPRE_Int              spmv_use_sell;
+
+   /* host memory options */
+   HYPRE_Int              host_first_touch;
+
+   /* struct options */
+   HYPRE_Int              boxloop_tile_size;
+   HYPRE_Int              struct_overlap_size;
+   HYPRE_Int              struct_comm_persistent;
+
    /* the device buffers needed to do MPI communication for struct comm */
    HYPRE_Complex         *struct_comm_recv_buffer;
    HYPRE_Complex         *struct_comm_send_buffer;
@@ -84,6 +115,11 @@ typedef struct
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
+#define hypre_HandleSpMVUseSell(hypre_handle)                   ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleHostFirstTouch(hypre_handle)                 ((hypre_handle) -> host_first_touch)
+#define hypre_HandleBoxLoopTileSize(hypre_handle)                ((hypre_handle) -> boxloop_tile_size)
+#define hypre_HandleStructOverlapSize(hypre_handle)              ((hypre_handle) -> struct_overlap_size)
+#define hypre_HandleStructCommPersistent(hypre_handle)           ((hypre_handle) -> struct_comm_persistent)
 
 #define hypre_HandleStructCommRecvBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_recv_buffer)
 #define hypre_HandleStructCommSendBuffer(hypre_handle)           ((hypre_handle) -> struct_comm_send_buffer)
@@ -242,6 +242,74 @@ hypre_UnifiedMemPrefetch(void *ptr, size_t size, hypre_MemoryLocation location)
 #endif
 }
 
+/*--------------------------------------------------------------------------
+ * NUMA-aware first touch of host allocations
+ *
+ * Operating systems commonly place a page on the NUMA node of the thread that
+ * writes to it first. When the first-touch mode is on, large host allocations
+ * made outside of OpenMP parallel regions are touched (or zeroed) by all the
+ * threads, each of them handling the contiguous chunk given by
+ * hypre_GetSimpleThreadPartition. Row- and nonzero-indexed arrays are then
+ * spread across the sockets like the work in the threaded host kernels.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_HOST_PAGE_SIZE        4096
+#define hypre_HOST_FIRST_TOUCH_MIN  (16 * hypre_HOST_PAGE_SIZE)
+
+/* Returns 1 if newly allocated arrays at the given location are to be first
+ * touched by the OpenMP threads (see HYPRE_SetHostFirstTouch) */
+HYPRE_Int
+hypre_HostFirstTouchActive( HYPRE_MemoryLocation location )
+{
+#if defined(HYPRE_USING_OPENMP)
+   return (hypre_HandleHostFirstTouch(hypre_handle()) &&
+           hypre_GetActualMemLocation(location) == hypre_MEMORY_HOST &&
+           hypre_NumThreads() > 1 && !omp_in_parallel());
+#else
+   HYPRE_UNUSED_VAR(location);
+
+   return 0;
+#endif
+}
+
+static inline void
+hypre_HostFirstTouch(void *ptr, size_t size, HYPRE_Int zeroinit)
+{
+#if defined(HYPRE_USING_OPENMP)
+   HYPRE_Int num_pages = (HYPRE_Int) ((size + hypre_HOST_PAGE_SIZE - 1) / hypre_HOST_PAGE_SIZE);
+
+   #pragma omp parallel
+   {
+      char      *cptr = (char *) ptr;
+      HYPRE_Int  page_begin, page_end, k;
+      size_t     begin, end;
+
+      hypre_GetSimpleThreadPartition(&page_begin, &page_end, num_pages);
+      begin = (size_t) page_begin * hypre_HOST_PAGE_SIZE;
+      end   = hypre_min((size_t) page_end * hypre_HOST_PAGE_SIZE, size);
+
+      if (zeroinit)
+      {
+         if (end > begin)
+         {
+            memset(cptr + begin, 0, end - begin);
+         }
+      }
+      else
+      {
+         for (k = page_begin; k < page_end; k++)
+         {
+            cptr[(size_t) k * hypre_HOST_PAGE_SIZE] = 0;
+         }
+      }
+   }
+#else
+   HYPRE_UNUSED_VAR(ptr);
+   HYPRE_UNUSED_VAR(size);
+   HYPRE_UNUSED_VAR(zeroinit);
+#endif
+}
+
 /*--------------------------------------------------------------------------
  * Malloc
  *--------------------------------------------------------------------------*/
@@ -257,13 +325,31 @@ hypre_HostMalloc(size_t size, HYPRE_Int zeroinit)
       memset(ptr, 0, size);
    }
 #else
-   if (zeroinit)
+   if (size >= hypre_HOST_FIRST_TOUCH_MIN && hypre_HostFirstTouchActive(HYPRE_MEMORY_HOST))
    {
-      ptr = calloc(size, 1);
+      ptr = malloc(size);
+      if (ptr)
+      {
+         hypre_HostFirstTouch(ptr, size, zeroinit);
+      }
    }
    else
    {
-      ptr = malloc(size);
+      /* host memory pool (HYPRE_SetHostMemoryPool), if enabled */
+      ptr = hypre_HostMemoryPoolAlloc(size);
+
+      if (ptr && zeroinit)
+      {
+         memset(ptr, 0, size);
+      }
+      else if (!ptr && zeroinit)
+      {
+         ptr = calloc(size, 1);
+      }
+      else if (!ptr)
+      {
+         ptr = malloc(size);
+      }
    }
 #endif
 
@@ -464,7 +550,10 @@ hypre_HostFree(void *ptr)
 #if defined(HYPRE_USING_UMPIRE_HOST)
    hypre_umpire_host_pooled_free(ptr);
 #else
-   free(ptr);
+   if (!hypre_HostMemoryPoolFree(ptr))
+   {
+      free(ptr);
+   }
 #endif
 }
 
@@ -1018,7 +1107,26 @@ hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location)
 #if defined(HYPRE_USING_UMPIRE_HOST)
    ptr = hypre_umpire_host_pooled_realloc(ptr, size);
 #else
-   ptr = realloc(ptr, size);
+   size_t block_size = hypre_HostMemoryPoolBlockSize(ptr);
+
+   if (block_size >= size)
+   {
+      /* pooled block large enough */
+   }
+   else if (block_size)
+   {
+      void *new_ptr = hypre_HostMalloc(size, 0);
+      if (new_ptr)
+      {
+         memcpy(new_ptr, ptr, block_size);
+         hypre_HostFree(ptr);
+      }
+      ptr = new_ptr;
+   }
+   else
+   {
+      ptr = realloc(ptr, size);
+   }
 #endif
 
    if (!ptr)
@@ -1387,12 +1495,13 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
 {
    HYPRE_Int    offset = 0;
    HYPRE_Int    ne = 6;
-   HYPRE_Real   lmem[16];
-   HYPRE_Real   min[16];
-   HYPRE_Real   max[16];
-   HYPRE_Real   avg[16];
-   HYPRE_Real   ssq[16];
-   HYPRE_Real   std[16];
+   HYPRE_Int    pidx;
+   HYPRE_Real   lmem[20];
+   HYPRE_Real   min[20];
+   HYPRE_Real   max[20];
+   HYPRE_Real   avg[20];
+   HYPRE_Real   ssq[20];
+   HYPRE_Real   std[20];
    HYPRE_Real  *gmem = NULL;
    HYPRE_Int    i, j, myid, nprocs, ndigits;
    const char  *labels[] = {"Min", "Max", "Avg", "Std"};
@@ -1407,6 +1516,10 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
    ne += 8;
 #endif
 
+   /* Host memory pool info comes last */
+   pidx = ne;
+   ne  += 4;
+
    /* Return if neither the 1st nor 2nd bits of log_level are set */
    if (!(log_level & 0x3))
    {
@@ -1451,6 +1564,9 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
    HYPRE_UNUSED_VAR(offset);
 #endif
 
+   /* Get host memory pool info */
+   hypre_HostMemoryPoolGetUsage(&lmem[pidx]);
+
    /* Gather memory info to rank 0 */
    hypre_MPI_Gather(lmem, ne, hypre_MPI_REAL, gmem, ne, hypre_MPI_REAL, 0, comm);
 
@@ -1531,6 +1647,13 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
                             gmem[ne * i + 14], gmem[ne * i + 15]);
             }
 #endif
+            if (gmem[ne * i + pidx])
+            {
+               hypre_printf(" | HPoolSize/HPoolUsed: (%.2f / %.2f)",
+                            gmem[ne * i + pidx], gmem[ne * i + pidx + 1]);
+               hypre_printf(" | HPoolReuse/Fallbacks: (%.1f%% / %.0f)",
+                            gmem[ne * i + pidx + 2], gmem[ne * i + pidx + 3]);
+            }
             hypre_printf("\n");
          }
       }
@@ -1569,6 +1692,11 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
 #if defined(HYPRE_USING_UMPIRE_PINNED)
          hypre_printf(" | %13s | %13s", "UmpPSize (GiB)", "UmpPPeak (GiB)")
 #endif
+         if (max[pidx] > 0.0)
+         {
+            hypre_printf(" | %15s | %15s | %14s", "HPoolSize (GiB)", "HPoolUsed (GiB)",
+                         "HPoolReuse (%)");
+         }
          hypre_printf("\n");
          hypre_printf("   ----+--------------+--------------+--------------+-------------");
 #if defined(HYPRE_USING_GPU)
@@ -1598,6 +1726,10 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
             hypre_printf("-+----------------+---------------");
          }
 #endif
+         if (max[pidx] > 0.0)
+         {
+            hypre_printf("-+-----------------+-----------------+---------------");
+         }
          hypre_printf("\n");
 
          /* Print table */
@@ -1633,6 +1765,11 @@ hypre_MemoryPrintUsage(MPI_Comm    comm,
                hypre_printf(" | %14.3f | %14.3f", data[i][14], data[i][15]);
             }
 #endif
+            if (max[pidx] > 0.0)
+            {
+               hypre_printf(" | %15.3f | %15.3f | %14.1f",
+                            data[i][pidx], data[i][pidx + 1], data[i][pidx + 2]);
+            }
             hypre_printf("\n");
          }
       }
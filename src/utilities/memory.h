@@ -197,12 +197,21 @@ HYPRE_Int hypre_UmpireFinalize(hypre_Handle *hypre_handle_);
 HYPRE_Int hypre_UmpireGetCurrentMemoryUsage(MPI_Comm comm, HYPRE_Real *current);
 HYPRE_Int hypre_UmpireMemoryGetUsage(HYPRE_Real *memory);
 HYPRE_Int hypre_HostMemoryGetUsage(HYPRE_Real *mem);
+HYPRE_Int hypre_HostFirstTouchActive( HYPRE_MemoryLocation location );
 HYPRE_Int hypre_MemoryPrintUsage(MPI_Comm comm, HYPRE_Int level,
                                  const char *function, HYPRE_Int line);
 #define HYPRE_PRINT_MEMORY_USAGE(comm) hypre_MemoryPrintUsage(comm,\
                                                               hypre_HandleLogLevel(hypre_handle()),\
                                                               __func__,\
                                                               __LINE__)
+/* memory_pool.c */
+HYPRE_Int hypre_SetHostMemoryPool( size_t pool_size );
+void *hypre_HostMemoryPoolAlloc( size_t size );
+HYPRE_Int hypre_HostMemoryPoolFree( void *ptr );
+size_t hypre_HostMemoryPoolBlockSize( void *ptr );
+HYPRE_Int hypre_HostMemoryPoolGetUsage( HYPRE_Real *mem );
+HYPRE_Int hypre_HostMemoryPoolDestroy( void );
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -0,0 +1,431 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host memory pool
+ *
+ * Size-class pool for host allocations, enabled with HYPRE_SetHostMemoryPool.
+ * Blocks are carved from a single arena reserved when the pool is enabled, so
+ * that pooled pointers are recognized with a range check when they are freed.
+ * Each block is preceded by a small header holding its size class. Freed
+ * blocks are kept in per-thread caches (one per OpenMP thread) and overflow
+ * into global free lists protected by a lock. Arena memory is not returned to
+ * the system before HYPRE_Finalize.
+ *
+ * Do NOT use hypre_T* in this file since the pool sits below them.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+/* Four size classes per power of two: 16, 32, 48, 64, 80, 96, 112, 128, 160, ...
+ * up to the largest pooled size (32 MiB). Larger blocks use malloc. */
+#define hypre_HOST_POOL_NUM_CLASSES  80
+#define hypre_HOST_POOL_MAX_SIZE     ((size_t) 1 << 25)
+#define hypre_HOST_POOL_HEADER       16
+#define hypre_HOST_POOL_CACHE_BYTES  ((size_t) 1 << 22)
+
+typedef struct hypre_HostPoolBlock_struct
+{
+   struct hypre_HostPoolBlock_struct *next;
+
+} hypre_HostPoolBlock;
+
+typedef struct
+{
+   hypre_HostPoolBlock  *free_list[hypre_HOST_POOL_NUM_CLASSES];
+   HYPRE_Int             num_free[hypre_HOST_POOL_NUM_CLASSES];
+
+   /* statistics */
+   size_t                num_allocs;
+   size_t                num_reused;
+   size_t                bytes_allocated;
+   size_t                bytes_freed;
+
+   /* avoid false sharing between the caches of different threads */
+   char                  pad[64];
+
+} hypre_HostPoolCache;
+
+typedef struct
+{
+   HYPRE_Int             enabled;
+   char                 *arena;
+   size_t                capacity;
+   size_t                arena_used;
+
+   hypre_HostPoolBlock  *free_list[hypre_HOST_POOL_NUM_CLASSES];
+
+   /* num_caches per-thread caches, plus a shared one used under the lock */
+   HYPRE_Int             num_caches;
+   hypre_HostPoolCache  *caches;
+   size_t                num_fallbacks;
+
+#if defined(HYPRE_USING_OPENMP)
+   omp_lock_t            lock;
+#endif
+
+} hypre_HostPool;
+
+static hypre_HostPool hypre_host_pool;
+
+#if defined(HYPRE_USING_OPENMP)
+#define hypre_HostPoolLock(pool)    omp_set_lock(&(pool) -> lock)
+#define hypre_HostPoolUnlock(pool)  omp_unset_lock(&(pool) -> lock)
+#else
+#define hypre_HostPoolLock(pool)
+#define hypre_HostPoolUnlock(pool)
+#endif
+
+/*--------------------------------------------------------------------------
+ * Size classes
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_HostPoolSizeClass( size_t size )
+{
+   size_t     base = 64, step;
+   HYPRE_Int  k = 6;
+
+   if (size <= 64)
+   {
+      return (HYPRE_Int) ((size + 15) / 16) - 1;
+   }
+
+   /* base < size <= 2*base */
+   while (2 * base < size)
+   {
+      base *= 2;
+      k++;
+   }
+   step = base / 4;
+
+   return 4 * (k - 5) + (HYPRE_Int) ((size - base + step - 1) / step) - 1;
+}
+
+static inline size_t
+hypre_HostPoolClassSize( HYPRE_Int c )
+{
+   size_t base;
+
+   if (c < 4)
+   {
+      return (size_t) (c + 1) * 16;
+   }
+
+   base = (size_t) 1 << (6 + (c - 4) / 4);
+
+   return base + (size_t) ((c - 4) % 4 + 1) * (base / 4);
+}
+
+/* Maximum number of blocks of class c kept in a per-thread cache */
+static inline HYPRE_Int
+hypre_HostPoolCacheLimit( HYPRE_Int c )
+{
+   size_t limit = hypre_HOST_POOL_CACHE_BYTES / hypre_HostPoolClassSize(c);
+
+   return (HYPRE_Int) hypre_max(4, hypre_min(limit, 256));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetHostMemoryPool
+ *
+ * Enables the pool with an arena of pool_size bytes (0 disables it). The arena
+ * is reserved the first time the pool is enabled; pages are only committed by
+ * the operating system once they are used. Disabling the pool stops new pooled
+ * allocations, pooled blocks still in use are released to the pool.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetHostMemoryPool( size_t pool_size )
+{
+   hypre_HostPool *pool = &hypre_host_pool;
+
+#if defined(HYPRE_USING_UMPIRE_HOST)
+   HYPRE_UNUSED_VAR(pool);
+   HYPRE_UNUSED_VAR(pool_size);
+
+   return hypre_error_flag;
+#else
+   if (!pool_size)
+   {
+      pool -> enabled = 0;
+
+      return hypre_error_flag;
+   }
+
+   if (!(pool -> arena))
+   {
+      pool -> arena = (char *) malloc(pool_size);
+      if (!(pool -> arena))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_MEMORY, "Could not reserve the host memory pool");
+
+         return hypre_error_flag;
+      }
+      pool -> capacity      = pool_size;
+      pool -> arena_used    = 0;
+      pool -> num_caches    = hypre_NumThreads();
+      pool -> caches        = (hypre_HostPoolCache *) calloc((size_t) pool -> num_caches + 1,
+                                                             sizeof(hypre_HostPoolCache));
+      pool -> num_fallbacks = 0;
+#if defined(HYPRE_USING_OPENMP)
+      omp_init_lock(&(pool -> lock));
+#endif
+   }
+   pool -> enabled = 1;
+
+   return hypre_error_flag;
+#endif
+}
+
+HYPRE_Int
+HYPRE_SetHostMemoryPool( size_t pool_size )
+{
+   return hypre_SetHostMemoryPool(pool_size);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostMemoryPoolAlloc
+ *
+ * Returns a pooled block of at least size bytes, or NULL if the pool is
+ * disabled, the size is not pooled, or the arena is exhausted.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostMemoryPoolAlloc( size_t size )
+{
+   hypre_HostPool       *pool = &hypre_host_pool;
+   hypre_HostPoolCache  *cache;
+   hypre_HostPoolBlock  *block;
+   char                 *ptr = NULL;
+   size_t                class_size;
+   HYPRE_Int             c, tid;
+
+   if (!(pool -> enabled) || size > hypre_HOST_POOL_MAX_SIZE)
+   {
+      return NULL;
+   }
+
+   tid = hypre_GetThreadNum();
+   if (tid >= pool -> num_caches)
+   {
+      /* threads started after the pool was enabled bypass it */
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp atomic
+#endif
+      pool -> num_fallbacks++;
+
+      return NULL;
+   }
+
+   c          = hypre_HostPoolSizeClass(size);
+   class_size = hypre_HostPoolClassSize(c);
+   cache      = &(pool -> caches[tid]);
+
+   /* 1) per-thread cache */
+   block = cache -> free_list[c];
+   if (block)
+   {
+      cache -> free_list[c] = block -> next;
+      cache -> num_free[c]--;
+      cache -> num_reused++;
+      ptr = (char *) block;
+   }
+   else
+   {
+      /* 2) global free list, 3) arena */
+      hypre_HostPoolLock(pool);
+      block = pool -> free_list[c];
+      if (block)
+      {
+         pool -> free_list[c] = block -> next;
+         cache -> num_reused++;
+         ptr = (char *) block;
+      }
+      else if (pool -> arena_used + hypre_HOST_POOL_HEADER + class_size <= pool -> capacity)
+      {
+         ptr = pool -> arena + pool -> arena_used + hypre_HOST_POOL_HEADER;
+         pool -> arena_used += hypre_HOST_POOL_HEADER + class_size;
+         *((HYPRE_Int *) (ptr - hypre_HOST_POOL_HEADER)) = c;
+      }
+      else
+      {
+         pool -> num_fallbacks++;
+      }
+      hypre_HostPoolUnlock(pool);
+   }
+
+   if (ptr)
+   {
+      cache -> num_allocs++;
+      cache -> bytes_allocated += class_size;
+   }
+
+   return (void *) ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostMemoryPoolFree
+ *
+ * Releases ptr to the pool if it is a pooled block. Returns 1 in that case,
+ * and 0 if ptr was not allocated from the pool.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostMemoryPoolFree( void *ptr )
+{
+   hypre_HostPool       *pool = &hypre_host_pool;
+   hypre_HostPoolCache  *cache;
+   hypre_HostPoolBlock  *block = (hypre_HostPoolBlock *) ptr;
+   hypre_HostPoolBlock  *last;
+   HYPRE_Int             c, tid, limit, k;
+
+   /* arena and capacity do not change while the pool is enabled, unlike
+      arena_used, so the test needs no lock */
+   if ((char *) ptr < pool -> arena || (char *) ptr >= pool -> arena + pool -> capacity)
+   {
+      return 0;
+   }
+
+   c   = *((HYPRE_Int *) ((char *) ptr - hypre_HOST_POOL_HEADER));
+   tid = hypre_GetThreadNum();
+
+   if (tid >= pool -> num_caches)
+   {
+      hypre_HostPoolLock(pool);
+      block -> next = pool -> free_list[c];
+      pool -> free_list[c] = block;
+      pool -> caches[pool -> num_caches].bytes_freed += hypre_HostPoolClassSize(c);
+      hypre_HostPoolUnlock(pool);
+
+      return 1;
+   }
+
+   cache = &(pool -> caches[tid]);
+   block -> next = cache -> free_list[c];
+   cache -> free_list[c] = block;
+   cache -> num_free[c]++;
+   cache -> bytes_freed += hypre_HostPoolClassSize(c);
+
+   /* Move half of an overfull cache to the global free list */
+   limit = hypre_HostPoolCacheLimit(c);
+   if (cache -> num_free[c] > limit)
+   {
+      last = block;
+      for (k = 1; k < limit / 2; k++)
+      {
+         last = last -> next;
+      }
+      cache -> free_list[c] = last -> next;
+      cache -> num_free[c] -= limit / 2;
+
+      hypre_HostPoolLock(pool);
+      last -> next = pool -> free_list[c];
+      pool -> free_list[c] = block;
+      hypre_HostPoolUnlock(pool);
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostMemoryPoolBlockSize
+ *
+ * Returns the usable size of a pooled block, or 0 if ptr is not pooled.
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_HostMemoryPoolBlockSize( void *ptr )
+{
+   hypre_HostPool *pool = &hypre_host_pool;
+
+   if ((char *) ptr < pool -> arena || (char *) ptr >= pool -> arena + pool -> capacity)
+   {
+      return 0;
+   }
+
+   return hypre_HostPoolClassSize(*((HYPRE_Int *) ((char *) ptr - hypre_HOST_POOL_HEADER)));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostMemoryPoolGetUsage
+ *
+ * mem[0]: arena memory carved into blocks (GiB)
+ * mem[1]: memory in pooled blocks currently in use (GiB)
+ * mem[2]: percentage of pooled allocations served by reusing a freed block
+ * mem[3]: number of allocations that fell back to malloc
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostMemoryPoolGetUsage( HYPRE_Real *mem )
+{
+   hypre_HostPool  *pool = &hypre_host_pool;
+   HYPRE_Real       b_to_gib = (HYPRE_Real) (1 << 30);
+   size_t           num_allocs = 0, num_reused = 0, allocated = 0, freed = 0;
+   HYPRE_Int        i;
+
+   mem[0] = mem[1] = mem[2] = mem[3] = 0.0;
+   if (!(pool -> arena))
+   {
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i <= pool -> num_caches; i++)
+   {
+      num_allocs += pool -> caches[i].num_allocs;
+      num_reused += pool -> caches[i].num_reused;
+      allocated  += pool -> caches[i].bytes_allocated;
+      freed      += pool -> caches[i].bytes_freed;
+   }
+
+   mem[0] = (HYPRE_Real) pool -> arena_used / b_to_gib;
+   mem[1] = (allocated > freed) ? (HYPRE_Real) (allocated - freed) / b_to_gib : 0.0;
+   mem[2] = num_allocs ? 100.0 * (HYPRE_Real) num_reused / (HYPRE_Real) num_allocs : 0.0;
+   mem[3] = (HYPRE_Real) pool -> num_fallbacks;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostMemoryPoolDestroy
+ *
+ * Releases the arena if no pooled block is in use anymore. Otherwise, the
+ * pool is kept so that the remaining blocks can still be freed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostMemoryPoolDestroy( void )
+{
+   hypre_HostPool  *pool = &hypre_host_pool;
+   size_t           allocated = 0, freed = 0;
+   HYPRE_Int        i;
+
+   if (!(pool -> arena))
+   {
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i <= pool -> num_caches; i++)
+   {
+      allocated += pool -> caches[i].bytes_allocated;
+      freed     += pool -> caches[i].bytes_freed;
+   }
+
+   if (allocated == freed)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      omp_destroy_lock(&(pool -> lock));
+#endif
+      free(pool -> arena);
+      free(pool -> caches);
+      memset(pool, 0, sizeof(hypre_HostPool));
+   }
+
+   return hypre_error_flag;
+}
@@ -75,6 +75,15 @@ hypre_MPI_Barrier( hypre_MPI_Comm comm )
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Ibarrier( hypre_MPI_Comm     comm,
+                    hypre_MPI_Request *request )
+{
+   HYPRE_UNUSED_VAR(comm);
+   *request = hypre_MPI_REQUEST_NULL;
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Comm_create( hypre_MPI_Comm   comm,
                        hypre_MPI_Group  group,
@@ -474,6 +483,25 @@ hypre_MPI_Isend( void               *buf,
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Issend( void               *buf,
+                  HYPRE_Int           count,
+                  hypre_MPI_Datatype  datatype,
+                  HYPRE_Int           dest,
+                  HYPRE_Int           tag,
+                  hypre_MPI_Comm      comm,
+                  hypre_MPI_Request  *request )
+{
+   HYPRE_UNUSED_VAR(buf);
+   HYPRE_UNUSED_VAR(count);
+   HYPRE_UNUSED_VAR(datatype);
+   HYPRE_UNUSED_VAR(dest);
+   HYPRE_UNUSED_VAR(tag);
+   HYPRE_UNUSED_VAR(comm);
+   HYPRE_UNUSED_VAR(request);
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Irecv( void               *buf,
                  HYPRE_Int           count,
@@ -768,6 +796,20 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -956,6 +998,20 @@ hypre_MPI_Barrier( hypre_MPI_Comm comm )
    return (HYPRE_Int) MPI_Barrier(comm);
 }
 
+HYPRE_Int
+hypre_MPI_Ibarrier( hypre_MPI_Comm     comm,
+                    hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Ibarrier(comm, request);
+#else
+   /* no non-blocking collectives before MPI-3: complete the barrier now */
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return (HYPRE_Int) MPI_Barrier(comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Comm_create( hypre_MPI_Comm   comm,
                        hypre_MPI_Group  group,
@@ -1277,6 +1333,19 @@ hypre_MPI_Isend( void               *buf,
                                 (hypre_int)dest, (hypre_int)tag, comm, request);
 }
 
+HYPRE_Int
+hypre_MPI_Issend( void               *buf,
+                  HYPRE_Int           count,
+                  hypre_MPI_Datatype  datatype,
+                  HYPRE_Int           dest,
+                  HYPRE_Int           tag,
+                  hypre_MPI_Comm      comm,
+                  hypre_MPI_Request  *request )
+{
+   return (HYPRE_Int) MPI_Issend(buf, (hypre_int)count, datatype,
+                                 (hypre_int)dest, (hypre_int)tag, comm, request);
+}
+
 HYPRE_Int
 hypre_MPI_Irecv( void               *buf,
                  HYPRE_Int           count,
@@ -1436,6 +1505,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return result;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   /* no non-blocking collectives before MPI-3: complete the reduction now */
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,